@@ -121,6 +121,9 @@ int handle_command_other(
           CurrentVersion.acidmud_git_revs,
           CurrentVersion.acidmud_git_hash,
           CurrentVersion.acidmud_datestamp);
+    if (mind && (vmode & LOC_NINJA)) {
+      mind->Send(u8"There are {} recycled objects awaiting reclamation.\n", Object::TrashPending());
+    }
     return 0;
   }
 
@@ -5853,6 +5856,30 @@ int handle_command_other(
     return 0;
   }
 
+  if (cnum == COM_TPROFILE) {
+    if (!mind)
+      return 0;
+    if (args == u8"on") {
+      Mind::SetTBAProfiling(true);
+      mind->Send(u8"TBA trigger profiling is now on.\n");
+    } else if (args == u8"off") {
+      Mind::SetTBAProfiling(false);
+      mind->Send(u8"TBA trigger profiling is now off.\n");
+    } else if (args == u8"clear") {
+      Mind::ClearTBAProfile();
+      mind->Send(u8"TBA trigger profile cleared.\n");
+    } else if (args == u8"dump") {
+      if (Mind::DumpTBAProfile(u8"acid/tba_profile.txt")) {
+        mind->Send(u8"TBA trigger profile written to acid/tba_profile.txt.\n");
+      } else {
+        mind->Send(u8"Failed to write the TBA trigger profile!\n");
+      }
+    } else {
+      mind->Send(Mind::TBAProfileReport(args));
+    }
+    return 0;
+  }
+
   if (mind)
     mind->Send(u8"Sorry, that command's not yet implemented.\n");
   return 0;
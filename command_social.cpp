@@ -0,0 +1,6498 @@
+// *************************************************************************
+//  This file is part of AcidMUD by Steaphan Greene
+//
+//  Copyright 1999-2022 Steaphan Greene <steaphan@gmail.com>
+//
+//  AcidMUD is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  AcidMUD is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with AcidMUD (see the file named "COPYING");
+//  If not, see <http://www.gnu.org/licenses/>.
+//
+// *************************************************************************
+
+#include "commands.hpp"
+#include "object.hpp"
+#include "utils.hpp"
+
+// Autogenerated from tba/socials.new
+static constexpr const std::array<std::array<std::u8string_view, 13>, NUM_SOCIALS> socials = {{
+    {u8"You're speechless.",
+     u8"$n is speechless.",
+     u8"You're speechless about what $E just did!",
+     u8"$n is speechless about what $N just did!",
+     u8"$n is speechless at what you just did!",
+     u8"Well they're not here, eh who cares? You were speechless anyway!",
+     u8"You're speechless about what you just did!",
+     u8"$n is speechless about what $e just did!",
+     u8"You're speechless about $S $t.",
+     u8"$n is speechless about $N's $t.",
+     u8"$n is speechless about your $t.",
+     u8"",
+     u8""},
+    {u8"You start to sing, \"ABCD LSD, Gummy Bears are chasing me.\"",
+     u8"$n starts to sing, \"ABCD LSD, Gummy Bears are chasing me.\"",
+     u8"You look at $N. \"Are the gummy bears chasing you?\"",
+     u8"$n looks at $N and says, \"Are the gummy bears chasing you?\"",
+     u8"$n looks at you and says, \"Are the gummy bears chasing you?\" You see a small gummy bear jumping up and down on their shoulder.",
+     u8"You must be crazy... you can't see the gummy bears!",
+     u8"You look behind you. You look back forward, worried. \"ABCD LSD, Gummy Bears are chasing me.\"",
+     u8"$n looks behind themselves. They look forward quickly, worried. \"ABCD LSD, Gummy Bears are chasing me\" escapes their lips.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Abra Abra Cadabra!",
+     u8"$n goes 'Abra Cadabra!'",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Accuse who??",
+     u8"$n accuses everyone.",
+     u8"You look accusingly at $M.",
+     u8"$n looks accusingly at $N.",
+     u8"$n looks accusingly at you.",
+     u8"Accuse somebody who's not even there??",
+     u8"You accuse yourself.",
+     u8"$n seems to have a bad conscience.",
+     u8"You look accusingly at $S $t.",
+     u8"$n looks accusingly at $N's $t.",
+     u8"$n looks at your $t accusingly.",
+     u8"You look accusingly at $p.",
+     u8"$n looks accusingly at $p."},
+    {u8"ACK!",
+     u8"$n goes ACK!!",
+     u8"You look at $M and go ACK!",
+     u8"$n looks at $N and goes ACK!",
+     u8"$n looks at you and goes ACK!",
+     u8"You look for someone to go ACK! at.",
+     u8"You look at yourself and go ACK!",
+     u8"$n looks at $mself and goes ACK!",
+     u8"You look at $S $t and go ACK!",
+     u8"$n looks atat $N's $t and goes ACK!",
+     u8"$n looks at your $t and goes ACK!",
+     u8"You look at $p and go ACK!",
+     u8"$n looks at $p and goes ACK!"},
+    {u8"You bid adieu to the world.",
+     u8"$n bids adieu to this world.",
+     u8"You bid $M a fond adieu.",
+     u8"$n bids $N a fond adieu.",
+     u8"$n bids you a fond adieu.",
+     u8"They must have already left.",
+     u8"You bid yourself a fond adieu.",
+     u8"$n bids $mself a fond adieu.",
+     u8"You look at $S $t and say adieu.",
+     u8"$n looks at $N's $t and bids it adieu.",
+     u8"$n looks at your $t and bids it adieu.",
+     u8"You look at $p and bids it adieu.",
+     u8"$n looks at $p and bids it adieu."},
+    {u8"Who do you wish to admire in this Cruel World?",
+     u8"$n admires the Cruel World $e has become part of.",
+     u8"You look admiringly at $M.",
+     u8"$n looks admiringly at $N.",
+     u8"$n looks admiringly at you.",
+     u8"Your idol seems not to be here...",
+     u8"You must love yourself, huh?",
+     u8"$n admires $mself... get a life, huh?",
+     u8"You look admiringly at $S $t.",
+     u8"$n looks admiringly at $N's $t.",
+     u8"$n looks at your $t admiringly.",
+     u8"You look admiringly at $p.",
+     u8"$n looks admiringly at $p."},
+    {u8"You look around with adoring eyes.",
+     u8"$n looks around with adoring eyes.",
+     u8"You look at $N with adoring eyes.",
+     u8"$n looks at $N with big, adoring eyes.",
+     u8"$n is looking at you with big, adoring eyes. Hmm...",
+     u8"You can't find that person! :(",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You nod in agreement.",
+     u8"$n nods in agreement.",
+     u8"You nod in agreement with $M.",
+     u8"$n nods, agreeing with $N.",
+     u8"$n nods in agreement with you.",
+     u8"Agree with them - you can't even see them.",
+     u8"You agree with yourself, how very reasonable.",
+     u8"$n starts agreeing with $mself. Perhaps $e should seek professional help.",
+     u8"You look at $S $t and agree with it. How strange.",
+     u8"$n looks at $N's $t and agree's with it. How strange.",
+     u8"$n looks at your $t and nods in agreement.",
+     u8"You look at $p and nod in agreement.",
+     u8"$n looks at $p and nods in agreement."},
+    {u8"You look down your nose and grunt 'Ahem!'",
+     u8"$n looks down $s nose and grunts 'Ahem!'",
+     u8"You look down your nose and grunt 'Ahem!' at $N.",
+     u8"$n looks down $s nose and grunts 'Ahem!' at $N.",
+     u8"$n looks down $s nose and grunts 'Ahem!' at you.",
+     u8"Ahem! That person isn't here!",
+     u8"You look down your nose and grunt 'Ahem!' to yourself.",
+     u8"$n looks down $s nose and grunts 'Ahem!' to $mself.",
+     u8"You look down your nose and grunt 'Ahem!' at $N's $t.",
+     u8"$n looks down $s nose and grunts 'Ahem!' at $N's $t.",
+     u8"$n looks down $s nose and grunts 'Ahem!' at your $t.",
+     u8"You look down your nose and grunt 'Ahem!' at $p.",
+     u8"$n looks down $s nose and grunts 'Ahem!' at your $p."},
+    {u8"You have to point your weapon at someone!!!",
+     u8"$n looks around the room frantically.  $e looks like $e's in a violent mood.",
+     u8"You point your weapon at $N, showing $M you will kill $M in a heartbeat.",
+     u8"$n points $s weapon at $N.  $e looks like $e means business!",
+     u8"$n points $n weapon at you.  $e looks quite annoyed!",
+     u8"How are you gonna scare $m with that if $e isn't even here???",
+     u8"You point your weapon at yourself. Ready to die?",
+     u8"$n points $s weapon at $mself, he's going to kill $mself!",
+     u8"You point your weapon at $S $t preparing to strike.",
+     u8"$n points $s weapon at $N's $t and prepares to strike.",
+     u8"$n points $s weapon at your $t and prepares to strike.",
+     u8"You take your best aim at $p.",
+     u8"$n takes $s best aim at $p."},
+    {u8"Your eyes flicker with amusement.",
+     u8"$n's eyes flicker with amusement.",
+     u8"You smile, amused with $N.",
+     u8"$n seems to find $N very amusing.",
+     u8"$n's eyes flicker with amusement at you.",
+     u8"You find yourself very amused but not quite sure why.",
+     u8"You find yourself very amusing.",
+     u8"$n finds $mself very amusing.",
+     u8"You find $N's $t very amusing.",
+     u8"$n finds $N's $t very amusing.",
+     u8"$n finds your $t very amusing.",
+     u8"You smile, amused with $p.",
+     u8"$n smiles, amused with $p."},
+    {u8"You apologize to the gods for your very existence.",
+     u8"$n apologizes for even being alive.",
+     u8"You apologize to $M.",
+     u8"$n apologizes to $N.",
+     u8"$n apologizes to you.",
+     u8"Your apology does not seem to have been well received.",
+     u8"You apologize to yourself for being such a numskull.",
+     u8"$n apologizes to $mself for everything $e has ever done.",
+     u8"You look at $S $t and apologize.",
+     u8"$n looks at $N's $t and apologizes.",
+     u8"$n looks at your $t and apologizes.",
+     u8"You look at $p and apologize.",
+     u8"$n looks at $p and apologizes."},
+    {u8"Clap, clap, clap.",
+     u8"$n gives a round of applause.",
+     u8"You give $M a round of applause.",
+     u8"$n gives $N a round of applause.",
+     u8"$n gives you a round of applause.",
+     u8"Clap away, they're not here.",
+     u8"No one else will do it, you may as well do it yourself.",
+     u8"$n must be desperate for praise, $e is applauding $mself.",
+     u8"You look at $S $t and applaud.",
+     u8"$n looks at $N's $t and applauds.",
+     u8"$n looks at your $t and applauds.",
+     u8"You look at $p and applaud.",
+     u8"$n looks at $p and applauds."},
+    {u8"You arch an eyebrow.",
+     u8"$n raises an eyebrow speculatively.",
+     u8"You raise an eyebrow at $N.",
+     u8"$n arches an eyebrow at $N.",
+     u8"$n raise an eyebrow at you.",
+     u8"They seem to have left.",
+     u8"What's the matter? Right brain not talking to the left?",
+     u8"$n furiously waggles $s eyebrows... What a loony!",
+     u8"You look at $S $t and arch an eyebrow in speculation.",
+     u8"$n looks at $N's $t and raises an eyebrow speculatively.",
+     u8"$n looks at your $t and raises an eyebrow speculatively.",
+     u8"You look at $p and arch an eyebrow in speculation.",
+     u8"$n looks at $p and raises an eyebrow in speculation."},
+    {u8"You slap your hands on your face - AARRGGHH!!",
+     u8"$n slaps $s hands on $s face - AARRGGHH!!",
+     u8"You take one look at $N - AARRGGHH!!",
+     u8"$n screams AARRGGHH at $N!!",
+     u8"$n screams AARRGGHH at you!!",
+     u8"ARGH! They're not here!",
+     u8"You provoke yourself into screaming AARRGGHH!",
+     u8"$n provokes $mself into screaming AARRGGHH!",
+     u8"You take one look at $N's $t - AARRGGHH!!",
+     u8"$n screams AARRGGHH at $N's $t!!",
+     u8"$n screams AARRGGHH at your $t!!",
+     u8"You take one look at $p - AARRGGHH!!",
+     u8"$n screams AARRGGHH at $p!!"},
+    {u8"You cross your arms.",
+     u8"$n crosses $s arms.",
+     u8"You look at $N, crossing your arms and being somewhat deffensive.",
+     u8"$n looks at $N, crossing $s arms and being somewhat deffensive.",
+     u8"$n looks at you, crossing $s arms and being somewhat deffensive.",
+     u8"They left before you had the chance to become deffensive.",
+     u8"You cross your arms and look at yourself deffensively?",
+     u8"$n crosses $s arms and looks at $mself deffensively.",
+     u8"You look at $S $t and cross your arms deffensively.",
+     u8"$n looks at $N's $t and crosses $s arms deffensively.",
+     u8"$n looks at your $t and crosses $s arms deffensively.",
+     u8"You look at $p and cross your arms deffensively.",
+     u8"$n looks at $p and crosses $s arms deffensively."},
+    {u8"You read everyone their rights. But you skip the part about the phonecall... ;)",
+     u8"$n has placed you all under arrest. 'You have the right to...bla bla bla...'",
+     u8"You read $N $S rights.",
+     u8"$n has placed $N under arrest. Everything $E will, and can say, will be used against $M.",
+     u8"$n says, 'You have the right to remain silent. You have the right to....' $e just arrested you!",
+     u8"NOOO! They fled! After them!",
+     u8"You read the rights to yourself and wait for someone to take you to jail.",
+     u8"$n reads the rights to $mself and sits down waiting for someone to take $m to jail.",
+     u8"You look at $S $t and try to arrest it.",
+     u8"$n looks at $N's $t and places it under arrest.",
+     u8"$n looks at your $t and places it under arrest, I hope you didn't need that.",
+     u8"You look at $p and place it under arrest.",
+     u8"$n looks at $p and places it under arrest."},
+    {u8"@YYou stamp your foot and give the mighty Avatar Salute!@n",
+     u8"@Y$n stamps $s foot and throws a fist in the air giving the proper Avatar Salute!@n",
+     u8"@YYou stamp your foot and give the mighty Avatar Salute towards $N!@n",
+     u8"$n stamps $s foot and throws a fist in the air, Avatar Saluting $N!",
+     u8"$n stamps $s foot and throws $s fist in the air, giving you the Avatar Salute!",
+     u8"@YYou do not see this person here.@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You go AWWW.",
+     u8"$n goes AWWW.",
+     u8"You go AWWW at $N.",
+     u8"$n goes AWWW at $N.",
+     u8"$n goes AWWW at you.",
+     u8"You go AWWW, they're not here.",
+     u8"You go AWWW at yourself.",
+     u8"$n goes AWWW at $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You babble unintelligently.",
+     u8"$n is babbling unintelligently.",
+     u8"You babble at $M in a meaningless manner.",
+     u8"$n is babbling at $N in a confused way.",
+     u8"$n is babbling something utterly meaningless at you.",
+     u8"You babble like a brook that only you can hear.",
+     u8"You babble to yourself like the total idiot that you are.",
+     u8"$n babbles to $mself like the fool $e really is.",
+     u8"You look at $S $t and start babbling incoherently.",
+     u8"$n looks at $N's $t and babbles incoherently.",
+     u8"$n looks at your $t and babbles unintellig.",
+     u8"You look at $p and begin babbling at it.",
+     u8"$n looks at $p and begins babbling like an idiot."},
+    {u8"You clap everyone on the back... good job!",
+     u8"$n claps everyone on the back... good job!",
+     u8"You clap $N on the back... good job!",
+     u8"$n claps $N on the back for a job well done!",
+     u8"$n claps you on the back, job well done!",
+     u8"You clap the air... where their back would have been.",
+     u8"You clap yourself on the back... good job you!",
+     u8"$n claps $mself on the back, $e did a good job!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You bark like a dog.",
+     u8"$n barks! Has $e taken $s medication lately?",
+     u8"You bark angrily at $M.",
+     u8"$n is barking angrily at $N.",
+     u8"$n barks at you!",
+     u8"Your bark would make a tree proud -- too bad no one can hear you.",
+     u8"You make like a dog and bark at yourself.",
+     u8"$n seems to be barking at $mself. $E must think $e is a dog!",
+     u8"You look at $S $t and start barking.",
+     u8"$n looks at $N's $t and barks at it.",
+     u8"$n looks at your $t and barks at it.",
+     u8"You look at $p and start barking.",
+     u8"$n looks at $p and barks at it."},
+    {u8"You bat your eyelashes.",
+     u8"$n bats $s eyelashes and looks cute.",
+     u8"You bat your eyelashes convincingly at $M.",
+     u8"$n bats $s eyelashes at $N.",
+     u8"$n bats $s eyelashes at you, how cute.",
+     u8"$E isn't here to be charmed!",
+     u8"How exactly do you propose to do that?",
+     u8"$n tries to bat $s eyelashes at $mself. It looks weird.",
+     u8"",
+     u8"",
+     u8"",
+     u8"For some reason, you bat your eyelashes at $p.",
+     u8"$n bats $s eyelashes at $p. Strange."},
+    {u8"'Quick Robin, to the BATMOBILE!'",
+     u8"$n exclaims, 'Quick Robin, to the BATMOBILE!' as $e dashes off!",
+     u8"You exclaim, 'Quick $N, to the BATMOBILE!' and dash off!",
+     u8"$n exclaims, 'Quick $N, to the BATMOBILE!' and dashes off!",
+     u8"$n exclaims, 'Quick $N, to the BATMOBILE!' and dashes off!",
+     u8"You don't see them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You beat your hands on your armor and give a blood-curdling warcry!",
+     u8"$n gives a blood-curdling warcry as $e beats $s hands on $s armor.",
+     u8"You beat your hands on your chest real hard, warcrying madly at $N.",
+     u8"$n beats $s hands on $s chest real hard, warcrying madly at $N.",
+     u8"$n beats $s hands on $s chest real hard, warcrying madly at you.",
+     u8"You begin to sound a warcry, until you realize they aren't here.",
+     u8"You start warcrying for no evident reason.  Kind of looks weird.",
+     u8"$n starts warcrying at $mself for no evident reason.  Hmmm.. Really weird.",
+     u8"You scream a warcry at $S $t",
+     u8"$n screams a warcry at $N's $t.",
+     u8"$n screams a warcry at at your $t and prepares for the attack.",
+     u8"You start to scream loudly in a strong battle cry at $p.",
+     u8"$n starts to scream loudly in a strong battle cry at $p."},
+    {u8"You beam like a golden ray of sunshine.",
+     u8"$n is beaming like a golden ray of sunshine.",
+     u8"You beam a cheery smile at $M.",
+     u8"$n beams a cheery smile at $N.",
+     u8"$n beams a cheery smile at you.",
+     u8"You feel so warm and sunny, why not beam a smile at a real person?",
+     u8"You inwardly glow with warmth.",
+     u8"$n beams a warm smile at $mself.",
+     u8"You beam a cheery smile at $S $t",
+     u8"$n beam a cheery smile at $N's $t.",
+     u8"$n beams a cheery smile at your $t.",
+     u8"You beam a cheery smile at $p.",
+     u8"$n beam a cheery smile at $p."},
+    {u8"Which bear do you wish to hug?",
+     u8"$n is pretending to be a bear... RUN!",
+     u8"You give $M a HUGE bearhug and nearly crack $S spine.",
+     u8"$n gives $N a huge bearhug!",
+     u8"$n gives you a huge, bone crushing bearhug!",
+     u8"Perhaps you better take lessons from a real bear?",
+     u8"You try to break every bone in your body.",
+     u8"$n seems to be trying to break every bone in $s body!",
+     u8"You squeeze $S $t in an impressive bearhug.",
+     u8"$n squeezes $N's $t in an impressive bearhug.",
+     u8"$n bearhugs your $t.",
+     u8"You give $p a huge bearhug.",
+     u8"$n gives $p a huge bearhug."},
+    {u8"Whom do you wish to beckon?",
+     u8"$n beckons everyone closer.",
+     u8"You beckon $M over to where you stand.",
+     u8"$n beckons $N over to $m.",
+     u8"$n beckons you over to $m.",
+     u8"You beckon, but no one comes.",
+     u8"You beckon to yourself, are you coming?",
+     u8"$n beckons to $mself, how strange.",
+     u8"You look at $S $t and beckon it closer.",
+     u8"$n looks at $N's $t and beckons it closer.",
+     u8"$n looks at your $t and beckons it closer.",
+     u8"You look at $p and beckon it closer.",
+     u8"$n looks at $p and beckons it closer."},
+    {u8"Aaaaaaaah! Better now...",
+     u8"$n opens up a bottle of beer and drinks it in less than 0 seconds!!!",
+     u8"Dang! You spilled the beer all over $N!",
+     u8"$n, sloppy as always, spills $s beer over $N!",
+     u8"$n spills $s beer all over you!",
+     u8"They're not here, you'll have to drink it yourself, darn it?",
+     u8"You spill it all over yourself! GAAAhhhhhh!",
+     u8"$n is so drunk that $e spills the beer over $mself.",
+     u8"You spill beer on $S $t.",
+     u8"$n spills beer on $N's $t, what a sloppy drunk.",
+     u8"$n spills beer on your $t, what a sloppy drunk.",
+     u8"You spill beer on $p, what a waste.",
+     u8"$n spills beer on $p, what a sloppy drunk."},
+    {u8"You beg the gods for mercy.  (No way you're gonna get it! :-))",
+     u8"The gods fall down laughing at $n's request for mercy.",
+     u8"You desperately try to squeeze a few coins from $M.",
+     u8"$n begs $N for a dime or two -- or twenty!",
+     u8"$n begs you for money.  You gratiously let $m peep at your fortune.",
+     u8"Your money-lender seems to be out for the moment.",
+     u8"How? - begging yourself for money doesn't help.",
+     u8"$n begs $mself for money.",
+     u8"You look at $S $t and beg pitifully.",
+     u8"$n looks at $N's $t and begs pitifully.",
+     u8"$n looks at your $t and begs pitifully.",
+     u8"You look at $p and beg pitifully.",
+     u8"$n looks at $p and begs pitifully."},
+    {u8"Whom do you want to hide behind?",
+     u8"",
+     u8"You hide behind $N.",
+     u8"$n hides behind $N.",
+     u8"$n hides behind you.",
+     u8"That person isn't here to hide behind.",
+     u8"You can't hide behind yourself!",
+     u8"$n tries to hide behind $mself, and fails miserably.",
+     u8"",
+     u8"",
+     u8"",
+     u8"You hide behind $p.",
+     u8"$n hides behind $p."},
+    {u8"A belch rumbles from the bottom of your stomach and echoes loudly in the room!",
+     u8"The room rumbles and shakes as $n belches!",
+     u8"You belch in $S face for a long time.",
+     u8"$n belches in $N's face.",
+     u8"$n belches in your face for a long time.",
+     u8"Belching in someone's face is quite disgusting!",
+     u8"You belch at yourself, that's disgusting.",
+     u8"$n belches at $mself, how disgusting.",
+     u8"You look at $S $t and belch at it.",
+     u8"$n looks at $N's $t and belches at it.",
+     u8"$n looks at your $t and belches at it.",
+     u8"You look at $p and belch at it.",
+     u8"$n looks at $p and belches at it."},
+    {u8"Who do you want to bite?",
+     u8"",
+     u8"You savagely bite $N.",
+     u8"$n savagely bites $N.",
+     u8"$n savagely bites you!",
+     u8"I cannot see that person here.",
+     u8"You attempt to bite yourself on the neck.",
+     u8"$n attempts to bite $mself on the neck.",
+     u8"You sink your teeth into $N's $t.",
+     u8"$n sinks $s teeth into $N's $t.",
+     u8"$n sinks $s teeth into your $t.",
+     u8"",
+     u8""},
+    {u8"You say, \"BLAH!!\"",
+     u8"$n goes, \"BLAH!!\"",
+     u8"You look at $N and go, \"BLAH!\"",
+     u8"$n looks at $N and goes, \"BLAH!\"",
+     u8"$n looks at you and goes, \"BLAH!\"",
+     u8"There's no one around by that name.",
+     u8"You look at yourself and go, \"BLAH!\"",
+     u8"$n looks at $mself and goes, \"BLAH!\"",
+     u8"You take a marker and write \"BLAH!\" on $N's $t.",
+     u8"$n takes a marker and writes \"BLAH!\" on $N's $t.",
+     u8"$n takes a marker and writes \"BLAH!\" on your $t.",
+     u8"You take a marker and write \"BLAH!\" on $p.",
+     u8"$n takes a marker and writes \"BLAH!\" on $p."},
+    {u8"You blame everyone!",
+     u8"$n blames you!",
+     u8"You blame $M.",
+     u8"$n blames $N.",
+     u8"$n blames YOU!",
+     u8"Try placing the blame on someone you can see.",
+     u8"You blame yourself.",
+     u8"$n blames $mself.",
+     u8"You blame everything on $S $t.",
+     u8"$n blames everything on $N's $t.",
+     u8"$n blames everything on your $t.",
+     u8"You blame everything on $p.",
+     u8"$n blames everything on $p."},
+    {u8"You bleed profusely, making an awful mess...",
+     u8"$n bleeds profusely, making an awful mess...",
+     u8"You bleed all over $M.",
+     u8"$n bleeds all over $N.",
+     u8"$n bleeds all over you..  YUCK!",
+     u8"You bleed in vain for no one cares.",
+     u8"You pick at an old scab and begin to bleed.",
+     u8"$n picks at an old scab and bleeds all over $sself.",
+     u8"You bleed all over $S $t.",
+     u8"$n bleeds all over $N's $t.",
+     u8"$n bleeds all over your $t.",
+     u8"You bleed all over $p.",
+     u8"$n bleeds all over $p."},
+    {u8"You blink.",
+     u8"$n blinks.",
+     u8"You blink at $M in disbelief.",
+     u8"$n blinks at $N.",
+     u8"$n blinks at you in disbelief.",
+     u8"Surprise! Surprise they are not here.",
+     u8"You blink your eye... Something in there?",
+     u8"$n seems to have something caught in $s eye.",
+     u8"You blink at $S $t",
+     u8"$n blinks at $N's $t.",
+     u8"$n blinks at your $t.",
+     u8"You blinks at $p.",
+     u8"$n blinks at $p."},
+    {u8"You tell a story about a bloober, you once saw.",
+     u8"$n bloobs out about nothing and everything.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You take a deep breath and hold it.",
+     u8"$n holds $s breath.",
+     u8"You glance at $N as you slowly start turning blue.",
+     u8"$n glances at $N as $e slowly starts turning blue.",
+     u8"$n glances at you as $e slowly starts turning blue.",
+     u8"Don't hold your breath, they're not here.",
+     u8"You slowly start turning blue.",
+     u8"$n slowly starts turning blue.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Your cheeks are burning.",
+     u8"$n blushes.",
+     u8"You glance at $M and blush.",
+     u8"$n glances at $N and blushes.",
+     u8"$n glances at you and blushes deeply.",
+     u8"You are too embarrassed for words.",
+     u8"You blush at the merest sight of yourself.",
+     u8"$n seems to be blushing over $mself.",
+     u8"You look at $S $t and blush.",
+     u8"$n looks at $N's $t and blushes.",
+     u8"$n looks at your $t and blushes.",
+     u8"You look at $p and blush.",
+     u8"$n looks at $p and blushes."},
+    {u8"BOIINNNNNNGG!",
+     u8"$n bounces around the room.",
+     u8"You take $M out for a joyful bounce.",
+     u8"$n grabs $N and bounces around the room with $M.",
+     u8"$n grabs you and bounces around with you in joy.",
+     u8"Find another trampoline to bounce upon.",
+     u8"You go bouncing against the walls.",
+     u8"$n bounces off the walls!",
+     u8"You grab $S $t and start bouncing around with it.",
+     u8"$n grabs $N's $t and starts bouncing around with it.",
+     u8"$n grabs your $t and starts bouncing around with it.",
+     u8"You take it out for a joyful bounce.",
+     u8"$n grabs $p and starts bouncing around with it."},
+    {u8"You boast about your great deed.",
+     u8"$n boasts loudly about $s great deed.",
+     u8"You boastfully tell $M about yourself.",
+     u8"$n boasts to $N.",
+     u8"$n boastfully tells you about $mself.",
+     u8"Your boasts seem generally ignored.",
+     u8"You boast to yourself and fill your head with silly thoughts.",
+     u8"$n boasts to $mself, how conceited.",
+     u8"You boast about $S $t.",
+     u8"$n boasts about $N's $t.",
+     u8"$n boasts about your $t.",
+     u8"You boast about $p.",
+     u8"$n boast about $p."},
+    {u8"You are completely boggled.",
+     u8"$n is completely boggled.",
+     u8"You are boggled by $M.",
+     u8"$n seems a bit boggled by $N.",
+     u8"You seem to have boggled $n.",
+     u8"You are truly and utterly boggled it seems.",
+     u8"You boggle yourself... evidently it was quite easy.",
+     u8"$n's mind is completely boggled.",
+     u8"You are boggled over $S $t.",
+     u8"$n seems to be boggled over $N's $t.",
+     u8"$n boggles over your $t.",
+     u8"You are boggled by $p.",
+     u8"$n seems to be boggled over $p."},
+    {u8"Who do you want to boink?",
+     u8"$n looks around, puzzled.",
+     u8"You boink $M.",
+     u8"$n boinks $N with ultimate passion.",
+     u8"$n boinks you passionately.",
+     u8"Who's that?",
+     u8"You boink yourself on the head.",
+     u8"*YUCK* $n boinks $mself on the head.",
+     u8"You boink $S $t.",
+     u8"$n boinks $N's $t.",
+     u8"$n boinks your $t.",
+     u8"You boink $p.",
+     u8"$n boinks $p."},
+    {u8"Whom do you wish to bonk on the head?",
+     u8"$n is looking for someone to bonk, RUN!",
+     u8"You bonk $M on the head.",
+     u8"$n bonks $N on the head.",
+     u8"$n bonks you on the head. OUCH!",
+     u8"The bonkee seems to have fled.",
+     u8"You bonk yourself on the head. Hey! that hurt!",
+     u8"$n bonks $mself in the head.",
+     u8"You bonk $S $t.",
+     u8"$n bonks $N's $t.",
+     u8"$n bonks your $t.",
+     u8"You bonk $p.",
+     u8"$n bonk $p."},
+    {u8"'BOO!' you're a frightening person, aren't ya?",
+     u8"From out of nowhere, $n goes, \"BOO!\"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You flick a booger from your finger off into space.",
+     u8"$n flicks a booger from $s finger.",
+     u8"You flick a slimy booger at $M.",
+     u8"$n flicks a booger at $N.",
+     u8"$n flicks a slimy booger at you. How disgusting!",
+     u8"Flicking boogers at people is not a good way of becoming well liked.",
+     u8"You pick your nose and discover a tasty booger.",
+     u8"$n picks $s nose and finds a big, green booger... ick!",
+     u8"You wipe a booger on $S $t.",
+     u8"$n wipes a booger on $N's $t.",
+     u8"$n wipes a booger on your $t.",
+     u8"You wipes a booger on $p.",
+     u8"$n wipes a booger $p."},
+    {u8"Bop who?",
+     u8"$n bops around like a teenager!",
+     u8"You bop $N over the head, OUCH!",
+     u8"$n bops $N over the head, OUCH!",
+     u8"$n bops you over the head, are you going to take that?",
+     u8"You bop around like a teenager.",
+     u8"You bop yourself over the head.",
+     u8"$n bops $s head hard with $s fist.",
+     u8"You bop $S $t.",
+     u8"$n bops $N's $t.",
+     u8"$n bops your $t.",
+     u8"You bop $p.",
+     u8"$n bop $p."},
+    {u8"You're bored out of your mind!",
+     u8"$n is bored out of $s mind!",
+     u8"Out of boredom, you try to annoy $N.",
+     u8"Out of boredom, $n tries to annoy $N.",
+     u8"Out of boredom, $n tries to annoy you.",
+     u8"They must be bored. They've left you all alone!",
+     u8"You're SO boring you even bore yourself!",
+     u8"$n bores even $mself!",
+     u8"Feeling very bored, you annoy $S $i.",
+     u8"Feeling very bored, $n annoys $N's $i.",
+     u8"Feeling very bored, $n annoys your $i.",
+     u8"Feeling bored, you try to annoy everyone with $p.",
+     u8"$n tries to annoy everyone with $p."},
+    {u8"You bow deeply.",
+     u8"$n bows deeply.",
+     u8"You bow before $M.",
+     u8"$n bows before $N.",
+     u8"$n bows before you.",
+     u8"Who's that?",
+     u8"You kiss your toes.",
+     u8"$n folds up like a jacknife and kisses $s own toes.",
+     u8"You bow at $S $t",
+     u8"$n bows at $N's $t.",
+     u8"$n bows at your $t.",
+     u8"You bow at $p.",
+     u8"$n bows at $p."},
+    {u8"You look for someone to box.",
+     u8"$n looks for someone to box.",
+     u8"You beat $N up. KO!",
+     u8"$n boxes $N. They both lose.",
+     u8"$n boxes with you. Oi... KO!",
+     u8"You beet him to a bloody pulp, they arn't here...",
+     u8"You can't beat yourself up!",
+     u8"Back away! $n is beating themselves up!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You brag about your adventures.",
+     u8"$n brags about deeds, done during $s countless adventures.",
+     u8"You brag to $M about your adventures.",
+     u8"$n brags to $N.",
+     u8"$n brags to you about $s adventures.",
+     u8"Your brags seem generally ignored.",
+     u8"You brag to yourself and make your head swell.",
+     u8"$n brags about $mself, how conceited.",
+     u8"You brag about $S $t.",
+     u8"$n brags about $N's $t.",
+     u8"$n bragss about your $t.",
+     u8"You brag about $p.",
+     u8"$n brags about $p."},
+    {u8"You let everyone know that you'll be right back!",
+     u8"$n will be right back!",
+     u8"You tell $M you'll be right back.",
+     u8"$n tells $N that $e will be right back.",
+     u8"$n tells you that $e will be right back.",
+     u8"You tell someone that isn't there that you will be right back.",
+     u8"You tell yourself that you'll be right back.",
+     u8"$n tells $mself that $e will be right back.",
+     u8"You tell $S $t that you'll be right back.",
+     u8"$n tells $N's $t that you'll be right back.",
+     u8"$n tells $t that you'll be right back.",
+     u8"You tell $p that you'll be right back.",
+     u8"$n tells $p that you'll be right back."},
+    {u8"You breathe slowly and steadily.",
+     u8"$n breathes.",
+     u8"You breathe on $M.",
+     u8"$n breathes on $N.",
+     u8"$n's breathes deeply, $s breath warm against your skin.",
+     u8"You can't breathe on someone that isn't even here!",
+     u8"You breathe onto your hand and sniff it... what a pong!",
+     u8"$n breathes onto $s hand and sniffs it.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You shriek for the witch to be BURNED!",
+     u8"$n shrieks for the witch to be BURNED!",
+     u8"You shriek that $N is a witch! BURN $M!",
+     u8"$n shrieks that $N is a witch! BURN $M!",
+     u8"$n shrieks that you are a witch! Do you smell smoke?",
+     u8"You need to find them first!",
+     u8"You're a witch, BURN!",
+     u8"$n shrieks that $e's a witch, and promptly BURNS $mself!",
+     u8"You shriek that $N's $t is the sign of a witch! BURN $M!",
+     u8"$n shrieks that $N's $t is the sign of a witch! BURN $M!",
+     u8"$n shrieks that your $t is the sign of a witch! Do you smell smoke?",
+     u8"You shriek that $p is the sign of a witch! BURN it!",
+     u8"$n shrieks that $p is the sign of a witch! BURN it!"},
+    {u8"You burp loudly! Better excuse yourself.",
+     u8"$n burps loudly.",
+     u8"You burp in $S face.",
+     u8"$n burps in $N's face.",
+     u8"$n burps in your face.",
+     u8"Burping in someone's face is not polite.",
+     u8"You try to stifle a small burp.",
+     u8"$n's tummy seems to be bothering $m.",
+     u8"You look at $S $t and burp at it.",
+     u8"$n looks at $N's $t and burps at it.",
+     u8"$n looks at your $t and burps at it.",
+     u8"You look at $p and burps at it.",
+     u8"$n looks at $p and burps at it."},
+    {u8"You buzz like a bug.",
+     u8"$n buzzes.",
+     u8"You buzz like a mosquito in $S ear.",
+     u8"$n is buzzing in $N's ear.",
+     u8"$n buzzes annoyingly in your ear.",
+     u8"You are much too big of a bug to buzz!",
+     u8"Something seems to be buzzing in your ear.",
+     u8"A cloud of gnats buzz around $n's head.",
+     u8"You buzz at $S $t.",
+     u8"$n buzzes at $N's $t.",
+     u8"$n buzzes at your $t.",
+     u8"You buzz at $p.",
+     u8"$n buzzes at $p."},
+    {u8"You cackle gleefully.",
+     u8"$n throws back $s head and cackles with insane glee!",
+     u8"You grasp $S shoulder and cackle at $M.",
+     u8"$n grasps $N's shoulder, throws back $s head and cackles insanely.",
+     u8"$n insanely cackles in your face.",
+     u8"Your madness seems to have affected your eyesight.",
+     u8"Still working on that wicked witch impersonation?",
+     u8"$n begins to cackle to $mself like an old crone.",
+     u8"You cackle insanely at $S $t.",
+     u8"$n cackles insanely at $N's $t.",
+     u8"$n cackles insanely at your $t.",
+     u8"You cackles insanely at $p.",
+     u8"$n cackles insanely at $p."},
+    {u8"Piece of cake!",
+     u8"$n thinks it will be a `piece of cake!'",
+     u8"You tell $M that it will be a 'piece of cake.'",
+     u8"$n tells $N that that it will be a 'piece of cake.'",
+     u8"$n tells you that that it will be a 'piece of cake.'",
+     u8"You tell someone that it will be a 'piece of cake.'",
+     u8"You tell yourself that it will be a 'piece of cake.'",
+     u8"$n tells $mself that that it will be a 'piece of cake.'",
+     u8"You tell $S $t that it will be a 'piece of cake.'",
+     u8"$n tells $N's $t that it will be a 'piece of cake.'",
+     u8"$n tells your $t that it will be a 'piece of cake.'",
+     u8"You tell $p that it will be a 'piece of cake.'",
+     u8"$n tells $p that it will be a 'piece of cake.'"},
+    {u8"You breathe deeply and count to 10.",
+     u8"$n takes in a few deep breaths and counts to 10.",
+     u8"You try to calm $N down.",
+     u8"$n tries to calm $N down.",
+     u8"$n tries to calm you down.",
+     u8"To late!",
+     u8"You breathe deeply and think happy thoughts.",
+     u8"$n breathes deeply and tries to calm $mself down.",
+     u8"You look at $N's $t and tell it to calm down.",
+     u8"$n looks at $N's $t and tells it to calm down.",
+     u8"$n looks at your $t and tells it to calm down.",
+     u8"",
+     u8""},
+    {u8"Whom do you wish to caress?",
+     u8"$n is looking for someone to caress?",
+     u8"You gently caress $M.",
+     u8"$n gently caress $N.",
+     u8"$n gently caresses you.",
+     u8"I hope you know this person!",
+     u8"You caress yourself... hmmmm.",
+     u8"$n caresses $mself in front of everyone.",
+     u8"You gently caress $S $t.",
+     u8"$n gently caresses $N's $t.",
+     u8"$n gently caresses your $t, it feels nice.",
+     u8"You gently caress $p.",
+     u8"$n gently caresses $p."},
+    {u8"What would you possibly do with a carrot.....?",
+     u8"$n whips out a firm carrot!",
+     u8"You whip out a carrot and wink at $N.",
+     u8"$n whips a carrot out of $s pocket and winks at $N.",
+     u8"$n whips a carrot out of $s pocket and winks at you.",
+     u8"You try penetrating the air with your carrot!",
+     u8"You whip out a carrot with a demented look on your face.",
+     u8"$n whips out a carrot with an odd look on $s face.",
+     u8"You prod $N's $t with your carrot.",
+     u8"$n prods $N's $t with $s carrot!",
+     u8"$n prods your $t with $s carrot.",
+     u8"You stick your carrot in $p.",
+     u8"$n sticks $s carrot into $p."},
+    {u8"You do a cartwheel. Wheeee!",
+     u8"$n does a cartwheel!",
+     u8"You cartwheel past $M.",
+     u8"$n cartwheels past $N in a blur.",
+     u8"$n cartwheels past you in a blur.",
+     u8"You spin me right round baby, right round...",
+     u8"You spin yourself around and around and around and...",
+     u8"$n does several cartwheels in a row. $e looks quite dizzy!",
+     u8"You do a cartwheel over $S $t.",
+     u8"$n does a cartwheel over $N's $t.",
+     u8"$n does a cartwheel over your $t.",
+     u8"You do a cartwheel over $p.",
+     u8"$n does a cartwheel over $p."},
+    {u8"You challenge all who dare oppose you.",
+     u8"$n challenges all who dare oppose $m - better stay clear.",
+     u8"You challenge $N to a fight until DEATH!",
+     u8"$n challenges $N to fight $m until DEATH!",
+     u8"$n challenges you to fight $m until DEATH!",
+     u8"Challenge who?!?",
+     u8"Challenge yourself to mortal combat?? - stupid!",
+     u8"$n looks real stupid, walking in circles around $mself shadowfighting!",
+     u8"You challenge $S $t to a duel.",
+     u8"$n challenges $N's $t to a duel.",
+     u8"$n challenges your $t to a duel.",
+     u8"You challenge $p to a duel.",
+     u8"$n challenge $p to a duel."},
+    {u8"You receive the \"I don't know how to talk on the right channel\" award.",
+     u8"$n wins the \"I don't know how to talk on the right channel\" award.",
+     u8"You give $N the \"I don't know how to talk on the right channel\" award.",
+     u8"$n gives $N the \"I don't know how to talk on the right channel\" award.",
+     u8"$n gives you the \"I don't know how to talk on the right channel\" award.",
+     u8"They left before you could present the award.",
+     u8"You award yourself for your accomplishments.",
+     u8"$n gives $mself the \"I don't know how to talk on the right channel\" award.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"CHARGE! Into the fray!",
+     u8"$n charges into the fray!",
+     u8"You charge headlong into $M!",
+     u8"$n charges headlong into $N.",
+     u8"$n charges right into you!",
+     u8"Will that be VISA, MasterCard, or AmEx?",
+     u8"Charge yourself? How?",
+     u8"$n looks real stupid, trying to charge at $mself!",
+     u8"You charge $S $t.",
+     u8"$n charges $N's $t.",
+     u8"$n charges your $t.",
+     u8"You charges $p.",
+     u8"$n charges $p."},
+    {u8"You look charming.",
+     u8"$n looks charming.",
+     u8"You are charmed by $M.",
+     u8"$n is charmed by $N.",
+     u8"$n is charmed by you.",
+     u8"Charming, isn't it?",
+     u8"You seem to be charmed by your own reflection.",
+     u8"$n is charmed by $s own reflection.",
+     u8"You are charmed by $S $t.",
+     u8"$n is charmed by $N's $t.",
+     u8"$n is charmed by your $t.",
+     u8"You is charmed by $p.",
+     u8"$n is charmed $p."},
+    {u8"Hooray!",
+     u8"$n gives a resounding cheer.",
+     u8"You cheer $M.",
+     u8"$n cheers $N's great work.",
+     u8"$n gives you a hearty cheer.",
+     u8"Hmmm wonder where they went?",
+     u8"You congratulate yourself.",
+     u8"$n seems to be very impressed with $mself.",
+     u8"You cheer at $S $t.",
+     u8"$n cheers at $N's $t.",
+     u8"$n cheers at your $t.",
+     u8"You cheer at $p.",
+     u8"$n cheers at $p."},
+    {u8"You chitter like a squirrel.",
+     u8"$n chitters loudly.",
+     u8"You chitter at $M like a squirrel.",
+     u8"$n chitters at $N.",
+     u8"$n chitters at you.",
+     u8"You chitter like a rabid squirrel at no one in particular.",
+     u8"You chitter to yourself like a squirrel off $s nut.",
+     u8"$n chitters loudly to $mself.",
+     u8"You chitter at $S $t.",
+     u8"$n chitters at $N's $t.",
+     u8"$n chitters at your $t.",
+     u8"You chitter at $p.",
+     u8"$n chitters at $p."},
+    {u8"You choke and gasp for breath.",
+     u8"$n chokes and gasps for breath.",
+     u8"You look pleadingly at $N as you choke and gasp for breath.",
+     u8"$n looks pleadingly at $N as $e chokes and gasps for breath.",
+     u8"$n looks pleadingly at you as $e chokes and gasps for breath.",
+     u8"I can't see them, I'm sorry.",
+     u8"You're slowly choking to death. Help!",
+     u8"$n is slowly choking to death. Help!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You chortle.",
+     u8"$n chortles.",
+     u8"You chortle at $N.",
+     u8"$n chortles at $N.",
+     u8"$n chortles at you.",
+     u8"You don't see them here!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You wish everyone a Merry Christmas!!!",
+     u8"$n wishes everyone a Merry Christmas!!!",
+     u8"You wish $N a Merry Christmas!!!",
+     u8"$n wishes $N a very Merry Christmas!!!",
+     u8"$n wishes you a very Merry Christmas!!!",
+     u8"First sign of insanity...",
+     u8"You wish yourself a very Merry Christmas.",
+     u8"$n wishes $mself a very Merry Christmas.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You chuckle politely.",
+     u8"$n chuckles politely.",
+     u8"You chuckle at $N.",
+     u8"$n chuckles at $N.",
+     u8"$n chuckles at you.",
+     u8"Hmm... No one like that seems to be about.",
+     u8"You chuckle quietly to yourself.",
+     u8"$n chuckles quietly to $mself, obviously some private joke.",
+     u8"You chuckle at $S $t.",
+     u8"$n chuckles at $N's $t.",
+     u8"$n chuckles at your $t.",
+     u8"You chuckle at $p.",
+     u8"$n chuckles at $p."},
+    {u8"You clap your small hands together.",
+     u8"$n shows $s approval by clapping $s hands together.",
+     u8"You clap wholeheartedly for $N's achievement!",
+     u8"$n claps wholeheartedly for $N's achievement!",
+     u8"$n claps wholeheartedly for your achievement!",
+     u8"You make the sound of one hand clapping.",
+     u8"You clap your hands over your ears.",
+     u8"$n claps $s hands over $s ears.",
+     u8"You clap at $S $t.",
+     u8"$n claps at $N's $t.",
+     u8"$n claps at your $t.",
+     u8"You clap at $p.",
+     u8"$n claps at $p."},
+    {u8"Clobber the air?  Sure, go ahead, fine by me...",
+     u8"$n starts shadow-boxing.",
+     u8"You clobber $M right in the face!  Yuck, the BLOOD!",
+     u8"$n swings weakly at $N, missing by miles.",
+     u8"$n tries to clobber you but misses by a good quarter-mile...",
+     u8"Clobber who?",
+     u8"You clobber yourself in the face resulting in your own nose being bloodied.",
+     u8"$n clobbers $mself in the face, looking kind of stupid.",
+     u8"You clobber $M in the $t!",
+     u8"$n clobbers $N in the $t!",
+     u8"$n clobbers you in the $t!",
+     u8"You clobber $p.",
+     u8"$n clobbers $p."},
+    {u8"You pour coffee for everyone, offering to tape eyelids open as needed.",
+     u8"$n pours coffee for everyone, offering to tape eyelids open as needed.",
+     u8"You fix two strips of tape to $N's eyelids and pour $M some coffee.",
+     u8"$n fixes two strips of tape to $N's eyelids and pours $M some coffee.",
+     u8"$n fixes two strips of tape to your eyelids and pours you some coffee.",
+     u8"Pouring coffee for imaginary friends?",
+     u8"You fix two strips of tape to your eyelids and pour yourself some coffee.",
+     u8"$n fixes two strips of tape to $s eyelids and pours $mself some coffee.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You shiver and hug your body, trying to get warm",
+     u8"$n's teeth starts chattering from the extremely cold weather",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You collapse into a heap of weary bones.",
+     u8"$n collapses into a heap.",
+     u8"You collapse on top of $M.",
+     u8"$n collapses on top of $N.",
+     u8"$n collapses on top of you.",
+     u8"Are you really at the point of total collapse?",
+     u8"You totally collapse.",
+     u8"$n totally collapses.",
+     u8"You collapse on $S $t.",
+     u8"$n collapses on $N's $t.",
+     u8"$n collapses on your $t.",
+     u8"You collapse on $p.",
+     u8"$n collapses on $p."},
+    {u8"Do you feel uncomfortable?",
+     u8"$n looks for someone to comfort.",
+     u8"You comfort $M.",
+     u8"$n comforts $N.",
+     u8"$n comforts you.",
+     u8"Comfort who?",
+     u8"You make a vain attempt to comfort yourself.",
+     u8"$n tries to comfort $mself.",
+     u8"You comfort $S $t.",
+     u8"$n comforts $N's $t.",
+     u8"$n comforts your $t.",
+     u8"You comfort $p.",
+     u8"$n comforts $p."},
+    {u8"You comb your hair -- perfect.",
+     u8"$n combs $s hair, what a dashing specimen!",
+     u8"You patiently untangle $N's hair -- what a mess!",
+     u8"$n tries patiently to untangle $N's hair.",
+     u8"$n pulls your hair in an attempt to comb it.",
+     u8"That person is not here.",
+     u8"You pull your hair, but it will not be combed.",
+     u8"$n tries to comb $s tangled hair.",
+     u8"You comb $S $t.",
+     u8"$n combs $N's $t.",
+     u8"$n combs your $t.",
+     u8"You comb $p.",
+     u8"$n comb $p."},
+    {u8"You feel very confused.",
+     u8"$n feels very confused.",
+     u8"You try to confuse $M.",
+     u8"$n tries to confuse $N.",
+     u8"$n tries to confuse you.",
+     u8"You're confused? So am I! Who's that supposed to be aimed at?",
+     u8"Well done, you've gone and confused yourself!",
+     u8"$n has confused $mself now.",
+     u8"You look at $N's $i in confusion.",
+     u8"$n looks at $N's $i in confusion.",
+     u8"$n looks at your $i in confusion.",
+     u8"",
+     u8""},
+    {u8"@YYou start a conga line! Conga conga conga!!@n",
+     u8"@Y$n starts dancing around creating a conga line! (type CONGA <person> to join $m)@n",
+     u8"@YYou put your hands on $N's hips and join the conga line!@n",
+     u8"@Y$n places their hands on $N's hips and joins the conga line!@n",
+     u8"@Y$n places their hands on your hips and joins the conga line! Weee fun!@n",
+     u8"You do not see them here.",
+     u8"You must conga with someone else!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"@YThe conga line dances around the location bringing joy and happiness to everyone!@n",
+     u8"@YThe conga line dances around the location bringing joy and happiness to everyone!@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You feel unconsolable.",
+     u8"$n looks for someone to console $m.",
+     u8"You console $M.",
+     u8"$n consoles $N.",
+     u8"$n consoles you.",
+     u8"Console who?",
+     u8"You make a vain attempt to console yourself.",
+     u8"$n tries to console $mself.",
+     u8"You console $S $t.",
+     u8"$n consoles $N's $t.",
+     u8"$n consoles your $t.",
+     u8"You console $p.",
+     u8"$n consoles $p."},
+    {u8"You contemplate theology, the concept of heaven and hell and ethereal realities.",
+     u8"$n contemplates theology, the concept of heaven and hell and ethereal realities.",
+     u8"You contemplate $N, and the reason why $E exists.",
+     u8"$n contemplates $N, and the reason why $E exists.",
+     u8"$n contemplates you, and the reason why you exist.",
+     u8"You contemplate nothingness, mainly because that person isn't even there!",
+     u8"You contemplate yourself and the reason for why you exist.",
+     u8"$n contemplates $mself and the reason for why $e exists.",
+     u8"You contemplate the meaning of $N's $t.",
+     u8"$n contemplates the meaning of $N's $t.",
+     u8"$n contemplates the meaning of your $t.",
+     u8"",
+     u8""},
+    {u8"You cough.",
+     u8"$n coughs.",
+     u8"You cough at $M trying to get attention.",
+     u8"$n coughs all over $N.",
+     u8"$n coughs all over you.",
+     u8"You cough, but they don't seem to care.",
+     u8"Something tickles your throat and you begin to cough.",
+     u8"$n coughs all over $sself.",
+     u8"You cough on $S $t.",
+     u8"$n coughs on $N's $t.",
+     u8"$n coughs on your $t.",
+     u8"You cough on $p.",
+     u8"$n coughs on $p."},
+    {u8"You cower away in fear.",
+     u8"$n cowers away in fear.",
+     u8"You cower away from $M in fear!",
+     u8"$n cowers away from $N.",
+     u8"$n cowers away from you in fear!",
+     u8"Who has scared you to the point of cowering?",
+     u8"You cower away from your own shadow.",
+     u8"$n cowers away from $s own shadow!",
+     u8"You cower away from $S $t.",
+     u8"$n cowers away from $N's $t.",
+     u8"$n cowers away from your $t.",
+     u8"You cower away from $p.",
+     u8"$n cowers away from $p."},
+    {u8"You look around desperately for someone to cradle in your arms.",
+     u8"$n is looking for someone to cradle in $s arms.",
+     u8"You wrap your arms around $N, cradling $M close to you.",
+     u8"$n wraps $s arms around $N, cradling $M to $m closely.",
+     u8"$n wraps $s arms gently around you, cradling you close to $m.",
+     u8"Sorry, they aren't here....maybe a cat would better suit you?",
+     u8"You wrap your arms around yourself and pretend it is your loved one.",
+     u8"n wraps $s arms around $mself as $e rocks side to side.",
+     u8"You cradle $S $t.",
+     u8"$n cradles $N's $t.",
+     u8"$n cradles your $t.",
+     u8"You cradle $p.",
+     u8"$n cradles $p."},
+    {u8"You get a crazed look in your eyes.",
+     u8"$n gets a crazed look in $s eyes.",
+     u8"You glance at $N with a crazed look in your eyes.",
+     u8"$n glances at $N with a crazed look in $s eyes.",
+     u8"$n glances at you with a crazed look in $s eyes.",
+     u8"You're crazy, they're not here.",
+     u8"You give yourself a crazed look.",
+     u8"$n gives $mself a crazed look.",
+     u8"You glance at $N's $t with a crazed look in your eyes.",
+     u8"$n glances at $N's $t with a crazed look in $s eyes.",
+     u8"$n glances at your $t with a crazed look in $s eyes.",
+     u8"You glance at $p with a crazed look in your eyes.",
+     u8"$n glances at $p with a crazed look in $s eyes."},
+    {u8"You look around. \"Crazy, I used to be crazy once... they put me in a rubber room with rubber rats.\" The memories flow back.",
+     u8"$n looks around. \"Crazy, I used to be crazy once. They put me in a rubber room with rubber rats.\" Their eyes daze over as they start to remember.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You creep quietly.",
+     u8"$n is creeping along quietly.",
+     u8"You creep towards $N.",
+     u8"$n creeps towards $N.",
+     u8"$n creeps towards you.",
+     u8"Sorry, they aren't here, you creep.",
+     u8"You creep towards yourself.",
+     u8"$n creeps towards $mself, how strange.",
+     u8"You creep towards $S $t.",
+     u8"$n creeps towards $N's $t.",
+     u8"$n creeps towards your $t.",
+     u8"You creep towards $p.",
+     u8"$n creeps towards $p."},
+    {u8"You cringe in terror.",
+     u8"$n cringes in terror!",
+     u8"You cringe away from $M.",
+     u8"$n cringes away from $N in mortal terror.",
+     u8"$n cringes away from you.",
+     u8"I don't see anyone by that name here.. what are you afraid of?",
+     u8"You cringe at yourself, what are you afraid of?",
+     u8"$n cringes at $mself, how strange.",
+     u8"You cringe at $S $t.",
+     u8"$n cringes at $N's $t.",
+     u8"$n cringes at your $t.",
+     u8"You cringe at $p.",
+     u8"$n cringes at $p."},
+    {u8"You criticize the whole world.",
+     u8"$n criticizes everything and everyone.",
+     u8"You harshly criticize $M.",
+     u8"$n harshly criticizes $N.",
+     u8"$n harshly criticizes you, $e should talk!",
+     u8"Whom do you wish to criticize?",
+     u8"Don't be so hard on yourself!",
+     u8"$n harshly criticizes $mself.",
+     u8"You criticize $S $t.",
+     u8"$n criticizes $N's $t.",
+     u8"$n criticizes your $t.",
+     u8"You criticize $p.",
+     u8"$n criticizes $p."},
+    {u8"You croon a melody in a mellow, soothing voice.",
+     u8"$n croons a soulful melody.",
+     u8"You croon a soothing tune to $M.",
+     u8"$n croons a song to $N in a soothing voice.",
+     u8"$n soulfully croons a song to you.",
+     u8"You croon away... off into space...",
+     u8"Ol' Blue Eyes, eh?",
+     u8"$n thinks $e croons like Frank Sinatra.",
+     u8"You croon at $S $t.",
+     u8"$n croons at $N's $t.",
+     u8"$n croons at your $t.",
+     u8"You croon at $p.",
+     u8"$n croons at $p."},
+    {u8"You cross your fingers and hope for the best.",
+     u8"$n crosses $s fingers and hopes for the best.",
+     u8"You cross your fingers and ask $N to wish you luck.",
+     u8"$n crosses $s fingers and asks $N to wish $m luck.",
+     u8"$n crosses $s fingers and asks you to wish $m luck.",
+     u8"They didn't wait around to wish you luck.",
+     u8"You cross your fingers and pray you don't mess things up.",
+     u8"$n crosses $s fingers and hopes he doesn't mess things up.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You collapse into broken pieces on the floor - CRUSHED!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED!",
+     u8"You collapse into broken pieces on the floor - CRUSHED by $N!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED by $N!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED by you!",
+     u8"You are CRUSHED by their nonexistance.",
+     u8"You are CRUSHED by yourself!",
+     u8"$n is CRUSHED by $mself.",
+     u8"You collapse into broken pieces on the floor - CRUSHED by $N's $t!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED by $N's $t!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED by your $t!",
+     u8"You collapse into broken pieces on the floor - CRUSHED by $p!",
+     u8"$n collapses into broken pieces on the floor - CRUSHED by $p!"},
+    {u8"Waaaaah..",
+     u8"$n bursts into tears.",
+     u8"You cry on $S shoulder.",
+     u8"$n cries on $N's shoulder.",
+     u8"$n cries on your shoulder.",
+     u8"Who's that?",
+     u8"You cry to yourself.",
+     u8"$n sobs quietly to $mself.",
+     u8"You cry on $S $t.",
+     u8"$n cries on $N's $t.",
+     u8"$n cries on your $t.",
+     u8"You cry on $p.",
+     u8"$n cries on $p."},
+    {u8"You wipe a tear from your eye.",
+     u8"$n wipes a tear from $s eye.",
+     u8"You wipe a tear from your eye as you laugh heartily at $N.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at $N.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at you.",
+     u8"You're crying with laughter that they left?",
+     u8"You wipe a tear from your eye as you laugh heartily at yourself.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at $mself.",
+     u8"You wipe a tear from your eye as you laugh heartily at $N's $t.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at $N's $t.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at your $t.",
+     u8"You wipe a tear from your eye as you laugh heartily at $p.",
+     u8"$n wipes a tear from $s eye as $e laughs heartily at $p."},
+    {u8"Who do you feel like cuddling today?",
+     u8"$n wants to cuddle with someone.",
+     u8"You cuddle $M.",
+     u8"$n cuddles $N.",
+     u8"$n cuddles you.",
+     u8"They aren't here.",
+     u8"You must feel very cuddly indeed.. :)",
+     u8"$n cuddles $mself.",
+     u8"You cuddle $S $t.",
+     u8"$n cuddles $N's $t.",
+     u8"$n cuddles your $t.",
+     u8"You cuddle $p.",
+     u8"$n cuddle $p."},
+    {u8"You look curiously about.",
+     u8"$n looks curiously about.",
+     u8"You look curiously at $N.",
+     u8"$n looks curiously at $N.",
+     u8"$n looks curiously at you.",
+     u8"Are you curious that they're not here?",
+     u8"You examine yourself curiously.",
+     u8"$n examines $mself curiously.",
+     u8"You look curiously at $N's $t.",
+     u8"$n looks curiously at $N's $t.",
+     u8"$n looks curiously at your $t.",
+     u8"You look curiously at $p.",
+     u8"$n looks curiously at $p."},
+    {u8"Curl what?",
+     u8"$n curls up into a little ball.",
+     u8"You curl up at $N's feet.",
+     u8"$n curls up into a little ball at $N's feet and goes to sleep.",
+     u8"$n curls up into a little ball and falls asleep at your feet.",
+     u8"You curl up to your imaginary friend.",
+     u8"You curl up and go to sleep.",
+     u8"$n curls and goes to sleep.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You swear loudly for a long time.",
+     u8"$n swears: @*\"*&^$$%@*&!!!!!!",
+     u8"You curse $M and all $S ancestors and descendants.",
+     u8"$n calls doubt on $N's parentage.",
+     u8"$n curses you, what a moron!",
+     u8"Your curses echo emptily.",
+     u8"You make yourself a solemn promise.",
+     u8"$n curses under $s breath.",
+     u8"You curse $S $t.",
+     u8"$n curses $N's $t.",
+     u8"$n curses your $t.",
+     u8"You curse $p.",
+     u8"$n curses $p."},
+    {u8"You curtsey to your audience.",
+     u8"$n curtseys gracefully.",
+     u8"You curtsey to $M.",
+     u8"$n curtsies gracefully to $N.",
+     u8"$n curtsies to you.",
+     u8"But there is nobody by that name here.",
+     u8"You try to curtsy to yourself and fall over.",
+     u8"$n falls over on $s derriere.",
+     u8"You curtsey  at $S $t.",
+     u8"$n curtseys at $N's $t.",
+     u8"$n curtseys at your $t.",
+     u8"You curtsey at $p.",
+     u8"$n curtseys at $p."},
+    {u8"You pull out a large custard pie and begin munching on it.",
+     u8"$n pulls out a large custard pie and eats it face-first.",
+     u8"You whip out a custard pie and slam it into $N's face, laughing all the while.",
+     u8"$n whips out a custard pie and slams it into $N's face!  Whipped cream everywhere!",
+     u8"$n slams a custard pie into your face, which permanently dents your forehead.",
+     u8"You can't throw a pie at someone when they aren't here.  *reality check*",
+     u8"You pull out a custard pie and slam it into your face.  YUMMY.",
+     u8"$n pulls out a custard pie and slams it into $s face.  YUM.",
+     u8"You toss a pie straight at $S $t.",
+     u8"$n tosses a custard pie straight at $N's $t, what a mess.",
+     u8"$n tosses a custard pie straight at your $t, what a mess, cherry you think.",
+     u8"You toss a custard pie onto $p.",
+     u8"$n tosses a custard pie onto $p."},
+    {u8"You dance around happily.",
+     u8"$n dances a little jig.",
+     u8"You dance around happily with $M.",
+     u8"$n dances around happily with $N.",
+     u8"$n dances around happily with you.",
+     u8"Eh, WHO?",
+     u8"You dance around happily by yourself.",
+     u8"$n skips a light Fandango.",
+     u8"You grab $S $t and start dancing with it.",
+     u8"$n grabs $N's $t and starts dancing with it.",
+     u8"$n grabs your $t and starts dancing with it.",
+     u8"You dance around happily with $p.",
+     u8"$n grabs $p and starts dancing with it."},
+    {u8"As you concentrate the room appears to darken.",
+     u8"$n concentrates on something, and the light in the room dims.",
+     u8"You raise your hand, palm open, towards $N.",
+     u8"$n raises $s hand, palm open, towards $N who staggers back.",
+     u8"$n raises $s hand, palm open towards you, and a wave of darkness passes through you!",
+     u8"You raise your hand and concentrate, but nothing happens.",
+     u8"You place your own hand over your heart, and a wave of darkness passes through you.",
+     u8"$n places $s hand over $s heart, and stumbles back.",
+     u8"You grab $S $t and send a wave of darkness through it.",
+     u8"$n grabs $N's $t and sends a wave of darkness through it.",
+     u8"$n grabs your $t and sends a wave of darkness through it.",
+     u8"You take $p and send a wave of darkness through it.",
+     u8"$n grabs $p and sends a wave of darkness through it."},
+    {u8"You dream of better times.",
+     u8"$n looks absent-minded, $s eyes staring into space.",
+     u8"You look at $M dreamily.",
+     u8"$n looks at $N dreamily.",
+     u8"$n looks dreamily at you.",
+     u8"Your idol seems not to be here...",
+     u8"You must love yourself, huh?",
+     u8"$n daydreams about $mself... get a life, huh?",
+     u8"You look at $S $t dreamily.",
+     u8"$n looks at $N's $t dreamily.",
+     u8"$n looks at your $t dreamily.",
+     u8"You look dreamily at $p.",
+     u8"$n looks dreamily at $p."},
+    {u8"This action is unfinished.",
+     u8"This action is unfinished.",
+     u8"You conjure up a bowl of icecream",
+     u8"$n conjures up a large bowl filled with Chocolate icecream, dipped in chocolate fudge sitting on a chocolate fudge brownie and hands it to $N - DBC",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You stagger weakly about the room before keeling over... DEAD!",
+     u8"$n staggers weakly about the room before keeling over... DEAD!",
+     u8"You stagger weakly, grasping $N's shoulder before keeling over... DEAD!",
+     u8"$n staggers weakly, grasping $N's shoulder before keeling over... DEAD!",
+     u8"$n staggers weakly, grasping your shoulder before keeling over... DEAD!",
+     u8"They're not here to observe your tragic demise.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You plug your ears with your fingers and scream 'I CAN'T HEAR YOU!'",
+     u8"$n plugs $s ears with $s fingers and loudly screams 'I CAN'T HEAR YOU!!!'",
+     u8"You plug your ears and scream loudly so you can't hear $N.",
+     u8"$n plugs $s ears and screams violently at $N.",
+     u8"$n plugs $s ears and screams 'I CAN'T HEAR YOU!!!' in your face.",
+     u8"You plug your ears with your fingers and make a scene for no reason in particular.",
+     u8"You try and drown out your own speech by plugging your ears and screaming obscenely.",
+     u8"$n plugs $s ears and screams at $mself because $e doesn't know how to shut up. That'll teach $m.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You charge up the defibrillator and yell 'Clear.'",
+     u8"$n charges up $s defibrillator and yells 'clear.'",
+     u8"You place the defibrillator paddles on $N's chest and give $M a jolt.",
+     u8"$n places some defibrillator paddles against $N's chest and gives $M a jolt.",
+     u8"$n places some defibrillator paddles against your chest and jolts you half to death.",
+     u8"You look around for someone to jolt.",
+     u8"You place the paddles against yourself. Are you crazy?",
+     u8"$n places the defibrillator paddles on $mself and is jolted by the shock.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You throw your hands up in despair. You give up.",
+     u8"$n surrenders, and throws $s hands up in despair.",
+     u8"You throw your hands up in despair at $N.",
+     u8"$n thinks of $N, and throws $s hands in the air.",
+     u8"$n thinks of you, and throws $s hand up in despair.",
+     u8"If you want to show despair find someone to show it to.",
+     u8"You are fed up with yourself.",
+     u8"$n is fed up with $mself.",
+     u8"You look at $S $t despairingly.",
+     u8"$n looks at $N's $t despairingly.",
+     u8"$n looks at your $t despairingly.",
+     u8"You look despairingly at $p.",
+     u8"$n looks despairingly at $p."},
+    {u8"You de-spine yourself... Ow.",
+     u8"$n de-spined $mself. Damn, that *HAD* to hurt...",
+     u8"You rip out $N's spine and cackle insanely, holding it up!",
+     u8"$n reaches over to $N's back, rips out $M spine, and laughs insanely!",
+     u8"$n has just ripped out your spine! Damn, that *HURT!*",
+     u8"Who do you wish to de-spine?",
+     u8"You de-spine yourself... Ow.",
+     u8"$n de-spines $mself. Damn, that *HAD* to hurt...",
+     u8"You try to de-spine $S $t.",
+     u8"$n tries to de-spine $N's $t.",
+     u8"$n tries to de-spine your $t.",
+     u8"You rip the spine out of the $p, then realize... inanimate objects don't have spines.",
+     u8"$n tries in vain to rip the $p's spine out, because it has no spine."},
+    {u8"You differ with that.",
+     u8"$n begs to differ.",
+     u8"You differ with what $E just said.",
+     u8"$n begs to differ with what $N just said.",
+     u8"$n begs to differ with what you just said.",
+     u8"You differ with whom?",
+     u8"You are disagreeing with yourself?",
+     u8"$n is disagreeing with $mself, AGAIN!",
+     u8"You disagree with $S $t.",
+     u8"$n disagrees with $N's $t.",
+     u8"$n disagrees with your $t.",
+     u8"You disagree with $p.",
+     u8"$n disagree with $p."},
+    {u8"You shake your head disapprovingly.",
+     u8"$n shakes $s head disapprovingly.",
+     u8"You give $N a disapproving glance.",
+     u8"$n gives $N a disapproving glance.",
+     u8"$n glances disapprovingly at you.",
+     u8"You disapprove of them but they're not here to notice.",
+     u8"You disapprove of yourself.",
+     u8"$n gives $mself a disapproving glance.",
+     u8"You glance disapprovingly at $N's $t.",
+     u8"$n glances disapprovingly at $N's $t.",
+     u8"$n glances disapprovingly at your $t.",
+     u8"You glance disapprovingly at $p.",
+     u8"$n glances disapprovingly at $p."},
+    {u8"You feel discombobulated.",
+     u8"$n feels discombobulated.",
+     u8"You think $M is discombobulated.",
+     u8"$n thinks $N is discombobulated.",
+     u8"$n thinks you are discombobulated.",
+     u8"You think someone is discombobulated? You're right.",
+     u8"You become all discombobulated.",
+     u8"$n becomes all discombobulated.",
+     u8"You look at $S discombobulated $t.",
+     u8"$n looks at $N's $t and declares it discombobulated.",
+     u8"$n looks at your $t and declares it discombobulated.",
+     u8"You look at $p and declare it discombobulated.",
+     u8"$n looks at $p and declares it discombobulated."},
+    {u8"You are highly disturbed...",
+     u8"$n is highly disturbed...",
+     u8"You find $N highly disturbing...",
+     u8"$n finds $N highly disturbing...",
+     u8"$n finds you highly disturbing...",
+     u8"They're not there... disturbing!",
+     u8"You are actually disturbed by yourself.",
+     u8"$n is disturbed by $mself.",
+     u8"$N's $t disturbs you...",
+     u8"$n is highly disturbed by $N's $t...",
+     u8"$n is highly disturbed by your $t...",
+     u8"You find $p highly disturbing...",
+     u8"$n finds $p highly disturbing..."},
+    {u8"You dive into the dirt.",
+     u8"$n dives into the dirt.",
+     u8"You dive behind $N's massive butt.",
+     u8"$n dives behind $N's massive butt.",
+     u8"$n dives behind your massive butt!",
+     u8"Sorry, that person's massive butt isn't here..",
+     u8"Thats not an easy thing to do.",
+     u8"$n tries to dive behind $s own ass, but fails miserably.",
+     u8"You dive behind $N's massive $t.",
+     u8"$n dives behind $N's massive $t.",
+     u8"$n dives behind your massive $N.",
+     u8"You dive behind $p.",
+     u8"$n dives behind $p."},
+    {u8"Doh!",
+     u8"$n dohs!",
+     u8"You look at $M and exclaim 'doh!'",
+     u8"$n looks at $N and exclaims 'doh!'",
+     u8"$n looks at you and exclaims 'doh!'",
+     u8"Doh a deer, a female deer...",
+     u8"You slap your forehead and exclaim 'doh!'",
+     u8"$n slaps $s forehead and exclaims 'doh!'",
+     u8"You look at $S $t and exclaim 'doh!'",
+     u8"$n looks at $N's $t and exclaims 'doh!'",
+     u8"$n looks at your $t and exclaims 'doh!'",
+     u8"You look at $p and and exclaim 'doh!'",
+     u8"$n looks at $p and and exclaims 'doh!'"},
+    {u8"You doodle in the dirt.",
+     u8"$n doodles in the dirt.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You dread to think.",
+     u8"$n dreads to think.",
+     u8"You recoil from $N in mortal dread.",
+     u8"$n recoils from $N in mortal dread.",
+     u8"$n recoils from you in mortal dread.",
+     u8"You dread them even when they're not here.",
+     u8"You recoil from yourself in mortal dread.",
+     u8"$n recoils from $mself in mortal dread.",
+     u8"You recoil from $N's $t in mortal dread.",
+     u8"$n recoils from $N's $t in mortal dread.",
+     u8"$n recoils from your $t in mortal dread.",
+     u8"You recoil from $p in mortal dread.",
+     u8"$n recoils from $p in mortal dread."},
+    {u8"You start to drool.",
+     u8"$n starts to drool.",
+     u8"You drool all over $N.",
+     u8"$n drools all over $N.",
+     u8"$n drools all over you.",
+     u8"Pardon??",
+     u8"Sure, go ahead and drool...yuk!",
+     u8"$n drools on $mself.  What a sight.",
+     u8"You drool all over $S $t.",
+     u8"$n drools all over $N's $t.",
+     u8"$n drools all over your $t.",
+     u8"You drool on $p.",
+     u8"$n drools on $p."},
+    {u8"You pound out a drumroll.",
+     u8"$n pounds out a drumroll.",
+     u8"You give $M a drumroll.",
+     u8"$n gives $N a drumroll.",
+     u8"$n gives you a drumroll.",
+     u8"You give a drumroll for someone that is not there.",
+     u8"You give yourself a drumroll.",
+     u8"$n gives $mself a drumroll.",
+     u8"You pound out a drumroll on $S $t.",
+     u8"$n pounds out a drumroll on $N's $t.",
+     u8"$n pounds out a drumroll on your $t.",
+     u8"You pound out a drumroll on $p.",
+     u8"$n pounds out a drumroll on $p."},
+    {u8"You duck out of the way.",
+     u8"$n ducks out of the way.",
+     u8"You duck past $M.",
+     u8"$n ducks past $N.",
+     u8"$n ducks past you.",
+     u8"Quack?",
+     u8"You begin to waddle and quack like a duck.",
+     u8"$n begins to waddle and quack like a duck.",
+     u8"You duck under $S $t.",
+     u8"$n ducks under $N's $t.",
+     u8"$n ducks under your $t.",
+     u8"You duck under $p.",
+     u8"$n ducks under $p."},
+    {u8"You hit yourself in the forehead and go, 'Duh!'.",
+     u8"$n hits themselves in the head and goes, 'Duh!'. What the?",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"There must be two people to do this you know...",
+     u8"$n looks seems to be looking for something.",
+     u8"You start to lick $N's ear gently and light in the touch.",
+     u8"$n whispers something to $N.",
+     u8"$n gently starts to lick your ear. MMmmmm...",
+     u8"Not here.. sorry. Pick another ear.",
+     u8"You can't.",
+     u8"$n seems to have something stuck between $s teeth.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Eeeeeeeek!",
+     u8"$n leaps onto a table and screams, 'Eeeeeeeeek!'",
+     u8"$N is terrifying!!!",
+     u8"$n leaps onto a table and screams 'Eeeeeeeeek!' at the sight of $N.",
+     u8"$n leaps onto a table and screams 'Eeeeeeeeek!' at the sight of you.",
+     u8"Panting you realise that the foul creature has left.   Phewww....",
+     u8"You point at yourself and scream, 'Eeeeeeeeek!'",
+     u8"$n points at $mself and screams, 'Eeeeeeeeek!'",
+     u8"You point at $S $t and scream, 'Eeeeeeeeek!'.",
+     u8"$n points at $N's $t and screams, 'Eeeeeeeeek!'.",
+     u8"$n points at your $t and screams, 'Eeeeeeeeek!'.",
+     u8"You point at $p and scream, 'Eeeeeeeeek!'.",
+     u8"$n points at $p and screams, 'Eeeeeeeeek!'."},
+    {u8"Eeeeep!",
+     u8"$n looks a little sheepish and goes 'eep'.",
+     u8"You look at $M and go 'eep'.",
+     u8"$n looks at $N and goes 'eep'.",
+     u8"$n looks at you and goes 'eep'.",
+     u8"Find someone else to eep at.",
+     u8"You look down go 'eep'.",
+     u8"$n looks down and goes 'eep'.",
+     u8"You look at $S $i and go 'eep'.",
+     u8"$n looks at $N's $i and goes 'eep'.",
+     u8"$n looks at your $i and goes 'eep'.",
+     u8"You look at $p and go 'eep'.",
+     u8"$n looks at $p and goes 'eep'."},
+    {u8"Your ego inflates like a giant balloon.",
+     u8"$n's ego inflates like a giant balloon!",
+     u8"You watch $N's ego inflate like a balloon.",
+     u8"$n watches $N's ego inflate like a balloon.",
+     u8"$n watches your ego inflate like a balloon.",
+     u8"They're not here to admire your ego.",
+     u8"You inflate your own ego like a giant balloon!",
+     u8"$n inflates $s ego like a giant balloon!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You grin very evilly.",
+     u8"$n grins very evilly.",
+     u8"You grin evilly, trying to frighten $M.",
+     u8"$n grins evilly, trying to frighten $N.",
+     u8"$n grins evilly, trying to frighten you.",
+     u8"Now, what's the point in trying to intimidate nothing?",
+     u8"You grin evilly, thinking about your own devious plans.",
+     u8"$n grins evilly, thinking about $s own devious plans.",
+     u8"You grin evilly at $N's $t.",
+     u8"$n grins evilly at $N's $t.",
+     u8"$n grins evilly at your $t.",
+     u8"",
+     u8""},
+    {u8"You show your grotesque face and scream, 'I AM NOT AN ANIMAL!!'",
+     u8"$n with the grotesque face screams, 'I AM NOT AN ANIMAL!!'",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You reach but come away empty.  :(",
+     u8"$n reaches out for an embrace, but no one is there.",
+     u8"You embrace $M warmly.",
+     u8"$n embraces $N warmly.",
+     u8"$n embraces you warmly.",
+     u8"Alas, your embracee is not here.",
+     u8"You embrace yourself??",
+     u8"$n wraps $s arms around $mself for a warm self-embrace.",
+     u8"You embrace $S $t warmly.",
+     u8"$n embraces $N's $t warmly.",
+     u8"$n embraces your $t warmly.",
+     u8"You embrace $p warmly.",
+     u8"$n embraces $p warmly."},
+    {u8"You throw your arms wide and express enthusiasm for the beautiful day!",
+     u8"$n throws $s arms wide and expresses enthusiasm for the beautiful day!",
+     u8"You throw your arms around $N and hug $M enthusiastically!",
+     u8"$n throws $s arms around $N and hugs $s enthusiastically!",
+     u8"$n throws $s arms around you and hugs you enthusiastically!",
+     u8"Not here to enthuse.",
+     u8"You hug yourself enthusiastically, caught up in the moment!",
+     u8"$n hugs $mself enthusiastically, caught up in the moment!",
+     u8"You look enthusiastically at $S $t.",
+     u8"$n seems very enthused by $N's $t.",
+     u8"$n seems very enthused by your $t.",
+     u8"You throw your arms around $p and hug it enthusiastically!",
+     u8"$n throws $s arms around $p and hugs it enthusiastically!"},
+    {u8"You turn green with envy!",
+     u8"$n turns green with envy!",
+     u8"You become an attractive green colour as you envy $N.",
+     u8"$n turns an attractive shade of green as $e envies $N.",
+     u8"$n turns an attractive shade of green as $e envies you.",
+     u8"You envy their... lack of presence?",
+     u8"You are envious of yourself.",
+     u8"$n turns green, envious of $mself.",
+     u8"You become an attractive green colour as you envy $N's $t.",
+     u8"$n turns an attractive shade of green as $e envies $N's $t.",
+     u8"$n turns an attractive shade of green as $e envies your $t.",
+     u8"You become an attractive green colour as you envy $p.",
+     u8"$n turns an attractive shade of green as $e envies $p."},
+    {u8"Whom do you wish to give the evileye?",
+     u8"$n looks for someone to give an evileye at.",
+     u8"You give $M the evileye.",
+     u8"$n gives $M the evileye.",
+     u8"$n gives you the evileye... scary!",
+     u8"Better check out that evileye.",
+     u8"You give yourself the evileye?",
+     u8"$n gives $mself the evileye.",
+     u8"You give $S $t the evileye.",
+     u8"$n gives $N's $t the evileye.",
+     u8"$n gives your $t the evileye.",
+     u8"You give $p the evileye.",
+     u8"$n gives $p the evileye."},
+    {u8"Your face distorts in unspeakable horror - Ewwwwww!",
+     u8"$n's face distorts in unspeakable horror as $e shrieks Ewwwww!",
+     u8"You grimace in horror at $N and shriek Ewwwwww!",
+     u8"$n grimaces in horror at $N and shrieks Ewwwww!",
+     u8"$n grimaces in horror at you and shrieks Ewwwww!",
+     u8"Hmm... imaginary friend of yours?",
+     u8"You grimace in horror at yourself and shriek Ewwwww!",
+     u8"$n grimaces in horror at $mself and shrieks Ewwwww!",
+     u8"You grimace in horror at $N's $t and shriek Ewwwwww!",
+     u8"$n grimaces in horror at $N's $t and shrieks Ewwwww!",
+     u8"$n grimaces in horror at your $t and shrieks Ewwwww!",
+     u8"You grimace in horror at $p and shriek Ewwwwww!",
+     u8"$n grimaces in horror at $p and shrieks Ewwwww!"},
+    {u8"You say 'excuse me'",
+     u8"$n exclaims 'Excuse me!'",
+     u8"You excuse yourself to $M.",
+     u8"$n excuses $mself to $N.",
+     u8"$n excuses $mself to you.",
+     u8"Well EXCUSE me!",
+     u8"You excuse yourself.",
+     u8"$n excuses $mself.",
+     u8"You excuse yourself to $S $t.",
+     u8"$n excuses $mself to $N's $t.",
+     u8"$n excuses $mself to your $t.",
+     u8"You excuse yourself to $p.",
+     u8"$n excuses $mself to $p."},
+    {u8"Your eyes take on a quizzical expression.",
+     u8"$n's eyes take on a quizzical expression.",
+     u8"You eye $N quizzically.",
+     u8"$n eyes $N quizzically.",
+     u8"$n eyes you quizzically.",
+     u8"You eye up the empty room.",
+     u8"You eye yourself quizzically.",
+     u8"$n eyes $mself quizzically.",
+     u8"You eye $N's $t quizzically.",
+     u8"$n eyes $N's $t quizzically.",
+     u8"$n eyes your $t quizzically.",
+     u8"You eye $p quizzically.",
+     u8"$n eyes $p quizzically."},
+    {u8"You raise an eyebrow inquiringly.",
+     u8"$n raises an eyebrow inquiringly.",
+     u8"You raise an eyebrow at $N, confused about what $E means.",
+     u8"$n raises an eyebrow at $N.",
+     u8"$n raises an eyebrow at you.",
+     u8"At whom do you wish to raise your eyebrows?",
+     u8"You raise and eyebrow at yourself, very questionable.",
+     u8"$n raises an eyebrow at $mself.",
+     u8"You look at $S $t and raise your eyebrows!",
+     u8"$n looks at $N's $t and raises $s eyebrows!",
+     u8"$n looks at your $t and raises $s eyebrows!",
+     u8"You look at $p and raise your eyebrows!",
+     u8"$n looks at $p and raises $s eyebrows!"},
+    {u8"You roll your eyes.",
+     u8"$n rolls $s eyes.",
+     u8"You look at $M and roll your eyes.",
+     u8"$n rolls $s eyes at $N.",
+     u8"$n stares at you and rolls $s eyes.",
+     u8"Um... who?",
+     u8"You roll your eyes, disgusted with your own incompetence.",
+     u8"$n rolls $s eyes, disgusted with $mself.",
+     u8"You roll your eyes at $S $t.",
+     u8"$n rolls $s eyes at $N's $t.",
+     u8"$n rolls $s eyes at your $t.",
+     u8"You roll your eyes at $p!",
+     u8"$n rolls $s eyes at $p."},
+    {u8"You look around for someone's face to grab.",
+     u8"$n looks around for someone's face to grab!",
+     u8"You grab $N's face tightly!",
+     u8"$n grabs $N's face tightly!",
+     u8"$n grabs your face tightly!",
+     u8"They're not here.",
+     u8"You grab your own face in disbelief.",
+     u8"$n grabs $s own face in disbelief.",
+     u8"You look at $S $t and contemplate grabbing it.",
+     u8"$n looks at $N's $t and contemplates grabbing it.",
+     u8"$n looks at your $t and contemplates grabbing it.",
+     u8"You look at $p and contemplates grabbing it.",
+     u8"$n looks at $p and contemplates grabbing it."},
+    {u8"You plant your face in the palm of your hand with disbelief.",
+     u8"$n plants $s face into the palm of $s hand, full of disbelief.",
+     u8"You plant your face in the palm of your hand, mumbling something about $N's ways.",
+     u8"$n plants $s face into the palm of $s hand, mumbling something about $N's ways.",
+     u8"$n plants $s face into the palm of $s hand, mumbling something about your ways.",
+     u8"They're not around, bub.",
+     u8"You plant your face in the palm of your hand, not quite sure where you went wrong.",
+     u8"$n plants $s face into the palm of $s hand at $s own mistake.",
+     u8"",
+     u8"",
+     u8"",
+     u8"You plant your face in the palm of your hand, cursing the day $p was ever conceived.",
+     u8"$n plants $s face into the palm of $s hand, cursing the day $p was ever conceived."},
+    {u8"You disappear into the void.",
+     u8"$n slowly fades out of existence.",
+     u8"You make $N disappear.",
+     u8"$n makes $N fade out of existence.",
+     u8"You follow $n and disappear into the void $n.",
+     u8"Already gone.  Good Job.",
+     u8"You disappear into the void.",
+     u8"$n slowly fades out of existence.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You faint dead away.",
+     u8"$n faints dead away.",
+     u8"You faint into $N's arms.",
+     u8"$n faints into $N's arms.",
+     u8"Feeling heroic, you catch $n as $e faints into your arms.",
+     u8"That person is not here to catch you, and you fall to the ground.",
+     u8"You faint at the sight of yourself.",
+     u8"$n faints at the sight of $mself.",
+     u8"You look at $S $t and faint.",
+     u8"$n looks at $N's $t and faints.",
+     u8"$n looks at your $t and faints.",
+     u8"You faint at the sight of $p.",
+     u8"$n faints at the sight of $p."},
+    {u8"You fall on your face!",
+     u8"$n falls flat on $s face, what a klutz!",
+     u8"You fall on $M!",
+     u8"$n falls on $N, how clumsy!",
+     u8"$n falls on you!",
+     u8"Who did you want to fall on?",
+     u8"Its pretty hard to fall on yourself.",
+     u8"$n tries to fall on $mself and fails miserably.",
+     u8"You fall on $S $t.",
+     u8"$n falls on $N's $t.",
+     u8"$n falls on your $t.",
+     u8"You fall on $p.",
+     u8"$n falls on $p."},
+    {u8"Fan who?",
+     u8"$n begins fanning the air, how odd!",
+     u8"You wave your paper fan at $N in an attempt to cool $M down.",
+     u8"$n pulls out a large cloth fan, and slowly waves it near $N , *now where did those grapes go?*",
+     u8"$n cools you down by fanning you.",
+     u8"Maybe you should check the WHO list again?",
+     u8"You feel much cooler, after fanning yourself.",
+     u8"$n cools $mself off, with a paper fan",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Where are your manners?",
+     u8"$n lets off a real rip-roarer!",
+     u8"You fart in $s general direction.",
+     u8"$n farts in $N's general direction.",
+     u8"$n farts in your general direction.",
+     u8"You let loose a noxious stinky cloud that only you can smell.",
+     u8"You fart and are overwhelmed by the odiferous stench.",
+     u8"$n farts and nearly faints from the smell.",
+     u8"You fart on $S $t.",
+     u8"$n farts on $N's $t.",
+     u8"$n farts on your $t.",
+     u8"You fart on $p.",
+     u8"$n farts on $p."},
+    {u8"You take out your smelly fish. Who wants some??",
+     u8"$n takes out a smelly fish and grins a devilish grin.",
+     u8"You take out your smelly fish and whack the muffins out of $M.",
+     u8"$n goes on a wild whacking-rampage with a smelly fish on $N.",
+     u8"$n starts whacking you uncontrollably with a smelly fish.",
+     u8"You whack whack whack....wait...they're not here. dumbass.",
+     u8"You whack yourself with a smelly fish. Ahh, the joys of life!",
+     u8"$n whacks $mself with a smelly.",
+     u8"You whack at $N's $t with your smelly fish.",
+     u8"$n whacks $N's $t with $s smelly fish, like a wild Britney Spears on steroids!",
+     u8"$n mercilessly whacks at your $t with a smelly fish.",
+     u8"You whack at $p with your smelly fish.",
+     u8"$n starts whacking at $p with a smelly fish for absolutely no reason whatsoever."},
+    {u8"You flail your arms about wildly.",
+     u8"$n flails $m arms about.",
+     u8"You wave your hands in front of $N's face, are they awake?",
+     u8"$n waves $s hands in front of $N's face.",
+     u8"$n waves a hand in front of your face, uh..hello?",
+     u8"They left before you could flail them.",
+     u8"You wave your hands in front of your face.",
+     u8"$n waves $s hands in front of $s face.",
+     u8"You flail your arms at $S $t.",
+     u8"$n flails $s arms at $N's $t.",
+     u8"$n flails $s arms at your $t.",
+     u8"You flail your arms at $p.",
+     u8"$n flails $s arms at $p."},
+    {u8"Kids, don't try this at home...",
+     u8"$n is using a flamethrower to light small fires in the corners.",
+     u8"You grab your trusty ACME-Flamethrower and create a BBQ-party for $M, with $M.",
+     u8"$n takes a ACME-Flamethrower from $s backpack and turns $N into ashes.",
+     u8"$n takes a ACME-Flamethrower from $s backpack and turns you into a pile of ashes.",
+     u8"Maybe your victim disintegrated... Then again, maybe it wasnt here at all.",
+     u8"You point the opening of the flamethrower towards yourself and turn yourself into piles of bones and ashes.",
+     u8"$n toasts $mself. $n is no more. $n is ashes, ashes and only ashes, and the ashes blows away in the wind. Byebye $n...",
+     u8"You point the flamethrower at $S $t and start to barbecue.",
+     u8"$n points a flamethrower at $N's $t and starts to barbecue.",
+     u8"$n points a flamethrower at your $t and starts to barbecue.",
+     u8"You point the flamethrower at $p and starts to barbecue.",
+     u8"$n points a flamethrower at $p and starts to barbecue."},
+    {u8"You flare your nostrils.",
+     u8"$n flares $s nostrils.",
+     u8"You flare your nostrils at $M.",
+     u8"$n flares $s nostrils at $N.",
+     u8"$n flares $s nostrils at you.",
+     u8"You send up a flare, but no one notices.",
+     u8"You seem to have a certain flare.",
+     u8"$n seems to have a certain flare about $mself.",
+     u8"You flare your nostrils at $S $t.",
+     u8"$n flares $s nostrils at $N's $t.",
+     u8"$n flares $s nostrils at your $t.",
+     u8"You flare your nostrils at $p.",
+     u8"$n flares $s nostrils at $p."},
+    {u8"You flash the room.",
+     u8"$n flashes you.",
+     u8"You flash $M.",
+     u8"$n flashes $N.",
+     u8"$n flashes you.",
+     u8"No one seems to notice you, you pervert!",
+     u8"You flash yourself, impressed?",
+     u8"$n flashes $mself.",
+     u8"You flash $S $t.",
+     u8"$n flashes $N's $t.",
+     u8"$n flashes your $t.",
+     u8"You flash $p.",
+     u8"$n flashes $p."},
+    {u8"You flex.",
+     u8"$n flexes $s impressive body.",
+     u8"You flex your muscles at $M.",
+     u8"$n flexes $s muscles at $N.",
+     u8"$n flexes $s muscles at you.",
+     u8"Oooo... Ahhhrnold!",
+     u8"You flex for yourself.",
+     u8"$n flexes $s massive body.",
+     u8"You flex $S $t.",
+     u8"$n flexes $N's $t.",
+     u8"$n flexes your $t.",
+     u8"You flex $p.",
+     u8"$n flexes $p."},
+    {u8"You flick your hair back and pose stylishly.",
+     u8"$n flicks $s hair back and poses stylishly.",
+     u8"You flick $N for being cheeky. That'll learn 'em.",
+     u8"$n flicks $N for being cheeky.",
+     u8"$n flicks you for being cheeky.",
+     u8"They've gotten away from you!",
+     u8"You flick yourself on the nose. Why?!",
+     u8"$n scrunches up $s face and flicks $mself on the nose.",
+     u8"You flick $N's $t.",
+     u8"$n flicks $N's $t.",
+     u8"$n flicks your $t.",
+     u8"",
+     u8""},
+    {u8"You flinch.",
+     u8"$n flinches.",
+     u8"$M makes you flinch.",
+     u8"$N makes $n flinch.",
+     u8"You make $n flinch.",
+     u8"Someone made you flinch?",
+     u8"You make yourself flinch.",
+     u8"$n makes $mself flinch.",
+     u8"You flinch away from $S $t.",
+     u8"$n flinches away from $N's $t.",
+     u8"$n flinches away from your $t.",
+     u8"You flinch away from $p.",
+     u8"$n flinches away from $p."},
+    {u8"You flip head over heels.",
+     u8"$n flips head over heels.",
+     u8"You flip over $S head.",
+     u8"$n flips over $N's head.",
+     u8"$n flips over your head.",
+     u8"You try to flip over someone who isn't here and fall flat on your face.",
+     u8"You flip your lid!",
+     u8"$n flips $s lid!",
+     u8"You flip over $S $t.",
+     u8"$n flips over $N's $t.",
+     u8"$n flips over your $t.",
+     u8"You flip over $p.",
+     u8"$n flips over $p."},
+    {u8"You flirt outrageously.",
+     u8"$n flirts outrageously.",
+     u8"You flirt outrageously with $N.",
+     u8"$n flirts outrageously with $N.",
+     u8"$n walks up to you and says, 'Hey baby, can I buy you a drink?'",
+     u8"Sorry, your dearly beloved is not around.",
+     u8"You flirt with yourself.  Must look stupid.",
+     u8"$n thinks $e is the most wonderful person in the world.",
+     u8"You flirt with $S $t.",
+     u8"$n flirts with $N's $t.",
+     u8"$n flirts with your $t.",
+     u8"You flirt with $p.",
+     u8"$n flirts with $p."},
+    {u8"You roll around on the floor.",
+     u8"$n rolls around on the floor! Looks like fun, no?",
+     u8"You roll along the floor and then on top of $N!",
+     u8"$n rolls along the floor and then on top of $N!",
+     u8"$n rolls along the floor until $e rolls on top of you!",
+     u8"You can't find them here! Too bad!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You flop to the ground like a sack of potatoes.",
+     u8"$n flops to the floor as if all the bones in $s body have disappeared.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You flutter like a butterfly.",
+     u8"$n flutters like a butterfly.",
+     u8"You flutter your hands in front of $N's face.",
+     u8"$n flutters $s hands in front of $N's face.",
+     u8"$n flutters $s hands in front of your face, uh..hello?",
+     u8"They left before you could flutter at them.",
+     u8"You flutter your hands in front of your face.",
+     u8"$n flutters $s hands in front of $s face.",
+     u8"You flutter your hands at $S $t.",
+     u8"$n flutters $s hands at $N's $t.",
+     u8"$n flutters $s hands at your $t.",
+     u8"You flutter your hands at $p.",
+     u8"$n flutters $s hands at $p."},
+    {u8"You foam at the mouth.",
+     u8"$n foams at the mouth!",
+     u8"You foam at the mouth at the sight of $M!",
+     u8"$n foams at the mouth at the sight of $N.",
+     u8"$n foams at the mouth at the sight of you!",
+     u8"You seem a bit foamy today.",
+     u8"MAD DOG!",
+     u8"$n foams at the mouth like a mad dog! Run away!",
+     u8"Your mouth foams at $S $t.",
+     u8"$n mouth foams at $N's $t.",
+     u8"$n mouth foams at your $s $t.",
+     u8"Your mouth foams at $p.",
+     u8"$n mouth foams at $p."},
+    {u8"Don't be a pervert.",
+     u8"$n is being a pervert.",
+     u8"Don't be a pervert.",
+     u8"$n is being a pervert.",
+     u8"$n is being a pervert.",
+     u8"They left before you could become perverted.",
+     u8"Don't be a pervert.",
+     u8"$n is being a pervert.",
+     u8"Don't be a pervert.",
+     u8"$n is being a pervert.",
+     u8"$n is being a pervert.",
+     u8"Don't be a pervert.",
+     u8"$n is being a pervert."},
+    {u8"Nice going, hotshot.",
+     u8"$n chews on $s foot. What a smart one, eh?",
+     u8"You help $N put $S foot in $S mouth.",
+     u8"$n helps $N put $S foot in $S mouth.",
+     u8"$n helps you put your foot in your mouth.",
+     u8"They must not have wanted you to put their foot in their mouth.",
+     u8"You put your foot in your mouth and begin chewing.",
+     u8"$n puts $s foot in $s mouth and starts chewing.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Who needs to be forgiven?",
+     u8"$n is looking for someone to forgive???",
+     u8"You forgive $M.",
+     u8"$n forgives $N.",
+     u8"$n forgives you.",
+     u8"You try to forgive someone not in the room, but who cares.",
+     u8"You forgive yourself, feel better?",
+     u8"$n forgives $mself!",
+     u8"You forgive $S $t.",
+     u8"$n forgives $N's $t.",
+     u8"$n forgives your $t.",
+     u8"You forgive $p.",
+     u8"$n forgives $p."},
+    {u8"French whom??",
+     u8"$n is looking for something to french!!!",
+     u8"You give $N a long and passionate kiss, it seems to take forever...",
+     u8"$n kisses $N passionately.",
+     u8"$n gives you a long and passionate kiss, it seems to take forever...",
+     u8"Your heart is filled with despair as that person is not here.",
+     u8"You gather yourself in your arms and try to kiss yourself.",
+     u8"$n makes an attempt at kissing $mself.",
+     u8"You kiss $S $t passionately.",
+     u8"$n kisses $N's $t passionately.",
+     u8"$n kisses your $t passionately.",
+     u8"You kiss $p passionately.",
+     u8"$n kisses $p passionately."},
+    {u8"You froth at the mouth.",
+     u8"$n froths at the mouth!",
+     u8"You froth at the mouth at the sight of $M!",
+     u8"$n froths at the mouth at the sight of $N.",
+     u8"$n froths at the mouth at the sight of you!",
+     u8"You seem a bit frothy today.",
+     u8"MAD DOG!",
+     u8"$n froths at the mouth like a mad dog! Run away!",
+     u8"Your mouth froths at $S $t.",
+     u8"$n mouth froths at $N's $t.",
+     u8"$n mouth froths at your $s $t.",
+     u8"Your mouth froths at $p.",
+     u8"$n mouth froths at $p."},
+    {u8"What's bothering you?",
+     u8"$n frowns.",
+     u8"You frown at $M.",
+     u8"$n frowns at $N.",
+     u8"$n frowns at you.",
+     u8"You frown, but who cares.",
+     u8"You frown at yourself, not your own best friend today?",
+     u8"$n frowns at $mself.",
+     u8"You frown at $S $t.",
+     u8"$n frowns at $N's $t.",
+     u8"$n frowns at your $s $t.",
+     u8"You frown at $p.",
+     u8"$n frowns at $p."},
+    {u8"Take it easy now!  Count to ten, very slowly.",
+     u8"$n grits $s teeth and fumes with rage.",
+     u8"You stare at $M, fuming.",
+     u8"$n stares at $N, fuming with rage.",
+     u8"$n stares at you, fuming with rage!",
+     u8"Fume away.. they ain't here.",
+     u8"That's right - hate yourself!",
+     u8"$n clenches $s fists and stomps $s feet, fuming with anger.",
+     u8"You stare at $S $t, fuming with rage.",
+     u8"$n stares at $N's $t, fuming with rage.",
+     u8"$n stares at your $s $t, fuming with rage.",
+     u8"You stare at $p, fuming with rage.",
+     u8"$n stares at $p, fuming with rage."},
+    {u8"You furrow your brow in thought.",
+     u8"$n furrows $s brow in thought.",
+     u8"You furrow your brow at $M.",
+     u8"$n furrows $s brow at $N.",
+     u8"$n furrows $s brow at you.",
+     u8"With furrows so deep, I doubt any one could see you.",
+     u8"You furrow your brow at yourself.",
+     u8"$n furrows $s brow in thought and $mself.",
+     u8"You furrow your brow at $S $t.",
+     u8"$n furrows $s brow at $N's $t.",
+     u8"$n furrows $s brow at your $s $t.",
+     u8"You furrow your brow at $p.",
+     u8"$n furrows $s brow at $p."},
+    {u8"You make a fuss.",
+     u8"$n makes a fuss.",
+     u8"You make a fuss over $M.",
+     u8"$n makes a fuss over $N.",
+     u8"$n makes a fuss over you.",
+     u8"Fussy, fussy!",
+     u8"You make a fuss over yourself.",
+     u8"$n makes a fuss over $mself.",
+     u8"You make a fuss about $S $t.",
+     u8"$n makes a fuss about $N's $t.",
+     u8"$n makes a fuss about your $t.",
+     u8"You make a fuss about $p.",
+     u8"$n makes a fuss about $p."},
+    {u8"Backhand to the left cheek. Shoots.  Scores!",
+     u8"$n backhands a pesky fly.",
+     u8"You backhand $N right in the face.  FWAP!",
+     u8"$n fwaps $N.  Ouch, that really HURT.",
+     u8"$n fwaps you in the face.  Ouch, that really HURT.",
+     u8"Backhand to the right cheek.  BUZZZ.  Missed.",
+     u8"Wham!  You fwap yourself in the face.  Ouch.",
+     u8"$n fwaps $mself in the face.  Ouch, that really HURT.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Gag who??",
+     u8"$n gags in disgust.",
+     u8"You gag $N with one of your dirtiest socks.",
+     u8"$n gags $N with one of $s dirtiest socks.",
+     u8"$n gags you with one of $s dirtiest socks.",
+     u8"Hard to gag someone that isn't here.",
+     u8"You gag yourself with one of your dirtiest socks.",
+     u8"$n gags $mself with one of $s dirtiest socks.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You gasp in astonishment.",
+     u8"$n gasps in astonishment.",
+     u8"You gasp in total astonishment at $M.",
+     u8"$n gasps in astonishment at $N.",
+     u8"$n gasps in utter astonishment at you.",
+     u8"You gasp desperately for air.",
+     u8"You gasp at your own misfortune.",
+     u8"$n seems to gasp at $mself in utter astonishment.",
+     u8"You gasp in astonishment at $S $t.",
+     u8"$n gasps in astonishment at $N's $t.",
+     u8"$n gasps in astonishment at your $s $t.",
+     u8"You gasp in astonishment at $p.",
+     u8"$n gasps in astonishment at $p."},
+    {u8"You gaze blankly into nothingness, not a thought in your head.",
+     u8"$n gazes blankly into nothingness, not a thought in $s head.",
+     u8"You gaze deeply into $S eyes, completely lost.",
+     u8"$n gazes deeply into $N's eyes, completely lost.",
+     u8"$n gazes deeply into your eyes, completely lost.",
+     u8"Where do you want to gaze?",
+     u8"You get cross-eyed, trying to gaze at yourself.",
+     u8"$n gets very cross-eyed.",
+     u8"You gaze at $S $i for a long time.",
+     u8"$n gazes at $N's $i for a long time.",
+     u8"$n gazes at your $i for a long time.",
+     u8"",
+     u8""},
+    {u8"You pull everyone into a group hug.",
+     u8"$n pulls everyone into a group hug.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You start to gibber insanely.",
+     u8"$n gibbers insanely.",
+     u8"You gibber insanely at $N.",
+     u8"$n watches $N and gibbers insanely.",
+     u8"$n watches you and is gibbering insanely.",
+     u8"You gibber in vain, they can't see nor hear you.",
+     u8"You look at yourself and start to gibber like a maniac.",
+     u8"$n looks at $mself and start to gibber like a maniac.",
+     u8"You gibber insanely at $S $t.",
+     u8"$n gibbers insanely at $N's $t.",
+     u8"$n gibbers insanely at your $t.",
+     u8"You gibber insanely at $p.",
+     u8"$n gibbers insanely at $p."},
+    {u8"You giggle.",
+     u8"$n giggles.",
+     u8"You look at $N and break into a fit of giggling.",
+     u8"$n points at $N and begins to giggle uncontrollably.",
+     u8"$n looks at you and giggles, wonder what $e finds so funny.",
+     u8"Well you may see something funny but I don't.",
+     u8"You seem to find yourself very amusing.",
+     u8"$n giggles at $mself.",
+     u8"You giggle at $S $t.",
+     u8"$n giggles at $N's $t.",
+     u8"$n giggles at your $t.",
+     u8"You giggle at $p.",
+     u8"$n giggles at $p."},
+    {u8"You glare at nothing in particular.",
+     u8"$n glares around $m.",
+     u8"You glare icily at $M.",
+     u8"$n glares at $N.",
+     u8"$n glares icily at you, you feel cold to your bones.",
+     u8"You try to glare at somebody who is not present.",
+     u8"You glare icily at your feet, they are suddenly very cold.",
+     u8"$n glares at $s feet, what is bothering $m?",
+     u8"You glare at $S $t.",
+     u8"$n glares at $N's $t.",
+     u8"$n glares at your $t.",
+     u8"You glare at $p.",
+     u8"$n glares at $p."},
+    {u8"You get a mischievous gleam in your eye.",
+     u8"$n gets a mischievous gleam in $s eye.",
+     u8"Your eyes gleam mischievously at $N.",
+     u8"$n's eyes gleam mischievously at $N.",
+     u8"$n's eyes gleam mischievously at you.",
+     u8"Do your eyes still gleam if there's no one around to see it?",
+     u8"Your eyes gleam mischievously at your own thoughts.",
+     u8"$n's eyes gleam mischievously at $s own thoughts.",
+     u8"Your eyes gleam mischievously at $N's $t.",
+     u8"$n's eyes gleam mischievously at $N's $t.",
+     u8"$n's eyes gleam mischievously at your $t.",
+     u8"Your eyes gleam mischievously at $p.",
+     u8"$n's eyes gleam mischievously at $p."},
+    {u8"You wave goodbye to everyone.",
+     u8"$n waves goodbye to everyone.",
+     u8"You wave goodbye to $N.",
+     u8"$n waves goodbye to $N.",
+     u8"$n waves goodbye to you.  Have a good journey.",
+     u8"They didn't wait for you to wave goodbye.",
+     u8"Are you going on adventures as well??",
+     u8"$n waves goodbye to $mself.",
+     u8"You wave goodbye to $S $t.",
+     u8"$n waves goodbye to $N's $t.",
+     u8"$n waves goodbye to your $t.",
+     u8"You wave goodbye to $p.",
+     u8"$n waves goodbye to $p."},
+    {u8"Whom do you want to goose?  Choose carefully.",
+     u8"$n is looking for a tush to goose!!!",
+     u8"You goose $S tush!",
+     u8"$n gooses $N's tush.",
+     u8"$n gooses your tush!",
+     u8"Goose? Mother Goose?",
+     u8"You goose your own tush!",
+     u8"$n gooses $s own tush.",
+     u8"You goose $S $t.",
+     u8"$n gooses $N's $t.",
+     u8"$n gooses your $t.",
+     u8"You goose $p.",
+     u8"$n gooses $p."},
+    {u8"You look around greedily.",
+     u8"$n looks around greedily.",
+     u8"You look at $S purse greedily.",
+     u8"$n looks at $N's purse greedily.",
+     u8"$n looks at your purse greedily.",
+     u8"Your money-lender seems to be out for the moment.",
+     u8"You look greedily at yourself",
+     u8"$n looks at $mself greedily?",
+     u8"You look at $S $t greedily.",
+     u8"$n looks at $N's $t greedily.",
+     u8"$n looks at your $t greedily.",
+     u8"You look at $p greedily.",
+     u8"$n looks at $p greedily."},
+    {u8"You greet everyone.",
+     u8"$n greets everyone.",
+     u8"You raise your hand and greet $M.",
+     u8"$n raises $s hand and greets $N.",
+     u8"$n raises $s hand and greets you.",
+     u8"Please -- try someone who is here?",
+     u8"So, you've finally discovered yourself!",
+     u8"$n greets $mself.. $e always was a strange one.",
+     u8"You greet $S $t.",
+     u8"$n greets $N's $t.",
+     u8"$n greets your $t.",
+     u8"You greet $p.",
+     u8"$n greets $p."},
+    {u8"You grimace in pain.",
+     u8"$n grimaces in pain.",
+     u8"You look at $M and grimace in pain.",
+     u8"$n grimaces at $N.",
+     u8"$n looks at you and grimaces in pain.",
+     u8"Life that bad, huh?",
+     u8"You grimace in pain at yourself... is life that bad?",
+     u8"$n grimaces at $mself.. $e always was a strange one.",
+     u8"You grimace at $S $t.",
+     u8"$n grimaces at $N's $t.",
+     u8"$n grimaces at your $t.",
+     u8"You grimace at $p.",
+     u8"$n grimaces at $p."},
+    {u8"You grin.",
+     u8"$n grins.",
+     u8"You grin at $M.",
+     u8"$n grins at $N.",
+     u8"$n grins at you.",
+     u8"Too bad, they aren't here to grin at.",
+     u8"You grin at yourself.",
+     u8"$n grins at $mself.. must be an inside joke.",
+     u8"You grin at $S $t evilly.",
+     u8"$n grins at $N's $t evilly.",
+     u8"$n grins at your $t evilly.",
+     u8"You grin at $p evilly.",
+     u8"$n grins at $p evilly."},
+    {u8"You groan loudly.",
+     u8"$n groans loudly.",
+     u8"You groan in agony at $M.",
+     u8"$n groans at $N.",
+     u8"$n groans in agony at you.",
+     u8"You groan into the wind.",
+     u8"You groan at what you just said.",
+     u8"$n groans at what $e just said.",
+     u8"You groan at $S $t.",
+     u8"$n groans at $N's $t.",
+     u8"$n groans at your $t.",
+     u8"You groan at $p.",
+     u8"$n groans at $p."},
+    {u8"Whom do you wish to grope??",
+     u8"$n gropes at thin air.",
+     u8"Well, what sort of noise do you expect here?",
+     u8"$n gropes $N.",
+     u8"$n gropes you.",
+     u8"Try someone who's here.",
+     u8"You grope yourself -- YUCK.",
+     u8"$n gropes $mself -- YUCK.",
+     u8"You grope $S $t.",
+     u8"$n gropes $N's $t.",
+     u8"$n gropes your $t.",
+     u8"You grope $p.",
+     u8"$n gropes $p."},
+    {u8"You grovel in the dirt.",
+     u8"$n grovels in the dirt.",
+     u8"You grovel before $M",
+     u8"$n grovels in the dirt before $N.",
+     u8"$n grovels in the dirt before you.",
+     u8"Who do you want to grovel in the dirt for?",
+     u8"That seems a little silly to me.. But, okay!",
+     u8"$n grovels in the dirt at $mself.",
+     u8"You grovel in the dirt before $S $t.",
+     u8"$n grovels in the dirt before $N's $t.",
+     u8"$n grovels in the dirt before your $t.",
+     u8"You grovel in the dirt before $p.",
+     u8"$n grovels in the dirt before $p."},
+    {u8"Grrrrrrrrrr...",
+     u8"$n growls.",
+     u8"You growl at $M.",
+     u8"$n growls menacingly at $N.",
+     u8"$n growls at you threateningly.",
+     u8"Your stomach growls, but no one seems to notice but you.",
+     u8"Grrrrrrrrr...",
+     u8"$n growls softly to $mself.",
+     u8"You growl at $S $t.",
+     u8"$n growls at $N's $t.",
+     u8"$n growls at your $t.",
+     u8"You growl at $p.",
+     u8"$n growls at $p."},
+    {u8"You grumble unhappily.",
+     u8"$n grumbles unhappily.",
+     u8"You grumble at $M.",
+     u8"$n grumbles at $N.",
+     u8"$n grumbles at you.",
+     u8"You should at least grumble at someone nearby.",
+     u8"You grumble unhappily at yourself.",
+     u8"$n grumbles unhappily to $mself.",
+     u8"You grumble unhappily at $S $t.",
+     u8"$n grumbles unhappily $N's $t.",
+     u8"$n grumbles unhappily your $t.",
+     u8"You grumble unhappily $p.",
+     u8"$n grumbles unhappily $p."},
+    {u8"You grunt loudly.",
+     u8"$n grunts at you vigorously!",
+     u8"You grunt vigorously at $M!",
+     u8"$n grunts vigorously at $N!",
+     u8"$n grunts vigorously at you!",
+     u8"Try grunting at a real person.",
+     u8"You grunt at yourself, maybe you should consider professional help...",
+     u8"You fall over with laughter as$n grunts at $mself.",
+     u8"You grunt at $S $t.",
+     u8"$n grunts at $N's $t.",
+     u8"$n grunts at your $t.",
+     u8"You grunt at $p.",
+     u8"$n grunts at $p."},
+    {u8"You whine about your crappy haircut.",
+     u8"$n whines about $s crappy haircut!  Waaaahhh...",
+     u8"You cut a few snips out of $N's hair.",
+     u8"$n cuts a few snips out of $N's hair.",
+     u8"$n cuts a few snips out of your hair.",
+     u8"You can't cut their hair, because they aren't here!",
+     u8"You almost cut your fingers trying to cut your hair.",
+     u8"$n tries to cut $s hair, but almost cuts $s finger instead.",
+     u8"You look at $S $t and think $E could use a little trimming off the top.",
+     u8"$n looks at $N's $t and seems to think it could use a little trimming off the top.",
+     u8"$n looks at your $t and seems to think it could use a little trimming off the top.",
+     u8"You look at $p and think it could use a little trimming off the top.",
+     u8"$n looks at $p and seems to think it could use a little trimming off the top."},
+    {u8"You whip out the ol' halo. That should prove your innocence.",
+     u8"$n loads a halo and dons it.",
+     u8"$N could use a good disguise.",
+     u8"$n loads a halo and gives it to $N.",
+     u8"$n gives you a halo. Apparently you don't look angelic enough.",
+     u8"Too late, that person already made a getaway.",
+     u8"You load a halo and place it on your head.",
+     u8"$n loads a halo and dons it.",
+     u8"You place a halo on $S $t.",
+     u8"$n places a halo on $N's $t.",
+     u8"$n places a halo on your $t.",
+     u8"You place a halo on $p.",
+     u8"$n places a halo on $p."},
+    {u8"You raise your hand - me me me!",
+     u8"$n raises $s hand - me me me!",
+     u8"You raise your hand, trying to get $N's attention?",
+     u8"$n raises $s hand in response to $N.",
+     u8"$n raises $s hand in response to you.",
+     u8"If you raise your hand in an empty room, does anyone see?",
+     u8"You raise your hand... at least that's one of you.",
+     u8"$n raises $s hand to $mself... that makes one.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You look for a hand to shake.",
+     u8"$n is looking for a hand to shake and babies to kiss.",
+     u8"You shake $N's hand.",
+     u8"$n shakes $N's hand.",
+     u8"$n shakes your hand.",
+     u8"They left before you could shake their hand.",
+     u8"You shake your own hand vigorously.",
+     u8"$n shakes $s own hand vigorously.",
+     u8"$n shakes $S $t.",
+     u8"$n shakes $N's $t.",
+     u8"$n shakes your $t.",
+     u8"You shake $p.",
+     u8"$n shakes $p."},
+    {u8"You look happy.",
+     u8"$n looks happy.",
+     u8"You look happily at $M.",
+     u8"$n looks happily at $N.",
+     u8"$n looks happily in your direction.",
+     u8"You need someone to look happy?",
+     u8"You are so happy with yourself.",
+     u8"$n looks happily at $mself.",
+     u8"You look happily at $S $t.",
+     u8"$n looks happily at $N's $t.",
+     u8"$n looks happily at your $t.",
+     u8"You look happily at $p.",
+     u8"$n looks happily at $p."},
+    {u8"Take it easy now!  Count to ten, very slowly.",
+     u8"$n's eyes burn with hatred.",
+     u8"You stare at $M, your eyes trying to burn through $S skull.",
+     u8"$n stares at $N, $s eyes burning with hatred.",
+     u8"$n stares at you, $s eyes burning with hatred.",
+     u8"Hate away.. they ain't here.",
+     u8"That's right - hate yourself!",
+     u8"$n clenches $s fists and stomps $s feet, hating $mself.",
+     u8"You stare at $S $t with hatred.",
+     u8"$n stares at $N's $t with hatred.",
+     u8"$n stares at your $s $t with hatred.",
+     u8"You stare at $p with hatred.",
+     u8"$n stares at $p with hatred."},
+    {u8"You rub your aching temples.",
+     u8"$n rubs $s aching temples.",
+     u8"You rub your aching temples, indicating that $N is giving you a headache.",
+     u8"$n rubs $s aching temples, indicating that $N is giving $m a headache.",
+     u8"$n rubs $s aching temples, indicating that you are giving $m a headache.",
+     u8"That person gives you a headache even when they're not here.",
+     u8"You're giving yourself a headache.",
+     u8"$n gives $mself a headache.",
+     u8"You rub your aching temples, indicating that $N's $t is giving you a headache.",
+     u8"$n rubs $s aching temples, indicating that $N's $t is giving $m a headache.",
+     u8"$n rubs $s aching temples, indicating that your $t is giving $m a headache.",
+     u8"You rub your aching temples, indicating that $p is giving you a headache.",
+     u8"$n rubs $s aching temples, indicating that $p is giving $m a headache."},
+    {u8"You heh. Heh, heh, heh.",
+     u8"$n hehs. Heh, heh, heh!",
+     u8"You heh at $M. Heh, heh, heh.",
+     u8"$n hehs at $N. Heh, heh, heh.",
+     u8"$n hehs at you. Heh heh!",
+     u8"You heh at someone no longer around.",
+     u8"You heh at yourself. Silly you!",
+     u8"$n hehs at $mself. So silly!",
+     u8"You heh at $S $t. Heh, heh, heh.",
+     u8"$n hehs at $N's $t. Heh, heh!",
+     u8"$n hehs at your $t. Heh heh!",
+     u8"You heh at $p. Heh, heh!",
+     u8"$n hehs at $p. Heh, heh!"},
+    {u8"*HIC*",
+     u8"$n hiccups.",
+     u8"You hiccup in $S face.",
+     u8"$n hiccups in $N's face.",
+     u8"$n hiccups in your face.",
+     u8"Hiccupping in someone's face is not polite.",
+     u8"You try to stifle some hiccups.",
+     u8"$n's hiccups uncontrollably.",
+     u8"You look at $S $t and hiccup at it.",
+     u8"$n looks at $N's $t and hiccups at it.",
+     u8"$n looks at your $t and hiccups at it.",
+     u8"You look at $p and hiccups at it.",
+     u8"$n looks at $p and hiccups at it."},
+    {u8"Whom do you wish to highfive?",
+     u8"$n is looking for someone to highfive.",
+     u8"You leap up and highfive $M.",
+     u8"$n leaps up and highfives $N.",
+     u8"$n leaps up and highfives you.",
+     u8"Sky me, baby!",
+     u8"You try to give yourself a highfive.",
+     u8"$n's attempts to give $mself a highfive.",
+     u8"You attempt to give $S $t a highfive.",
+     u8"$n attempts to give $N's $t a highfive.",
+     u8"$n attempts to give your $t a highfive.",
+     u8"You attempt to give $p a highfive.",
+     u8"$n attempts to give $p a highfive."},
+    {u8"You hiss, trying to look menacing.",
+     u8"$n hisses, making your neck hairs stand on end!",
+     u8"You hiss at $N, trying to scare $M.",
+     u8"$n hisses at $N.",
+     u8"$n hisses at you! Maybe $e wants to start a fight?",
+     u8"Who are you hissing at?",
+     u8"You cross your eyes and hiss at yourself, getting even more pissed!",
+     u8"$n crosses $s eyes and hisses at $mself!",
+     u8"You hiss at $S $t.",
+     u8"$n hisses at $N's $t.",
+     u8"$n hisses at your $t.",
+     u8"You hiss at $p.",
+     u8"$n hisses at $p."},
+    {u8"Hmmmmm.",
+     u8"$n seems to think about it for a while, and then goes hmm.",
+     u8"You go hmmmmm over what $E just said.",
+     u8"$n goes hmmmmm over $N's words.",
+     u8"$n goes hmmmmm your words.",
+     u8"They left you!",
+     u8"You go hmmm.",
+     u8"$n goes hmmmm.",
+     u8"You look at $S $t and go hmmmmmm.",
+     u8"$n looks at $N's $t and goes hmmmmmm.",
+     u8"$n looks at your $t and goes hmmmmmm.",
+     u8"You look at $p and go hmmmmmm.",
+     u8"$n looks at $p and goes hmmmmmm."},
+    {u8"You pick up a big honeypot, mmm.",
+     u8"$n picks up a big honeypot, mmm.",
+     u8"You hand $N a big honeypot.",
+     u8"$n hands $N a big honeypot.",
+     u8"$n hands you a big honeypot.",
+     u8"Guess you've got it all to yourself.",
+     u8"You pick up a big honeypot and stick your paws in for a taste.",
+     u8"$n picks up a big honeypot and sticks $s paws in for a taste.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You hop about on one foot",
+     u8"$n hops about looking anxious.",
+     u8"You hop around merrily with $M.",
+     u8"$n hops around merrily with $N.",
+     u8"$n hops around merrily with you.",
+     u8"Hard to play `Leap-Frog' when no one is around.",
+     u8"You hop around yourself. What are you? A frog, right?",
+     u8"$n hops around $mself.",
+     u8"You hop over $S $t.",
+     u8"$n hops over $N's $t.",
+     u8"$n hops over your $t.",
+     u8"You hop over $p.",
+     u8"$n hops over $p."},
+    {u8"Whom do you wish to give a hotfoot?",
+     u8"$n is looking for someone to give a hotfoot.",
+     u8"You light a match and give $M a hotfoot!",
+     u8"$n lights a match and gives $N a hotfoot!",
+     u8"$n lights a match and gives you a hotfoot!",
+     u8"They are already hotfooting it away from you.",
+     u8"You light a match and gives yourself a hotfoot!",
+     u8"$n lights a match and gives $mself a hotfoot!",
+     u8"You give $S $t a hotfoot?",
+     u8"$n gives $N's $t a hotfoot?",
+     u8"$n gives your $t a hotfoot?",
+     u8"You give $p a hotfoot?",
+     u8"$n gives $p a hotfoot?"},
+    {u8"AWWWWROOOOO!",
+     u8"$n howls at the moon.",
+     u8"You howl at $M.",
+     u8"$n howls at $N.",
+     u8"$n howls at you.",
+     u8"Full moon tonight, eh?",
+     u8"You howl at yourself.",
+     u8"$n howls at $mself!",
+     u8"You howl at $S $t.",
+     u8"$n howls at $N's $t.",
+     u8"$n howls at your $t.",
+     u8"You howl at $p.",
+     u8"$n howls at $p."},
+    {u8"Hrmph.",
+     u8"$n goes hrmph.",
+     u8"You goe hrmph over what $E just said.",
+     u8"$n goes hrmph over $N's words.",
+     u8"$n goes hrmph your words.",
+     u8"They left before you could hrmph them.",
+     u8"You go hrmph at yourself.",
+     u8"$n goes hrmph at $mself.",
+     u8"You look at $S $t and go hrmph.",
+     u8"$n looks at $N's $t and goes hrmph.",
+     u8"$n looks at your $t and goes hrmph.",
+     u8"You look at $p and go hrmph.",
+     u8"$n looks at $p and goes hrmph."},
+    {u8"Hug who?",
+     u8"$n is looking for someone to hug.",
+     u8"You hug $M.",
+     u8"$n hugs $N.",
+     u8"$n hugs you.",
+     u8"Sorry, friend, I can't see that person here.",
+     u8"You hug yourself.",
+     u8"$n hugs $mself.",
+     u8"You hug $S $t.",
+     u8"$n hugs $N's $t.",
+     u8"$n hugs your $t.",
+     u8"You hug $p.",
+     u8"$n hugs $p."},
+    {u8"Who do you want to huggle?",
+     u8"",
+     u8"You huggle $M, sending them to the ground.",
+     u8"$n tackle hugs $N to the ground.",
+     u8"$n huggles you to the ground!",
+     u8"You can't huggle someone who doesn't exit you know.",
+     u8"You huggle yourself, nobody loves you!",
+     u8"$n huggles $mself, nobody loves $m!",
+     u8"You wrap your arms around $M and huggle $S $t.",
+     u8"$n wraps $s arms around $N and huggles $S $t.",
+     u8"$n wraps $s arms around you and huggles your $t.",
+     u8"",
+     u8""},
+    {u8"You put on a grass skirt and start to hula dance.",
+     u8"$n puts on a grass skirt and starts to hula dance.",
+     u8"You put on a grass skirt and hula dance with $M.",
+     u8"$n puts on a grass skirt and hula dances with $N.",
+     u8"$n puts on a grass skirt and hula dances with you.",
+     u8"Who do you want to hula dance with?",
+     u8"You put on a grass skirt and start to hula dance.",
+     u8"$n puts on a grass skirt and starts to hula dance.",
+     u8"You put on a grass skirt and start to hula dance with $S $t.",
+     u8"$n puts on a grass skirt and hula dances with $N's $t.",
+     u8"$n puts on a grass skirt and hula dances with your $t.",
+     u8"You put on a grass skirt and hula dance with $p.",
+     u8"$n puts on a grass skirt and hula dances with $p."},
+    {u8"You hum.",
+     u8"$n hums.",
+     u8"You hum an annoying little tune in $M's ear.",
+     u8"$n hums in $N's ear.",
+     u8"$n hums an annoying little tune in your ear.",
+     u8"Humming is so very much fun, no?",
+     u8"You hum to yourself.",
+     u8"$n hums to $mself.",
+     u8"You hum at $S $t.",
+     u8"$n hums at $N's $t.",
+     u8"$n hums at your $t.",
+     u8"You hum at $p.",
+     u8"$n hums at $p."},
+    {u8"You make an agitated statement, 'Humans! Bah..'",
+     u8"'Humans! Bah...' blurts out $n.",
+     u8"You point at $N and blurt out, 'Humans! Bah..'",
+     u8"$n points at $N and blurts out, 'Humans! Bah...'",
+     u8"$n points at you and blurts out, 'Humans!  Bah...'",
+     u8"You don't see them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You hush.",
+     u8"$n hushes.",
+     u8"You try to hush $M.",
+     u8"$n tries to hush $N.",
+     u8"$n tries to hush you.",
+     u8"Whom do you wish to hush?",
+     u8"You hush yourself.",
+     u8"$n hushes $mself.",
+     u8"You hush $S $t.",
+     u8"$n hushes $N's $t.",
+     u8"$n hushes your $t.",
+     u8"You hush $p.",
+     u8"$n hushes $p."},
+    {u8"You hustle along.",
+     u8"$n hustles along.",
+     u8"You hustle past $M.",
+     u8"$n hustles past $N.",
+     u8"$n hustles past you.",
+     u8"Do the Hustle!",
+     u8"You do the Hustle!",
+     u8"$n does the Hustle!",
+     u8"You tell $S $t to hustle.",
+     u8"$n tells $N's $t to hustle.",
+     u8"$n tells your $t to hustle.",
+     u8"You tell $p to hustle.",
+     u8"$n tell $p to hustle."},
+    {u8"You give a resounding, HUZZAH!",
+     u8"$n huzzahs!",
+     u8"You huzzah $M!",
+     u8"$n huzzahs $N.",
+     u8"$n huzzahs you!",
+     u8"Hmmm?",
+     u8"You give a resounding, HUZZAH! at yourself.",
+     u8"$n gives a resounding, HUZZAH! at $mself.",
+     u8"You HUZZAH at $S $t.",
+     u8"$n HUZZAHS at $N's $t.",
+     u8"$n HUZZAHS at your $t.",
+     u8"You HUZZAH at $p.",
+     u8"$n HUZZAHS at $p."},
+    {u8"You clutch your sides, doubling over with laughter.",
+     u8"$n clutches $s sides, doubling over with laughter.",
+     u8"You clutch your sides, doubling over with laughter at $N.",
+     u8"$n clutches $s sides, doubling over with laughter at $N.",
+     u8"$n clutches $s sides, doubling over with laughter at you.",
+     u8"Hmm they're not here. Hallucinating again?",
+     u8"You clutch your sides, doubling over with laughter at yourself.",
+     u8"$n clutches $s sides, doubling over with laughter at $mself.",
+     u8"You clutch your sides, doubling over with laughter at $N's $t.",
+     u8"$n clutches $s sides, doubling over with laughter at $N's $t.",
+     u8"$n clutches $s sides, doubling over with laughter at your $t.",
+     u8"You clutch your sides, doubling over with laughter at $p.",
+     u8"$n clutches $s sides, doubling over with laughter at $p."},
+    {u8"You ignore everyone.",
+     u8"$n ignores everyone, how rude!",
+     u8"You ignore $M.",
+     u8"$n ignores $N.",
+     u8"$n turns $s back towards you.",
+     u8"Who did you want to ignore?",
+     u8"You can't ignore yourself!",
+     u8"You watch as $n ignores $mself.",
+     u8"You try to ignore $S $t.",
+     u8"$n tries to ignore $N's $t.",
+     u8"$n tries to ignore your $t.",
+     u8"You try to ignore $p.",
+     u8"$n tries to ignore $p."},
+    {u8"You do your best to look innocent....I don't think they're buying it.",
+     u8"$n bats $s eyelashes and smiles innocently.",
+     u8"You give $N an innocent glance, wonder if they're catching on...",
+     u8"$n gives $N an innocent glance... what is $e up to?",
+     u8"$n gives you an innocent glance... what could $e be up to?",
+     u8"You don't seem that innocent to me.",
+     u8"You look innocently at yourself.",
+     u8"$n looks innocently at $mself.",
+     u8"You look innocently at $S $t.",
+     u8"$n looks innocently at $N's $t.",
+     u8"$n looks innocently at your $t.",
+     u8"You look innocently at $p.",
+     u8"$n looks innocently at $p."},
+    {u8"You always were a bit daft.",
+     u8"$n is insane!",
+     u8"You think $E is insane.",
+     u8"$n thinks $N is insane.",
+     u8"$n thinks you are insane.",
+     u8"You think someone is insane? You're right.",
+     u8"You become even more insane than you already were.",
+     u8"$n is losing $s sanity.",
+     u8"You look at $S $t and declare it insane.",
+     u8"$n looks at $N's $t and declares it insane.",
+     u8"$n looks at your $t and declares it insane.",
+     u8"You look at $p and declare it insane.",
+     u8"$n looks at $p and declares it insane."},
+    {u8"Go to bed this instant!",
+     u8"Someone tell $n to quit and go to sleep.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Your jaw drops to the ground in disbelief.",
+     u8"$n's jaw drops to the ground in disbelief.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You jeer at the world in general.",
+     u8"$n seems upset with the world.",
+     u8"You jeer $M.",
+     u8"$n jeers at $N, how cruel.",
+     u8"$n jeers at you in an insulting and hurtful way.",
+     u8"Hmmm wonder where they went?",
+     u8"You laugh at your own inadequacies.",
+     u8"$n succeeds in making a fool of $mself.",
+     u8"You jeer at $S $t.",
+     u8"$n jeers at $N's $t.",
+     u8"$n jeers at your $t.",
+     u8"You jeer at $p.",
+     u8"$n jeers at $p."},
+    {u8"You're only jesting!",
+     u8"$n is only jesting!",
+     u8"You playfully jest with $M.",
+     u8"$n playfully jests with $N.",
+     u8"$n playfully jests with you.",
+     u8"You fool! That person isn't here.",
+     u8"You make a fool of yourself.",
+     u8"$n makes a fool of $mself.",
+     u8"You make fun of $N's $t.",
+     u8"$n makes fun of $N's $t.",
+     u8"$n makes fun of your $t.",
+     u8"",
+     u8""},
+    {u8"This looks like a job for you!",
+     u8"This looks like a job for... $n!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You start to jog in place.",
+     u8"$n starts to jog in place.",
+     u8"You jog around $N in circles!",
+     u8"$n jogs around $N in circles!",
+     u8"$n is jogging around you in circles!",
+     u8"You can't jog around people who aren't here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You whip out a JoInT and get ready to meet the clouds...",
+     u8"$n whips out a JoInT and gets ready to meet the clouds...",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You were only joking!",
+     u8"$n was only joking!",
+     u8"You play a cruel joke on $N!",
+     u8"$n plays a cruel joke on $N!",
+     u8"$n plays a cruel joke on you!",
+     u8"Find someone who actually exists to play a joke on.",
+     u8"You tell yourself a joke. I bet you'd laugh as well, huh?",
+     u8"$n tells $mself a joke... strange.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You begin to juggle.",
+     u8"$n begins to juggle.",
+     u8"You begin juggling with $N.",
+     u8"$n begins juggling with $N.",
+     u8"$n begins juggling with you.",
+     u8"That person is not here to juggle with.",
+     u8"You've only got so many hands.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"You juggle a knife, a flaming torch, a bowling ball, and $p.",
+     u8"$n juggles a knife, a flaming torch, a bowling ball, and $p."},
+    {u8"Isn't there someone you want to kiss?",
+     u8"$n is looking for someone to kiss.",
+     u8"You kiss $M.",
+     u8"$n kisses $N.",
+     u8"$n kisses you.",
+     u8"Never around when required.",
+     u8"All the lonely people :(",
+     u8"Tres bizarre! $n kisses $mself all over $s body.",
+     u8"You kiss $M on $S $t.",
+     u8"$n kisses $N on $S $t.",
+     u8"$n kisses you on your $t.",
+     u8"You kiss $p.",
+     u8"$n kisses $p."},
+    {u8"You kneel.",
+     u8"$n kneels.",
+     u8"You kneel before $M.",
+     u8"$n kneels before $N.",
+     u8"$n kneels before you.",
+     u8"You fall over and bruise your knee.",
+     u8"You kneel before yourself.",
+     u8"$n looks pretty foolish trying kneel before $mself.",
+     u8"You kneel at $S $t",
+     u8"$n kneels at $N's $t.",
+     u8"$n kneels at your $t.",
+     u8"You kneel at $p.",
+     u8"$n kneels at $p."},
+    {u8"Whom do you wish to knight?",
+     u8"$n is looking for someone to knight.",
+     u8"You tap a magical sword on $N's shoulder and knight $M.",
+     u8"$n taps a magical sword on $N's shoulder and knights $M.",
+     u8"$n taps a magical sword on your shoulder and knights you!",
+     u8"You want to knight someone?",
+     u8"You knight yourself, wouldn't your mother be proud.",
+     u8"$n knights $mself, $s mother must be proud.",
+     u8"You knight $S $t",
+     u8"$n knights $N's $t.",
+     u8"$n knights your $t.",
+     u8"You knight $p.",
+     u8"$n knights $p."},
+    {u8"You start to pop your knuckles. Time to kick some ass.",
+     u8"$n starts to pop $s knuckles. $e looks like $e means business!",
+     u8"You feed $N a knuckle sandwich!",
+     u8"$n feeds $N a knuckle sandwich!",
+     u8"$n feeds you a knuckle sandwich! Are you gonna take that???",
+     u8"You can't do that, they arent here!",
+     u8"You crack your knuckles in a cacophonous explosion of joints.",
+     u8"$n cracks $s knuckles. Causing a cacophony of exploding joints.",
+     u8"You knuckle $S $t.",
+     u8"$n knuckles $N's $t.",
+     u8"$n knuckles your $t.",
+     u8"You knuckle $p.",
+     u8"$n knuckle $p."},
+    {u8"You stick your fingers in your ears - LA LA LA!",
+     u8"$n sticks $s fingers in $s ears and shouts LA LA LA!",
+     u8"You stick your fingers in $N's ears and shout LA LA LA!",
+     u8"$n sticks $s fingers in $N's ears and shouts LA LA LA!",
+     u8"$n sticks $s fingers in your ears and shouts LA LA LA!",
+     u8"Maybe you better take your fingers out of your eyes first - they're not here!",
+     u8"You stick your fingers in your ears, can you hear yourself?",
+     u8"$n sticks $s fingers in $s ears and goes LA LA LA!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You know that was lame, but you couldn't help yourself.",
+     u8"$n knows that was lame, but $e couldn't help $mself.",
+     u8"You think $N's comments were really lame.",
+     u8"$n thinks $N's comments were really lame.",
+     u8"$n thinks that was really lame.",
+     u8"You are so lame that they didn't stick around for you to tell them.",
+     u8"You are being lame.",
+     u8"$n is being lame.",
+     u8"You think $N's $t is lame.",
+     u8"$n thinks $N's $t is lame.",
+     u8"$n thinks your $t is lame.",
+     u8"You think $p is lame.",
+     u8"$n thinks $p is lame."},
+    {u8"You laugh.",
+     u8"$n laughs.",
+     u8"You laugh wholeheartedly with $M.",
+     u8"$n laughs wholeheartedly with $N.",
+     u8"$n laughs wholeheartedly with you!",
+     u8"Well you may see something funny but I don't.",
+     u8"You seem to find yourself very amusing.",
+     u8"$n starts laughing at $s own joke.",
+     u8"You laugh at $S $t.",
+     u8"$n laughs at $N's $t.",
+     u8"$n laughs at your $t.",
+     u8"You laugh at $p.",
+     u8"$n laughs at $p."},
+    {u8"You lean against a nearby tree.",
+     u8"$n leans against a nearby tree.",
+     u8"You lean against $N, pressing your body close.",
+     u8"$n leans against $N, pressing $s body close.",
+     u8"$n leans against you, pressing $s body close.",
+     u8"You try to lean on someone but end up on your butt.",
+     u8"That's not even possible!",
+     u8"",
+     u8"You lean against $S $i, pressing your body close.",
+     u8"$n leans against $N's $i, pressing $s body close.",
+     u8"$n leans against your $i, pressing $s body close.",
+     u8"",
+     u8""},
+    {u8"You lick your lips and smile.",
+     u8"$n licks $s lips and smiles.",
+     u8"You lick your lips and look at $M.",
+     u8"$n licks $s lips and looks at $N.",
+     u8"$n licks $s lips and looks at you.",
+     u8"Lick away, nobody's here with that name.",
+     u8"You lick your lips.",
+     u8"$n licks $s lips.",
+     u8"You lick $S $t.",
+     u8"$n licks $N's $t.",
+     u8"$n licks your $t.",
+     u8"You lick $p.",
+     u8"$n licks $p."},
+    {u8"You listen with great attention.",
+     u8"$n listens carefully.",
+     u8"You listen carefully to what $N has to say.",
+     u8"$n pays close attention to $N.",
+     u8"$n listens to what you have to say.",
+     u8"Who you tryin' to listen to stupid? The air???",
+     u8"You listen to yourself talk and start to wonder...",
+     u8"$n listens to $mself talk.",
+     u8"You listen to $S $t.",
+     u8"$n listens to $N's $t.",
+     u8"$n listens to your $t.",
+     u8"You listen to $p.",
+     u8"$n listens to $p."},
+    {u8"You laugh on the floor, rolling.",
+     u8"$n laughs on the floor, rolling.",
+     u8"You laugh on the floor, rolling at $M.",
+     u8"$n laughs on the floor, rolling at $N.",
+     u8"$n laughs on the floor, rolling at you.",
+     u8"You can't laugh at someone who isn't there, that would be silly.",
+     u8"You laugh on the floor, rolling because you know you're silly.",
+     u8"$n laughs on the floor, rolling because $e knows $e's silly.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You laugh out loud.",
+     u8"$n laughs out loud.",
+     u8"You laugh out loud at $M.",
+     u8"$n laughs out loud at $N.",
+     u8"$n laughs out loud at you.",
+     u8"You can't laugh at someone who isn't even here!",
+     u8"You laugh out loud at yourself.",
+     u8"$n laughs out loud at $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You gaze at your surroundings, trying to make out where you are.",
+     u8"$n wanders around in a daze, with a rather clueless face. $e must be lost!",
+     u8"You look at $N, completely lost.",
+     u8"$n stares at $N, completely lost.",
+     u8"$n stares at you, completely lost.",
+     u8"You stare and stare but are still completely lost.",
+     u8"You stare at yourself - but are still completely lost.",
+     u8"$n stares at $mself - $e is completely lost.",
+     u8"You stare at $S $t, completely lost.",
+     u8"$n stares at $N's $t, $e is completely lost.",
+     u8"$n stares at your $t, $e is completely lost.",
+     u8"You stare at $p, completely lost.",
+     u8"$n stares at $p, $e is completely lost."},
+    {u8"You love the whole world.",
+     u8"$n loves everybody in the world.",
+     u8"You tell your true feelings to $N.",
+     u8"$n whispers softly to $N.",
+     u8"$n whispers to you sweet words of love.",
+     u8"Alas, your love is not present...",
+     u8"Well, we already know you love yourself (lucky someone does!)",
+     u8"$n loves $mself, can you believe it?",
+     u8"You love $S $t.",
+     u8"$n loves $N's $t.",
+     u8"$n loves your $t.",
+     u8"You love $p.",
+     u8"$n loves $p."},
+    {u8"You lusty devil you.",
+     u8"$n is lusty.",
+     u8"You lust after $M!",
+     u8"$n lusts after $N.",
+     u8"$n lusts after you!",
+     u8"It's May! It's May! The lusty month of May!",
+     u8"You lust after yourself.",
+     u8"$n lusts after $mself, can you believe it?",
+     u8"You lust after $S $t.",
+     u8"$n lusts after $N's $t.",
+     u8"$n lusts after your $t.",
+     u8"You lust after $p.",
+     u8"$n lusts after $p."},
+    {u8"You are suffering from lag.",
+     u8"$n is lagging.",
+     u8"You lag behind $M.",
+     u8"$n lags behind $N.",
+     u8"$n lags behind you.",
+     u8"The lag doesn't seem that bad for them.",
+     u8"You are really lagged.",
+     u8"$n is really lagged.",
+     u8"You make $S $t lag.",
+     u8"$n makes $N's $t lag.",
+     u8"$n makes your $t lag.",
+     u8"You make $p lag.",
+     u8"$n makes $p lag."},
+    {u8"You look around for someone to mace.",
+     u8"$n pulls out a can of mace and is looking for someone to spray.",
+     u8"You grab your can of mace and douce $N with it.",
+     u8"$n pulls out a can of mace and douces $N's face with it.",
+     u8"$n pulls out a can of mace and douces your face.",
+     u8"They ran away before you could mace them.",
+     u8"You spray a can of mace at yourselves burning your own eyes!",
+     u8"$n sprays $mself with a can of mace. $e immediately breaks down into tears.",
+     u8"You mace $S $t.",
+     u8"$n maces $N's $t.",
+     u8"$n maces your $t.",
+     u8"You mace $p.",
+     u8"$n maces $p."},
+    {u8"You giggle madly.",
+     u8"$n giggles madly...",
+     u8"$n giggles madly at your crazy antics.",
+     u8"$n giggles madly at $N's insane antics.",
+     u8"$n giggles madly at you.",
+     u8"You giggle madly at someone...who isn't here anymore...",
+     u8"You giggle madly at yourself.",
+     u8"$nn is giggling madly at $mself. How strange...",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Who are you trying to makeout with?",
+     u8"$n is looking for someone to makeout with!",
+     u8"You rush up to $N and beg for some action.",
+     u8"$n slides up next to $N and begs for some action.",
+     u8"$n has a wild look in $s eyes. $e looks desperate for some action.",
+     u8"Sorry, looks like you have to makeout with yourself this time.",
+     u8"Makingout with yourself !?!? Talk about lonely....",
+     u8"$n starts running $s hands up and down $s body, what is $e nuts???",
+     u8"You makeout with $S $t.",
+     u8"$n makes out with $N's $t.",
+     u8"$n makes out with your $t.",
+     u8"You makeout with $p.",
+     u8"$n makes out with $p."},
+    {u8"Massage what, thin air?",
+     u8"$n is looking for someone to massage, any volunteers.",
+     u8"You gently massage $N's shoulders.",
+     u8"$n massages $N's shoulders.",
+     u8"$n gently massages your shoulders...ahhhhhhhhhh...",
+     u8"You can only massage someone in the same room as you.",
+     u8"You practice yoga as you try to massage yourself.",
+     u8"$n gives a show on yoga-positions, trying to massage $mself.",
+     u8"You gently massage $S $t.",
+     u8"$n gently massages $N's $t.",
+     u8"$n gently massages your $t....",
+     u8"You gently massage $p.",
+     u8"$n gently massages $p."},
+    {u8"You need medication.",
+     u8"$n is looking for some medication.",
+     u8"You give $N $S daily dose of medications.",
+     u8"$n gives $N $S daily dose of medications.",
+     u8"$n gives you your daily dose of medications.",
+     u8"They left before you get give them their medications.",
+     u8"You gather up all of your medications and swallow it dry.",
+     u8"$n gathers up all of $s medications and swallows it dry.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You meep!",
+     u8"$n meeps!",
+     u8"You meep at $N!",
+     u8"$n meeps at $N!",
+     u8"$n meeps at you!",
+     u8"Your meep goes echoing off the empty walls.",
+     u8"You meep at yourself!",
+     u8"$n meeps at $mself!",
+     u8"You meep at $N's $t!",
+     u8"$n meeps at $N's $t!",
+     u8"$n meeps at your $t!",
+     u8"You meep at $p!",
+     u8"$n meeps at $p!"},
+    {u8"Meeeeooow!",
+     u8"$n meows.",
+     u8"You meow at $M.",
+     u8"$n meows at $N.",
+     u8"$n meows at you.",
+     u8"Full moon tonight, eh?",
+     u8"You meow at yourself.",
+     u8"$n meows at $mself!",
+     u8"You meow at $S $t.",
+     u8"$n meows at $N's $t.",
+     u8"$n meows at your $t.",
+     u8"You meow at $p.",
+     u8"$n meows at $p."},
+    {u8"You tap on the mic and wonder if it is turned on.",
+     u8"$n taps on the Microphone and says \"Is this thing on?\"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You start to moan.",
+     u8"$n starts moaning.",
+     u8"You moan passionately at $M.",
+     u8"$n moans at $N.",
+     u8"$n moans passionately at you.",
+     u8"You moan at the moon.",
+     u8"You moan as if you were your own ghost.",
+     u8"$n moans at $mself.",
+     u8"You moan at $S $t.",
+     u8"$n moans at $N's $t.",
+     u8"$n moans at your $t.",
+     u8"You moan at $p.",
+     u8"$n moans at $p."},
+    {u8"You mock the entire World.",
+     u8"$n mocks the entire World.",
+     u8"You mock $M.",
+     u8"$n mocks $N.",
+     u8"$n mocks you!",
+     u8"Well you may see something worth mocking, but I don't.",
+     u8"You mock yourself.",
+     u8"$n starts mocking $mself.",
+     u8"You mock $S $t.",
+     u8"$n mocks $N's $t.",
+     u8"$n mocks your $t.",
+     u8"You mock $p.",
+     u8"$n mocks $p."},
+    {u8"You strike a pose! \"I wanna be a supermodel!\"",
+     u8"$n poses attractively and models $s fab gear.",
+     u8"You strike your best pose for $M. They seem to maintain neutrality.",
+     u8"$n is posing for $N. I think somebody wants on!",
+     u8"$n appears to be posing for you. $e will do anything to catch your eye won't $e!",
+     u8"Modelling for the wall again? You really need friends.",
+     u8"You pose and proceed to observe yourself. \"Perky!, nice and Perky!\"",
+     u8"$n is modeling for $mself again. WHAT a surprise!",
+     u8"You grab $S $t and model it for $M.",
+     u8"$n grabs $N's $t and models it for $M.",
+     u8"$n grabs your $t and models it for you.",
+     u8"You pose attractively and model $p. It definitely goes with your outfit.",
+     u8"$n poses attractively and models $p. Don't they look gorgeous!"},
+    {u8"You smile modestly, mumbling \"It was nothing really.\"",
+     u8"$n smiles modestly, mumbling \"It was nothing really.\"",
+     u8"You assure $N it was nothing really.",
+     u8"$n assures $N it was nothing really.",
+     u8"$n assures you it was nothing really.",
+     u8"That person is not here to appreciate your modesty.",
+     u8"You don't think you're anything special.",
+     u8"$n doesn't think $e's particularly special.",
+     u8"You don't find $N's $t particularly special.",
+     u8"$n doesn't find $N's $t particularly special.",
+     u8"$n doesn't find your $t particularly special.",
+     u8"You don't find $p particularly special.",
+     u8"$n doesn't find $p particularly special."},
+    {u8"Mooooooooo.",
+     u8"$n moos like a cow.",
+     u8"You moo at $M like a cow.",
+     u8"$n moos at $N like a cow.",
+     u8"$n moos at you like a cow.",
+     u8"Full moon tonight, eh?",
+     u8"You moo at yourself.",
+     u8"$n moos at $mself!",
+     u8"You moo at $S $t like a cow.",
+     u8"$n moos at $N's $t like a cow.",
+     u8"$n moos at your $t like a cow.",
+     u8"You moo at $p like a cow.",
+     u8"$n moos at $p like a cow."},
+    {u8"From whom do you wish to mooch?",
+     u8"$n is looking for someone to mooch off from.",
+     u8"You try to mooch off of $M.",
+     u8"$n tries to mooch off of $N.",
+     u8"$n is trying to mooch off of you!",
+     u8"Try mooching off of someone.",
+     u8"How? - mooching from yourself rarely works.",
+     u8"$n mooches off of $mself.",
+     u8"You trie to mooch off of $S $t.",
+     u8"$n tries to mooch off of $N's $t.",
+     u8"$n tries to mooch off of your $t.",
+     u8"You trie to mooch off of $p.",
+     u8"$n tries to mooch off of $p."},
+    {u8"You moon the whole world.",
+     u8"$n moons everyone in sight.",
+     u8"You drop your pants and moon $M!",
+     u8"$n drops $s pants and moons $N.",
+     u8"$n drops $s pants and moons you!",
+     u8"Blue Moon... You saw me standing alone...",
+     u8"You moon yourself, impressed?",
+     u8"$n moons $mself, $e has problems.",
+     u8"You moon $S $t.",
+     u8"$n moons $N's $t.",
+     u8"$n moons your $t.",
+     u8"You moon $p.",
+     u8"$n moons $p."},
+    {u8"Aaagh!! I can't stand mortals!!!",
+     u8"$n cries out, 'Aaaagh!! I can't stand mortals!!!'",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You start slam-dancing.  Yeah!",
+     u8"$n starts slam-dancing.  Yeah!",
+     u8"You slam into $N, before proceeding to mosh around the room!",
+     u8"$n slams into $N, then $e continues to mosh around the room!",
+     u8"$n slams into you while $e slam-dances around the room!",
+     u8"Uh, who?  Nope, nobody like that here.",
+     u8"You mosh with yourself.",
+     u8"$n moshes with $mself.",
+     u8"You mosh with $S $t.",
+     u8"$n moshes with $N's $t.",
+     u8"$n moshes with your $t.",
+     u8"You moshes with $p.",
+     u8"$n moshes with $p."},
+    {u8"Muahahaha!",
+     u8"$n demonically chortles, 'Muahahaha!'",
+     u8"Muahahaha! You demonically chortles at $M.",
+     u8"Muahahaha! $n demonically chortles at $N.",
+     u8"Muahahaha! $n demonically chortles at you.",
+     u8"You seem a bit insane, but nothing more.",
+     u8"You tip your head back and insanely chortle, `Muahahaha!'",
+     u8"$n tips $s head back and insanely chortles, `Muahahaha!'",
+     u8"You chortle demonically at $S $t `Muahahaha!'",
+     u8"$n chortles demonically at $N's $t `Muahahaha!'",
+     u8"$n chortles demonically at your $t `Muahahaha!'",
+     u8"You chortle demonically at $p `Muahahaha!'",
+     u8"$n chortles demonically at $p `Muahahaha!'"},
+    {u8"You try to speak but only manage a weak muffle.",
+     u8"$n tries to speak but only manages a weak muffled sound.",
+     u8"You try to muffle $N.",
+     u8"$n tries to muffle $N.",
+     u8"$n tries to muffle you.",
+     u8"They're no longer hre.",
+     u8"You make muffled sounds to yourself.",
+     u8"$n makes some muffled sounds to $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You mumble quietly.",
+     u8"$n mumbles quietly.",
+     u8"You mumble to $M.",
+     u8"$n mumbles to $N.",
+     u8"$n mumbles to you.",
+     u8"That person isn't here to mumble to.",
+     u8"You mumble to yourself.",
+     u8"$n mumbles to $mself.",
+     u8"You mumble into $N's $t.",
+     u8"$n mumbles into $N's $t.",
+     u8"$n mumbles into your $t.",
+     u8"You mumble at $p.",
+     u8"$n mumbles at $p."},
+    {u8"Who's hair do you want to muss up?",
+     u8"$n is looking for someone's hair to muss.",
+     u8"You walk up to $N and muss up $S hair.",
+     u8"$n walks up to $N and musses up $S hair till it is in knots.",
+     u8"$n walks up to you and musses up your hair, you will never get those knots out now!",
+     u8"Sorry, they aren't here.",
+     u8"You pull your hair in frustration.",
+     u8"$n pulls $m hair in frustration.",
+     u8"You muss up $S $t.",
+     u8"$n musses up $N's $t.",
+     u8"$n musses up your $t.",
+     u8"You muss up $p.",
+     u8"$n musses up $p."},
+    {u8"You mutter quietly under your breath.",
+     u8"$n mutters quietly under $s breath.",
+     u8"You mutter something at $M.",
+     u8"$n mutters something at $N.",
+     u8"$n mutters something at you.",
+     u8"If you mutter, how will anyone hear you?",
+     u8"You mutter quietly to yourself.",
+     u8"$n mutters quietly to $mself.",
+     u8"You mutter at $S $t.",
+     u8"$n mutters at $N's $t.",
+     u8"$n mutters at your $t.",
+     u8"You mutter at $p.",
+     u8"$n mutters at $p."},
+    {u8"You file your nails with a glazed look.",
+     u8"$n files $s nails with a glazed look.",
+     u8"You file your nails with a glazed look, obviously impressed with $N.",
+     u8"$n files $s nails with a glazed look, obviously impressed by $N.",
+     u8"$n files $s nails with a glazed look, obviously you made an impression.",
+     u8"You file your nails, but noone is around to admire!",
+     u8"You file your nails, utterly bored with yourself.",
+     u8"$n files $s nails, utterly bored with $mself.",
+     u8"You take a glance at $N's $t and start filing your nails, obviously impressed.",
+     u8"$n takes a glance at $N's $t and starts filing $s nails, obviously impressed.",
+     u8"$n takes a glance at your $t and starts filing $s nails, obviously impressed.",
+     u8"You take a glance at $p and start filing your nails, obviously impressed.",
+     u8"$n takes a glance at $p and starts filing $s nails, obviously impressed."},
+    {u8"You whip out a surgical needle and glance around, looking for an arm to stab!",
+     u8"$n whips out a surgical needle and glances around, looking for an arm to stab.",
+     u8"You whip out a surgical needle, glare at $N and laugh maniacally.",
+     u8"$n whips out a surgical needle, glares at $N and laughs maniacally.",
+     u8"$n whips out a surgical needle, glares at you and laughs maniacally.",
+     u8"You can't stab someone who isn't there!",
+     u8"You whip out a surgical needle and carefully withdraw some blood from your arm.",
+     u8"$n whips out a surgical needle and carefully withdraws some blood from $s arm.",
+     u8"You whip out a surgical needle and frantically stab $N's $t.",
+     u8"$n whips out a surgical needle and frantically stabs $N's $t.",
+     u8"$n whips out a surgical needle and frantically stabs your $t.",
+     u8"",
+     u8""},
+    {u8"You suddenly understand.",
+     u8"A lightbulb clicks on over $n's head.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Nibble on who?",
+     u8"$n seems to be getting hungry.",
+     u8"You nibble on $N's ear.",
+     u8"$n nibbles on $N's ear.",
+     u8"$n nibbles on your ear.",
+     u8"Sorry, not here, better go back to dreaming about it.",
+     u8"You nibble on your OWN ear???????????????????",
+     u8"$n nibbles on $s OWN ear (I wonder how it is done!!).",
+     u8"You nibble lightly on $S $t.",
+     u8"$n nibbles lightly on $N's $t.",
+     u8"$n nibbles lightly on your $t.",
+     u8"You nibble on $p.",
+     u8"$n nibbles on $p."},
+    {u8"You bid everyone a good night.",
+     u8"$n bids everyone a good night.",
+     u8"You bid $M a good night.",
+     u8"$n bids $N a good night.",
+     u8"$n bids you a good night, sleep well!",
+     u8"They've gone to bed before you!",
+     u8"You bid yourself a good night, noone else seems to care!",
+     u8"$n bid $mself a good night, how lonely!",
+     u8"You bend down and bid $S $t a good night.",
+     u8"$n bends down and bids $N's $t a good night.",
+     u8"$n bends down and bids your $t a good night.",
+     u8"",
+     u8""},
+    {u8"You nod your head.",
+     u8"$n nods $s head.",
+     u8"You nod at $N.",
+     u8"$n nods at $N.",
+     u8"$n nods at you.",
+     u8"They aren't here.",
+     u8"You nod reassuringly to yourself.",
+     u8"$n nods reassuringly to $mself.",
+     u8"You nod at $M $t.",
+     u8"$n nods at $N's $t.",
+     u8"$n nods at your $t.",
+     u8"You nod at $p.",
+     u8"$n nods at $p."},
+    {u8"You chant \"say no to drugs.\"",
+     u8"$n says no to drugs.",
+     u8"You tell $N to say no to drugs.",
+     u8"$n tells $N to say no to drugs.",
+     u8"$n reminds you to say no to drugs.",
+     u8"They didn't stick around.",
+     u8"You remind yourself once again to say no to drugs.",
+     u8"$n reminds $mself to say no to drugs.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"@yYou wag your finger, shouting, '@gNo@G! @gNo@G!@y'@n",
+     u8"@y$n wags $s finger, shouting, '@gNo@G! @gNo@G!@y'@n",
+     u8"@yYou wag your finger at $N, shouting '@gNo@G! @gNo@G!@y'@n",
+     u8"@y$n wags $s finger at $N, shouting '@gNo@G! @gNo@G!@y'@n",
+     u8"@y$n wags $s finger at you like your momma would, shouting, '@gNo@G! @gNo@G!'@n",
+     u8"@yWho are you trying to scold?@n",
+     u8"@yYou mutter to yourself, '@gNo@G! @gNo@G!@y'@n",
+     u8"@yWhat's $n muttering about?@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Whom do you wish to noogie?",
+     u8"Run! $n is looking for someone to Noogie.",
+     u8"You give $M a noogie!",
+     u8"$n noogies $N.",
+     u8"$n gives you a noogie!",
+     u8"Such childish behavior and no one real to play with.",
+     u8"You give yourself a big noogie. Ouch!",
+     u8"$n gives $mself a big noogie!",
+     u8"You give $M $t a noogie.",
+     u8"$n gives $N's $t a noogie.",
+     u8"$n gives your $t a noogie.",
+     u8"You give $p a noogie.",
+     u8"$n gives $p a noogie."},
+    {u8"Nudge?  Nudge???  The HELL you say!!!!",
+     u8"$n nudges everyone in the room suggestively.",
+     u8"You nudge $M with your elbow.",
+     u8"$n nudges $N suggestively with $s elbow.",
+     u8"$n nudges you suggestively.  You two have an understanding.",
+     u8"Eh?  That person isn't here, you know.",
+     u8"Well, just nudge yourself, but how do you get your elbow in that position?",
+     u8"$n nudges $mself with $s elbows, making $m look like a large chicken.",
+     u8"You give $M $t a nudge.",
+     u8"$n gives $N's $t a nudge.",
+     u8"$n gives your $t a nudge.",
+     u8"You give $p a nudge.",
+     u8"$n gives $p a nudge."},
+    {u8"Nuzzle who??",
+     u8"$n is looking for someone to nuzzle.",
+     u8"You nuzzle $S neck softly.",
+     u8"$n softly nuzzles $N's neck.",
+     u8"$n softly nuzzles your neck.",
+     u8"No.. they aren't here..",
+     u8"I'm sorry, friend, but that's impossible.",
+     u8"$n tries to nuzzle $mself?",
+     u8"You nuzzle $N's $t.",
+     u8"$n nuzzles $N's $t.",
+     u8"$n nuzzles your $t.",
+     u8"You nuzzle $p.",
+     u8"$n nuzzles $p."},
+    {u8"Nyuk, nyuk, nyuk!",
+     u8"$n goes 'Nyuk, nyuk, nyuk!'",
+     u8"You poke at $S eyes and go 'nyuk, nyuk, nyuk!'",
+     u8"$n pokes at $N's eyes and goes 'nyuk, nyuk, nyuk!",
+     u8"$n pokes at your eyes and goes 'nyuk, nyuk, nyuk!",
+     u8"Oh? A wise guy, huh?",
+     u8"You look at yourself and go 'Nyuk, nyuk, nyuk!'",
+     u8"$n looks at $mself and goes 'Nyuk, nyuk, nyuk!'",
+     u8"You look at $S $t and go 'Nyuk, nyuk, nyuk!'",
+     u8"$n looks atat $N's $t and goes 'Nyuk, nyuk, nyuk!'",
+     u8"$n looks at your $t and goes 'Nyuk, nyuk, nyuk!'",
+     u8"You look at $p and go 'Nyuk, nyuk, nyuk!'",
+     u8"$n looks at $p and goes 'Nyuk, nyuk, nyuk!'"},
+    {u8"At whom do you wish to ogle?",
+     u8"$n is looking for someone to ogle at.",
+     u8"You amorously ogle $M.",
+     u8"$n amorously ogles $N.",
+     u8"$n is amorously ogling you.",
+     u8"Who do you love?",
+     u8"You ogle yourself amorously.",
+     u8"$n ogles at $mself, talk about conceited?",
+     u8"You ogle at $M $t amorously.",
+     u8"$n ogles at $N's $t amorously.",
+     u8"$n ogles at your $t amorously.",
+     u8"You ogle at $p amorously.",
+     u8"$n ogles at $p amorously."},
+    {u8"You give out a little, 'Oh..'",
+     u8"$n gives out a little, 'Oh..'",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You let out a big, 'OK!'",
+     u8"$n lets out a big, 'OK!'",
+     u8"You nod towards $N and let out a big, 'OK!'",
+     u8"$n nods towards $N and lets out a big, 'OK!'",
+     u8"$n nods towards you and lets out a big, 'OK!'",
+     u8"You can't find them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"'Orcs...' you patronize.",
+     u8"'Orcs...' patronizes $n.",
+     u8"You motion towards $N saying, 'Orcs...' patronizingly.",
+     u8"$n motions towards $N saying, 'Orcs...' patronizingly.",
+     u8"$n motions towards you saying, 'Orcs...' patronizingly.",
+     u8"You can't find them to patronize.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You say ouch.",
+     u8"$n says ouch.",
+     u8"You look at $M and say ouch.",
+     u8"$n looks at $N and says ouch.",
+     u8"$n looks at you and says ouch.",
+     u8"I don't see anyone by that name here..?",
+     u8"You look at yourself and say ouch.",
+     u8"$n looks at $mself and says ouch, how strange.",
+     u8"You look at $S $t and say ouch.",
+     u8"$n looks at $N's $t and says ouch.",
+     u8"$n looks at your $t and says ouch.",
+     u8"You look at $p and say ouch.",
+     u8"$n looks at $p and says ouch."},
+    {u8"Pat who??",
+     u8"$n is looking for someone to pet.",
+     u8"You pat $N on $S head.",
+     u8"$n pats $N on $S head.",
+     u8"$n pats you on your head.",
+     u8"Who, where, what??",
+     u8"You pat yourself on your head, very reassuring.",
+     u8"$n pats $mself on the head.",
+     u8"You pat $M on $S $t.",
+     u8"$n pats $N on $S $t.",
+     u8"$n pats you on your $t.",
+     u8"You pat $p.",
+     u8"$n pats $p."},
+    {u8"You pace the floor.",
+     u8"$n paces the floor, wearing a rut in it.",
+     u8"You pace in front of $N.",
+     u8"$n paces in front of $N.",
+     u8"$n paces in front of you.",
+     u8"They left before you could pace in front of them.",
+     u8"You pace back and forth across the room impatiently.",
+     u8"$n paces back and forth across the room impatiently.",
+     u8"You pace in front of $S $t.",
+     u8"$n paces in front of $N's $t.",
+     u8"$n paces in front of your $t.",
+     u8"You pace in front of $p.",
+     u8"$n paces in front of $p."},
+    {u8"The sky is falling! We're all doomed! They're everywhere! Don't panic, don't PANIC!!!",
+     u8"$n starts to panic, $s eyes wide open with fear.",
+     u8"You take one look at $M and start to panic!",
+     u8"$n takes one look at $N and starts to panic!",
+     u8"$n takes one look at you and starts to panic!",
+     u8"Good idea, panic about nothing!",
+     u8"You take one look at yourself and start to panic!",
+     u8"$n takes one look at $mself and starts to panic!",
+     u8"You take one look at $S $t and start to panic.",
+     u8"$n takes one look at $N's $t and starts to panic.",
+     u8"$n takes one look at your $t and starts to panic.",
+     u8"You take one look at $p and start to panic.",
+     u8"$n takes one look at $p and starts to panic."},
+    {u8"You start panting, damn near out of breath.",
+     u8"$n begins panting, $e looks out of breath.",
+     u8"You pant at $N, showing you're out of breath.",
+     u8"$n pants at $N, showing that $e is out of breath.",
+     u8"$n pants at you, showing that $e is out of breath.",
+     u8"They obviously aren't here.",
+     u8"You pant to yourself, not wanting to show how tired you are.",
+     u8"$n quietly pants to $mself, trying to disguise $s tiredness.",
+     u8"You pant on $S $t, drool everywhere.",
+     u8"$n pants on $N's $t, getting drool everywhere.",
+     u8"$n pants on your $t, getting drool everywhere.",
+     u8"You pant on $p, drool everywhere.",
+     u8"$n pants on $p, getting drool all over it."},
+    {u8"Who do you want to give a gentle peck on the cheek?",
+     u8"$n is looking for someone to give a peck on the cheek.",
+     u8"You give $N a gentle peck on the cheek.",
+     u8"$n gives $N a gentle peck on the cheek.",
+     u8"$n gives you a gentle peck on the cheek.",
+     u8"No, I'm afraid not. That person isn't here.",
+     u8"That's not very possible you know?",
+     u8"$n tries to give $mself a peck on the cheek. Failing miserably.",
+     u8"You give $N a gentle peck on $S $t.",
+     u8"$n gives $N a gentle peck on $S $t.",
+     u8"$n gives you a gentle peck on your $t.",
+     u8"",
+     u8""},
+    {u8"You peer around you, uncertain that what you see is actually true.",
+     u8"$n peers around, looking as if $e has trouble seeing everything clearly.",
+     u8"You peer intently at $N.",
+     u8"$n peers intently at $N, what is $e looking for?",
+     u8"$n peers intently at you, what is $e looking for?",
+     u8"Sorry buddy, no one here like that.",
+     u8"You peer at yourself, no small feat.",
+     u8"$n peers at $mself .. no small feat.",
+     u8"You peer intently at $S $t.",
+     u8"$n peers intently at $N's $t.",
+     u8"$n peers intently at your $t.",
+     u8"You peer intently at $p.",
+     u8"$n peers intently at $p."},
+    {u8"Cool down?",
+     u8"$n perspires!",
+     u8"You look at $S and begin to perspire.",
+     u8"$n looks at $N and begins to perspire.",
+     u8"$n looks at you and begins to perspire.",
+     u8"You begin to perspire.",
+     u8"You perspire like a pig and begin to smell like one.",
+     u8"$n is perspiring and is beginning to smell funny.",
+     u8"You perspire on $S $t.",
+     u8"$n perspires on $N's $t.",
+     u8"$n perspires on your $t.",
+     u8"You perspire on $p.",
+     u8"$n perspires on $p."},
+    {u8"What do you want to pet?",
+     u8"$n tries to pet the air.",
+     u8"You pet $M.",
+     u8"$n pets $N.",
+     u8"$n pets you.",
+     u8"You are not in Kansas anymore, pet someone that is near you.",
+     u8"You pet yourself, ummm wouldn't privacy be a good thing.",
+     u8"You see $n pet $mself -- not a pretty sight.",
+     u8"You pet $S $t.",
+     u8"$n pets $N's $t.",
+     u8"$n pets your $t.",
+     u8"You pet $p.",
+     u8"$n pets $p."},
+    {u8"You let out a loud pheew!",
+     u8"$n wipes the sweat off $s brow and exclaims, Phew!",
+     u8"You wipe the sweat off your brow and exclaim, Phew to $M!",
+     u8"$n wipes the sweat off $s brow and exclaims, Phew! to $N.",
+     u8"$n wipes the sweat off $s brow and exclaims, Phew! to you.",
+     u8"You can't exclaim phew to them, they aren't here.",
+     u8"You exclaim phew to yourself.",
+     u8"$n exclaims phew to $mself.",
+     u8"You look at $S $t and exclaim, Phew!",
+     u8"$n looks at $N's $t and exclaims, Phew!",
+     u8"$n looks at your $t and exclaims, Phew!",
+     u8"You relax at the sight of the $p and exclaim, Phew!",
+     u8"$n relaxes at the sight of the $p and exclaims, Phew!"},
+    {u8"You phlegm.",
+     u8"$n phlegms all over the place, making a mess.",
+     u8"You phlegm on $S.",
+     u8"$n phlegms on $N.",
+     u8"$n phlegms on you.",
+     u8"Phlegming on someone is not polite.",
+     u8"You try to phlegm all over yourself.",
+     u8"$n phlegms all over $mself.",
+     u8"You phlegm on $S $t, that is so disgusting.",
+     u8"$n phlegms on $N's $t, how disgusting.",
+     u8"$n phlegms on your $t, all green and slimy.",
+     u8"You phlegm on $p.",
+     u8"$n phlegms on $p."},
+    {u8"You pick your nose.  Gross!",
+     u8"$n picks $s nose. Apparently someone doesn't know any manners.",
+     u8"You pick your nose, unfortunately at the same time as $N glances over at you!",
+     u8"$n picks $s nose right when $N glances over at $m! How unfortunate!",
+     u8"As you glance at $n, they pick their nose!! Ewwww!",
+     u8"You don't see them here.",
+     u8"You pick your nose, hoping noone will notice you.",
+     u8"$n picks $s nose, looking around making sure noone notices.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You get hold of a new, fresh slimy pie and look around for someone who seems hungry...",
+     u8"$n gets hold of a new, fresh slimy pie and looks around for someone who seems hungry...",
+     u8"You toss a pie straight into $N's face, Bwahahahaha!!",
+     u8"$n tosses a pie straight into the face of $N, yuck, goo all over $S face.",
+     u8"You are too late to see $n tossing a pie straight at your face. You try to move, but, no... Cherry flavored goo all over your face!",
+     u8"You can't see that person here, sorry. Aim again. :)",
+     u8"You plant a pie in your face, making a good work to get yourself as messy as possible, after all you like cherry...",
+     u8"$n looks at a pie and suddenly plants it straight in $s own face, whirling it around till it falls into tiny bits and pieces...",
+     u8"You toss a pie straight at $S $t.",
+     u8"$n tosses a pie straight at $N's $t, what a mess.",
+     u8"$n tosses a pie straight at your $t, what a mess, cherry you think.",
+     u8"You toss a pie onto $p.",
+     u8"$n tosses a pie onto $p."},
+    {u8"You yell, 'PILLOW FIGHT!' and wait for the feathers to fly.",
+     u8"$n yells, 'PILLOW FIGHT!'",
+     u8"You whack $N right in the noggin with a pillow.",
+     u8"$n beans $N neatly with a pillow.",
+     u8"You get a mouthful of feathers as $n hits you with a pillow.",
+     u8"Try someone who's here.",
+     u8"You smack yourself with a pillow. Weirdo.",
+     u8"$n smacks $mself with a pillow... okayyy...",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You test the silence by dropping a pin",
+     u8"$n drops a pin.  @RTWAAAAAAAANNNGGGG!@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Whom do you want to pinch?  Choose carefully.",
+     u8"$n is looking for a tush to pinch!!!",
+     u8"You pinch $S tush!",
+     u8"$n pinches $N's tush.",
+     u8"$n pinches your tush!",
+     u8"They ran away before you could pinch them.",
+     u8"You pinch your own tush!",
+     u8"$n pinches $s own tush.",
+     u8"You pinch $S $t.",
+     u8"$n pinches $N's $t.",
+     u8"$n pinches your $t.",
+     u8"You pinch $p.",
+     u8"$n pinches $p."},
+    {u8"You pity the world.",
+     u8"$n is looking for something to pity.",
+     u8"You pity $M, $E is so pathetic.",
+     u8"$n pities $N and everything $E stands for.",
+     u8"$n pities you and everything you stand for.",
+     u8"Hmmmmmmm.....nope, no one by that name here.",
+     u8"You pity yourself.",
+     u8"$n pities $mself to tears.",
+     u8"You pity $S $t.",
+     u8"$n pities $N's $t.",
+     u8"$n pities your $t.",
+     u8"You pity $p.",
+     u8"$n pities $p."},
+    {u8"Who do you want to point at?",
+     u8"$n points in all directions, seemingly confused.",
+     u8"You point at $M.",
+     u8"$n points at $N.",
+     u8"$n points at you.",
+     u8"You must have a VERY long index-finger...",
+     u8"You point at yourself.  Insinuating something?",
+     u8"$n points at $mself, suggesting that the center of matters is $e.",
+     u8"You point at $S $t.",
+     u8"$n points at $N's $t.",
+     u8"$n points at your $t.",
+     u8"You point at $p.",
+     u8"$n points at $p."},
+    {u8"Poke who??",
+     u8"$n seems to be poking around for something.",
+     u8"You poke $M.",
+     u8"$n pokes $N.",
+     u8"$n pokes you.",
+     u8"You can't poke someone who's not here!",
+     u8"You poke yourself in the ribs, feeling very silly.",
+     u8"$n pokes $mself in the ribs, looking very sheepish.",
+     u8"You poke $M in $S $t.",
+     u8"$n pokes $N in $S $t.",
+     u8"$n pokes you in your $t.",
+     u8"You poke at $p.",
+     u8"$n pokes at $p."},
+    {u8"You ponder over matters as they appear to you at this moment.",
+     u8"$n sinks deeply into $s own thoughts.",
+     u8"You ponder over what $E just said.",
+     u8"$n ponders $N's words.",
+     u8"$n ponders your words.",
+     u8"You ponder.",
+     u8"You ponder your very existence.",
+     u8"$n seems to be pondering why $e is even here.",
+     u8"You ponder over $S $t.",
+     u8"$n ponders over $N's $t.",
+     u8"$n ponders over your $t.",
+     u8"You ponder over $p.",
+     u8"$n ponders over $p."},
+    {u8"You fold your arms, tap your temple and utter, 'think, think, think....'",
+     u8"$n folds $s arms, taps $s temple and utters, 'think, think, think....'",
+     u8"You fold your arms and tap your temple, deep in thought about $N.",
+     u8"$n folds $s arms and taps $s temple, deep in thought about $N.",
+     u8"$n folds $s arms and taps $s temple, deep in thought about you.",
+     u8"They're not here, you silly Pooh-bear.",
+     u8"You fold your arms and bite your tongue, deep in thought about yourself.",
+     u8"$n folds $s arms and bites $s tongue, deep in thought about $mself.",
+     u8"You fold your arms and tap your temple, deep in thought about $N's $t.",
+     u8"$n folds $s arms and taps $s temple, deep in thought about $N's $t.",
+     u8"$n folds $s arms and taps $s temple, deep in thought about your $t.",
+     u8"",
+     u8""},
+    {u8"You mischievously get out a pin... POP!",
+     u8"$n mischievously gets out a pin... POP!",
+     u8"You get a pin and poke at $N... POP!",
+     u8"$n gets out a pin and pokes at $N... POP!",
+     u8"$n gets out a pin and pokes at you... POP!",
+     u8"Maybe you should take that pin and drop it. They're not here.",
+     u8"You get a pin and poke yourself... POP!",
+     u8"$n gets out a pin and pokes $mself... POP!",
+     u8"You get a pin and poke at $N's $t... POP!",
+     u8"$n gets out a pin and pokes at $N's $t... POP!",
+     u8"$n gets out a pin and pokes at your $t... POP!",
+     u8"You get out a pin and pokes at $p... POP!",
+     u8"$n gets out a pin and pokes at $p... POP!"},
+    {u8"You pose dramatically.",
+     u8"$n poses dramatically.",
+     u8"You pose before $N; $E seems to be impressed.",
+     u8"$n poses before $N; $E cheers at the drama.",
+     u8"$n poses dramatically at you; You feel honored.",
+     u8"You pose for someone, who seemingly isn't there.",
+     u8"You pose with passion in front of a mirror.",
+     u8"$n poses with passion in front of a mirror.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You go postal!",
+     u8"Run for cover! $n is going postal.",
+     u8"You go postal on $N.",
+     u8"$n goes postal on $N!",
+     u8"$n goes postal on you!",
+     u8"You WANT to go postal on them, but they're not here.",
+     u8"You go postal on yourself in frustration.",
+     u8"$n just went postal on $mself.",
+     u8"You go postal on $S $t.",
+     u8"$n goes postal on $N's $t.",
+     u8"$n goes postal on your $t.",
+     u8"You go postal on $p in frustration.",
+     u8"$n goes postal on $p in frustration."},
+    {u8"You pounce around.",
+     u8"$n pounces around like a cat.",
+     u8"You pounce on $M.",
+     u8"$n pounces on $N, pinning $M to the ground.",
+     u8"$n pounces on you, knocking you down.",
+     u8"They aren't here.",
+     u8"You pounce upon yourself.",
+     u8"$n pounces upon $mself.",
+     u8"You pounce on $S $t.",
+     u8"$n pounces on $N's $t.",
+     u8"$n pounces on your $t.",
+     u8"You pounce on $p.",
+     u8"$n pounces on $p."},
+    {u8"You pound your fist into the wall! You are so mad!",
+     u8"$n pounds $s fist into the wall! Ouch! $e looks mad!",
+     u8"You pound $N into the ground!",
+     u8"$n pounds $N into the ground!",
+     u8"$n pounds you into the ground! Are you gonna take that??",
+     u8"You swing your fist as you pound the air.",
+     u8"You pound yourself.",
+     u8"You watch $N pound $mself in the face.",
+     u8"You pound on $S $t.",
+     u8"$n pounds on $N's $t.",
+     u8"$n pounds on your $t.",
+     u8"You pound on $p.",
+     u8"$n pounds on $p."},
+    {u8"Ah, don't take it so hard.",
+     u8"$n pouts, $s lower lip quivering.",
+     u8"You pout at $N.",
+     u8"$n pouts at $N.",
+     u8"$n pouts at you.",
+     u8"You pout, but no one notices.",
+     u8"You purse your lips and pout.",
+     u8"$n pouts pitifully at $mself.",
+     u8"You pout at $S $t.",
+     u8"$n pouts at $N's $t.",
+     u8"$n pouts at your $t.",
+     u8"You pout at $p.",
+     u8"$n pouts at $p."},
+    {u8"You feel righteous, and maybe a little foolish.",
+     u8"$n begs and grovels to the powers that be.",
+     u8"You crawl in the dust before $M.",
+     u8"$n falls down and grovels in the dirt before $N.",
+     u8"$n kisses the dirt at your feet.",
+     u8"No such person around, your prayers vanish into the endless voids.",
+     u8"Talk about narcissism...",
+     u8"$n performs some strange yoga-exercises and mumbles a prayer to $mself.",
+     u8"You pray to $S $t.",
+     u8"$n prays to $N's $t.",
+     u8"$n prays to your $t.",
+     u8"You pray to $p.",
+     u8"$n prays to $p."},
+    {u8"You are proud and show it.",
+     u8"$n just wants to make $s mommy proud.",
+     u8"You show your heartfelt pride to $M.",
+     u8"$n beams with pride at $N's accomplishments.",
+     u8"$n beams with pride at your accomplishments.",
+     u8"No such person around, your pride vanishes into the endless voids.",
+     u8"You pride yourself in all of your accomplishments.",
+     u8"$n is full of $mself, again.",
+     u8"You are proud of $S $t.",
+     u8"$n is proud of $N's $t.",
+     u8"$n is proud of your $t.",
+     u8"You is proud of $p.",
+     u8"$n is proud of $p."},
+    {u8"Still looking for the special someone, eh?",
+     u8"$n looks around for $s lost love.",
+     u8"You kneel before $N vowing your love asking for $S hand in marriage.",
+     u8"$n kneels before $N vowing $s eternal love and devotion.",
+     u8"$n kneels before you proclaiming $s love for you saying, \"Will you marry me?\"",
+     u8"Who are you proposing to?",
+     u8"Proposing to yourself now? Are you a little desperate?",
+     u8"$n kneels down, gets a funny look on $s face as $e proclaims selflove!",
+     u8"You propose to $S $t.",
+     u8"$n proposes to $N's $t, I hope $E doesn't need that.",
+     u8"$n proposes to your $t, I hope you didn't need that.",
+     u8"You propose to $p.",
+     u8"$n proposes to $p."},
+    {u8"You get out your bottle of prozac.....*sigh* relief.",
+     u8"$n gets out $s bottle of prozac....he looks better??",
+     u8"You hand over a prozac bottle to $N.",
+     u8"$n hands some prozac to $N.",
+     u8"$n hands ya some prozac.....relief. Ahhh...",
+     u8"Nobody here to take your cheap prozac.",
+     u8"AHHHHHHHHHHHHHHHH*sigh*",
+     u8"Apparently, prozac makes $n feel giddy.",
+     u8"You look at $S $t, and offer $M some prozac in sympathy.",
+     u8"$n looks at $N's $t, and offers $M some prozac in sympathy.",
+     u8"$n looks at your $t, and offers $M some prozac in sympathy.",
+     u8"You look at $p, and offer it some prozac in sympathy.",
+     u8"$n looks at $p, and offers it some prozac in sympathy."},
+    {u8"You puke all over.",
+     u8"$n pukes.",
+     u8"You puke on $M.",
+     u8"$n pukes on $N.",
+     u8"$n pukes on your clothes!",
+     u8"Once again?",
+     u8"You puke on yourself.",
+     u8"$n pukes on $s clothes.",
+     u8"You puke on $S $t.",
+     u8"$n pukes on $N's $t.",
+     u8"$n pukes on your $t.",
+     u8"You puke on $p.",
+     u8"$n pukes on $p."},
+    {u8"Who's leg do you want to pull?",
+     u8"",
+     u8"You pull $S leg.",
+     u8"$n pulls $N's leg.",
+     u8"$n pulls your leg.",
+     u8"They're not here!",
+     u8"You pull your own leg.",
+     u8"$n pulls $s own leg.",
+     u8"You pull $S $i.",
+     u8"$n pulls $N's $i.",
+     u8"$n pulls your $i.",
+     u8"You pull at $p.",
+     u8"$n pulls at $p."},
+    {u8"Who do you want to check for a pulse?",
+     u8"$n is looking for someone to check a pulse on.",
+     u8"You check $M's pulse.",
+     u8"$n checks $N for a pulse.",
+     u8"$n checks you for a pulse.",
+     u8"They must have seen you coming.",
+     u8"You check yourself for a pulse.",
+     u8"$n checks $mself for a pulse.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Your eyes brim with tears as you do your most sorrowful puppy eyes.",
+     u8"$n's eyes brim with tears as $e does $s most sorrowful puppy eyes.",
+     u8"Your eyes brim with tears as you look at $N, giving $M your most sorrowful puppy eyes.",
+     u8"$n looks at $N sorrowfully, with big tearful puppy eyes.",
+     u8"$n's eyes brim with tears as $e looks at you with $s most sorrowful puppy eyes.",
+     u8"Your puppy eyes are a wasted effort as that person is not here to fall for them.",
+     u8"You look at yourself tearfully, doing your most sorrowful puppy eyes.",
+     u8"$n looks at $mself sorrowfully, with big tearful puppy eyes.",
+     u8"You look at $N's $t sorrowfully, with big tearful puppy eyes.",
+     u8"$n looks at $N's $t sorrowfully, with big tearful puppy eyes.",
+     u8"$n looks at your $t sorrowfully, with big tearful puppy eyes.",
+     u8"You look at $p sorrowfully, with big tearful puppy eyes.",
+     u8"$n looks at $p sorrowfully, with big tearful puppy eyes."},
+    {u8"Puuuurrrrrrrrrrrrrr.............",
+     u8"$n purrs contentedly.",
+     u8"You purr contentedly at $M.",
+     u8"$n purrs at $N.",
+     u8"$n purrs contentedly at you.",
+     u8"You purr, but no one notices.",
+     u8"You make little purring sounds to yourself.",
+     u8"$n purrs at $mself.",
+     u8"You purr at $S $t.",
+     u8"$n purrs at $N's $t.",
+     u8"$n purrs at your $t.",
+     u8"You purr at $p.",
+     u8"$n purrs at $p."},
+    {u8"You assume the proper position and do a push-up.",
+     u8"$n assumes the proper position and does a push-up.",
+     u8"'Drop and give me 20, bucket-head!' you command $N.",
+     u8"$n shouts out at $N, 'Drop and give me 20, bucket-head!'",
+     u8"$n shouts at you, 'Drop and give me 20, bucket-head!'",
+     u8"You don't see them here.",
+     u8"You do a push-up.",
+     u8"$n does a push-up.",
+     u8"test",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You try to sort all this confusion out.",
+     u8"$n seems puzzled.",
+     u8"$E looks as puzzled as you.",
+     u8"$n gives $N a puzzled look.",
+     u8"$n gives you a puzzled look.",
+     u8"Hmmm wonder where they went?",
+     u8"You attempt to confuse yourself and succeed!!",
+     u8"$n succeeds in confusing $mself.",
+     u8"You puzzle over $S $t.",
+     u8"$n is puzzled by $N's $t.",
+     u8"$n is puzzled by your $t.",
+     u8"You is puzzled by $p.",
+     u8"$n is puzzled by $p."},
+    {u8"You quiver and quake like a bowl of jelly.",
+     u8"$n quivers and quakes like a bowl of jelly.",
+     u8"You eye $N fearfully, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes $N fearfully, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes you fearfully, quivering and quaking like a bowl of jelly.",
+     u8"Trying to keep yourself warm?",
+     u8"You eye yourself, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes $mself, quivering and quaking like a bowl of jelly.",
+     u8"You eye $N's $t fearfully, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes $N's $t fearfully, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes your $t fearfully, quivering and quaking like a bowl of jelly.",
+     u8"You eye $p fearfully, quivering and quaking like a bowl of jelly.",
+     u8"$n eyes $p fearfully, quivering and quaking like a bowl of jelly."},
+    {u8"You let everyone see a whole new R A I N B O W !!",
+     u8"Everyone sees a whole new R A I N B O W !!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You raise your eyebrow at the situation.",
+     u8"$n raises an eyebrow at the situation.",
+     u8"You raise an eyebrow at $N.",
+     u8"$n raises an eyebrow at $N.",
+     u8"$n raises an eyebrow at you.",
+     u8"You can't find them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You must blow a raspberry at someone!",
+     u8"",
+     u8"You blow a raspberry at $N!",
+     u8"$n sticks out $s tongue and blows a raspberry at $N!",
+     u8"$n sticks out $s tongue and blows a raspberry at you!",
+     u8"You don't see them here.",
+     u8"You gotta blow a raspberry at someone ELSE!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Who's demon spirits do you wish to rebuke? You rebuke everything.",
+     u8"$n rebukes everything in the this god forsaken realm.",
+     u8"You wave your hands at $N and rebuke $S demonic spirits!",
+     u8"$n waves $s hands like an idiot, rebuking demons which are clearly not there...",
+     u8"$n slaps you on the head, screaming 'Demonic pumpkin, I rebuke thee!'",
+     u8"That person's demon spirits must have gone somewhere else.",
+     u8"You rebuke your own inner demons!",
+     u8"$n waves $s hands at $mself and screams 'Out, out, Demonic Raisins, I rebuke thee!'",
+     u8"You rebuke $S $t.",
+     u8"$n rebukes $N's $t.",
+     u8"$n rebukes $t.",
+     u8"You rebuke $p.",
+     u8"$n rebukes $p."},
+    {u8"You have to reconnect, be right back!",
+     u8"$n has to reconnect, $e'll be right back!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You kick back and just enjoy the world around you.",
+     u8"$n relaxes and lets out a huge sigh of contentment.",
+     u8"You relax into $N's arms.",
+     u8"$n relaxes into $N's arms.",
+     u8"$n relaxes into your arms.",
+     u8"You can't relax, they are no where to be found.",
+     u8"You relax every muscle in your body.",
+     u8"$n relaxes every muscle in $s body.",
+     u8"You look at $S $t and relax.",
+     u8"$n looks at $N's $t and relaxes.",
+     u8"$n looks at your $t and relaxes.",
+     u8"You relax at the sight of the $p.",
+     u8"$n relaxes at the sight of the $p."},
+    {u8"You sigh in relief.",
+     u8"$n sighs in relief.",
+     u8"You look at $M and sigh in relief.",
+     u8"$n sighs in relief at $N.",
+     u8"$n sighs in relief at you.",
+     u8"You sigh in relief at yourself.",
+     u8"You sighs in relief to yourself.",
+     u8"$n sighs in relief to $mself.",
+     u8"You sigh in relief at $S $t.",
+     u8"$n sighs in relief at $N's $t.",
+     u8"$n sighs in relief at your $t.",
+     u8"You sigh in relief at $p.",
+     u8"$n sighs in relief at $p."},
+    {u8"Oh! Happy Happy, Joy Joy!",
+     u8"$n jumps up and shouts: \"Oh, Happy Happy, Joy Joy!!\"",
+     u8"You turn to $M and shout: \"You eeediot!!\"",
+     u8"$n turns to $N and shouts: \"You eeediot!!\"",
+     u8"$n turns to you and shouts: \"You eeediot!!\"",
+     u8"You eeediot!!!",
+     u8"Oh! Happy Happy, Joy Joy!",
+     u8"$n sniffs $mself and says: \"Sttteeenky!!!\"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Who do you want to give the item to?",
+     u8"$n looks silly trying to pawn things off on people who are not there.",
+     u8"You give $N a revolving door.",
+     u8"$n slaps a revolving door on $Ns back.",
+     u8"$n hands you a revolving door.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You ROAR like a triumphant lion!",
+     u8"$n ROARS like a triumphant lion!",
+     u8"You ROAR aggressively at $N.",
+     u8"$n ROARS aggressively at $N.",
+     u8"$n ROARS aggressively at you.",
+     u8"You ROAR at thin air!... pointless huh?",
+     u8"You ROAR and beat your chest aggressively!",
+     u8"$n ROARS and beats $s chest aggressively!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You roll around on the floor, laughing.",
+     u8"$n rolls around on the floor, laughing.",
+     u8"You fall to the floor and throw yourself back and forth... LAUGHING at their antics.",
+     u8"$n rolls around on the floor laughing at $N's antics.",
+     u8"$n rolls around on the floor laughing at your antics.",
+     u8"You can't... you are rolling around on the floor laughing at their absence.",
+     u8"You start to roll around on the floor laughing at your own antics.",
+     u8"$n rolls around on the floor laughing at $s own antics. Neat, huh?",
+     u8"You collapse on the floor laughing at $S $t.",
+     u8"$n collapses on the floor laughing at $N's $t.",
+     u8"$n collapses on the floor laughing at your $t.",
+     u8"You collapse on the floor laughing at $p.",
+     u8"$n collapses on the floor laughing at $p."},
+    {u8"You roll your eyes in disgust.",
+     u8"$n rolls $s eyes in disgust.",
+     u8"You look at $M and roll your eyes in disgust.",
+     u8"$n looks at $N in contempt and rolls $s eyes in disgust.",
+     u8"$n stares at you and rolls $s eyes in disgust.",
+     u8"Um... who?",
+     u8"You roll your eyes, disgusted with your own incompetence.",
+     u8"$n rolls $s eyes, disgusted with $mself.",
+     u8"You roll your eyes at $S $t in disgust.",
+     u8"$n rolls $s eyes at $N's $t in disgust.",
+     u8"$n rolls $s eyes at your $t in disgust.",
+     u8"You roll your eyes at $p in disgust.",
+     u8"$n rolls $s eyes at $p in disgust."},
+    {u8"You romp around joyfully.",
+     u8"$n romps around joyfully.",
+     u8"You romp joyfully around $N.",
+     u8"$n romps joyfully around $N.",
+     u8"$n romps joyfully around you.",
+     u8"They're not here, you sponge!",
+     u8"You romp around yourself. You feel quite dizzy.",
+     u8"$n romps around $mself and looks quite dizzy.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You whip out a beautiful @R@@@G}---`---,---@n",
+     u8"$n whips out a beautiful @R@@@G}---`---,---@n",
+     u8"You hand $N a @R@@@G}---`---,---@n",
+     u8"$n hands $N a @R@@@G}---@g`@G---@g,@G---@n",
+     u8"$n hands you a @R@@@G}---`---,---@n",
+     u8"The rose drops forlornly to the ground, no one is here.",
+     u8"You hand yourself a @R@@@G}---`---,---@n",
+     u8"$n hands $mself a @R@@@G}---`---,---@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You've got to ruffle SOMEONE.",
+     u8"$n is looking for someone's hair to ruffle.",
+     u8"You ruffle $N's hair playfully.",
+     u8"$n ruffles $N's hair playfully.",
+     u8"$n ruffles your hair playfully.",
+     u8"Might be a bit difficult.",
+     u8"You ruffle your hair, wondering how far you can go before the rest think you're crazy.",
+     u8"$n ruffles $s hair -- weirdo!",
+     u8"You ruffle $S $t.",
+     u8"$n ruffles $N's $t.",
+     u8"$n ruffles your $t.",
+     u8"You ruffle $p.",
+     u8"$n ruffles $p."},
+    {u8"You run screaming for the hills.",
+     u8"$n runs screaming for the hills.",
+     u8"You take one look at $N and run screaming for the hills.",
+     u8"$n takes one look at $N and runs screaming for the hills.",
+     u8"$n takes one look at you and runs screaming for the hills.",
+     u8"You run screaming... but from who?",
+     u8"You run screaming from yourself... AAH! You can't get away!",
+     u8"$n runs screaming from $mself... $e can't get away!",
+     u8"You take one look at $N's $t and run screaming for the hills.",
+     u8"$n takes one look at $N's $t and runs screaming for the hills.",
+     u8"$n takes one look at your $t and runs screaming for the hills.",
+     u8"You take one look at $p and run screaming for the hills.",
+     u8"$n takes one look at $p and runs screaming for the hills."},
+    {u8"Your face sinks, an image of sadness.",
+     u8"$n's face sinks, an image of sadness.",
+     u8"Your face sinks as you look sadly at $N.",
+     u8"$n's face sinks as $e looks sadly at $N.",
+     u8"$n's face sinks as $e looks sadly at you.",
+     u8"You look sad, but no one is here to see.",
+     u8"Your face sinks as you look sadly at yourself.",
+     u8"$n's face sinks as $e looks sadly at $mself.",
+     u8"Your face sinks as you look sadly at $N's $t.",
+     u8"$n's face sinks as $e looks sadly at $N's $t.",
+     u8"$n's face sinks as $e looks sadly at your $t.",
+     u8"Your face sinks as you look sadly at $p.",
+     u8"$n's face sinks as $e looks sadly at your $p."},
+    {u8"You nod sagely.",
+     u8"$n nods sagely.",
+     u8"You nod sagely to $N.",
+     u8"$n nods sagely to $N.",
+     u8"$n nods sagely to you.",
+     u8"Nod at who did you say?",
+     u8"You nod sagely, thinking about something important.",
+     u8"$n nods sagely, thinking about something important.",
+     u8"You nod sagely, thinking about $N's $t.",
+     u8"$n nods sagely, thinking about $N's $t.",
+     u8"$n nods sagely, thinking about your $t.",
+     u8"",
+     u8""},
+    {u8"You salute everyone present.",
+     u8"$n salutes everyone present.",
+     u8"You salute $N.",
+     u8"$n salutes $N.",
+     u8"$n salutes you.",
+     u8"Hmmm. I wonder who you're trying to salute?",
+     u8"You manage to sprain your wrist while trying to salute yourself.",
+     u8"$n bends $s hand backwards and salutes $mself!",
+     u8"You salute $S $t.",
+     u8"$n salutes $N's $t.",
+     u8"$n salutes your $t.",
+     u8"You salute $p.",
+     u8"$n salutes $p."},
+    {u8"You pick at a scab.. Don't you know it will never heal now?",
+     u8"$n picks at one of $s scabs.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You begin to scold this Cruel World we live in.",
+     u8"$n begins to scold the Cruel World we live in.",
+     u8"You scold $M to within a thrashing of $S life.",
+     u8"$n scolds $N to within a thrashing of $S life.",
+     u8"$n scolds you to within a thrashing of your life.",
+     u8"Sure sure, but who might that be?",
+     u8"You scold yourself, there that's better, you told yourself.",
+     u8"$n scolds $mself furiously.",
+     u8"You scold $S $t.",
+     u8"$n scolds $N's $t.",
+     u8"$n scolds your $t.",
+     u8"You scold $p.",
+     u8"$n scolds $p."},
+    {u8"You take a good look around.",
+     u8"$n looks like $e has lost something nearby.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You scratch your head.",
+     u8"$n scratches $s head in confusion.",
+     u8"You rake $S face with your nails.",
+     u8"$n tries to scratch $N's eyes out.",
+     u8"$n lunges at you hissing like a stray cat.",
+     u8"Ahh you frightened them off! Good.",
+     u8"Ahhhhh that feels good!",
+     u8"$n scratches $s head in contemplation.",
+     u8"You scratch $S $t.",
+     u8"$n scratches $N's $t.",
+     u8"$n scratches your $t.",
+     u8"You scratch $p.",
+     u8"$n scratches $p."},
+    {u8"ARRRRRRRRRRGH!!!!!",
+     u8"$n screams loudly!",
+     u8"You scream at $M.",
+     u8"$n screams loudly in $N's ear.",
+     u8"$n screams in your ear! AAAAAARRRRGGHHHHH!!!!!",
+     u8"No one can hear your screams.",
+     u8"You are so mad at yourself, you could just scream!",
+     u8"$n gapes in a silent expression of pain and angst.",
+     u8"You scream at $S $t.",
+     u8"$n screams at $N's $t.",
+     u8"$n screams at your $t.",
+     u8"You scream at $p.",
+     u8"$n screams at $p."},
+    {u8"You scuffle your feet around in the dirt.",
+     u8"$n scuffles $s feet around in the dirt.",
+     u8"You scuffle your feet in front of $N.",
+     u8"$n scuffles $s feet in front of $N.",
+     u8"$n scuffles $s feet in front of you.",
+     u8"They left before you could scuffle in front of them.",
+     u8"You scuffle your feet back and forth across the room impatiently.",
+     u8"$n scuffles $s feet back and forth across the room impatiently.",
+     u8"You scuffle your feet in front of $S $t.",
+     u8"$n scuffles $s feet in front of $N's $t.",
+     u8"$n scuffles $s feet in front of your $t.",
+     u8"You scuffle your feet in front of $p.",
+     u8"$n scuffles $s feet in front of $p."},
+    {u8"Whom do you wish to give the secret TBA handshake?",
+     u8"$n is looking for someone to to give the secret TBA handshake.",
+     u8"You give $N the secret TBA handshake.",
+     u8"$n gives $N the secret TBA handshake.",
+     u8"$n gives you the secret TBA handshake.",
+     u8"They are not cool enough to know the secret TBA handshake anyways.",
+     u8"You give yourself the secret TBA handshake.",
+     u8"$n gives $mself the secret TBA handshake.",
+     u8"$n shakes $S $t.",
+     u8"$n shakes $N's $t.",
+     u8"$n shakes your $t.",
+     u8"You give $p the secret TBA handshake.",
+     u8"$n gives $p the secret TBA handshake."},
+    {u8"@yYou @Dw@Ci@Dnk @yand blow @Rkisses@y at everyone in the room, attempting to seduce all of @Mthem@y.",
+     u8"@y$n looks like $e is trying to @Mseduce @ythe whole room!@n",
+     u8"@yYou slide up $S side and whisper @rnaughty@y things into $S ear.@n",
+     u8"@y$n slides up $N's side and whispers @rnaughty@y things into $S ear.@n",
+     u8"@y$n slides up your side and whispers @rnaughty@y things into your ear. @ROh my!@n",
+     u8"@yWho are you trying to @Mseduce@y?",
+     u8"@yYou pull out a mirror and blow @Rkisses@y at it, trying to @Mseduce@y yourself.@n",
+     u8"@yPoor $n is trying to @Mseduce@y $mself, and isn't doing a very good job.@n",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"What a dirty, dirty mind you have!",
+     u8"$n has the personality of a potted plant.",
+     u8"Get some soap for your mind.",
+     u8"$n needs some soap for $s mind.",
+     u8"$n needs some soap for $s mind.",
+     u8"Get some soap for your mind.",
+     u8"Get some soap for your mind.",
+     u8"$n needs some soap for $s mind.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You shake your head.",
+     u8"$n shakes $s head.",
+     u8"You shake your head at $N.",
+     u8"$n shakes $s head at $N.",
+     u8"$n shakes $s head at you.",
+     u8"Sorry good buddy, but that person doesn't seem to be here.",
+     u8"You shake your head at yourself.",
+     u8"$n shakes $s head to $mself.",
+     u8"You shake $N's $t.",
+     u8"$n shakes $N's $t.",
+     u8"$n shakes your $t.",
+     u8"You shake your head at $p.",
+     u8"$n shakes $s head at $p."},
+    {u8"You bow your head in shame.",
+     u8"$n bows $s head in shame.",
+     u8"You look at $M, shame in your eyes.",
+     u8"$n looks at $N, shame in $s eyes.",
+     u8"$n looks at you, shame in $s eyes.",
+     u8"Sorry good buddy, but that person doesn't seem to be here.",
+     u8"You are ashamed of yourself.",
+     u8"$n is ashamed of $mself.",
+     u8"You are ashamed of $S $t.",
+     u8"$n is ashamed of $N's $t.",
+     u8"$n is ashamed of your $t.",
+     u8"You are ashamed of $p.",
+     u8"$n is ashamed of $p."},
+    {u8"You sheathe your weapon.",
+     u8"$n sheaths $s weapon.",
+     u8"You sheathe your weapon glaring at $M.",
+     u8"$n sheathes $s weapon glaring at $N.",
+     u8"$n sheathes $s weapon glaring at you.",
+     u8"In front of whom?",
+     u8"You put it down, you are free to live.",
+     u8"$n cannot take $s life, so the weapon sheaths and $n looks more alive.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You whisper, 'Shhh!'",
+     u8"$n whispers, 'Shhh!'",
+     u8"You look at $m and whisper, 'Shhh!'",
+     u8"$n looks at $N and whispers, 'Shhh!'",
+     u8"$n looks at you and whispers, 'Shhh!'",
+     u8"They are in your mind only my friend.",
+     u8"You whisper quietly to yourself.",
+     u8"$n whispers quietly to $mself.",
+     u8"You look at $N's $t and whisper, 'Shhh!'",
+     u8"$n looks at $N's $t and whispers, 'Shhh!'",
+     u8"$n looks at your $t and whispers, 'Shhh!'",
+     u8"",
+     u8""},
+    {u8"You whip out your kabobing tools.",
+     u8"$n whips out $s kabobing tools and prepares lunch.",
+     u8"You shishkabobs $M right through $S heart.",
+     u8"$n shishkabobs $N right through $S heart.",
+     u8"$n shishkabobs you right through your heart.",
+     u8"Sorry good chef, but that person doesn't seem to be here.",
+     u8"You stab yourself in the arm.  I hope you're not planning to eat that!",
+     u8"$n kabobs $mself right in the arm... YUCK!!!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Brrrrrrrrr.",
+     u8"$n shivers uncomfortably.",
+     u8"You shiver at the sight of $M.",
+     u8"$n shivers at $N in fear.",
+     u8"You cause $n to shiver in fear.",
+     u8"Brrrrrr, mighty cold in here.",
+     u8"You shiver, feeling your skin covered with goose bumps.",
+     u8"$n shivers at $s own reflection.",
+     u8"You look at $S $t and shiver uncontrollably.",
+     u8"$n looks at $N's $t and shivers uncontrollably.",
+     u8"$n looks at your $t and shivers uncontrollably.",
+     u8"You look at $p and shiver uncontrollably.",
+     u8"$n looks at $p and shivers uncontrollably."},
+    {u8"You shuffle your feet on the floor to amass static electricity...",
+     u8"$n shuffles $s feet on the floor to amass static electricity...",
+     u8"You stick your finger to $N's nose and release a bolt of static electricity.",
+     u8"$n sticks $s finger to $N's nose and releases a bolt of static electricity.",
+     u8"$n sticks a static-electricity-charged finger on your nose, and @R*@cBZZ@CZZZ@nZZT@R*@n.",
+     u8"You point at the air and release a couple sparks...",
+     u8"You put your finger on your nose and shock yourself.",
+     u8"$n places $s finger on $s own nose and shocks $mself!",
+     u8"You grab ahold of $N's $t and release all of your amassed static electricity into it.",
+     u8"$n grabs ahold of $N's $t and releases all of $s amassed static electricity into it.",
+     u8"$n grabs your $t and releases all of $s amassed static electricity into it.",
+     u8"You touch $p and release a bolt of energy right through it.",
+     u8"$n touches $p and makes a bolt of electricity dance around and through it."},
+    {u8"You can't have a shootout by yourself, pardner.",
+     u8"$n looks around for someone to hold a shoot out with.",
+     u8"This town ain't big enough for you and $N!",
+     u8"$n wiggles $s fingers, holds $s hands near $s holsters, and sizes up $N.",
+     u8"$n wiggles $s fingers, holds $s hands near $s holsters, and sizes you up.",
+     u8"That there person ain't here.",
+     u8"You can't have a shootout with yourself, pardner.",
+     u8"$n seems to think about having a shoot out with $mself. $e decides against it.",
+     u8"You look at $N's $t and get ready to draw.",
+     u8"$n looks at $N's $t and gets ready to draw $s guns.",
+     u8"$n looks at your $t and gets ready to draw $s guns.",
+     u8"You look over $p and get ready to draw.",
+     u8"$n looks over $p and gets ready to draw $s guns."},
+    {u8"You shrug.",
+     u8"$n shrugs helplessly.",
+     u8"You look at $M and shrug helplessly.",
+     u8"$n looks at $N and shrugs.",
+     u8"$n looks at you and shrugs helplessly.",
+     u8"Might be a bit difficult.",
+     u8"You shrug your shoulders.",
+     u8"$n shrugs $s shoulders totally confused.",
+     u8"You shrug your shoulders at $S $t.",
+     u8"$n shrugs $s shoulders at $N's $t.",
+     u8"$n shrugs $s shoulders at your $t.",
+     u8"You shrug your shoulders at $p.",
+     u8"$n shrugs $s shoulders at $p."},
+    {u8"Urrrgghhh! Someone just walked over your grave.",
+     u8"$n shudders.",
+     u8"You shudder at the sight of $M.",
+     u8"$n shudders at $N as if $e has just seen a ghost.",
+     u8"$n shudders at the very sight of you.",
+     u8"A spooky sensation tingles up and down your spine.",
+     u8"You shudder in fear, as if you have seen your own ghost.",
+     u8"$n shudders, frightened by $s own shadow.",
+     u8"You shudder at the sight of $S $t.",
+     u8"$n shudders at the sight of $N's $t.",
+     u8"$n shudders at the sight of your $t.",
+     u8"You shudder at the sight of $p.",
+     u8"$n shudders at the sight of $p."},
+    {u8"You shy away from everyone.",
+     u8"$n shies away from everyone.",
+     u8"You shy away from $N.",
+     u8"$n shies away from $N.",
+     u8"$n shies away from you.",
+     u8"You shy away from no one at all!",
+     u8"You shy away from yourself.",
+     u8"$n shies away from $mself.",
+     u8"You shy away from $N's $t.",
+     u8"$n shies away from $N's $t.",
+     u8"$n shies away from your $t.",
+     u8"You shy away from $p.",
+     u8"$n shies away from $p."},
+    {u8"Sidle up to who?",
+     u8"$n contemplates sidling up to someone.",
+     u8"You sidle up to $N... $E has something you want?",
+     u8"$n sidles up to $N, $E has something $e wants?",
+     u8"$n sidles up to you, you have something $e wants?",
+     u8"You find yourself falling onto your side as you sidle up to someone who isn't there.",
+     u8"You sidle up to yourself... strangely uncomforting.",
+     u8"$n sidles up to $mself... bit sad actually.",
+     u8"You sidle up cozily to $N's $t.",
+     u8"$n sidles up to $N's $t.",
+     u8"$n sidles up to your $t.",
+     u8"You sidle up cozily to $p.",
+     u8"$n sidles up cozily to $p."},
+    {u8"You sigh.",
+     u8"$n sighs loudly.",
+     u8"You look at $N and sigh.",
+     u8"$n sighs at $N.",
+     u8"$n sighs at you.",
+     u8"You sigh in a halfhearted way.",
+     u8"You sigh to yourself under your breath.",
+     u8"$n looks around bewildered and gives a big sigh.",
+     u8"You sigh at $S $t.",
+     u8"$n sighs at $N's $t.",
+     u8"$n sighs at your $t.",
+     u8"You sigh at $p.",
+     u8"$n sighs at $p."},
+    {u8"You raise your clear (?) voice towards the sky.",
+     u8"SEEK SHELTER AT ONCE! $n has begun to sing.",
+     u8"You serenade $M.",
+     u8"$n sings softly to $N.",
+     u8"$n sings you a love song.",
+     u8"Sing away no-one will hear.",
+     u8"You raise your clear (?) voice towards the sky, serenading yourself.",
+     u8"SEEK SHELTER AT ONCE! $n has begun to serenade $mself.",
+     u8"You sing to $S $t.",
+     u8"$n sings to $N's $t.",
+     u8"$n sings to your $t.",
+     u8"You sing to $p.",
+     u8"$n sings to $p."},
+    {u8"You skip around merrily.",
+     u8"$n skips around merrily.",
+     u8"You merrily skip around $N.",
+     u8"$n merrily skips around $N.",
+     u8"$n merrily skips around you.",
+     u8"You can't skip around that person because they're not here.",
+     u8"You skip around rapidly, in circles!",
+     u8"$n skips around rapidly, in circles.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Normally you slap SOMEBODY.",
+     u8"$n looks around for someone to vent $s frustrations on.",
+     u8"You slap $N.",
+     u8"$n slaps $N.",
+     u8"$n slaps you. Ow!",
+     u8"How about slapping someone in the same room as you??",
+     u8"You slap yourself, silly you.",
+     u8"$n slaps $mself, really strange...",
+     u8"You slap $S $t.",
+     u8"$n slaps $N's $t.",
+     u8"$n slaps your $t.",
+     u8"You slap $p.",
+     u8"$n slaps $p."},
+    {u8"You order your dog to fetch someone's slippers",
+     u8"$n tells $s dog to go fetch slippers for someone who's not there.",
+     u8"You order your dog to go fetch slippers belonging to $N.",
+     u8"$n orders $s dog to go and fetch the slippers of $N.",
+     u8"$n orders $s dog to go and fetch your slippers.",
+     u8"Your dog looks miffed as he cannot find them to give slippers to.",
+     u8"Your dog dashes off and returns with your slippers.",
+     u8"$n tells $s dog to go fetch slippers for $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You slouch lazily in the corner.",
+     u8"$n slouches lazily in the corner.",
+     u8"You slouch lazily on $N.",
+     u8"$n slouches lazily on $N.",
+     u8"$n slouches lazily on you.",
+     u8"Who do you want to slouch upon?",
+     u8"That's not possible, I'm afraid.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Feeling extremely tired, you slump to the floor.",
+     u8"$n slumps tiredly to the floor.",
+     u8"You slump tiredly onto $S shoulder.",
+     u8"$n slumps tiredly onto $N's shoulder.",
+     u8"$n slumps tiredly onto your shoulder.",
+     u8"You can't slump onto someone who exists only in your mind.",
+     u8"Be reasonable!",
+     u8"",
+     u8"You slump tiredly onto $S $t.",
+     u8"$n slumps tiredly onto $N's $t.",
+     u8"$n slumps tiredly onto your $t.",
+     u8"",
+     u8""},
+    {u8"You smile happily.",
+     u8"$n smiles happily.",
+     u8"You smile at $M.",
+     u8"$n beams a smile at $N.",
+     u8"$n smiles at you.",
+     u8"There's no one by that name around.",
+     u8"You smile at yourself.",
+     u8"$n smiles at $mself.",
+     u8"You smile at $S $t.",
+     u8"$n smiles at $N's $t.",
+     u8"$n smiles at your $t.",
+     u8"You smile at $p.",
+     u8"$n smiles at $p."},
+    {u8"Pick someone to smack!",
+     u8"$n swings wildly at the air, trying to swat a fly or something.",
+     u8"You smack $N.  $N reels from the blow.",
+     u8"$n gives $N a good smack, sending $M reeling.",
+     u8"$n smacks you!  Idiot!",
+     u8"Nyuk Nyuk.. you miss and smack yourself instead.",
+     u8"You smack yourself.",
+     u8"$n smacks $mself?",
+     u8"You give $N a good smack in the $t.",
+     u8"$n smacks $N, right in the $t.",
+     u8"$n gives you a good smacking in the $t!  You Idiot!",
+     u8"You smack $p.",
+     u8"$n smacks $p."},
+    {u8"WHO DO YOU WANNA SMASH?",
+     u8"$n thinks $e smashing air.",
+     u8"You smash the $N into the ground!",
+     u8"$n smashes $N 0 feet into the ground!",
+     u8"$n SMASHES you into the ground about Ten Feet!",
+     u8"Ummmmmmmm \"mental note: i must be retarded\"",
+     u8"Ouch, you smashed your own skull, stupid, stupid.",
+     u8"stupid ass $n Smashed $mself into the ground, OUCH!!!",
+     u8"You totaly MUTILATE $N's $t.",
+     u8"$n MUTILATES $N's $t.",
+     u8"$n has...Lets say Dismantled your $t.",
+     u8"YOU SMASH THE HELL OUT OF $p.",
+     u8"$n mutters\"work dammnit WORK\" as $e SMASHES $p."},
+    {u8"You smirk.",
+     u8"$n smirks.",
+     u8"You smirk at $M.",
+     u8"$n smirks at $N.",
+     u8"$n smirks at you.",
+     u8"Try it again when their here.",
+     u8"You smirk at yourself.",
+     u8"$n smirks at $mself, really strange...",
+     u8"You smirk at $S $t.",
+     u8"$n smirks at $N's $t.",
+     u8"$n smirks at your $t.",
+     u8"You smirk at $p.",
+     u8"$n smirks at $p."},
+    {u8"Smiting the entire MUD is not allowed (bad for business).",
+     u8"$n is looking for someone to smite.",
+     u8"You smite $N with lighting.",
+     u8"$n calls down lightning on $N, leaving a pile of ashes that blows away in the wind.",
+     u8"$n calls down lightning on you, smiting you to death.",
+     u8"You try to smite them but they are not around.",
+     u8"You smite yourself into oblivion.",
+     u8"$n calls down lightning upon $mself. Smiting $mself out of existence.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You pull out a cigarette and begin to smoke.",
+     u8"$n pulls out a cigarette and starts to smoke, driving another nail into $s coffin.",
+     u8"You light a cigarette and give it to $N, driving another nail into $S coffin.",
+     u8"$n lights a cigarette and gives it to $N, driving another nail into $S coffin.",
+     u8"$n lights a cigarette and gives it to you, driving another nail into your coffin.",
+     u8"You lit a smoke for them and they walk away?",
+     u8"You light yourself a cigarette and drive another nail in your coffin.",
+     u8"$n lights $mself a cigarette.",
+     u8"You try to offer $S $t a cigarette.",
+     u8"$n offers $N's $t a cigarette.",
+     u8"$n offers your $t a cigarette.",
+     u8"You offer $p a cigarette.",
+     u8"$n offers $p a cigarette."},
+    {u8"Who do you want to smooch?",
+     u8"$n is looking for someone to smooch.",
+     u8"You smooch $N all over the face.",
+     u8"$n smooches $N all over the face.",
+     u8"$n smooches you all over the face.",
+     u8"Now where did they go?",
+     u8"You want to smooch yourself?!?",
+     u8"$n smooches $mself, really strange...",
+     u8"You smooch $S $t.",
+     u8"$n smooches $N's $t.",
+     u8"$n smooches your $t.",
+     u8"You smooch $p.",
+     u8"$n smooches $p."},
+    {u8"You start to look smug.",
+     u8"$n starts to look smug.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"PRONTO!  You snap your fingers.",
+     u8"$n snaps $s fingers.",
+     u8"You snap your fingers at $M.",
+     u8"$n snaps $s fingers at $N.",
+     u8"$n snaps $s fingers at you. Hurry up!",
+     u8"You snap your fingers at no one in particular.",
+     u8"You snap you fingers. Aww shucks.",
+     u8"$n snaps $s fingers at $mself.",
+     u8"You snap your fingers at $S $t.",
+     u8"$n snaps $s fingers at $N's $t.",
+     u8"$n snaps $s fingers at your $t.",
+     u8"You snap your fingers at $p.",
+     u8"$n snaps $s fingers at $p."},
+    {u8"You snarl like a vicious animal.",
+     u8"$n snarls like a cornered, vicious animal.",
+     u8"You snarl at $M angrily.  Control yourself!",
+     u8"$n snarls angrily at $N.  $e seems incapable of controlling $mself.",
+     u8"$n snarls viciously at you.  $s self-control seems to have gone bananas.",
+     u8"Eh?  Who?  Not here, my friend.",
+     u8"You snarl at yourself, obviously suffering from schizophrenia.",
+     u8"$n snarls at $mself, and suddenly looks very frightened.",
+     u8"You snarl at $S $t.",
+     u8"$n snarls at $N's $t.",
+     u8"$n snarls at your $t.",
+     u8"You snarl at $p.",
+     u8"$n snarls at $p."},
+    {u8"You sneer at no one in particular.",
+     u8"$n sneers at everyone!",
+     u8"You sneer at $M.",
+     u8"$n sneers at $N!",
+     u8"$n sneers at you!",
+     u8"Did you wish to sneer at an actual person?",
+     u8"You try to sneer at yourself.",
+     u8"$n looks like a retard as $e tries to sneer at $mself.",
+     u8"You sneer at $S $t.",
+     u8"$n sneers at $N's $t.",
+     u8"$n sneers at your $t.",
+     u8"You sneer at $p.",
+     u8"$n sneers at $p."},
+    {u8"Gesundheit!",
+     u8"$n sneezes.",
+     u8"You sneeze on $M.",
+     u8"$n sneezes all over $N.",
+     u8"$n sneezes all over you.",
+     u8"Aww-chooo!",
+     u8"Something tickles your nose and you sneeze.",
+     u8"$n sneezes snot all over $mself.",
+     u8"You sneeze all over $S $t.",
+     u8"$n sneezes all over $N's $t.",
+     u8"$n sneezes all over your $t.",
+     u8"You sneeze all over $p.",
+     u8"$n sneezes all over $p."},
+    {u8"You snicker softly.",
+     u8"$n snickers softly.",
+     u8"You snicker at $M.",
+     u8"$n snickers at $N.",
+     u8"$n snickers at you.",
+     u8"Hmm no one like that to be seen.",
+     u8"You snicker quietly to yourself.",
+     u8"$n snickers quietly to $mself, obviously some private joke.",
+     u8"You snicker at $S $t.",
+     u8"$n snickers at $N's $t.",
+     u8"$n snickers at your $t.",
+     u8"You snicker at $p.",
+     u8"$n snickers at $p."},
+    {u8"You sniff sadly.  *SNIFF*",
+     u8"$n sniffs sadly.",
+     u8"You sniff $M.",
+     u8"$n sniffs $N.",
+     u8"$n sniffs under your arm. Hope you have bathed!",
+     u8"You sniff about - Hmmm nowhere to be found.",
+     u8"You sniff under your arm and nearly faint from the fumes.",
+     u8"$n sniffs under $s underarm and nearly faints.",
+     u8"You sniff $S $t.",
+     u8"$n sniffs $N's $t.",
+     u8"$n sniffs your $t.",
+     u8"You sniff $p.",
+     u8"$n sniffs $p."},
+    {u8"You snigger like a school child.",
+     u8"$n sniggers like an immature child.",
+     u8"You snigger at $N.",
+     u8"$n sniggers at $N.",
+     u8"$n sniggers at you.",
+     u8"You can't find the person you wish to snigger at.",
+     u8"You snigger at yourself.",
+     u8"$n sniggers at $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You must snog someone!",
+     u8"",
+     u8"You give $N a fierce snogging! Thou art brave!",
+     u8"$n gives $N a fierce snogging!",
+     u8"$n moves forward and gives you a fierce snogging!",
+     u8"You can't find them here.",
+     u8"You attempt to snog yourself..",
+     u8"$n disregards physical impossibility and tries to snog $mself!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You do a snoopy dance",
+     u8"$n hops up onto Linus' piano and does a Snoopy dance.",
+     u8"",
+     u8"$n hops up onto Linus' piano and does a Snoopy dance.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Zzzzzzzzzzzzzzzzz.",
+     u8"$n snores loudly.",
+     u8"You accuse $M of snoring.",
+     u8"$n accuses $N of snoring.",
+     u8"$n accuses you of snoring like a pig.",
+     u8"You hear snoring?",
+     u8"You snore loud enough to wake yourself.",
+     u8"$n snores so loud that $e wakes $mself.",
+     u8"You snore boringly at $S $t.",
+     u8"$n snores boringly at $N's $t.",
+     u8"$n snores boringly at your $t.",
+     u8"You snore boringly at $p.",
+     u8"$n snores boringly at $p."},
+    {u8"You snort in discontent.",
+     u8"$n snorts in discontent.",
+     u8"You snort in discontent at $M.",
+     u8"$n snorts in discontent at $N.",
+     u8"$n snorts in discontent at you.",
+     u8"Snort away, they are not here to hear your discontent.",
+     u8"You snort in discontent at yourself.",
+     u8"$n snorts in discontent at $mself.",
+     u8"You snort in discontent at $S $t.",
+     u8"$n snorts in discontent at $N's $t.",
+     u8"$n snorts in discontent at your $t.",
+     u8"You snort in discontent at $p.",
+     u8"$n snorts in discontent at $p."},
+    {u8"Who do you want to throw a snowball at??",
+     u8"$n has a snowball $e needs to get rid of.",
+     u8"You throw a snowball in $N's face.",
+     u8"$n conjures a snowball from thin air and throws it at $N.",
+     u8"$n conjures a snowball from thin air and throws it at you.",
+     u8"You stand with the snowball in your hand because your victim is not here.",
+     u8"You conjure a snowball from thin air and throw it at yourself.",
+     u8"$n conjures a snowball out of the thin air and throws it at $mself.",
+     u8"You conjure a snowball out of thin air and throw it at $S $t.",
+     u8"$n conjures a snowball out of thin air and throws it at $N's $t.",
+     u8"$n conjures a snowball out of thin air and throws it at your $t.",
+     u8"You conjure a snowball out of thin air and throw it at $p.",
+     u8"$n conjures a snowball out of thin air and throws it at $p."},
+    {u8"You wish to do some laundry?",
+     u8"$n wants to snuggle.",
+     u8"you snuggle $M.",
+     u8"$n snuggles up to $N.",
+     u8"$n snuggles up to you.",
+     u8"They aren't here.",
+     u8"You snuggle with yourself.",
+     u8"$n tries to snuggle $mself?",
+     u8"You snuggle up to $N's $t.",
+     u8"$n snuggles up to $N's $t.",
+     u8"$n snuggles up to your $t.",
+     u8"You snuggle up to $p.",
+     u8"$n snuggles up to $p."},
+    {u8"Who's shoulder do you want to cry on?",
+     u8"$n looks around for a shoulder to cry on.",
+     u8"You bawl your eyes out on $N's shoulder.",
+     u8"$n leans on $N's shoulder and bawls $s eyes out.",
+     u8"$n leans on your shoulder and bawls $s eyes out, soaking you.",
+     u8"Aww....all alone again huh?",
+     u8"You break down bawling, tears flying everywhere.",
+     u8"$n breaks down bawling, tears flying everywhere.",
+     u8"You sob on $S $t.",
+     u8"$n sobs on $N's $t.",
+     u8"$n sobs on your $t.",
+     u8"You sob on $p.",
+     u8"$n sobs on $p."},
+    {u8"You snivel out a, 'Sorry.'",
+     u8"$n snivels out a, 'Sorry.'",
+     u8"You snivel out a, 'Sorry,' to $N.",
+     u8"$n snivels out, 'Sorry,' to $N.",
+     u8"$n snivels out, 'Sorry,' to you.",
+     u8"You don't see them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You spank WHO?  Eh?  How?  Naaah, you'd never.",
+     u8"$n spanks the thin air with a flat hand.",
+     u8"You spank $M vigorously, long and hard.  Your hand hurts.",
+     u8"$n spanks $N over $s knee.  It hurts to even watch.",
+     u8"$n spanks you long and hard.  You feel like a naughty child.",
+     u8"Are you sure about this?  I mean, that person isn't even here!",
+     u8"You spank yourself, such a naughty person.",
+     u8"$n spanks $mself, $e seems to enjoy it a little too much.",
+     u8"You spank $M $t.",
+     u8"$n spanks $N's $t.",
+     u8"$n spanks your $t.",
+     u8"You spank $p.",
+     u8"$n spanks $p."},
+    {u8"SPEW!!!!!",
+     u8"EWW!!! $n spews all over.",
+     u8"EWW!!! You spew all over $M.",
+     u8"YECK!!! $n spews all over $N.",
+     u8"YECK!!! $n spews all over you!",
+     u8"Again?",
+     u8"You spew all over yourself.",
+     u8"$n spews all over $s own clothes.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You spin joyously in a circle.",
+     u8"$n spins around cheerfully.",
+     u8"You spin joyously in a circle.",
+     u8"$n spins around cheerfully.",
+     u8"",
+     u8"You spin $N around and into your arms.",
+     u8"$n twirls $N around and into $s arms.",
+     u8"$n twirls you around and into $s warm embrace.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You spit on the ground.",
+     u8"$n spits on the ground.",
+     u8"You spit on $M.",
+     u8"$n spits at $N.",
+     u8"$n spits at you.",
+     u8"Can you spit that far?",
+     u8"You drool down your front.",
+     u8"$n drools down $s front.",
+     u8"You spit on $S $t.",
+     u8"$n spits on $N's $t.",
+     u8"$n spits on your $t.",
+     u8"You spit on $p.",
+     u8"$n spits on $p."},
+    {u8"You splash your face with water.",
+     u8"$n splashes $s face water.",
+     u8"You splash water on $N soaking $M.... how rude.",
+     u8"$n splashes water on $N soaking $M.... run you might be next.",
+     u8"$n splashes you with water... you are soaked... REVENGE!",
+     u8"Whom do you want to splash water on again?",
+     u8"You splash water all over yourself..... FOOL you are drenched.....",
+     u8"$n splashes water all over $mself... the FOOL is drenched...",
+     u8"You playfully splash $N's $t with water.",
+     u8"$n playfully splashes $N's $t with water.",
+     u8"$n playfully splashes water at your $t...... going to take that?",
+     u8"You splash $p with water, trying to clean off those nasty bloodstains.",
+     u8"$n splashes $p with water, and starts to wash away an imaginary bloodstain."},
+    {u8"You demand a sponge bath.",
+     u8"$n demands a sponge bath.",
+     u8"You look at $N and demand your sponge bath.",
+     u8"$n looks at $N and demands $s sponge bath.",
+     u8"$n looks at you and demands you give $m a sponge bath.",
+     u8"They left before you could give them a sponge bath.",
+     u8"You give yourself a sponge bath.",
+     u8"$n gives $mself a sponge bath...",
+     u8"You look at $N's $t and demand a sponge bath.",
+     u8"$n looks at $N's $t and demands a sponge bath.",
+     u8"$n looks at your $t and demands you give $m a sponge bath.",
+     u8"You look at $p and demand a sponge bath.",
+     u8"$n looks at $p and demands a sponge bath."},
+    {u8"You whip out your spork and prepare for the worst.",
+     u8"$n pulls out a spork.",
+     u8"You spork $N ruthlessly.",
+     u8"$n sporks $N ruthlessly.",
+     u8"You are sporked by $n. It hurts!",
+     u8"They did not wait for you to spork them.",
+     u8"You spork yourself until it hurts",
+     u8"$n sporks $mself, it looks painful.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You let out a pitiful squeak.",
+     u8"$n lets out a pitiful squeak.",
+     u8"You look at $M and squeak in fear.",
+     u8"$n looks at $N and squeaks in fear.",
+     u8"$n looks at you and squeaks in fear.",
+     u8"Your squeak goes unanswered.",
+     u8"You squeak quietly to yourself.",
+     u8"$n squeaks quietly to $mself.",
+     u8"You nudge at $N's $t and squeak adorably.",
+     u8"$n nudges at $N's $t and squeaks adorably.",
+     u8"$n nudges at your $t and squeaks adorably.",
+     u8"",
+     u8""},
+    {u8"You squeal with delight!",
+     u8"$n squeals with delight!",
+     u8"You look at $N and squeal with delight!",
+     u8"$n squeals with delight at $N's actions.",
+     u8"$n looks at you and squeals with delight!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Where, what, how, WHO???",
+     u8"$n is looking for someone to squeeze.",
+     u8"You squeeze $M fondly.",
+     u8"$n squeezes $N fondly.",
+     u8"$n squeezes you fondly.",
+     u8"Where, what, how, WHO???",
+     u8"You squeeze yourself -- try to relax a little!",
+     u8"$n squeezes $mself.",
+     u8"You fondly squeeze $N's $t.",
+     u8"$n fondly squeezes $N's $t.",
+     u8"$n fondly squeezes your $t.",
+     u8"You squeeze $p.",
+     u8"$n squeezes $p."},
+    {u8"You stare at the sky.",
+     u8"$n stares at the sky.",
+     u8"You stare dreamily at $N, completely lost in $S eyes..",
+     u8"$n stares dreamily at $N.",
+     u8"$n stares dreamily at you, completely lost in your eyes.",
+     u8"You stare and stare but can't see that person anywhere...",
+     u8"You stare dreamily at yourself - enough narcissism for now.",
+     u8"$n stares dreamily at $mself - NARCISSIST!",
+     u8"You stare at $S $t.",
+     u8"$n stares at $N's $t.",
+     u8"$n stares at your $t.",
+     u8"You stare at $p.",
+     u8"$n stares at $p."},
+    {u8"You let out some steam, much to the others' relief (and your own!)",
+     u8"$n lets out a lot of steam, much to your relief.",
+     u8"You fume and rage at $M.",
+     u8"$n starts ranting at $N, $s face purple with rage.",
+     u8"$n starts yelling at you, $e should calm down.",
+     u8"Sure sure, but who might that be?",
+     u8"You scold yourself, there thats better, you told yourself.",
+     u8"$n seems furious about something or other.",
+     u8"You fume and rage at $S $t.",
+     u8"$n fumes and rages at $N's $t.",
+     u8"$n fumes and rages at your $t.",
+     u8"You fume and rage at $p.",
+     u8"$n fumes and rages at $p."},
+    {u8"You stomp around like a little child.",
+     u8"$n stomps around in an irate manner.",
+     u8"You stomp on $N's toes! CRUNCH!",
+     u8"$n stomps on $N's toes! CRUNCH!",
+     u8"$n stomps on your toes! CRUNCH!",
+     u8"You go to stomp on them then stop short, realizing they're not here.",
+     u8"You stomp on your toes, way to go klutz!",
+     u8"$n stomps on $s own toes, don't they look stupid?",
+     u8"You stomp on $S $t.",
+     u8"$n stomps on $N's $t.",
+     u8"$n stomps on your $t.",
+     u8"You stomp on $p, breaking it into a million pieces.",
+     u8"$n stomps on $p, breaking it into a million pieces."},
+    {u8"You call for a stoning! There's a SINNER about!",
+     u8"$n calls for a stoning! There's a SINNER about!",
+     u8"You start hurling stones at $N, SINNER!",
+     u8"$n starts hurling stones at $N the SINNER!",
+     u8"$n starts hurling stones at you, what did you do?",
+     u8"The stone whistles through the empty air.",
+     u8"You start pummeling yourself with stones, feel better yet?",
+     u8"$n starts pummeling $mself with stones, $e must be feeling guilty!",
+     u8"You hurl stones at $N's $t, it must have sinned!",
+     u8"$n hurls stones at $N's $t, it must have sinned!",
+     u8"$n hurls stones at your $t, what did it do?",
+     u8"You start hurling stones at $p, it must be evil!",
+     u8"$n starts hurling stones at $p, it must be evil!"},
+    {u8"You look around for a victim...",
+     u8"$n looks around for a victim to strangle.",
+     u8"You throw yourself against $N's throat, trying to squeeze the life out.",
+     u8"$n throws $mself after $N's throat.",
+     u8"$n throws $mself after your throat, you try to defend yourself.",
+     u8"AARGH! They must have left... #&%@!",
+     u8"You put your hands around your throat and stop breathing.",
+     u8"$n tries to strangle $mself, making a very strange noise and getting blue in the face.",
+     u8"You strangle $M $t.",
+     u8"$n strangles $N's $t.",
+     u8"$n strangles your $t.",
+     u8"You strangle $p.",
+     u8"$n strangles $p."},
+    {u8"You stretch your tired muscles.  That feels so good.",
+     u8"$n stretches $s aching muscles.",
+     u8"You stretch $N.",
+     u8"$n stretches $N.",
+     u8"$n stretches you.",
+     u8"I hope you know this person!",
+     u8"You stretch yourself.",
+     u8"$n stretches $mself, $e must be getting ready for some exercise.",
+     u8"You stretch $S $t.",
+     u8"$n stretches $N's $t.",
+     u8"$n stretches your $t, it feels nice.",
+     u8"You stretch $p.",
+     u8"$n stretches $p."},
+    {u8"Who would you like to stroke?",
+     u8"$n is looking for something to stroke?!?",
+     u8"You gently stroke $S inner thigh.",
+     u8"$n gently strokes $N's inner thigh... hrmm...",
+     u8"$n gently strokes your inner thigh...",
+     u8"That person is not within reach.",
+     u8"You are about to do something you would rather not be caught doing.",
+     u8"$n starts to do something disgusting and then stops.",
+     u8"You gently stroke $S $t.",
+     u8"$n gently strokes $N's $t... hrmm...",
+     u8"$n gently strokes your $t...",
+     u8"You gently stroke $p...",
+     u8"$n gently strokes $p..."},
+    {u8"Strut your stuff.",
+     u8"$n struts proudly.",
+     u8"You strut proudly in front of $N.",
+     u8"$n struts proudly in front of $N.",
+     u8"$n struts proudly in front of $N.",
+     u8"They left before you could strut proudly in front of them.",
+     u8"You strut proudly, admiring yourself.",
+     u8"$n struts proudly, admiring $mself.",
+     u8"You strut proudly in front of $S $t.",
+     u8"$n struts proudly in front of $N's $t.",
+     u8"$n struts proudly in front of your $t.",
+     u8"You strut proudly in front of $p.",
+     u8"$n struts proudly in front of $p."},
+    {u8"You drive on.",
+     u8"$n looks for someone to give a can of suckit-up.",
+     u8"You give $N a can of suckit-up.",
+     u8"$n gives $N a can of suckit-up.",
+     u8"$n gives you a can of suckit-up.",
+     u8"Who do you want to tell to suckit-up?",
+     u8"You tell yourself to suckit-up.",
+     u8"$n gets $mself a can of suckit-up.",
+     u8"You give $S $t a can of suckit-up.",
+     u8"$n gives $N's $t a can of suckit-up.",
+     u8"$n gives your $t a can of suckit-up.",
+     u8"You give $p a can of suckit-up.",
+     u8"$n gives $p a can of suckit-up."},
+    {u8"You sue everyone for all they're worth!!!",
+     u8"$n sues everyone for all they're worth!!!",
+     u8"You sue $N for all $E's worth!!!",
+     u8"$n sues $N for all $E's worth!!!",
+     u8"$n sues you for all you're worth!!!",
+     u8"You sue them for... not being there?",
+     u8"You sue yourself for all you're worth!!!",
+     u8"$n sues $mself for all $e's worth!!!",
+     u8"You sue $N for the state of $S $t.",
+     u8"$n sues $N for the state of $S $t.",
+     u8"$n sues you for the state of your $t.",
+     u8"You take one look at $p and decides to sue!!!",
+     u8"$n takes one look at $p and decides to sue!!!"},
+    {u8"You sulk.",
+     u8"$n sulks in a corner.  $e looks so pitiful, you can't help but feel a bit sorry for $m.",
+     u8"You look at $M and sulk.",
+     u8"$n looks at $N and goes and sulks in a corner.",
+     u8"$N looks at you and goes and sulks in a corner.",
+     u8"No worries, they're not here.",
+     u8"You look at your pitiful equipment and sulk.",
+     u8"$n looks at $s pitiful equipment and sulks in a corner.",
+     u8"You look at $S $t and sulk.",
+     u8"$n looks at $N's $t and goes and sulks in a corner.",
+     u8"$n looks at your $t and goes and sulks in a corner.  Guess $e's jealous...",
+     u8"You look at $p, and then go sulk in a corner.",
+     u8"$n looks at $p, and then goes and sulks in a corner."},
+    {u8"BONGA BONGA!!  You don't believe in weather forecasts?",
+     u8"$n dances around trying to summon the sun out of the clouds.",
+     u8"You dance wildly around $M trying to summon the sun out of the clouds.",
+     u8"$n dances wildly around $N trying to summon the sun out of the clouds.",
+     u8"$n dances wildly around you trying to summon the sun out of the clouds.",
+     u8"A totem pole is good for one thing, you understand that now. They don't move!",
+     u8"You BONGAWONGA around yourself, quicker, quicker and quicker!",
+     u8"$n attempts to dance the sundance around $mself.",
+     u8"You perform a sundance around $S $t.",
+     u8"$n performs a sundance around $N's $t.",
+     u8"$n performs a sundance around your $t.",
+     u8"You perform a sundance around $p.",
+     u8"$n performs a sundance around $p."},
+    {u8"You ride off into the sunset.",
+     u8"$n rides off into the sunset.",
+     u8"",
+     u8"",
+     u8"",
+     u8"Sorry, pardner, but $E ain't here.",
+     u8"You ride off into the sunset, all alone.",
+     u8"$n rides off, a lonely silhouette against the sunset.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You take out some black sunshades and slip them on.",
+     u8"$n takes out some dark sunshades and slips them on.",
+     u8"",
+     u8"",
+     u8"",
+     u8"They're not here to admire your cool shades.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You really should try to swat someone.",
+     u8"$n runs around with a fly swatter looking for a bug to squash.",
+     u8"You swat $N like the bug that they are.",
+     u8"$n swats $N like the bug that $E is.",
+     u8"$n starts running after you with a fly swatter and a crazed look on $s face.",
+     u8"They buzzed away too quickly.",
+     u8"You turn the fly swatter on yourself and commence the swatting.",
+     u8"$n starts smacking $mself with $s fly swatter.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You sway with the rhythm.",
+     u8"$n sways with the rhythm.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You swear loudly for a long time.",
+     u8"$n swears: @*\"*&^$$%@*&!!!!!!",
+     u8"You swear $M and all $S ancestors and descendants.",
+     u8"$n swears at $N's profanely.",
+     u8"$n swears at you profanely, what a jerk!",
+     u8"Your swearing echo's emptily.",
+     u8"You swear at yourself profanely.",
+     u8"$n swears under $s breath.",
+     u8"You swear at $S $t.",
+     u8"$n swears at $N's $t.",
+     u8"$n swears at your $t.",
+     u8"You swear at $p.",
+     u8"$n swears at $p."},
+    {u8"Cool down?",
+     u8"$n sweats a river!",
+     u8"You look at $S and break out into a sweat.",
+     u8"$n looks at $N and breaks out in a sweat.",
+     u8"$n looks at you and starts sweating.",
+     u8"You break out in a sweat.",
+     u8"You sweat like a pig and begin to smell like one.",
+     u8"$n is sweating freely and is beginning to smell funny.",
+     u8"You sweat on $S $t.",
+     u8"$n sweats on $N's $t.",
+     u8"$n sweats on your $t.",
+     u8"You sweat on $p.",
+     u8"$n sweats on $p."},
+    {u8"You smile sweetly.",
+     u8"$n smiles sweetly.",
+     u8"You smile sweetly at $M.",
+     u8"$n smiles sweetly at $N.",
+     u8"$n smiles sweetly at you. Hmm...",
+     u8"You smile sweetly at...someone who isn't here anymore...",
+     u8"You smile sweetly at...yourself.",
+     u8"$n smiles sweetly at...$mself?",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You swoon!",
+     u8"$n swoons!",
+     u8"You swoon into $S arms.",
+     u8"$n swoons into $N's arms.",
+     u8"$n swoons into your arms.",
+     u8"That person isn't here to catch you.",
+     u8"You can't catch yourself when you swoon!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"You swoon onto $p.",
+     u8"$n swoons onto $p."},
+    {u8"You unsheathe your blade and threaten to lop someone's head off.",
+     u8"$n draws forth $s sword and threatens to lop someone's head off.",
+     u8"You unsheathe your sword and point it directly at the neck of $N.",
+     u8"$n unsheathes $s sword and points it directly at the neck of $N.",
+     u8"$n draws $s sword and points it directly at your neck!",
+     u8"Who shall you threaten with your sword?",
+     u8"You draw your sword and threaten to lop off your own head...",
+     u8"$n draws $s sword from its scabbard and begins to threaten $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You tackle the air.  It stands not a chance.",
+     u8"$n starts running around $mself in a desperate attempt to tackle the air.",
+     u8"You ruthlessly tackle $M to the ground.",
+     u8"$n ruthlessly tackles $N, pinning $M to the ground.",
+     u8"$n suddenly lunges at you and tackles you to the ground!",
+     u8"That person isn't here (luck for them, it would seem...)",
+     u8"Tackle yourself?  Yeah, right....",
+     u8"$n makes a dexterous move and kicks $s left leg away with $s right.",
+     u8"You tackle $S $t.",
+     u8"$n tackles $N's $t.",
+     u8"$n tackles your $t.",
+     u8"You tackle $p.",
+     u8"$n tackles $p."},
+    {u8"You give out a big 'TADA!' and jazz your hands!",
+     u8"$n gives a big 'TADA!' as $e jazzes $s hands!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You should really be tagging someone specific.",
+     u8"$n seems to want to play tag!",
+     u8"You tag $M and scream \"YOU'RE IT!\"",
+     u8"$n tags $N and screams, \"YOU'RE IT!\"",
+     u8"$n tags you!  YOURE IT!!!!",
+     u8"Swing.. miss.. dang, they must have run off.",
+     u8"You tag yourself and say, \"I'M IT!\"",
+     u8"$n tags $mself and says, \"I'M IT!\"",
+     u8"You tag $S $t.",
+     u8"$n tags $N's $t.",
+     u8"$n tags your $t.",
+     u8"You tag $p.",
+     u8"$n tags $p."},
+    {u8"With whom would you like to tango?",
+     u8"$n puts a rose between $s teeth, but takes it out since no one joins $m.",
+     u8"You put a rose between your teeth and tango with $M seductively.",
+     u8"$n puts a rose between $s teeth and tangos with $N seductively.",
+     u8"$n puts a rose between $s teeth and tangos with you seductively.",
+     u8"That person isn't around.  Better sit this one out.",
+     u8"Feels rather stupid, doesn't it?",
+     u8"$n puts a rose between $s teeth and tries to tango with $mself.",
+     u8"You tango with $S $t.",
+     u8"$n tangos with $N's $t.",
+     u8"$n tangos with your $t.",
+     u8"You tango with $p.",
+     u8"$n tangos with $p."},
+    {u8"You flop to the floor having a tantrum.",
+     u8"$n flops to the floor, flailing $s arms in tantrum.",
+     u8"You flop to the floor, flailing your arms in tantrum at $N.",
+     u8"$n flops to the floor, flailing $s arms in tantrum at $N.",
+     u8"$n flops to the floor, flailing $s arms in tantrum at you.",
+     u8"Pity they aren't here to witness your performance.",
+     u8"You flop to the floor, flailing your arms in frustration at yourself.",
+     u8"$n flops to the floor, flailing $s arms in tantrum at $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"You flop to the floor, flailing your arms in tantrum at $p.",
+     u8"$n flops to the floor, flailing $s arms in tantrum at $p."},
+    {u8"You tap your foot impatiently.",
+     u8"$n starts tapping $s foot.",
+     u8"You tap $M on the shoulder.",
+     u8"$n taps $N on the shoulder.",
+     u8"$n taps you on the shoulder.",
+     u8"You move to tap them -- but they are gone.",
+     u8"You knowingly tap yourself on the side of your head.",
+     u8"$n knowingly taps $mself on the side of $s head.",
+     u8"You tap $S $t.",
+     u8"$n taps $N's $t.",
+     u8"$n taps your $t.",
+     u8"You tap $p.",
+     u8"$n taps $p."},
+    {u8"You do a little tapdance for everyone's amusement.",
+     u8"$n does a little tapdance for everyone's amusement.",
+     u8"You do a little tapdance for $N's amusement.",
+     u8"$n does a little tapdance for $N's amusement.",
+     u8"$n does a little tapdance for your amusement.",
+     u8"You do a fantastic dance, but that person is not here to see it.",
+     u8"You tapdance happily for yourself.",
+     u8"$n tapdances happily for $mself.",
+     u8"You do a tapdance on $N's $t.",
+     u8"$n does a tapdance on $N's $t.",
+     u8"$n does a tapdance on your $t.",
+     u8"You do a tapdance around $p.",
+     u8"$n does a tapdance around $p."},
+    {u8"You look for a target to attack.",
+     u8"$n looks for a target to attack.",
+     u8"You target $N, making sure not to mess up and miss.",
+     u8"$n targets $N, preparing to attack!",
+     u8"$n targets you for attack. Better hope $e misses!",
+     u8"You can't target someone that isn't here you nimrod!",
+     u8"You point your weapon at yourself, attempting to commit suicide.",
+     u8"$n points $s weapon at $mself, preparing to commit suicide!",
+     u8"You target $S $t.",
+     u8"$n targets $N's $t!",
+     u8"$n targets your $t, watch out!!!",
+     u8"You target $p.",
+     u8"$n targets $p."},
+    {u8"You taunt the nothing in front of you.",
+     u8"$n taunts something that seems to be right in front of $m.",
+     u8"You taunt $M, to your own delight.",
+     u8"$n taunts $N rather insultingly.  $n seems to enjoy it tremendously.",
+     u8"$n taunts you.  It really hurts your feelings.",
+     u8"Hmmmmmmm.....nope, no one by that name here.",
+     u8"You taunt yourself, almost making you cry...:(",
+     u8"$n taunts $mself to tears.",
+     u8"You taunt $S $t.",
+     u8"$n taunts $N's $t.",
+     u8"$n taunts your $t.",
+     u8"You taunt $p.",
+     u8"$n taunts $p."},
+    {u8"Please don't play these games with me, you tease!",
+     u8"$n is such a tease.",
+     u8"You tease $M.",
+     u8"$n teases $N. Tee Hee Hee Hee...",
+     u8"$n teases you gently.",
+     u8"Hmmmmmmm.....nope, no one by that name here.",
+     u8"You tease yourself, this is fun!",
+     u8"$n teases $mself. What a peculiar person.",
+     u8"You tease $S $t.",
+     u8"$n teases $N's $t.",
+     u8"$n teases your $t.",
+     u8"You tease $p.",
+     u8"$n teases $p."},
+    {u8"This action is unfinished.",
+     u8"This action is unfinished.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Thank you too.",
+     u8"$n thanks everyone.",
+     u8"You thank $N heartily.",
+     u8"$n thanks $N heartily.",
+     u8"$n thanks you heartily.",
+     u8"No one answers to that name here.",
+     u8"You thank yourself since nobody else wants to!",
+     u8"$n thanks $mself since you won't.",
+     u8"You thank $S $t.",
+     u8"$n thanks $N's $t.",
+     u8"$n thanks your $t.",
+     u8"You thank $p.",
+     u8"$n thanks $p."},
+    {u8"You think about life, the universe and everything.",
+     u8"$n sinks deeply into thought about the meaning of life.",
+     u8"You think about what purpose $E has in relation to your part of life.",
+     u8"$n stops and thinks about $N, completely lost in thought.",
+     u8"Your ears burn as $n thinks about you.. you wonder what about.",
+     u8"You'd better think harder, if you hope to make contact!",
+     u8"You think about yourself (for once).",
+     u8"$n thinks about $mself for a change.....(?)",
+     u8"You think about $S $t.",
+     u8"$n thinks about $N's $t.",
+     u8"$n thinks about your $t.",
+     u8"You spend some time thinking about $p.",
+     u8"$n seems to be spending a lot of time thinking about $p."},
+    {u8"You threaten everyone and everything, you are just that good.",
+     u8"$n threatens everyone and everything.",
+     u8"You threaten $M.",
+     u8"$n threatens $N.",
+     u8"$n threatens you.",
+     u8"They ran away in fear before you could threaten them.",
+     u8"You threaten yourself, that's an under statement.",
+     u8"$n threatens $mself. No duh!",
+     u8"You threaten $S $t.",
+     u8"$n threatens $N's $t.",
+     u8"$n threatens your $t.",
+     u8"You threaten $p.",
+     u8"$n threatens $p."},
+    {u8"You seem very happy today.",
+     u8"$n gives everyone a big thumbs up.",
+     u8"You give $N a big thumbs up.",
+     u8"$n gives $N a big thumbs up.",
+     u8"$n gives you a big thumbs up.",
+     u8"You don't see that person.",
+     u8"You feel extremely silly.",
+     u8"$n gives $mself a big thumbs up.  How silly.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Thwap?? THWAP?! Thwap WHO?!",
+     u8"$n puts $s hand out, looking for someone to thwap.",
+     u8"You pull back your hand and THWAP $N.",
+     u8"$n pulls back $s hand and THWAPs $N!",
+     u8"$n pulls back $s hand and THWAPs you!",
+     u8"You thwap thin air..",
+     u8"You pull back your hand and.. THWAP!",
+     u8"$n pulls back $s hand and THWAPS $mself.",
+     u8"You THWAP $N's $t.",
+     u8"$n THWAPs $N's $t.",
+     u8"$n THWAPs your $t!",
+     u8"You pull back your hand and THWAP $p.",
+     u8"$n pulls back and THWAPs $p."},
+    {u8"Who do you want to tickle??",
+     u8"$n is looking for someone to tickle.",
+     u8"You tickle $N.",
+     u8"$n tickles $N.",
+     u8"$n tickles you - hee hee hee.",
+     u8"Who is that??",
+     u8"You tickle yourself, how funny!",
+     u8"$n tickles $mself.",
+     u8"You tickle $S $t.",
+     u8"$n tickles $N's $t.",
+     u8"$n tickles your $t.",
+     u8"You tickle $p.",
+     u8"$n tickles $p."},
+    {u8"Whom do you wish to tie?",
+     u8"",
+     u8"You tie $M up with all possible speed!",
+     u8"$n ties $N up!",
+     u8"You find yourself being tied up by $n!",
+     u8"That person is not here!",
+     u8"You can't tie yourself up!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You tip your hat gallantly.",
+     u8"$n gallantly tips $s hat.",
+     u8"You tip your hat to $M.",
+     u8"$n gallantly tips $s hat to $N.",
+     u8"$n gallantly tips $s hat to you.",
+     u8"Who?",
+     u8"That's silly. You tip your hat to yourself.",
+     u8"$n tips $s hat to $mself.",
+     u8"You tip your hat at $S $t.",
+     u8"$n tips $s hat at $N's $t.",
+     u8"$n tips $s hat at your $t.",
+     u8"You tip your hat at $p.",
+     u8"$n tips $s hat at $p."},
+    {u8"You titter nervously.",
+     u8"$n titters nervously.",
+     u8"You titter nervously and shrink away from $N.",
+     u8"$n titters nervously and shrinks away from $N.",
+     u8"$n titters nervously and shrinks away from you.",
+     u8"They've left, phew!",
+     u8"You titter privately to yourself.",
+     u8"$n titters privately to $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"Looking for someone to toast eh, you pyromaniac!",
+     u8"$n looks around for someone $e can toast... HIDE!",
+     u8"You pull out a pocket dragon and squeeze it at $N. You wicked you!",
+     u8"$n pulls out a pocket dragon and toasts $N. $N is no more. $N is ashes, ashes and only ashes, and the ashes blow away in the wind. Buhbye $N.",
+     u8"$n pulls out a pocket dragon and toasts you. You are no more! Ow...",
+     u8"POOF! Maybe your victim disintegrated... Then again, maybe it was just a figment of your imagination.",
+     u8"You toast yourself. You are no more! Ow...",
+     u8"$n toasts $mself. $n is no more. $n is ashes, ashes and only ashes, and the ashes blow away in the wind. Buhbye $n.",
+     u8"",
+     u8"",
+     u8"",
+     u8"You pull out a pocket dragon and squeeze it at $p. $p bursts in flame. $p is toast. Poor $p.",
+     u8"$n pulls out a pocket dragon and squeezes it at $p. $p bursts in flame. $p is toast. Poor $p."},
+    {u8"You stick your tongue out.",
+     u8"$n sticks $s tongue out.",
+     u8"You stick your tongue out at $M.",
+     u8"$n sticks $s tongue out at $N.",
+     u8"$n sticks $s tongue out at you.",
+     u8"That's a little hard to do, what with no-one being there.",
+     u8"You stick your tongue out at yourself... How the?!",
+     u8"$n sticks $s tongue out at $mself... Somehow.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You're feeling very touchy!",
+     u8"$n is feeling very touchy!",
+     u8"You touch $M.",
+     u8"For some reason, $n has just touched $N.",
+     u8"For some reason, $n has just touched you.",
+     u8"You can't touch that person, they don't exist.",
+     u8"You touch yourself, eww!",
+     u8"$n does something a little discusting.",
+     u8"You curiously touch $S $t.",
+     u8"$n curiously touches $N's $t.",
+     u8"$n curiously touches your $t.",
+     u8"You curiously touch $p.",
+     u8"$n curiously touches $p."},
+    {u8"You sit down in a yogin style position and begin to go, \"Huuuuuuuuuuuuuuuuuuuu\"",
+     u8"$n sits down with crossed legs and goes, \"Huuuuuuuuuuuuuuuuuuuuuuu\" slowly.",
+     u8"You try to put $N into a trance.",
+     u8"$n tries to put $N into a trance.",
+     u8"$n tries to put you into a trance.",
+     u8"You stare and stare but can't find anyone to put into a trance.",
+     u8"You put yourself into a deep trance, to never awaken again.",
+     u8"$n puts $mself into a deep trance.",
+     u8"You try to put $S $t into a deep trance.",
+     u8"$n tries to put $N's $t into a trance.",
+     u8"$n tries to put your $t into a deep trance.",
+     u8"You try to put $p into a deep trance.",
+     u8"$n tries to put $p into a deep trance."},
+    {u8"Feeling very irritated, you tsk.",
+     u8"$n is irritated and starts to tsk.",
+     u8"You tsk at $N.",
+     u8"$n tsks at $N.",
+     u8"$n tsks at you.",
+     u8"Who's that supposed to be? I don't see anyone.",
+     u8"You tsk quietly to yourself.",
+     u8"$n tsks quietly to $mself.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You grab a big cozy blanket... ready to tuck someone in!",
+     u8"$n grabs a big cozy blanket... ready to tuck someone in!",
+     u8"You grab a big cozy blanket and tuck it warmly around $N.",
+     u8"$n grabs a big cozy blanket and tucks it warmly around $N.",
+     u8"$n grabs a big cozy blanket and tucks it warmly around you.",
+     u8"You go to tuck them in but they're not here!",
+     u8"You grab a big cozy blanket and tuck yourself in.",
+     u8"$n grabs a big cozy blanket and tucks $mself in.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You tug on your clothes a bit.",
+     u8"$n tugs on $s clothes a bit.",
+     u8"You tug on $N to try and get $S attention.",
+     u8"$n tugs on $N to try and get $S attention.",
+     u8"$n tugs on you to try and get your attention.",
+     u8"What are you trying to tug on?  Air?",
+     u8"That's silly. You tug on yourself.",
+     u8"$n tugs on $mself.",
+     u8"You tug on $S $t.",
+     u8"$n tugs on $N's $t.",
+     u8"$n tugs on your $t.",
+     u8"$n tug on $p.",
+     u8"$n tugs on $p."},
+    {u8"You rub your tummy, wishing you had bought that bagel earlier.",
+     u8"$n rubs $s tummy, $e looks famished!",
+     u8"You vigorously rub $M in the tummy!",
+     u8"$n vigorously rubs $N's tummy!",
+     u8"$n vigorously rubs your tummy!",
+     u8"Whos tummy did you want to rub?",
+     u8"You rub your tummy, wishing you had bought that bagel earlier.",
+     u8"$n rubs $s tummy, $e looks famished!",
+     u8"You look at $S $t and rub your tummy hungrily.",
+     u8"$n looks at $N's $t and rubs $s tummy hungrily.",
+     u8"$n looks at your $t and rubs $s tummy hungrily.",
+     u8"You look at $p and rub your tummy hungrily.",
+     u8"$n looks at $p and rubs $s tummy hungrily."},
+    {u8"You look for a cheek to tweak.",
+     u8"$n starts scanning $s surroundings, flexing her fingers.",
+     u8"You tweak $S's cheek.",
+     u8"$n tweaks $N's cheek.",
+     u8"$n tweaks your cheek.",
+     u8"Aw, no cheek to be found!",
+     u8"You tweak your own cheek... Such a beautiful blush!",
+     u8"$n tweaks $s cheek... Look at that blush!",
+     u8"You tweak $S $t",
+     u8"$n tweaks $N's $t",
+     u8"$n tweaks your $t",
+     u8"You tweak $p",
+     u8"$n tweaks $p"},
+    {u8"You patiently twiddle your thumbs.",
+     u8"$n patiently twiddles $s thumbs.",
+     u8"You twiddle your thumbs patiently as you wait for $N.",
+     u8"$n twiddles $s thumbs patiently as $e waits for $N.",
+     u8"$n twiddles $s thumbs, patiently waiting for you.",
+     u8"They left before you could twiddle at them.",
+     u8"You twiddle your thumbs impatiently.",
+     u8"$n twiddles $s thumbs impatiently.",
+     u8"You twiddle your thumbs at $S $t.",
+     u8"$n twiddles $s thumbs at $N's $t.",
+     u8"$n twiddles $s thumbs at your $t.",
+     u8"You twiddle your thumbs at $p.",
+     u8"$n twiddles $s thumbs at $p."},
+    {u8"You lie there, twitching helplessly.",
+     u8"$n lies there, twitching helplessly.",
+     u8"Your facial tick twitches at the thought of $N.",
+     u8"$n's facial tick twitches at the thought of $N.",
+     u8"$n's facial tick twitches at the thought of you.",
+     u8"Bad corpse! They're not there.",
+     u8"Your limp body twitches slightly.",
+     u8"$n's limp body twitches slightly.",
+     u8"You twitch at the thought of $S $i.",
+     u8"$n twitches at the thought of $N's $i.",
+     u8"$n twitches at the thought of your $i.",
+     u8"You twitch at the thought of $p.",
+     u8"$n twitches at the thought of $p."},
+    {u8"You thro up yor handz in dizgust at yur lousy tiping skils.",
+     u8"$n couldn't type a period if there was only one key on the keyboard!",
+     u8"You declare $N to be inept at typing.",
+     u8"$n declares $N to be inept at typing.",
+     u8"$n declares you to be inept at typing.",
+     u8"They left before you could comment on their typing abilities.",
+     u8"You declare yourself to be inept at typing.",
+     u8"$n declares $mself to be inept at typing.",
+     u8"You declare $S $t to be inept at typing..",
+     u8"$n declares that $N's $t is inept at typing.",
+     u8"$n declares your $t to be inept at typing.",
+     u8"You blame $p on all your typing mistakes.",
+     u8"$n blames $p on all $s typing mistakes."},
+    {u8"You nod in understanding.",
+     u8"$n nods in understanding.",
+     u8"You nod in understanding with $M.",
+     u8"$n nods in understanding with $N.",
+     u8"$n nods in understanding with you.",
+     u8"Understand them - you can't even find them.",
+     u8"You finally understand yourself.",
+     u8"$n finally understands $mself after all these years.",
+     u8"You nod at $S $t in complete understanding.",
+     u8"n nods at $N's $t in complete understanding.",
+     u8"$n nods at your $t in complete understanding",
+     u8"You look at $p and nod in understanding.",
+     u8"$n looks at $p and nods in complete understanding."},
+    {u8"You unsheathe your weapon, getting ready to fight.",
+     u8"$n unsheathes $s weapon, getting ready to fight.",
+     u8"You unsheathe your weapon and point it at $M.",
+     u8"$n unsheathes $s weapon and points it at $N.",
+     u8"$n unsheathes $s weapon and points it at you.",
+     u8"You decide to leave it sheathed, after all you don't see that person here.",
+     u8"You unsheathe your weapon and put it to your throat.",
+     u8"$n unsheathes $s weapon and puts it to $s throat.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"'Bla.. I vant to suck yer blood!'",
+     u8"$n throws up $s hands and says, 'Bla.. I vant to suck yer blood!'",
+     u8"You turn to $N and tell $M, 'Bla.. I vant to suck yer blood!'",
+     u8"$n turns to $N and tells $M, 'Bla.. I vant to suck yer blood!'",
+     u8"$n turns to you and tells you, 'Bla.. I vant to suck yer blood!'",
+     u8"You don't see them here.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You perform careful maintenance on your vice and attach the four foot crank extension.",
+     u8"$n expertly strips down the vice and carefully oils the steel parts. Satisfied, $n reassembles the vice and attaches the four-foot extension to the crank.",
+     u8"You place $S head in the jaws of the vice and tighten them enough to prevent movement. Slowly, you crank the vice tighter and tighter, enjoying the rising amplitude of the screams until the splintering climax when the skull shatters. $N is quiet now.",
+     u8"$n stuns $N with a quick punch and forces $S head into the vice. $N screams and thrashes helplessly but the steel jaws hold $M tight. Grinning sadistically, $n slowly turns the crank until the skull cracks with a sickening pop. $N has been silenced.",
+     u8"$n forces your head into the vice and tightens the steel jaws preventing all movement. Smiling sadistically, $e cranks the handle as your screaming headache becomes everything. Then there is nothing but peace.",
+     u8"Your vice remains empty.",
+     u8"You place your own head into a vice and turn the crank until your consciousness fades.",
+     u8"$n puts $s own head into a vice and turns the crank until there is a loud pop.",
+     u8"You place $S $t in the jaws of the vice and tighten them enough to prevent movement. Slowly, you crank the vice tighter and tighter, enjoying the rising amplitude of the screams until the splintering climax when the $t shatters. $N is quiet now.",
+     u8"$n stuns $N with a quick punch and forces $S $t into the vice. $N screams and thrashes helplessly but the steel jaws hold $M tight. Grinning sadistically, $n slowly turns the crank until the $t cracks with a sickening pop. $N has been silenced.",
+     u8"$n forces your $t into the vice and tightens the steel jaws preventing all movement. Smiling sadistically, $e cranks the handle as your screaming $tache becomes everything. Then there is nothing but peace.",
+     u8"",
+     u8""},
+    {u8"You waggle your eyebrows impressively. Go, caterpillars, go!",
+     u8"$n waggles $s eyebrows. Geez, look at those caterpillars go!",
+     u8"You give $M a good, solid waggle!",
+     u8"$n grabs $N's eyebrows and waggles them good. What a sight!",
+     u8"$n grabs your eyebrows and waggles them! Oi!",
+     u8"You look around for eyebrows to waggle but sadly, find none. Shoot!",
+     u8"You grab a firm hold of your eyebrows and give them a good waggle. Are they misbehaving?",
+     u8"$n grabs a firm hold of her eyebrows and starts to waggle them with fervor. Will they stay put??",
+     u8"You waggle at $S $t. Now look at that!",
+     u8"$n waggles $s eyebrows at $N's $t. Oohyah!",
+     u8"$n waggles $s eyebrows at your $t. Oi oi!",
+     u8"You waggle $p. Wow!",
+     u8"$n waggles $p. Eep!"},
+    {u8"You put your hand up.",
+     u8"$n raises $s hand, as if to say, \"Wait\".",
+     u8"You tell $N to hold on a minute.",
+     u8"$n tells $N to wait just a minute.",
+     u8"$n tells you to wait just a minute.",
+     u8"Who?",
+     u8"Why would you want to do that?",
+     u8"$n tells $mself to just wait one minute.",
+     u8"You tell $S $t to hold on for one minute.",
+     u8"$n tell $N's $t to hold on for one minute.",
+     u8"$n tells your $t to hold on for one minute.",
+     u8"You tell $p to hold on for one minute.",
+     u8"$n tells $p to hold on for one minute."},
+    {u8"Wow, that sounds like a cool word!",
+     u8"$n bluntly says 'Wakka wakka'",
+     u8"You say 'Wakka Wakka' to $N.",
+     u8"$n bluntly says 'Wakka Wakka' to $N.",
+     u8"$n says 'Wakka wakka' rather loudly to you.",
+     u8"They arn't here.",
+     u8"Why must you talk to yourself?",
+     u8"$n seems to be talking with himself...strange.",
+     u8"Why are you talking to $N's $t?",
+     u8"&n is talking to $N's $t...time to see a doctor.",
+     u8"$n mumbles something to your $t.",
+     u8"You mumble something to $p.",
+     u8"$n mumbles somthing to $p."},
+    {u8"You ask around if anyone would like to join you for a waltz.",
+     u8"$n would like to perform a waltz with someone.",
+     u8"You sweep $N into a glorious waltz!",
+     u8"$n sweeps $N off $S feet into a beautiful waltz!",
+     u8"$n sweeps you into a glorious waltz!",
+     u8"You need to waltz with someone real, not your imaginary friend!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You holler your favourite warcry.",
+     u8"$n screams $s fiercest warcry, 'MOMMIEEEEEeeeee!'",
+     u8"You scream a warcry at $M.",
+     u8"$n screams a warcry at $N.",
+     u8"$n screams a warcry in your ear!",
+     u8"No one can hear your warcry.",
+     u8"Are you that mad at yourself?",
+     u8"$n screams a warcry at $mself.",
+     u8"You scream a warcry at $S $t.",
+     u8"$n screams a warcry at $N's $t.",
+     u8"$n screams a warcry at your $t.",
+     u8"You scream a warcry at $p.",
+     u8"$n screams a warcry at $p."},
+    {u8"You wave.",
+     u8"$n waves.",
+     u8"You wave to $N.",
+     u8"$n waves to $N.",
+     u8"$n waves to you.  Have a good journey.",
+     u8"They didn't wait for you to wave.",
+     u8"Are you going on adventures as well??",
+     u8"$n waves to $mself.",
+     u8"You wave to $S $t.",
+     u8"$n waves to $N's $t.",
+     u8"$n waves to your $t.",
+     u8"You wave to $p.",
+     u8"$n waves to $p."},
+    {u8"You welcome everyone back.",
+     u8"$n welcomes everyone back.",
+     u8"You welcome $M back.",
+     u8"$n welcomes $N back.",
+     u8"$n welcomes you back.",
+     u8"They left before you could welcome them back.",
+     u8"You welcome yourself back to the real world.",
+     u8"$n welcomes $mself back. Strange, very strange.",
+     u8"You welcome $S $t back.",
+     u8"$n welcomes $N's $t back.",
+     u8"$n welcomes your $t back.",
+     u8"You welcome $p back.",
+     u8"$n welcomes $p back."},
+    {u8"Who do you want to give a wedgie to?",
+     u8"$n is looking for someone to give a wedgie to.",
+     u8"You grab $N's underwear and pull it way up $S crack, that'll show em!",
+     u8"$n gives $N a massive wedgie, you might be next...RUN!",
+     u8"$n gives you a huge wedgie, feels like it went to your tonsils...REVENGE!",
+     u8"Sorry, they aren't here.",
+     u8"You reach behind yourself and yank your underwear up your crack, YOU ARE SICK!!",
+     u8"$n reaches behind $mself and pulls $s underwear up $s crack....EWWW how gross!!",
+     u8"You want to give $S $t a wedgie, but don't know how.",
+     u8"$n wants to give $N's $t a wedgie, but doesn't know how.",
+     u8"$n wants to give your $t a wedgie, but doesn't know how.",
+     u8"You want to give $p a wedgie, but you think better of it.",
+     u8"$n wants to give $p a wedgie, but thinks better of it."},
+    {u8"You shed tears everywhere, what a mess!",
+     u8"$n weeps loudly drenching you!",
+     u8"You weep on $N, effectively drenching $M!",
+     u8"$n weeps all over $N, drenching $M!",
+     u8"$n soaks you with $s tears!",
+     u8"Since that player is not readily available you weep all over yourself instead.",
+     u8"You weep all over yourself!",
+     u8"$n sheds multiple tears drenching $s clothes and face.",
+     u8"You weep on $S $t.",
+     u8"$n weeps on $N's $t.",
+     u8"$n weeps on your $t.",
+     u8"You weep on $p.",
+     u8"$n weeps on $p."},
+    {u8"You welcome everyone.",
+     u8"$n welcomes everyone.",
+     u8"You welcome $M.",
+     u8"$n welcomes $N.",
+     u8"$n welcomes you.",
+     u8"Please -- try someone who is here?",
+     u8"So, you've finally discovered yourself!",
+     u8"$n welcomes $mself.. $e always was a strange one.",
+     u8"You welcome $S $t.",
+     u8"$n welcomes $N's $t.",
+     u8"$n welcomes your $t.",
+     u8"You welcome $p.",
+     u8"$n welcomes $p."},
+    {u8"You take out your spongy bat of whacking.  Who wants some??",
+     u8"$n takes out a giant spongy bat and grins a devilish grin.",
+     u8"You take out your spongy bat of whacking and whack the muffins out of $M.",
+     u8"$n goes on a wild whacking-rampage on $N.",
+     u8"$n starts whacking you uncontrollably with a giant spongy bat.",
+     u8"You whack whack whack....wait...they're not here. dumbass.",
+     u8"You whack yourself with a spongy bat. Ahh, the joys of life!",
+     u8"$n whacks $mself with a giant spongy bat.",
+     u8"You whack at $N's $t with your mighty spongy bat.",
+     u8"$n whacks $N's $t with $s spongy bat, like a wild Britney Spears on steroids!",
+     u8"$n mercilessly whacks at your $t.",
+     u8"You whack at $p with your spongy bat.",
+     u8"$n starts whacking at $p for absolutely no reason whatsoever."},
+    {u8"You whimper pitifully.",
+     u8"$n whimpers pitifully.",
+     u8"With a tear in your eye, you whimper pitifully at $N.",
+     u8"With a tear in $s eye, $n whimpers pitifully at $N.",
+     u8"With a tear in $s eye, $n whimpers pitifully at you.",
+     u8"Now, we both know that that person is not there.",
+     u8"You whimper pitifully about how unfair everyone is to you.",
+     u8"$n whimpers pitifully about how unfair everyone is to $m.",
+     u8"You whimper pitifully at the loss of $N's $t.",
+     u8"$n whimpers pitifully at the loss of $N's $t.",
+     u8"$n whimpers pitifully at the loss of your $t.",
+     u8"",
+     u8""},
+    {u8"You whine pitifully.",
+     u8"$n whines pitifully about the whole situation.",
+     u8"You whine at $M.",
+     u8"$n starts whining at $N.",
+     u8"$n whines at you. How pathetic.",
+     u8"You can whine, but no one will care.",
+     u8"You whine to yourself -- poor you.",
+     u8"$n whines piteously about the whole situation.",
+     u8"You whine to $S $t.",
+     u8"$n whines to $N's $t.",
+     u8"$n whines to your $t.",
+     u8"You whine to $p.",
+     u8"$n whines to $p."},
+    {u8"You break out your bullwhip and crack it loudly!",
+     u8"$n grabs $s bullwhip and cracks it loudly in the air!",
+     u8"You crack your bullwhip at $N barely missing!",
+     u8"$n cracks $s bullwhip at $N, barely missing!",
+     u8"$n cracks $s bullwhip at you, it just barely misses!",
+     u8"Awww, they must have seen that bullwhip and ran....",
+     u8"You rub your bullwhip as your eyes take on a daring look.",
+     u8"$n rubs $s bullwhip and gets a daring look in $s eyes.",
+     u8"You crack your bullwhip at $S $t, barely missing!",
+     u8"$n cracks $s bullwhip at $N's $t, barely missing!",
+     u8"$n cracks $s bullwhip at your $t, barely missing!",
+     u8"You crack your bullwhip at $p, barely missing!",
+     u8"$n cracks $s bullwhip at $p, barely missing!"},
+    {u8"You whistle appreciatively.",
+     u8"$n whistles appreciatively.",
+     u8"you whistle a happy tune.",
+     u8"$n whistles a happy tune at $N.",
+     u8"$n whistles a happy tune at you -- do you know $m.",
+     u8"Who do you want to whistle at?",
+     u8"Woah! You know you got it.",
+     u8"$n whistles a happy tune.",
+     u8"You whistle at $N's $t",
+     u8"$n whistles appreciatively at $N's $t",
+     u8"$n whistles appreciatively at your $t",
+     u8"You whistle appreciatively at $p.",
+     u8"$n whistles appreciatively at $p."},
+    {u8"You go, \"Whoo-hoo!\"",
+     u8"$n goes, \"Whoo-hoo!\"",
+     u8"You give $M a \"Whoo-hoo!\"",
+     u8"$n gives $N a \"Whoo-hoo!\"",
+     u8"$n gives you a \"Whoo-hoo!\"",
+     u8"\"Whoo-hoo!\" away, the're not here.",
+     u8"No one else will do it, you may as well do it yourself. \"Whoo-hoo!\"",
+     u8"$n must be desperate for attention, $e is screaming \"Whoo-hoo!\"",
+     u8"You look at $S $t and scream at the top of your lungs \"Whoo-hoo!\"",
+     u8"$n looks at $N's $t and screams \"Whoo-hoo!\"",
+     u8"$n looks at your $t and screams \"Whoo-hoo!\"",
+     u8"You look at $p and scream \"Whoo-hoo!\"",
+     u8"$n looks at $p and screams \"Whoo-hoo!\""},
+    {u8"You wiggle your bottom.",
+     u8"$n wiggles $s bottom.",
+     u8"You wiggle your bottom at $M.",
+     u8"$n wiggles $s bottom at $N.",
+     u8"$n wiggles $s bottom at you -- do you know $m.",
+     u8"You wiggle like a worm, but no one notices.",
+     u8"You wiggle yourself!",
+     u8"$n wiggles $s bottom at $mself, $e never was the brightest crayon in the box.",
+     u8"You wiggle your bottom at $S $t.",
+     u8"$n wiggles $s bottom at $N's $t.",
+     u8"$n wiggles $s bottom at your $t.",
+     u8"You wiggle your bottom at $p.",
+     u8"$n wiggles $s bottom at $p."},
+    {u8"You wince.",
+     u8"$n winces.",
+     u8"You wince at what $N did.",
+     u8"$n winces at what $N just did.",
+     u8"$n winces at what you just did.",
+     u8"Can't wince at someone who isn't here, eh?",
+     u8"You wince at yourself.",
+     u8"$n winces at $mself",
+     u8"You look at $S $t and wince.",
+     u8"$n looks at $N's $t and winces.",
+     u8"$n looks at your $t and winces.",
+     u8"You wince at the damage done to $p.",
+     u8"$n winces at the damage done to $p."},
+    {u8"Have you got something in your eye?",
+     u8"$n winks.",
+     u8"You wink at $N.",
+     u8"$n winks at $N.",
+     u8"$n winks at you.",
+     u8"No one with that name is present.",
+     u8"You wink at yourself?? -- what are you up to?",
+     u8"$n winks at $mself -- something strange is going on...",
+     u8"You wink at $S $t.",
+     u8"$n winks at $N's $t.",
+     u8"$n winks at your $t.",
+     u8"You wink at $p.",
+     u8"$n winks at $p."},
+    {u8"You wipe your nose.",
+     u8"$n wipes $s nose.",
+     u8"You wipe $N's nose -- what a mess!",
+     u8"$n tries to wipe $N's nose.",
+     u8"$n wipes your nose.",
+     u8"That person is not here.",
+     u8"You wipe your nose.",
+     u8"$n tries to wipe $s nose.",
+     u8"You wipe $S $t.",
+     u8"$n wipes $N's $t.",
+     u8"$n wipes your $t.",
+     u8"You wipe $p.",
+     u8"$n wipes $p."},
+    {u8"You are in awe of the beauty, intellect, and driving skills of women.",
+     u8"$n is in awe of the beauty, intellect, and driving skills of women.",
+     u8"You remind $N of the beauty, intellect, and driving skills of women.",
+     u8"$n reminds $N of the beauty, intellect, and driving skills of women.",
+     u8"$n reminds you of the beauty, intellect, and driving skills of women.",
+     u8"Your awe goes sadly unnoticed.",
+     u8"You remind yourself of the beauty, intellect, and driving skills of women.",
+     u8"$n reminds $mself of the beauty, intellect, and driving skills of women.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You wonder about many things...",
+     u8"$n has a look of wonder on $s face.",
+     u8"You wonder about $N's sanity.",
+     u8"$n wonders about $N's sanity.",
+     u8"$n wonders about your sanity.",
+     u8"I can't see that person here, perhaps you need some glasses?",
+     u8"You wonder about your sanity, and so do I!",
+     u8"$n wonders about $s own sanity.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You can't help but be very worried.",
+     u8"$n can't help but be very worried.",
+     u8"You worry about $N.",
+     u8"$n worries about $N.",
+     u8"$n worries about you.",
+     u8"They're not here, but I'm sure they appreciate the concern.",
+     u8"You can't help but be very worried about yourself.",
+     u8"$n can't help but be very worried about $mself.",
+     u8"$N's $t is very worrying indeed.",
+     u8"$n finds $N's $t very worrying indeed.",
+     u8"$n finds your $t very worrying indeed.",
+     u8"You find $p very worrying indeed.",
+     u8"$n finds $p very worrying indeed."},
+    {u8"You find yourself head-down in the dirt, worshipping.",
+     u8"$n starts worshipping nothing at all.",
+     u8"You fall to your knees and worship $M deeply.",
+     u8"$n falls to $s knees, worshipping $N with uncanny dedication.",
+     u8"$n kneels before you in solemn worship.",
+     u8"Uh.. who?  They're not here, pal.",
+     u8"You seem sure to have found a true deity.....",
+     u8"$n falls to $s knees and humbly worships $mself.",
+     u8"You fall to your knees and worship $S $t.",
+     u8"$n falls to $s knees and worships $N's $t.",
+     u8"$n falls to $s knees and worships your $t.",
+     u8"You fall to your knees and worship $p.",
+     u8"$n falls to $s knees and worships $p."},
+    {u8"You couldn't find the right social if your life depended on it.",
+     u8"$n couldn't find the right social if $s life depended on it.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You yawn broadly.",
+     u8"$n yawns from exhaustion.",
+     u8"You yawn sleepily at $N.",
+     u8"$n yawns sleepily at $N.",
+     u8"$n yawns sleepily at you. Are you really that boring?",
+     u8"No one with that name is present.",
+     u8"You cause yourself to yawn! You truly are a dull person.",
+     u8"$n yawns at $mself. Talk about dull!",
+     u8"You yawn at $S $t suggestively.",
+     u8"$n yawns at $N's $t sleepily.",
+     u8"$n yawns at your $t sleepily.",
+     u8"You yawn at $p sleepily.",
+     u8"$n yawns at $p sleepily."},
+    {u8"Yay for whom?",
+     u8"",
+     u8"You cry out, 'Yay for $N!'",
+     u8"$n cries out, 'Yay for $N!'",
+     u8"$n cries out, 'Yay for $N!' and you feel special.",
+     u8"You could if that person were here.",
+     u8"No one else appreciates you. You cry out, 'Yay for me!'",
+     u8"$n cries out, 'Yay for me!' since no one else was going to.",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You give out a polite, 'Yes.'",
+     u8"$n gives out a polite, 'Yes.'",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+    {u8"You start yodelling loudly and rather beautifully in your own ears.",
+     u8"$n starts a yodelling session that goes right to the bone.",
+     u8"You yodel at $N.",
+     u8"$n yodels in $N's ear. Yodelayheehoo!",
+     u8"$n yodels in your ear -- Yodelayheehoo!",
+     u8"Heh heh, your victim seems to have fled -- very wise.",
+     u8"Yodelayheehoo!",
+     u8"$n yodels quietly to $mself.",
+     u8"You yodel to $S $t.",
+     u8"$n yodels to $N's $t.",
+     u8"$n yodels to your $t.",
+     u8"You yodel to $p.",
+     u8"$n yodels to $p."},
+    {u8"You summon zeke and strike the ground with it.",
+     u8"$n summons zeke and strikes the ground with it.",
+     u8"You summon zeke and zap the hell out of $N.",
+     u8"$n summons zeke and zaps the hell out of $N.",
+     u8"$n summons zeke and zaps the hell out of you! You feel fried.",
+     u8"Zap who?",
+     u8"That HURT! Didn't your mother teach you better?",
+     u8"$n screams in pain as $e zaps $mself.",
+     u8"You zap $S $t.",
+     u8"$n zaps $N's $t.",
+     u8"$n zaps your $t.",
+     u8"In a bout of frustration, you bring down zeke on $p, trying to hurt it.",
+     u8"Looking very frustrated, $n brings down zeke on $p, trying to hurt it."},
+    {u8"You zip your mouth shut - zzzzzip!",
+     u8"$n zips $s mouth shut - zzzzzip!",
+     u8"You zip $N's mouth shut - zzzzzip!",
+     u8"$n zips $N's mouth shut - zzzzzip!",
+     u8"$n zips your mouth shut - zzzzzip!",
+     u8"Unzip your eyelids, they're not here!",
+     u8"You zip your mouth shut - zzzzzip!",
+     u8"$n zips $s mouth shut - zzzzzip!",
+     u8"",
+     u8"",
+     u8"",
+     u8"",
+     u8""},
+}};
+
+int handle_social_command(
+    Object* body,
+    std::shared_ptr<Mind>& mind,
+    int cnum,
+    const std::u8string_view& args,
+    int stealth_t,
+    int stealth_s) {
+  if (!mind)
+    return 0;
+
+  const auto snum = cnum - COM_MAX_STANDARD;
+  Object* targ = nullptr;
+  if (body && body->Parent()) {
+    std::u8string youmes = std::u8string(socials[snum][0]);
+    std::u8string outmes = std::u8string(socials[snum][1]);
+    std::u8string targmes = std::u8string(u8"");
+    if (!args.empty()) {
+      targ = body->PickObject(args, LOC_NEARBY | LOC_SELF | LOC_INTERNAL);
+      if (!targ) {
+        youmes = socials[snum][5];
+        outmes = u8"";
+      } else if (targ == body) {
+        youmes = socials[snum][6];
+        outmes = socials[snum][7];
+      } else {
+        youmes = socials[snum][2];
+        outmes = socials[snum][3];
+        targmes = socials[snum][4];
+      }
+    }
+    if (outmes[0]) {
+      replace_all(outmes, u8"$e", body->Pron());
+      replace_all(outmes, u8"$m", body->Obje());
+      replace_all(outmes, u8"$s", body->Poss());
+      replace_all(outmes, u8"$n", body->Noun(1));
+      if (targ) {
+        replace_all(outmes, u8"$E", targ->Pron());
+        replace_all(outmes, u8"$M", targ->Obje());
+        replace_all(outmes, u8"$S", targ->Poss());
+        replace_all(outmes, u8"$N", targ->Noun(1));
+        replace_all(outmes, u8"$t", targ->Noun(1));
+        replace_all(outmes, u8"$p", targ->Noun(1));
+      }
+      outmes[0] = ascii_toupper(outmes[0]);
+      outmes += u8"\n";
+    }
+    if (youmes[0]) {
+      replace_all(youmes, u8"$e", body->Pron());
+      replace_all(youmes, u8"$m", body->Obje());
+      replace_all(youmes, u8"$s", body->Poss());
+      replace_all(youmes, u8"$n", body->Noun(1));
+      if (targ) {
+        replace_all(youmes, u8"$E", targ->Pron());
+        replace_all(youmes, u8"$M", targ->Obje());
+        replace_all(youmes, u8"$S", targ->Poss());
+        replace_all(youmes, u8"$N", targ->Noun(1));
+        replace_all(youmes, u8"$t", targ->Noun(1));
+        replace_all(youmes, u8"$p", targ->Noun(1));
+      }
+      youmes[0] = ascii_toupper(youmes[0]);
+      youmes += u8"\n";
+    }
+    if (targ) {
+      replace_all(targmes, u8"$e", body->Pron());
+      replace_all(targmes, u8"$m", body->Obje());
+      replace_all(targmes, u8"$s", body->Poss());
+      replace_all(targmes, u8"$n", body->Noun(1));
+      if (targ) {
+        replace_all(targmes, u8"$E", targ->Pron());
+        replace_all(targmes, u8"$M", targ->Obje());
+        replace_all(targmes, u8"$S", targ->Poss());
+        replace_all(targmes, u8"$N", targ->Noun(1));
+        replace_all(targmes, u8"$t", targ->Noun(1));
+        replace_all(targmes, u8"$p", targ->Noun(1));
+      }
+      targmes[0] = ascii_toupper(targmes[0]);
+      targmes += u8"\n";
+      targ->Send(0, 0, targmes);
+      targ->Deafen(true);
+    }
+    body->Parent()->SendOut(0, 0, outmes, youmes, body, targ);
+    if (targ)
+      targ->Deafen(false);
+  }
+  return 0;
+}
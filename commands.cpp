@@ -0,0 +1,3888 @@
+// *************************************************************************
+//  This file is part of AcidMUD by Steaphan Greene
+//
+//  Copyright 1999-2022 Steaphan Greene <steaphan@gmail.com>
+//
+//  AcidMUD is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  AcidMUD is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with AcidMUD (see the file named "COPYING");
+//  If not, see <http://www.gnu.org/licenses/>.
+//
+// *************************************************************************
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "color.hpp"
+#include "commands.hpp"
+#include "dice.hpp"
+#include "global.hpp"
+#include "infile.hpp"
+#include "log.hpp"
+#include "mind.hpp"
+#include "net.hpp"
+#include "object.hpp"
+#include "properties.hpp"
+#include "utils.hpp"
+#include "version.hpp"
+
+#define SIT_ETHEREAL 1
+#define SIT_CORPOREAL 2
+#define SIT_ALIVE 4
+#define SIT_CONSCIOUS 8
+#define SIT_AWAKE 16
+#define SIT_ALERT 32
+#define SIT_LIE 64
+#define SIT_SIT 128
+#define SIT_STAND 256
+#define SIT_USE 512
+#define SIT_ACTION 4096
+#define SIT_NINJAMODE 8192
+#define SIT_NINJA 16384
+#define SIT_SUPERNINJA 32768
+
+#define CMD_FLAVORTEXT 65536
+
+#define REQ_ETHEREAL (SIT_ETHEREAL)
+#define REQ_CORPOREAL (SIT_CORPOREAL)
+#define REQ_ALIVE (SIT_ALIVE | REQ_CORPOREAL)
+#define REQ_CONSCIOUS (SIT_CONSCIOUS | REQ_ALIVE)
+#define REQ_AWAKE (SIT_AWAKE | REQ_CONSCIOUS)
+#define REQ_ALERT (SIT_ALERT | REQ_AWAKE)
+#define REQ_LIE (SIT_LIE | REQ_CORPOREAL)
+#define REQ_SIT (SIT_SIT | REQ_CORPOREAL)
+#define REQ_STAND (SIT_STAND | REQ_CORPOREAL)
+#define REQ_UP (SIT_STAND | SIT_USE | REQ_CORPOREAL)
+
+#define REQ_ACTION (SIT_ACTION | REQ_CORPOREAL)
+
+#define REQ_NINJAMODE (SIT_NINJAMODE)
+#define REQ_NINJA (SIT_NINJA)
+#define REQ_SUPERNINJA (SIT_SUPERNINJA | SIT_NINJA)
+
+#define REQ_ANY (SIT_CORPOREAL | SIT_ETHEREAL)
+
+int handle_command_ccreate(Object*, std::shared_ptr<Mind>&, const std::u8string_view&, int, int);
+int handle_command_wload(Object*, std::shared_ptr<Mind>&, const std::u8string_view&, int, int);
+int handle_command_list(Object*, std::shared_ptr<Mind>&, int, const std::u8string_view&, int, int);
+int handle_command_buy(Object*, std::shared_ptr<Mind>&, int, const std::u8string_view&, int, int);
+int handle_command_shops(Object*, std::shared_ptr<Mind>&, int, const std::u8string_view&, int, int);
+int handle_social_command(
+    Object*,
+    std::shared_ptr<Mind>&,
+    int,
+    const std::u8string_view&,
+    int,
+    int);
+int handle_command_other(Object*, std::shared_ptr<Mind>&, int, std::u8string_view, int, int);
+
+struct Command {
+  std::u8string_view command;
+  std::u8string_view shortdesc;
+  std::u8string_view longdesc;
+  int sit;
+  com_t id;
+};
+
+constexpr static const Command comlist[COM_MAX + 1] = {
+    {u8"", u8"", u8"", 0, COM_NONE},
+    {u8"help",
+     u8"Get help for a topic or command.",
+     u8"Get help for a topic or command.",
+     (REQ_ANY),
+     COM_HELP},
+    {u8"quit", u8"Quit the game.", u8"Quit the game.", (REQ_ANY), COM_QUIT},
+    {u8"password",
+     u8"Change player password.",
+     u8"Change player password.",
+     (REQ_ANY | CMD_FLAVORTEXT),
+     COM_PASSWORD},
+
+    {u8"north", u8"Travel north.", u8"Travel north.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_NORTH},
+    {u8"south", u8"Travel south.", u8"Travel south.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_SOUTH},
+    {u8"east", u8"Travel east.", u8"Travel east.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_EAST},
+    {u8"west", u8"Travel west.", u8"Travel west.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_WEST},
+    {u8"up", u8"Travel up.", u8"Travel up.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_UP},
+    {u8"down", u8"Travel down.", u8"Travel down.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_DOWN},
+
+    {u8"look",
+     u8"Look around, look in a direction, or look at an object or creature.",
+     u8"Look around, look in a direction, or look at an object or creature.",
+     (REQ_AWAKE | REQ_ACTION | REQ_ETHEREAL),
+     COM_LOOK},
+    {u8"examine",
+     u8"Examine an object or creature.",
+     u8"Examine an object or creature.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_EXAMINE},
+    {u8"consider",
+     u8"Consider attacking someone, or using something, and size it up.",
+     u8"Consider attacking someone, or using something, and size it up.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_CONSIDER},
+    {u8"inventory",
+     u8"Check what you have on you.",
+     u8"Check what you have on you.",
+     (REQ_AWAKE | REQ_ACTION),
+     COM_INVENTORY},
+    {u8"equipment",
+     u8"Check what you are wearing and using.",
+     u8"Check what you are wearing and using.",
+     (REQ_AWAKE | REQ_ACTION),
+     COM_EQUIPMENT},
+    {u8"search",
+     u8"Search an area, object or creature.",
+     u8"Search an area, object or creature.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SEARCH},
+    {u8"hide",
+     u8"Hide an object, or yourself.",
+     u8"Hide an object, or yourself.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_HIDE},
+
+    {u8"leave",
+     u8"Leave an object.",
+     u8"Leave an object.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_LEAVE},
+    {u8"enter",
+     u8"Enter an object (or enter the game).",
+     u8"Enter an object (or enter the game).",
+     (REQ_ETHEREAL | REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_ENTER},
+    {u8"select",
+     u8"Select an unfinished character.",
+     u8"Select an unfinished character.",
+     (REQ_ETHEREAL),
+     COM_SELECT},
+
+    {u8"open",
+     u8"Open a door or container.",
+     u8"Open a door or container.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_OPEN},
+    {u8"close",
+     u8"Close a door or container.",
+     u8"Close a door or container.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_CLOSE},
+    {u8"unlock",
+     u8"Unlock a door or container.",
+     u8"Unlock a door or container.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_UNLOCK},
+    {u8"lock",
+     u8"Lock a door or container.",
+     u8"Lock a door or container.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_LOCK},
+
+    {u8"get",
+     u8"Get an item from your surroundings.",
+     u8"Get an item from your surroundings.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_GET},
+    {u8"hold",
+     u8"Hold an item you are carrying in your off-hand.",
+     u8"Hold an item you are carrying in your off-hand.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_HOLD},
+    {u8"offer",
+     u8"Offer to give your held item to someone, or stop offering.",
+     u8"Offer to give your held item to someone, or stop offering.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_OFFER},
+
+    {u8"drag",
+     u8"Drag a heavy item with you when you next move.",
+     u8"Drag a heavy item with you when you next move.",
+     (REQ_ALERT | REQ_STAND | REQ_ACTION),
+     COM_DRAG},
+    {u8"put",
+     u8"Put a held item in or on something.",
+     u8"Put a held item in or on something.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_PUT},
+    {u8"drop",
+     u8"Drop an item you are carrying.",
+     u8"Drop an item you are carrying.",
+     (REQ_ALERT),
+     COM_DROP},
+    {u8"stash",
+     u8"Store an item you are holding in one of your containers.",
+     u8"Store an item you are holding in one of your containers.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_STASH},
+    {u8"wield",
+     u8"Wield a weapon you are carrying.",
+     u8"Wield a weapon you are carrying.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_WIELD},
+    {u8"unwield",
+     u8"Unwield the weapon you are currently wielding.",
+     u8"Unwield the weapon you are currently wielding.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_UNWIELD},
+    {u8"light",
+     u8"Light an item you are carrying and hold it in your off-hand.",
+     u8"Light an item you are carrying and hold it in your off-hand.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_LIGHT},
+    {u8"wear",
+     u8"Wear an item you are carrying.",
+     u8"Wear an item you are carrying.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_WEAR},
+    {u8"remove",
+     u8"Remove an item you are wearing.",
+     u8"Remove an item you are wearing.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_REMOVE},
+    {u8"label",
+     u8"Label, or read the label of, an item you are holding.",
+     u8"Label, or read the label of, an item you are holding.",
+     (REQ_ALERT | REQ_ACTION | CMD_FLAVORTEXT),
+     COM_LABEL},
+    {u8"unlabel",
+     u8"Remove the label the item you are holding.",
+     u8"Remove the label the item you are holding.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_UNLABEL},
+    {u8"heal",
+     u8"Use healing/first-aid skills to help another, or yourself.",
+     u8"Use healing/first-aid skills to help another, or yourself.",
+     (REQ_CORPOREAL | REQ_ACTION),
+     COM_HEAL},
+
+    {u8"sleep", u8"Go to sleep.", u8"Go to sleep.", (REQ_CONSCIOUS | REQ_ACTION), COM_SLEEP},
+    {u8"wake",
+     u8"Wake up, or wake someone else up.",
+     u8"Wake up, or wake someone else up.",
+     (REQ_CONSCIOUS | REQ_ACTION),
+     COM_WAKE},
+    {u8"lie", u8"Lie down.", u8"Lie down.", (REQ_CONSCIOUS | REQ_ACTION), COM_LIE},
+    {u8"rest", u8"Relax and rest.", u8"Relax and rest.", (REQ_CONSCIOUS | REQ_ACTION), COM_REST},
+    {u8"sit", u8"Sit down.", u8"Sit down.", (REQ_CONSCIOUS | REQ_ACTION), COM_SIT},
+    {u8"stand", u8"Stand up.", u8"Stand up.", (REQ_CONSCIOUS | REQ_ACTION), COM_STAND},
+    {u8"use",
+     u8"Start, or stop using a skill.",
+     u8"Start, or stop using a skill.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_USE},
+    {u8"stop",
+     u8"Stop using a skill.",
+     u8"Stop using a skill.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_STOP},
+    {u8"cast", u8"Cast a spell.", u8"Cast a spell.", (REQ_ALERT | REQ_UP | REQ_ACTION), COM_CAST},
+    {u8"pray",
+     u8"Use faith to enhance another command.",
+     u8"Use faith to enhance another command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_PRAY},
+
+    {u8"shout",
+     u8"Shout something to all nearby.",
+     u8"Shout something to all nearby.",
+     (REQ_AWAKE | CMD_FLAVORTEXT),
+     COM_SHOUT},
+    {u8"yell",
+     u8"Shout something to all nearby.",
+     u8"Shout something to all nearby.",
+     (REQ_AWAKE | CMD_FLAVORTEXT),
+     COM_YELL},
+    {u8"call",
+     u8"Shout something to all nearby.",
+     u8"Shout something to all nearby.",
+     (REQ_AWAKE | CMD_FLAVORTEXT),
+     COM_CALL},
+    {u8"say", u8"Say something.", u8"Say something.", (REQ_AWAKE | CMD_FLAVORTEXT), COM_SAY},
+    {u8"emote",
+     u8"Indicate to others that you are doing something.",
+     u8"Indicate to others that you are doing something.",
+     (REQ_AWAKE | CMD_FLAVORTEXT),
+     COM_EMOTE},
+    {u8"introduce",
+     u8"Indroduce yourself, or someone or something else, to others.",
+     u8"Indroduce yourself, or someone or something else, to others.",
+     (REQ_AWAKE | CMD_FLAVORTEXT),
+     COM_INTRODUCE},
+
+    {u8"eat",
+     u8"Eat an item you are carrying.",
+     u8"Eat an item you are carrying.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_EAT},
+    {u8"drink",
+     u8"Drink from an item you are carrying.",
+     u8"Drink from an item you are carrying.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_DRINK},
+    {u8"fill",
+     u8"Fill a held liquid container from another.",
+     u8"Fill a held liquid container from another.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_FILL},
+    {u8"dump",
+     u8"Dump all liquid out of a container you are carrying.",
+     u8"Dump all liquid out of a container you are carrying.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_DUMP},
+
+    {u8"point",
+     u8"Point at an object, or stop pointing.",
+     u8"Point at an object, or stop pointing.",
+     (REQ_ALERT),
+     COM_POINT},
+    {u8"follow",
+     u8"Follow someone, or stop following someone.",
+     u8"Follow someone, or stop following someone.",
+     (REQ_ALERT | REQ_UP),
+     COM_FOLLOW},
+    {u8"attack",
+     u8"Attack somebody, or an object.",
+     u8"Attack somebody, or an object.",
+     (REQ_ALERT | REQ_ACTION | REQ_STAND),
+     COM_ATTACK},
+    {u8"kill",
+     u8"Try to kill somebody, or smash an object.",
+     u8"Try to kill somebody, or smash an object.",
+     (REQ_ALERT | REQ_ACTION | REQ_STAND),
+     COM_KILL},
+    {u8"punch",
+     u8"Punch somebody, or an object.",
+     u8"Punch somebody, or an object.",
+     (REQ_ALERT | REQ_ACTION | REQ_STAND),
+     COM_PUNCH},
+    {u8"kick",
+     u8"Kick somebody, or an object.",
+     u8"Kick somebody, or an object.",
+     (REQ_ALERT | REQ_ACTION | REQ_STAND),
+     COM_KICK},
+    {u8"flee",
+     u8"Escape the area as fast as you can, in a random direction.",
+     u8"Escape the area as fast as you can, in a random direction.",
+     (REQ_ALERT | REQ_ACTION | REQ_UP),
+     COM_FLEE},
+
+    {u8"list",
+     u8"List items available at a shop.",
+     u8"List items available at a shop.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_LIST},
+    {u8"buy",
+     u8"Buy an item at a shop.",
+     u8"Buy an item at a shop.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_BUY},
+    {u8"value",
+     u8"Find out how much a shop will give you for an item.",
+     u8"Find out how much a shop will give you for an item.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_VALUE},
+    {u8"sell",
+     u8"Sell an item at a shop.",
+     u8"Sell an item at a shop.",
+     (REQ_ALERT | REQ_ACTION),
+     COM_SELL},
+
+    {u8"toggle",
+     u8"Turn options on and off, or show current options setting.",
+     u8"Turn options on and off, or show current options setting.",
+     (REQ_ANY),
+     COM_TOGGLE},
+
+    {u8"who",
+     u8"Get a list of who is on the MUD right now.",
+     u8"Get a list of who is on the MUD right now.",
+     (REQ_ANY),
+     COM_WHO},
+    {u8"ooc",
+     u8"Toggle or use ooc (Out-Of-Character) chat.",
+     u8"Toggle or use ooc (Out-Of-Character) chat.",
+     (REQ_ANY | CMD_FLAVORTEXT),
+     COM_OOC},
+    {u8"newbie",
+     u8"Toggle or use newbie (new player) chat (use this to ask for help).",
+     u8"Toggle or use newbie (new player) chat (use this to ask for help).",
+     (REQ_ANY | CMD_FLAVORTEXT),
+     COM_NEWBIE},
+
+    {u8"newcharacter",
+     u8"Create a new character.",
+     u8"Create a new character.",
+     (REQ_ETHEREAL | CMD_FLAVORTEXT),
+     COM_NEWCHARACTER},
+    {u8"raise",
+     u8"Spend a skill or attribute point of current character.",
+     u8"Spend a skill or attribute point of current character.",
+     (REQ_ETHEREAL | REQ_CORPOREAL),
+     COM_RAISE},
+    {u8"lower",
+     u8"Lower a skill or attribute point of current in-progress character.",
+     u8"Lower a skill or attribute point of current in-progress character.",
+     (REQ_ETHEREAL),
+     COM_LOWER},
+    {u8"resetcharacter",
+     u8"Undo (erase!) *all* work on in-progress character.",
+     u8"Undo (erase!) *all* work on in-progress character.",
+     (REQ_ETHEREAL),
+     COM_RESETCHARACTER},
+    {u8"randomize",
+     u8"Spend all remaining points of current character randomly.",
+     u8"Spend all remaining points of current character randomly.",
+     (REQ_ETHEREAL),
+     COM_RANDOMIZE},
+    {u8"archetype",
+     u8"Replace (erase!) *all* work on in-progress character with preset.",
+     u8"Replace (erase!) *all* work on in-progress character with preset.",
+     (REQ_ETHEREAL),
+     COM_ARCHETYPE},
+    {u8"score",
+     u8"Get your current character and/or player's stats and score.",
+     u8"Get your current character and/or player's stats and score.",
+     (REQ_ETHEREAL | REQ_CORPOREAL),
+     COM_SCORE},
+
+    {u8"time",
+     u8"Get the current world's MUD time.",
+     u8"Get the current world's MUD time.",
+     (REQ_ETHEREAL | REQ_CORPOREAL),
+     COM_TIME},
+    {u8"world",
+     u8"Get the name of the current world.",
+     u8"Get the name of the current world.",
+     (REQ_ETHEREAL | REQ_CORPOREAL),
+     COM_WORLD},
+    {u8"zone",
+     u8"Get the name of the current zone.",
+     u8"Get the name of the current zone.",
+     (REQ_CORPOREAL),
+     COM_ZONE},
+    {u8"version",
+     u8"Query the version information of running AcidMUD.",
+     u8"Query the version information of running AcidMUD.",
+     (REQ_ANY),
+     COM_VERSION},
+
+    {u8"skilllist",
+     u8"List all available skill categories, or all skills in a category.",
+     u8"List all available skill categories, or all skills in a category.",
+     (REQ_ANY),
+     COM_SKILLLIST},
+
+    {u8"recall",
+     u8"Teleport back to the start when you are uninjured.",
+     u8"Teleport back to the start when you are uninjured.",
+     (REQ_STAND),
+     COM_RECALL},
+    {u8"teleport",
+     u8"Teleport to a named location (requires a power to enable).",
+     u8"Teleport to a named location (requires a power to enable).",
+     (REQ_STAND),
+     COM_TELEPORT},
+    {u8"resurrect",
+     u8"Resurrect a long-dead character (one with no corpse left).",
+     u8"Resurrect a long-dead character (one with no corpse left).",
+     (REQ_STAND),
+     COM_RESURRECT},
+
+    {u8"ninjamode",
+     u8"Ninja command: run a command in Ninja Mode[TM].",
+     u8"Ninja command: run a command in Ninja Mode[TM].",
+     (REQ_ETHEREAL | REQ_ANY | REQ_ACTION | REQ_NINJA | CMD_FLAVORTEXT),
+     COM_NINJAMODE},
+    {u8"makeninja",
+     u8"Ninja command: make (or unmake) another player into a True Ninja[TM].",
+     u8"Ninja command: make (or unmake) another player into a True Ninja[TM].",
+     (REQ_ANY | REQ_SUPERNINJA | REQ_NINJAMODE),
+     COM_MAKENINJA},
+    {u8"makesuperninja",
+     u8"Ninja command: make (or unmake) a True Ninja into a Super Ninja[TM].",
+     u8"Ninja command: make (or unmake) a True Ninja into a Super Ninja[TM].",
+     (REQ_ANY | REQ_SUPERNINJA | REQ_NINJAMODE),
+     COM_MAKESUPERNINJA},
+
+    {u8"create",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_CREATE},
+    {u8"dcreate",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_DCREATE},
+    {u8"ccreate",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_CCREATE},
+    {u8"wload",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_WLOAD},
+    {u8"anchor",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_ANCHOR},
+    {u8"link",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_LINK},
+    {u8"connect",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_CONNECT},
+    {u8"command",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_CORPOREAL | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_COMMAND},
+    {u8"control",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_CORPOREAL | REQ_NINJAMODE),
+     COM_CONTROL},
+    {u8"clone",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_CLONE},
+    {u8"mirror",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_MIRROR},
+    {u8"junk",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_JUNK},
+    {u8"prod",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_PROD},
+    {u8"reset",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_RESET},
+
+    {u8"players",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_PLAYERS},
+    {u8"delplayer",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_DELPLAYER},
+    {u8"characters",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_CHARACTERS},
+
+    {u8"jack",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_JACK},
+    {u8"chump",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_CHUMP},
+    {u8"increment",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_INCREMENT},
+    {u8"decrement",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_DECREMENT},
+    {u8"double",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_DOUBLE},
+
+    {u8"setstats",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_SETSTATS},
+    {u8"brief",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_BRIEF},
+    {u8"name",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_NAME},
+    {u8"unname",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_UNNAME},
+    {u8"undescribe",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_UNDESCRIBE},
+    {u8"describe",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_DESCRIBE},
+    {u8"undefine",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_UNDEFINE},
+    {u8"define",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_DEFINE},
+
+    {u8"stats",
+     u8"Ninja command: Get stats of a character, object or creature.",
+     u8"Ninja command: Get stats of a character, object or creature.",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_STATS},
+
+    {u8"shutdown",
+     u8"Ninja command: shutdown the entire MUD.",
+     u8"Ninja command: shutdown the entire MUD.",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_SHUTDOWN},
+    {u8"restart",
+     u8"Ninja command: restart the entire MUD - preserving connections.",
+     u8"Ninja command: restart the entire MUD - preserving connections.",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_RESTART},
+    {u8"saveall",
+     u8"Ninja command: save the entire MUD Universe - preserving connections.",
+     u8"Ninja command: save the entire MUD Universe - preserving connections.",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_SAVEALL},
+
+    {u8"makestart",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_MAKESTART},
+
+    {u8"tload",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE | CMD_FLAVORTEXT),
+     COM_TLOAD},
+    {u8"tclean",
+     u8"Ninja command.",
+     u8"Ninja command - ninjas only!",
+     (REQ_ALERT | REQ_NINJAMODE),
+     COM_TCLEAN},
+    {u8"tprofile",
+     u8"Ninja command: show which TBA trigger scripts cost the most.",
+     u8"Ninja command: show which TBA trigger scripts cost the most - turn it on, off, clear, "
+     u8"dump it to a file, or list by time, max, lines, fires, runs, quota, or waits.",
+     (REQ_ANY | REQ_NINJAMODE),
+     COM_TPROFILE},
+
+    // These are all autogenerated from tba/socials.new
+    {u8"...",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL____},
+    {u8"abc",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ABC},
+    {u8"abrac",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ABRAC},
+    {u8"accuse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ACCUSE},
+    {u8"ack",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ACK},
+    {u8"adieu",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ADIEU},
+    {u8"admire",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ADMIRE},
+    {u8"adoring",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ADORING},
+    {u8"agree",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AGREE},
+    {u8"ahem",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AHEM},
+    {u8"aim",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AIM},
+    {u8"amused",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AMUSED},
+    {u8"apologize",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_APOLOGIZE},
+    {u8"applaud",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_APPLAUD},
+    {u8"arch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ARCH},
+    {u8"argh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ARGH},
+    {u8"armcross",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ARMCROSS},
+    {u8"arrest",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ARREST},
+    {u8"avsalute",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AVSALUTE},
+    {u8"aww",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_AWW},
+    {u8"babble",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BABBLE},
+    {u8"backclap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BACKCLAP},
+    {u8"bark",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BARK},
+    {u8"bat",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BAT},
+    {u8"batman",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BATMAN},
+    {u8"battlecry",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BATTLECRY},
+    {u8"beam",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BEAM},
+    {u8"bearhug",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BEARHUG},
+    {u8"beckon",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BECKON},
+    {u8"beer",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BEER},
+    {u8"beg",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BEG},
+    {u8"behind",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BEHIND},
+    {u8"belch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BELCH},
+    {u8"bite",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BITE},
+    {u8"blah",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLAH},
+    {u8"blame",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLAME},
+    {u8"bleed",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLEED},
+    {u8"blink",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLINK},
+    {u8"bloob",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLOOB},
+    {u8"blue",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLUE},
+    {u8"blush",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BLUSH},
+    {u8"bounce",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOUNCE},
+    {u8"boast",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOAST},
+    {u8"boggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOGGLE},
+    {u8"boink",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOINK},
+    {u8"bonk",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BONK},
+    {u8"boo",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOO},
+    {u8"booger",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOOGER},
+    {u8"bop",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOP},
+    {u8"bored",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BORED},
+    {u8"bow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOW},
+    {u8"box",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BOX},
+    {u8"brag",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BRAG},
+    {u8"brb",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BRB},
+    {u8"breathe",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BREATHE},
+    {u8"burn",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BURN},
+    {u8"burp",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BURP},
+    {u8"buzz",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_BUZZ},
+    {u8"cackle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CACKLE},
+    {u8"cake",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CAKE},
+    {u8"calm",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CALM},
+    {u8"caress",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CARESS},
+    {u8"carrot",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CARROT},
+    {u8"cartwheel",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CARTWHEEL},
+    {u8"challenge",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHALLENGE},
+    {u8"channel",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHANNEL},
+    {u8"charge",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHARGE},
+    {u8"charm",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHARM},
+    {u8"cheers",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHEERS},
+    {u8"chitter",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHITTER},
+    {u8"choke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHOKE},
+    {u8"chortle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHORTLE},
+    {u8"christmas",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHRISTMAS},
+    {u8"chuckles",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CHUCKLES},
+    {u8"clap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CLAP},
+    {u8"clobber",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CLOBBER},
+    {u8"coffee",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COFFEE},
+    {u8"cold",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COLD},
+    {u8"collapse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COLLAPSE},
+    {u8"comfort",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COMFORT},
+    {u8"comb",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COMB},
+    {u8"confuse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CONFUSE},
+    {u8"conga",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CONGA},
+    {u8"conga2",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CONGA2},
+    {u8"console",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CONSOLE},
+    {u8"contemplate",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CONTEMPLATE},
+    {u8"cough",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COUGH},
+    {u8"cower",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_COWER},
+    {u8"cradle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRADLE},
+    {u8"crazed",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRAZED},
+    {u8"crazy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRAZY},
+    {u8"creep",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CREEP},
+    {u8"cringe",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRINGE},
+    {u8"criticize",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRITICIZE},
+    {u8"croon",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CROON},
+    {u8"crossfinger",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CROSSFINGER},
+    {u8"crushed",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRUSHED},
+    {u8"cry",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRY},
+    {u8"crylaugh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CRYLAUGH},
+    {u8"cuddle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CUDDLE},
+    {u8"curious",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CURIOUS},
+    {u8"curl",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CURL},
+    {u8"curse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CURSE},
+    {u8"curtsey",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CURTSEY},
+    {u8"custard",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_CUSTARD},
+    {u8"dance",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DANCE},
+    {u8"dark",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DARK},
+    {u8"daydream",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DAYDREAM},
+    {u8"dbc",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DBC},
+    {u8"dead",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DEAD},
+    {u8"deaf",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DEAF},
+    {u8"defib",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DEFIB},
+    {u8"despair",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DESPAIR},
+    {u8"despine",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DESPINE},
+    {u8"differ",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DIFFER},
+    {u8"disapprove",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DISAPPROVE},
+    {u8"discombob",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DISCOMBOB},
+    {u8"disturbed",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DISTURBED},
+    {u8"dive",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DIVE},
+    {u8"doh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DOH},
+    {u8"doodle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DOODLE},
+    {u8"dread",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DREAD},
+    {u8"drool",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DROOL},
+    {u8"drumroll",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DRUMROLL},
+    {u8"duck",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DUCK},
+    {u8"duh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_DUH},
+    {u8"earlick",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EARLICK},
+    {u8"eek",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EEK},
+    {u8"eep",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EEP},
+    {u8"ego",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EGO},
+    {u8"egrin",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EGRIN},
+    {u8"elephantma",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ELEPHANTMA},
+    {u8"embrace",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EMBRACE},
+    {u8"enthuse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ENTHUSE},
+    {u8"envy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ENVY},
+    {u8"evileye",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EVILEYE},
+    {u8"eww",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EWW},
+    {u8"excuse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EXCUSE},
+    {u8"eye",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EYE},
+    {u8"eyebrow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EYEBROW},
+    {u8"eyeroll",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_EYEROLL},
+    {u8"facegrab",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FACEGRAB},
+    {u8"facepalm",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FACEPALM},
+    {u8"fade",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FADE},
+    {u8"faint",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FAINT},
+    {u8"fall",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FALL},
+    {u8"fan",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FAN},
+    {u8"fart",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FART},
+    {u8"fish",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FISH},
+    {u8"flail",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLAIL},
+    {u8"flame",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLAME},
+    {u8"flare",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLARE},
+    {u8"flash",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLASH},
+    {u8"flex",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLEX},
+    {u8"flick",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLICK},
+    {u8"flinch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLINCH},
+    {u8"flip",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLIP},
+    {u8"flirt",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLIRT},
+    {u8"floor",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLOOR},
+    {u8"flop",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLOP},
+    {u8"flutter",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FLUTTER},
+    {u8"foam",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FOAM},
+    {u8"fondle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FONDLE},
+    {u8"foot",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FOOT},
+    {u8"forgive",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FORGIVE},
+    {u8"french",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FRENCH},
+    {u8"froth",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FROTH},
+    {u8"frown",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FROWN},
+    {u8"fume",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FUME},
+    {u8"furrow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FURROW},
+    {u8"fuss",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FUSS},
+    {u8"fwap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_FWAP},
+    {u8"gag",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GAG},
+    {u8"gasp",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GASP},
+    {u8"gaze",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GAZE},
+    {u8"ghug",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GHUG},
+    {u8"gibber",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GIBBER},
+    {u8"giggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GIGGLE},
+    {u8"glare",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GLARE},
+    {u8"gleam",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GLEAM},
+    {u8"goodbye",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GOODBYE},
+    {u8"goose",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GOOSE},
+    {u8"greed",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GREED},
+    {u8"greet",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GREET},
+    {u8"grimace",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GRIMACE},
+    {u8"grin",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GRIN},
+    {u8"groan",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GROAN},
+    {u8"grope",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GROPE},
+    {u8"grovel",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GROVEL},
+    {u8"growl",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GROWL},
+    {u8"grumbles",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GRUMBLES},
+    {u8"grunts",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_GRUNTS},
+    {u8"haircut",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HAIRCUT},
+    {u8"halo",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HALO},
+    {u8"handraise",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HANDRAISE},
+    {u8"handshake",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HANDSHAKE},
+    {u8"happy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HAPPY},
+    {u8"hate",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HATE},
+    {u8"headache",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HEADACHE},
+    {u8"heh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HEH},
+    {u8"hiccup",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HICCUP},
+    {u8"highfive",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HIGHFIVE},
+    {u8"hiss",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HISS},
+    {u8"hmmmmm",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HMMMMM},
+    {u8"honey",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HONEY},
+    {u8"hop",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HOP},
+    {u8"hotfoot",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HOTFOOT},
+    {u8"howl",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HOWL},
+    {u8"hrmph",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HRMPH},
+    {u8"hug",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUG},
+    {u8"huggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUGGLE},
+    {u8"hula",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HULA},
+    {u8"hum",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUM},
+    {u8"humans",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUMANS},
+    {u8"hush",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUSH},
+    {u8"hustle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUSTLE},
+    {u8"huzzah",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HUZZAH},
+    {u8"hysterical",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_HYSTERICAL},
+    {u8"ignore",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_IGNORE},
+    {u8"innocent",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_INNOCENT},
+    {u8"insane",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_INSANE},
+    {u8"insomnia",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_INSOMNIA},
+    {u8"jaw",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JAW},
+    {u8"jeer",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JEER},
+    {u8"jest",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JEST},
+    {u8"job",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JOB},
+    {u8"jog",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JOG},
+    {u8"joint",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JOINT},
+    {u8"joke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JOKE},
+    {u8"juggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_JUGGLE},
+    {u8"kiss",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_KISS},
+    {u8"kneel",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_KNEEL},
+    {u8"knight",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_KNIGHT},
+    {u8"knuckle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_KNUCKLE},
+    {u8"lala",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LALA},
+    {u8"lame",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LAME},
+    {u8"laughs",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LAUGHS},
+    {u8"lean",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LEAN},
+    {u8"licks",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LICKS},
+    {u8"listen",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LISTEN},
+    {u8"lofr",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LOFR},
+    {u8"lol",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LOL},
+    {u8"lost",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LOST},
+    {u8"love",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LOVE},
+    {u8"lust",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LUST},
+    {u8"lag",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_LAG},
+    {u8"mace",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MACE},
+    {u8"madgiggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MADGIGGLE},
+    {u8"makeout",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MAKEOUT},
+    {u8"massage",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MASSAGE},
+    {u8"meds",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MEDS},
+    {u8"meep",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MEEP},
+    {u8"meow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MEOW},
+    {u8"mic",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MIC},
+    {u8"moan",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOAN},
+    {u8"mock",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOCK},
+    {u8"model",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MODEL},
+    {u8"modest",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MODEST},
+    {u8"moo",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOO},
+    {u8"mooch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOOCH},
+    {u8"moon",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOON},
+    {u8"mortals",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MORTALS},
+    {u8"mosh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MOSH},
+    {u8"muahaha",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MUAHAHA},
+    {u8"muffle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MUFFLE},
+    {u8"mumble",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MUMBLE},
+    {u8"muss",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MUSS},
+    {u8"mutter",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_MUTTER},
+    {u8"nailfile",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NAILFILE},
+    {u8"needle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NEEDLE},
+    {u8"newidea",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NEWIDEA},
+    {u8"nibble",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NIBBLE},
+    {u8"night",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NIGHT},
+    {u8"nods",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NODS},
+    {u8"nodrugs",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NODRUGS},
+    {u8"nono",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NONO},
+    {u8"noogie",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NOOGIE},
+    {u8"nudge",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NUDGE},
+    {u8"nuzzle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NUZZLE},
+    {u8"nyuk",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_NYUK},
+    {u8"ogle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_OGLE},
+    {u8"oh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_OH},
+    {u8"ok",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_OK},
+    {u8"orcs",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ORCS},
+    {u8"ouch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_OUCH},
+    {u8"pat",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PAT},
+    {u8"pace",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PACE},
+    {u8"panic",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PANIC},
+    {u8"pant",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PANT},
+    {u8"peck",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PECK},
+    {u8"peer",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PEER},
+    {u8"perspire",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PERSPIRE},
+    {u8"pet",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PET},
+    {u8"phew",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PHEW},
+    {u8"phlegm",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PHLEGM},
+    {u8"picknose",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PICKNOSE},
+    {u8"pie",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PIE},
+    {u8"pillow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PILLOW},
+    {u8"pindrop",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PINDROP},
+    {u8"pinch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PINCH},
+    {u8"pity",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PITY},
+    {u8"point",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POINT},
+    {u8"poke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POKE},
+    {u8"ponder",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PONDER},
+    {u8"pooh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POOH},
+    {u8"pop",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POP},
+    {u8"pose",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POSE},
+    {u8"postal",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POSTAL},
+    {u8"pounce",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POUNCE},
+    {u8"pound",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POUND},
+    {u8"pout",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_POUT},
+    {u8"pray",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PRAY},
+    {u8"pride",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PRIDE},
+    {u8"propose",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PROPOSE},
+    {u8"prozac",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PROZAC},
+    {u8"puke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PUKE},
+    {u8"pull",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PULL},
+    {u8"pulse",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PULSE},
+    {u8"puppyeyes",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PUPPYEYES},
+    {u8"purr",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PURR},
+    {u8"pushup",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PUSHUP},
+    {u8"puzzle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_PUZZLE},
+    {u8"quiver",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_QUIVER},
+    {u8"rainbow",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RAINBOW},
+    {u8"raise",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RAISE},
+    {u8"raspberry",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RASPBERRY},
+    {u8"rebuke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_REBUKE},
+    {u8"reconnect",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RECONNECT},
+    {u8"relax",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RELAX},
+    {u8"relief",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RELIEF},
+    {u8"ren",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_REN},
+    {u8"revolve",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_REVOLVE},
+    {u8"roar",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ROAR},
+    {u8"rofl",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ROFL},
+    {u8"roll",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ROLL},
+    {u8"romp",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ROMP},
+    {u8"rose",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ROSE},
+    {u8"ruffle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RUFFLE},
+    {u8"run",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_RUN},
+    {u8"sad",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SAD},
+    {u8"sage",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SAGE},
+    {u8"salute",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SALUTE},
+    {u8"scab",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCAB},
+    {u8"scold",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCOLD},
+    {u8"scout",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCOUT},
+    {u8"scratch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCRATCH},
+    {u8"scream",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCREAM},
+    {u8"scuffle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SCUFFLE},
+    {u8"secret",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SECRET},
+    {u8"seduce",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SEDUCE},
+    {u8"sex",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SEX},
+    {u8"shake",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHAKE},
+    {u8"shame",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHAME},
+    {u8"sheathe",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHEATHE},
+    {u8"shh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHH},
+    {u8"shiskabob",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHISKABOB},
+    {u8"shivers",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHIVERS},
+    {u8"shock",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHOCK},
+    {u8"shootout",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHOOTOUT},
+    {u8"shrugs",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHRUGS},
+    {u8"shudder",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHUDDER},
+    {u8"shy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SHY},
+    {u8"sidle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SIDLE},
+    {u8"sigh",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SIGH},
+    {u8"sing",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SING},
+    {u8"skip",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SKIP},
+    {u8"slap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SLAP},
+    {u8"slippers",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SLIPPERS},
+    {u8"slouch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SLOUCH},
+    {u8"slump",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SLUMP},
+    {u8"smile",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMILE},
+    {u8"smack",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMACK},
+    {u8"smash",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMASH},
+    {u8"smirks",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMIRKS},
+    {u8"smite",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMITE},
+    {u8"smoke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMOKE},
+    {u8"smooch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMOOCH},
+    {u8"smug",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SMUG},
+    {u8"snap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNAP},
+    {u8"snarl",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNARL},
+    {u8"sneer",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNEER},
+    {u8"sneeze",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNEEZE},
+    {u8"snicker",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNICKER},
+    {u8"sniff",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNIFF},
+    {u8"snigger",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNIGGER},
+    {u8"snog",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNOG},
+    {u8"snoopy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNOOPY},
+    {u8"snore",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNORE},
+    {u8"snort",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNORT},
+    {u8"snowball",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNOWBALL},
+    {u8"snuggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SNUGGLE},
+    {u8"sob",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SOB},
+    {u8"sorry",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SORRY},
+    {u8"spank",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPANK},
+    {u8"spew",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPEW},
+    {u8"spin",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPIN},
+    {u8"spit",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPIT},
+    {u8"splash",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPLASH},
+    {u8"spongebath",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPONGEBATH},
+    {u8"spork",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SPORK},
+    {u8"squeak",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SQUEAK},
+    {u8"squeal",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SQUEAL},
+    {u8"squeeze",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SQUEEZE},
+    {u8"stare",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STARE},
+    {u8"steam",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STEAM},
+    {u8"stomp",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STOMP},
+    {u8"stone",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STONE},
+    {u8"strangle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STRANGLE},
+    {u8"stretch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STRETCH},
+    {u8"stroke",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STROKE},
+    {u8"strut",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_STRUT},
+    {u8"suckit-up",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SUCKIT_UP},
+    {u8"sue",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SUE},
+    {u8"sulk",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SULK},
+    {u8"sundance",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SUNDANCE},
+    {u8"sunset",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SUNSET},
+    {u8"sunshade",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SUNSHADE},
+    {u8"swat",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWAT},
+    {u8"sways",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWAYS},
+    {u8"swear",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWEAR},
+    {u8"sweat",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWEAT},
+    {u8"sweetsmile",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWEETSMILE},
+    {u8"swoon",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWOON},
+    {u8"sword",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_SWORD},
+    {u8"tackle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TACKLE},
+    {u8"tada",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TADA},
+    {u8"tag",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TAG},
+    {u8"tango",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TANGO},
+    {u8"tantrum",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TANTRUM},
+    {u8"tap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TAP},
+    {u8"tapdance",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TAPDANCE},
+    {u8"target",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TARGET},
+    {u8"taunt",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TAUNT},
+    {u8"tease",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TEASE},
+    {u8"testsocial",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TESTSOCIAL},
+    {u8"thanks",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_THANKS},
+    {u8"think",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_THINK},
+    {u8"threaten",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_THREATEN},
+    {u8"thumbsup",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_THUMBSUP},
+    {u8"thwap",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_THWAP},
+    {u8"tickle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TICKLE},
+    {u8"tie",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TIE},
+    {u8"tip",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TIP},
+    {u8"titter",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TITTER},
+    {u8"toast",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TOAST},
+    {u8"tongue",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TONGUE},
+    {u8"touch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TOUCH},
+    {u8"trance",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TRANCE},
+    {u8"tsk",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TSK},
+    {u8"tuck",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TUCK},
+    {u8"tug",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TUG},
+    {u8"tummy",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TUMMY},
+    {u8"tweak",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TWEAK},
+    {u8"twiddle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TWIDDLE},
+    {u8"twitch",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TWITCH},
+    {u8"type",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_TYPE},
+    {u8"understand",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_UNDERSTAND},
+    {u8"unsheathe",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_UNSHEATHE},
+    {u8"vampire",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_VAMPIRE},
+    {u8"vice",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_VICE},
+    {u8"waggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WAGGLE},
+    {u8"wait",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WAIT},
+    {u8"wakka",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WAKKA},
+    {u8"waltz",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WALTZ},
+    {u8"warscream",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WARSCREAM},
+    {u8"waves",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WAVES},
+    {u8"wb",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WB},
+    {u8"wedgie",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WEDGIE},
+    {u8"weep",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WEEP},
+    {u8"welcome",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WELCOME},
+    {u8"whack",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHACK},
+    {u8"whimper",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHIMPER},
+    {u8"whine",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHINE},
+    {u8"whip",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHIP},
+    {u8"whistle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHISTLE},
+    {u8"whoo",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WHOO},
+    {u8"wiggle",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WIGGLE},
+    {u8"wince",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WINCE},
+    {u8"winks",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WINKS},
+    {u8"wipe",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WIPE},
+    {u8"women",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WOMEN},
+    {u8"wonder",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WONDER},
+    {u8"worry",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WORRY},
+    {u8"worship",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WORSHIP},
+    {u8"wrong",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_WRONG},
+    {u8"yawn",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_YAWN},
+    {u8"yayfor",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_YAYFOR},
+    {u8"yes",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_YES},
+    {u8"yodel",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_YODEL},
+    {u8"zaps",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ZAPS},
+    {u8"zip",
+     u8"Social Command.",
+     u8"Social Command.",
+     (REQ_ALERT | REQ_UP | REQ_ACTION),
+     COM_SOCIAL_ZIP},
+    {u8"", u8"", u8"", 0, COM_MAX},
+};
+
+static_assert(comlist[COM_NONE].id == COM_NONE);
+static_assert(comlist[COM_HELP].id == COM_HELP);
+static_assert(comlist[COM_QUIT].id == COM_QUIT);
+static_assert(comlist[COM_PASSWORD].id == COM_PASSWORD);
+static_assert(comlist[COM_NORTH].id == COM_NORTH);
+static_assert(comlist[COM_SOUTH].id == COM_SOUTH);
+static_assert(comlist[COM_EAST].id == COM_EAST);
+static_assert(comlist[COM_WEST].id == COM_WEST);
+static_assert(comlist[COM_UP].id == COM_UP);
+static_assert(comlist[COM_DOWN].id == COM_DOWN);
+static_assert(comlist[COM_LOOK].id == COM_LOOK);
+static_assert(comlist[COM_EXAMINE].id == COM_EXAMINE);
+static_assert(comlist[COM_CONSIDER].id == COM_CONSIDER);
+static_assert(comlist[COM_INVENTORY].id == COM_INVENTORY);
+static_assert(comlist[COM_EQUIPMENT].id == COM_EQUIPMENT);
+static_assert(comlist[COM_SEARCH].id == COM_SEARCH);
+static_assert(comlist[COM_HIDE].id == COM_HIDE);
+static_assert(comlist[COM_LEAVE].id == COM_LEAVE);
+static_assert(comlist[COM_ENTER].id == COM_ENTER);
+static_assert(comlist[COM_SELECT].id == COM_SELECT);
+static_assert(comlist[COM_OPEN].id == COM_OPEN);
+static_assert(comlist[COM_CLOSE].id == COM_CLOSE);
+static_assert(comlist[COM_UNLOCK].id == COM_UNLOCK);
+static_assert(comlist[COM_LOCK].id == COM_LOCK);
+static_assert(comlist[COM_GET].id == COM_GET);
+static_assert(comlist[COM_DRAG].id == COM_DRAG);
+static_assert(comlist[COM_PUT].id == COM_PUT);
+static_assert(comlist[COM_DROP].id == COM_DROP);
+static_assert(comlist[COM_STASH].id == COM_STASH);
+static_assert(comlist[COM_WIELD].id == COM_WIELD);
+static_assert(comlist[COM_UNWIELD].id == COM_UNWIELD);
+static_assert(comlist[COM_HOLD].id == COM_HOLD);
+static_assert(comlist[COM_OFFER].id == COM_OFFER);
+static_assert(comlist[COM_LIGHT].id == COM_LIGHT);
+static_assert(comlist[COM_WEAR].id == COM_WEAR);
+static_assert(comlist[COM_REMOVE].id == COM_REMOVE);
+static_assert(comlist[COM_LABEL].id == COM_LABEL);
+static_assert(comlist[COM_UNLABEL].id == COM_UNLABEL);
+static_assert(comlist[COM_HEAL].id == COM_HEAL);
+static_assert(comlist[COM_SLEEP].id == COM_SLEEP);
+static_assert(comlist[COM_WAKE].id == COM_WAKE);
+static_assert(comlist[COM_LIE].id == COM_LIE);
+static_assert(comlist[COM_REST].id == COM_REST);
+static_assert(comlist[COM_SIT].id == COM_SIT);
+static_assert(comlist[COM_STAND].id == COM_STAND);
+static_assert(comlist[COM_USE].id == COM_USE);
+static_assert(comlist[COM_STOP].id == COM_STOP);
+static_assert(comlist[COM_CAST].id == COM_CAST);
+static_assert(comlist[COM_PRAY].id == COM_PRAY);
+static_assert(comlist[COM_SHOUT].id == COM_SHOUT);
+static_assert(comlist[COM_YELL].id == COM_YELL);
+static_assert(comlist[COM_CALL].id == COM_CALL);
+static_assert(comlist[COM_SAY].id == COM_SAY);
+static_assert(comlist[COM_EMOTE].id == COM_EMOTE);
+static_assert(comlist[COM_INTRODUCE].id == COM_INTRODUCE);
+static_assert(comlist[COM_EAT].id == COM_EAT);
+static_assert(comlist[COM_DRINK].id == COM_DRINK);
+static_assert(comlist[COM_FILL].id == COM_FILL);
+static_assert(comlist[COM_DUMP].id == COM_DUMP);
+static_assert(comlist[COM_POINT].id == COM_POINT);
+static_assert(comlist[COM_FOLLOW].id == COM_FOLLOW);
+static_assert(comlist[COM_ATTACK].id == COM_ATTACK);
+static_assert(comlist[COM_KILL].id == COM_KILL);
+static_assert(comlist[COM_PUNCH].id == COM_PUNCH);
+static_assert(comlist[COM_KICK].id == COM_KICK);
+static_assert(comlist[COM_FLEE].id == COM_FLEE);
+static_assert(comlist[COM_LIST].id == COM_LIST);
+static_assert(comlist[COM_BUY].id == COM_BUY);
+static_assert(comlist[COM_VALUE].id == COM_VALUE);
+static_assert(comlist[COM_SELL].id == COM_SELL);
+static_assert(comlist[COM_TOGGLE].id == COM_TOGGLE);
+static_assert(comlist[COM_WHO].id == COM_WHO);
+static_assert(comlist[COM_OOC].id == COM_OOC);
+static_assert(comlist[COM_NEWBIE].id == COM_NEWBIE);
+static_assert(comlist[COM_NEWCHARACTER].id == COM_NEWCHARACTER);
+static_assert(comlist[COM_RAISE].id == COM_RAISE);
+static_assert(comlist[COM_LOWER].id == COM_LOWER);
+static_assert(comlist[COM_RESETCHARACTER].id == COM_RESETCHARACTER);
+static_assert(comlist[COM_RANDOMIZE].id == COM_RANDOMIZE);
+static_assert(comlist[COM_ARCHETYPE].id == COM_ARCHETYPE);
+static_assert(comlist[COM_SCORE].id == COM_SCORE);
+static_assert(comlist[COM_TIME].id == COM_TIME);
+static_assert(comlist[COM_WORLD].id == COM_WORLD);
+static_assert(comlist[COM_ZONE].id == COM_ZONE);
+static_assert(comlist[COM_VERSION].id == COM_VERSION);
+static_assert(comlist[COM_SKILLLIST].id == COM_SKILLLIST);
+static_assert(comlist[COM_RECALL].id == COM_RECALL);
+static_assert(comlist[COM_TELEPORT].id == COM_TELEPORT);
+static_assert(comlist[COM_RESURRECT].id == COM_RESURRECT);
+static_assert(comlist[COM_NINJAMODE].id == COM_NINJAMODE);
+static_assert(comlist[COM_MAKENINJA].id == COM_MAKENINJA);
+static_assert(comlist[COM_MAKESUPERNINJA].id == COM_MAKESUPERNINJA);
+static_assert(comlist[COM_CREATE].id == COM_CREATE);
+static_assert(comlist[COM_DCREATE].id == COM_DCREATE);
+static_assert(comlist[COM_CCREATE].id == COM_CCREATE);
+static_assert(comlist[COM_WLOAD].id == COM_WLOAD);
+static_assert(comlist[COM_ANCHOR].id == COM_ANCHOR);
+static_assert(comlist[COM_LINK].id == COM_LINK);
+static_assert(comlist[COM_CONNECT].id == COM_CONNECT);
+static_assert(comlist[COM_COMMAND].id == COM_COMMAND);
+static_assert(comlist[COM_CONTROL].id == COM_CONTROL);
+static_assert(comlist[COM_CLONE].id == COM_CLONE);
+static_assert(comlist[COM_MIRROR].id == COM_MIRROR);
+static_assert(comlist[COM_JUNK].id == COM_JUNK);
+static_assert(comlist[COM_PROD].id == COM_PROD);
+static_assert(comlist[COM_RESET].id == COM_RESET);
+static_assert(comlist[COM_PLAYERS].id == COM_PLAYERS);
+static_assert(comlist[COM_DELPLAYER].id == COM_DELPLAYER);
+static_assert(comlist[COM_CHARACTERS].id == COM_CHARACTERS);
+static_assert(comlist[COM_JACK].id == COM_JACK);
+static_assert(comlist[COM_CHUMP].id == COM_CHUMP);
+static_assert(comlist[COM_INCREMENT].id == COM_INCREMENT);
+static_assert(comlist[COM_DECREMENT].id == COM_DECREMENT);
+static_assert(comlist[COM_DOUBLE].id == COM_DOUBLE);
+static_assert(comlist[COM_SETSTATS].id == COM_SETSTATS);
+static_assert(comlist[COM_BRIEF].id == COM_BRIEF);
+static_assert(comlist[COM_NAME].id == COM_NAME);
+static_assert(comlist[COM_UNNAME].id == COM_UNNAME);
+static_assert(comlist[COM_UNDESCRIBE].id == COM_UNDESCRIBE);
+static_assert(comlist[COM_DESCRIBE].id == COM_DESCRIBE);
+static_assert(comlist[COM_UNDEFINE].id == COM_UNDEFINE);
+static_assert(comlist[COM_DEFINE].id == COM_DEFINE);
+static_assert(comlist[COM_STATS].id == COM_STATS);
+static_assert(comlist[COM_SHUTDOWN].id == COM_SHUTDOWN);
+static_assert(comlist[COM_RESTART].id == COM_RESTART);
+static_assert(comlist[COM_SAVEALL].id == COM_SAVEALL);
+static_assert(comlist[COM_MAKESTART].id == COM_MAKESTART);
+static_assert(comlist[COM_TLOAD].id == COM_TLOAD);
+static_assert(comlist[COM_TCLEAN].id == COM_TCLEAN);
+static_assert(comlist[COM_TPROFILE].id == COM_TPROFILE);
+static_assert(comlist[COM_MAX].id == COM_MAX);
+
+// Command lookup is by unambiguous prefix, taking the first match in comlist order, so all
+// command names (and aliases) are compiled into a prefix trie here, at compile time.  Each
+// node records, for each lookup mode, the first comlist entry with a name under that prefix.
+
+// Alternate names for commands.  Ninja aliases work only in ninja mode, the others work for
+// their command in whichever of the other modes it does.
+struct com_alias {
+  std::u8string_view name;
+  com_t id;
+  bool ninja;
+};
+constexpr static const com_alias com_aliases[] = {
+    {u8"empty", COM_DUMP, false},
+    {u8"take", COM_GET, false},
+    {u8"passwd", COM_PASSWORD, false},
+    {u8"chars", COM_CHARACTERS, true},
+};
+
+struct com_trie_node {
+  char8_t chr;
+  uint16_t child; // First child, or 0 for none
+  uint16_t sibling; // Next sibling, or 0 for none
+  uint16_t first[COM_MODE_MAX]; // First comlist entry under here, or COM_NONE
+};
+
+template <size_t N>
+struct com_trie {
+  com_trie_node nodes[N];
+  size_t size;
+};
+
+constexpr int com_modes(int sit) {
+  if (sit & SIT_NINJAMODE) {
+    return (1 << COM_MODE_NINJA);
+  }
+  return ((sit & SIT_ETHEREAL) ? (1 << COM_MODE_ETHEREAL) : 0) |
+      ((sit & SIT_CORPOREAL) ? (1 << COM_MODE_CORPOREAL) : 0);
+}
+
+template <size_t N>
+constexpr com_trie<N> build_com_trie() {
+  com_trie<N> trie{};
+  trie.size = 1; // Root
+
+  auto add = [&trie](std::u8string_view name, int ctr, int modes) {
+    auto mark = [&trie, ctr, modes](size_t node) {
+      for (int mode = 0; mode < COM_MODE_MAX; ++mode) {
+        auto& first = trie.nodes[node].first[mode];
+        if ((modes & (1 << mode)) && (first == COM_NONE || ctr < first)) {
+          first = ctr;
+        }
+      }
+    };
+    size_t node = 0;
+    mark(node);
+    for (auto chr : name) {
+      size_t next = trie.nodes[node].child;
+      while (next != 0 && trie.nodes[next].chr != chr) {
+        next = trie.nodes[next].sibling;
+      }
+      if (next == 0) {
+        if (trie.size >= N) {
+          return; // Out of room, caught by the static_assert below.
+        }
+        next = trie.size++;
+        trie.nodes[next].chr = chr;
+        trie.nodes[next].sibling = trie.nodes[node].child;
+        trie.nodes[node].child = next;
+      }
+      node = next;
+      mark(node);
+    }
+  };
+
+  for (int ctr = 1; comlist[ctr].id != COM_MAX; ++ctr) {
+    add(comlist[ctr].command, ctr, com_modes(comlist[ctr].sit));
+    for (const auto& alias : com_aliases) {
+      if (alias.id == comlist[ctr].id) {
+        int modes = com_modes(comlist[ctr].sit) & ~(1 << COM_MODE_NINJA);
+        add(alias.name, ctr, (alias.ninja) ? (1 << COM_MODE_NINJA) : modes);
+      }
+    }
+  }
+  return trie;
+}
+
+constexpr size_t com_trie_max = 16384;
+constexpr size_t com_trie_size = build_com_trie<com_trie_max>().size;
+static_assert(com_trie_size < com_trie_max);
+static_assert(COM_MAX < 0x10000);
+constexpr static const auto com_lookup = build_com_trie<com_trie_size>();
+
+constexpr com_t find_command(const std::u8string_view str, com_mode_t mode) {
+  size_t node = 0;
+  for (auto chr : str) {
+    node = com_lookup.nodes[node].child;
+    while (node != 0 && com_lookup.nodes[node].chr != chr) {
+      node = com_lookup.nodes[node].sibling;
+    }
+    if (node == 0) {
+      node = com_trie_size; // Not found
+      break;
+    }
+  }
+  com_t ret = (node < com_trie_size) ? com_t(com_lookup.nodes[node].first[mode]) : COM_NONE;
+
+  // Anything quoted is speech - as long as no earlier command claims it.
+  if (mode != COM_MODE_NINJA && (str.starts_with(u8"'") || str.starts_with(u8"\""))) {
+    if ((com_modes(comlist[COM_SAY].sit) & (1 << mode)) && (ret == COM_NONE || ret > COM_SAY)) {
+      ret = COM_SAY;
+    }
+  }
+  return ret;
+}
+
+static_assert(find_command(u8"n", COM_MODE_CORPOREAL) == COM_NORTH);
+static_assert(find_command(u8"l", COM_MODE_CORPOREAL) == COM_LOOK);
+static_assert(find_command(u8"take", COM_MODE_CORPOREAL) == COM_GET);
+static_assert(find_command(u8"passwd", COM_MODE_ETHEREAL) == COM_PASSWORD);
+static_assert(find_command(u8"'Hello", COM_MODE_CORPOREAL) == COM_SAY);
+static_assert(find_command(u8"chars", COM_MODE_NINJA) == COM_CHARACTERS);
+static_assert(find_command(u8"tclean", COM_MODE_CORPOREAL) == COM_NONE);
+static_assert(find_command(u8"tclean", COM_MODE_NINJA) == COM_TCLEAN);
+static_assert(find_command(u8"tprof", COM_MODE_NINJA) == COM_TPROFILE);
+static_assert(find_command(u8"xyzzy", COM_MODE_CORPOREAL) == COM_NONE);
+
+com_t identify_command(const std::u8string_view str, bool corporeal) {
+  return find_command(str, (corporeal) ? COM_MODE_CORPOREAL : COM_MODE_ETHEREAL);
+}
+
+com_t identify_command(const std::u8string_view str, com_mode_t mode) {
+  return find_command(str, mode);
+}
+
+com_entry command_entry(int cnum) {
+  return {
+      comlist[cnum].command,
+      comlist[cnum].id,
+      (comlist[cnum].sit & SIT_ETHEREAL) != 0,
+      (comlist[cnum].sit & SIT_CORPOREAL) != 0,
+      (comlist[cnum].sit & SIT_NINJAMODE) != 0};
+}
+
+// Return values: -1: Player D/Ced
+//                0: Command Understood
+//                1: Command NOT Understood
+//                2: Command Understood - No More Actions This Round
+static int handle_single_command(Object* body, std::u8string line, std::shared_ptr<Mind> mind) {
+  std::u8string_view cmd = line;
+  std::u8string_view args = line;
+  std::u8string args_buf;
+
+  auto c1 = cmd.find_first_not_of(u8" \t\n\r;");
+  if (c1 == std::u8string::npos) {
+    return 1;
+  }
+
+  auto c2 = cmd.find_first_of(u8" \t\n\r;", c1 + 1);
+  if (c2 == std::u8string::npos) {
+    cmd = cmd.substr(c1);
+  } else {
+    cmd = cmd.substr(c1, c2 - c1);
+  }
+
+  // Lowercase the command portion, and only that portion, for now.
+  auto clen = cmd.find_first_not_of(u8"abcdefghijklmnopqrstuvwxyz");
+  if (clen != std::u8string::npos && clen < cmd.length() && ascii_isupper(cmd[clen])) {
+    if (c2 == std::u8string::npos) {
+      std::transform(line.begin(), line.end(), line.begin(), ascii_tolower);
+    } else {
+      std::transform(line.begin(), line.begin() + c2 + 1, line.begin(), ascii_tolower);
+    }
+  }
+
+  if ((!body) && (!mind)) { // Nobody doing something?
+    loge(u8"Warning: absolutely nobody tried to '{}'.", line);
+    return 0;
+  }
+
+  if (cmd.empty() || cmd.front() == '#')
+    return 0;
+
+  if (mind && mind->Type() == mind_t::REMOTE && (!mind->Owner())) {
+    if (mind->PName() != u8"")
+      mind->SetPPass(std::u8string(cmd));
+    else {
+      int ctr;
+      for (ctr = 0; ctr < int(cmd.length()); ++ctr) {
+        if (!(ascii_isalnum(cmd[ctr]) || cmd[ctr] == ' ')) {
+          mind->Send(
+              u8"Name '{}' is invalid.\nNames can only have letters, numbers, and spaces.\n", cmd);
+          loge(u8"Name '{}' is invalid.\nNames can only have letters, numbers, and spaces.", cmd);
+          break;
+        }
+      }
+      if (ctr == int(cmd.length()))
+        mind->SetPName(std::u8string(cmd));
+    }
+    return 0;
+  }
+
+  int ninja = 0, sninja = 0, nmode = 0;
+  if (mind && mind->Owner() && mind->Owner()->Is(PLAYER_SUPERNINJA)) {
+    sninja = 1;
+    ninja = 1;
+  } else if (mind && mind->Owner() && mind->Owner()->Is(PLAYER_NINJA)) {
+    ninja = 1;
+  }
+  if (mind && mind->Owner() && mind->Owner()->Is(PLAYER_NINJAMODE)) {
+    nmode = LOC_NINJA;
+  }
+
+  int cnum = identify_command(cmd, (body != nullptr));
+  if (cnum == COM_NONE && nmode) { // Now match ninja commands (for ninjas)
+    cnum = find_command(cmd, COM_MODE_NINJA);
+  }
+
+  // Lowercase the entire command, for non-flavortext commands.
+  if (cnum != COM_NONE && (comlist[cnum].sit & CMD_FLAVORTEXT) == 0) {
+    auto fclen = line.find_first_of(u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    if (fclen != std::u8string::npos && fclen < line.length()) {
+      std::transform(line.begin(), line.end(), line.begin(), ascii_tolower);
+    }
+  }
+
+  if (c2 == std::u8string::npos) {
+    args = u8"";
+  } else {
+    auto a1 = args.find_first_not_of(u8" \t\n\r;", c2 + 1);
+    if (a1 == std::u8string::npos) {
+      args = u8"";
+    } else {
+      args = args.substr(a1);
+    }
+  }
+
+  // Only look for *-COMMAND triggers if there are any around here to find.
+  if ((!nmode) && cnum != COM_RECALL && body && body->Parent() &&
+      (body->Room() == body || (body->Room()->TriggerTypesWithin() & 0x0000004))) {
+    DArr64<Object*> items;
+    Object* room = body->PickObject(u8"here", LOC_HERE);
+    auto items2 = body->PickObjects(u8"everything", LOC_INTERNAL | LOC_NEARBY);
+    auto items3 = body->PickObjects(u8"everyone", LOC_NEARBY);
+    items.reserve(items2.size() + items3.size() + (room != nullptr));
+    if (room != nullptr)
+      items.push_back(room);
+    items.insert(items.end(), items2.begin(), items2.end());
+    items.insert(items.end(), items3.begin(), items3.end());
+
+    for (auto obj : items) {
+      auto trigs = obj->PickObjects(u8"all tbamud trigger script", LOC_NINJA | LOC_INTERNAL);
+      for (auto trig : trigs) {
+        if (trig->Skill(prhash(u8"TBAScriptType")) & 0x04) { // *-COMMAND trigs
+          if ((cnum == COM_NONE &&
+               cmd == std::u8string_view(trig->Desc()).substr(0, cmd.length())) ||
+              (cnum && cnum == identify_command(trig->Desc(), true))) {
+            if (trig->Skill(prhash(u8"TBAScriptType")) & 0x2000000) { // OBJ
+              int narg = trig->Skill(prhash(u8"TBAScriptNArg"));
+              if ((narg & 3) == 0 && body->HasWithin(obj)) {
+                continue;
+              } else if ((narg & 3) == 2 && body->Wearing(obj)) {
+                continue;
+              } else if ((narg & 3) == 1 && (!body->Wearing(obj))) {
+                continue;
+              }
+              if ((narg & 4) == 0 && (!body->HasWithin(obj))) {
+                continue;
+              }
+            }
+            std::u8string cmln;
+            if (cnum != COM_NONE) {
+              cmln = fmt::format(u8"{} {}", comlist[cnum].command, args);
+            } else {
+              cmln = fmt::format(u8"{} {}", trig->Desc(), args);
+            }
+            if (!new_trigger(0, trig, body, cmln)) {
+              return 0; // Handled, unless script says not.
+            }
+          }
+        }
+      }
+    }
+  }
+  if (cnum == COM_NONE) { // Unknown, and not trigger-supported, command
+    if (mind)
+      mind->Send(u8"Command NOT understood - type 'help' for assistance.\n");
+    return 1;
+  }
+
+  if ((!sninja) && (comlist[cnum].sit & SIT_SUPERNINJA)) {
+    if (mind)
+      mind->Send(u8"Sorry, that command is for Super Ninjas only!\n");
+    return 0;
+  }
+
+  if ((!ninja) && (comlist[cnum].sit & SIT_NINJA)) {
+    if (mind)
+      mind->Send(u8"Sorry, that command is for True Ninjas only!\n");
+    return 0;
+  }
+
+  if ((!nmode) && (comlist[cnum].sit & SIT_NINJAMODE)) {
+    if (mind && ninja)
+      mind->Send(u8"Sorry, you need to be in Ninja Mode[TM] to do that.\n");
+    else if (mind)
+      mind->Send(u8"Sorry, that command is for Ninjas only!\n");
+    return 0;
+  }
+
+  if ((!(comlist[cnum].sit & SIT_ETHEREAL)) && (!body)) {
+    if (mind)
+      mind->Send(
+          u8"You can't use that command until you join the game - with "
+          u8"the 'enter' command.\n");
+    return 0;
+  }
+
+  if ((!(comlist[cnum].sit & SIT_CORPOREAL)) && (body)) {
+    if (mind)
+      mind->Send(
+          u8"You can't use that command until you quit the game - with "
+          u8"the 'quit' command.\n");
+    return 0;
+  }
+
+  if (body) {
+    if (body->StillBusy() && (comlist[cnum].sit & SIT_ACTION)) {
+      body->DoWhenFree(std::u8string(comlist[cnum].command) + u8" " + std::u8string(args));
+      return 0;
+    }
+    if (comlist[cnum].sit & (SIT_ALIVE | SIT_AWAKE | SIT_ALERT)) {
+      if (body->IsAct(act_t::DYING) || body->IsAct(act_t::DEAD)) {
+        if (mind)
+          mind->Send(u8"You must be alive to use that command.\n");
+        return 0;
+      }
+    }
+    if (body && (comlist[cnum].sit & SIT_CONSCIOUS)) {
+      if (body->IsAct(act_t::UNCONSCIOUS)) {
+        if (mind)
+          mind->Send(u8"You can't do that, you are out cold.\n");
+        return 0;
+      }
+    }
+    if ((comlist[cnum].sit & (SIT_STAND | SIT_USE)) == (SIT_STAND | SIT_USE)) {
+      if (body->Position() != pos_t::STAND && body->Position() != pos_t::USE) {
+        if (mind)
+          mind->Send(u8"You must stand up to use that command.\n");
+        handle_single_command(body, u8"stand", mind);
+        if (body->Position() != pos_t::STAND && body->Position() != pos_t::USE)
+          return 0;
+      }
+    } else if ((comlist[cnum].sit & (SIT_STAND | SIT_SIT)) == (SIT_STAND | SIT_SIT)) {
+      if (body->Position() == pos_t::USE) {
+        if (mind)
+          mind->Send(u8"You must stop using this skill to do that.\n");
+        handle_single_command(body, u8"stop", mind);
+        if (body->Position() != pos_t::STAND)
+          return 0;
+      } else if (body->Position() != pos_t::SIT && body->Position() != pos_t::STAND) {
+        if (mind)
+          mind->Send(u8"You must at least sit up to use that command.\n");
+        handle_single_command(body, u8"sit", mind);
+        if (body->Position() != pos_t::SIT && body->Position() != pos_t::STAND)
+          return 0;
+      }
+    } else if (comlist[cnum].sit & SIT_STAND) {
+      if (body->Position() == pos_t::USE) {
+        if (mind)
+          mind->Send(u8"You must stop using this skill to do that.\n");
+        handle_single_command(body, u8"stop", mind);
+        if (body->Position() != pos_t::STAND)
+          return 0;
+      } else if (body->Position() != pos_t::STAND) {
+        if (mind)
+          mind->Send(u8"You must stand up to use that command.\n");
+        handle_single_command(body, u8"stand", mind);
+        if (body->Position() != pos_t::STAND)
+          return 0;
+      }
+    }
+    if (comlist[cnum].sit & SIT_SIT) {
+      if (body->Position() != pos_t::SIT) {
+        if (mind)
+          mind->Send(u8"You must sit to use that command.\n");
+        handle_single_command(body, u8"sit", mind);
+        if (body->Position() != pos_t::SIT)
+          return 0;
+      }
+    }
+    if (comlist[cnum].sit & SIT_ALERT) {
+      if (body->IsAct(act_t::SLEEP)) {
+        if (mind)
+          mind->Send(u8"You must be awake to use that command.\n");
+        handle_single_command(body, u8"wake", mind);
+        if (body->IsAct(act_t::SLEEP))
+          return 0;
+      }
+      if (body->IsAct(act_t::REST)) {
+        if (mind)
+          mind->Send(u8"You must be alert to use that command.\n");
+        handle_single_command(body, u8"rest", mind);
+        if (body->IsAct(act_t::REST))
+          return 0;
+      }
+    }
+    if (comlist[cnum].sit & SIT_AWAKE) {
+      if (body->IsAct(act_t::SLEEP)) {
+        if (mind)
+          mind->Send(u8"You must be awake to use that command.\n");
+        handle_single_command(body, u8"wake", mind);
+        if (body->IsAct(act_t::SLEEP))
+          return 0;
+      }
+    }
+  }
+
+  int stealth_t = 0, stealth_s = 0;
+  if (body && body->IsUsing(prhash(u8"Stealth")) && body->Skill(prhash(u8"Stealth")) > 0) {
+    stealth_t = body->Skill(prhash(u8"Stealth"));
+    stealth_s = body->Roll(prhash(u8"Stealth"), 2);
+  }
+
+  if (cnum == COM_HELP) {
+    if ((!mind) || (!mind->Owner()))
+      return 0;
+    if (args == u8"commands") {
+      std::u8string mes = u8"";
+      for (int ctr = 1; comlist[ctr].id != COM_MAX; ++ctr) {
+        if (comlist[ctr].id > COM_LAST_STANDARD)
+          continue;
+        if ((comlist[ctr].sit & SIT_NINJAMODE) && (!nmode))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_NINJAMODE)) && nmode)
+          continue;
+        if ((comlist[ctr].sit & SIT_NINJA) && (!ninja))
+          continue;
+        if ((comlist[ctr].sit & SIT_SUPERNINJA) && (!sninja))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_CORPOREAL)) && (body))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_ETHEREAL)) && (!body))
+          continue;
+        mes += comlist[ctr].command;
+        mes += u8" - ";
+        mes += comlist[ctr].shortdesc;
+        mes += '\n';
+      }
+      mind->Send(mes);
+      return 0;
+    } else if (args == u8"socials") {
+      std::u8string mes = u8"";
+      for (int ctr = 1; comlist[ctr].id != COM_MAX; ++ctr) {
+        if (comlist[ctr].id > COM_LAST_STANDARD)
+          continue;
+        if ((comlist[ctr].sit & SIT_NINJAMODE) && (!nmode))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_NINJAMODE)) && nmode)
+          continue;
+        if ((comlist[ctr].sit & SIT_NINJA) && (!ninja))
+          continue;
+        if ((comlist[ctr].sit & SIT_SUPERNINJA) && (!sninja))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_CORPOREAL)) && (body))
+          continue;
+        if ((!(comlist[ctr].sit & SIT_ETHEREAL)) && (!body))
+          continue;
+        mes += comlist[ctr].command;
+        mes += u8" - ";
+        mes += comlist[ctr].shortdesc;
+        mes += '\n';
+      }
+      mind->Send(mes);
+      return 0;
+    }
+    mind->Send(
+        u8"Well, the help command's not really implemented yet :P\n"
+        u8"Try 'help commands' for a list of general commands.\n"
+        u8"Try 'help socials' for a list of social commands.\n");
+    return 0;
+  }
+
+  if (cnum == COM_NINJAMODE) {
+    if (!mind)
+      return 0;
+
+    Player* pl = mind->Owner();
+    if (args.empty()) {
+      mind->Send(u8"What command do you want to run in Ninja Mode[TM]?\n");
+      mind->Send(u8"You need to include the command, like 'ninja junk boat'.\n");
+    } else if (!pl) {
+      mind->Send(u8"Sorry, you don't seem to be a player!\n");
+    } else {
+      pl->Set(PLAYER_NINJAMODE);
+      mind->Send(u8"Ninja mode activated.\n");
+      handle_single_command(body, std::u8string(args), mind);
+      pl->UnSet(PLAYER_NINJAMODE);
+      mind->Send(u8"Ninja mode deactivated.\n");
+    }
+    return 0;
+  }
+
+  if (cnum == COM_PRAY) {
+    if (!mind)
+      return 0;
+
+    if (args.empty()) {
+      mind->Send(u8"What command do you want to pray for?\n");
+      mind->Send(u8"You need to include the command, like 'pray kill Joe'.\n");
+    } else {
+      // FIXME: Tell sub-command you're praying!
+      body->Parent()->SendOut(
+          stealth_t, stealth_s, u8";s prays.\n", u8"You pray.\n", body, nullptr);
+      handle_single_command(body, std::u8string(args), mind);
+    }
+    return 0;
+  }
+
+  if (cnum == COM_LIST) {
+    return handle_command_list(body, mind, cnum, args, stealth_t, stealth_s);
+  }
+
+  if (cnum == COM_BUY) {
+    return handle_command_buy(body, mind, cnum, args, stealth_t, stealth_s);
+  }
+
+  if (cnum == COM_VALUE || cnum == COM_SELL) {
+    return handle_command_shops(body, mind, cnum, args, stealth_t, stealth_s);
+  }
+
+  if (cnum == COM_CCREATE) {
+    if (!mind)
+      return 0;
+    return handle_command_ccreate(body, mind, args, stealth_t, stealth_s);
+  }
+
+  if (cnum == COM_WLOAD) {
+    if (!mind)
+      return 0;
+    return handle_command_wload(body, mind, args, stealth_t, stealth_s);
+  }
+
+  if (cnum > COM_LAST_STANDARD) {
+    return handle_social_command(body, mind, cnum, args, stealth_t, stealth_s);
+  }
+
+  return handle_command_other(body, mind, cnum, args, stealth_t, stealth_s);
+}
+
+int handle_command(Object* body, const std::u8string_view& cl, std::shared_ptr<Mind> mind) {
+  int ret = 0;
+
+  if (mind && !mind->SpecialPrompt().empty()) {
+    std::u8string cmd = fmt::format(u8"{} {}", mind->SpecialPrompt(), cl);
+    ret = handle_single_command(body, cmd, mind);
+    return ret;
+  }
+
+  auto start = cl.find_first_not_of(u8"; \t\r\n");
+  while (start != std::u8string::npos) {
+    auto end = cl.find_first_of(u8";\r\n", start + 1);
+
+    std::u8string_view single(cl);
+    if (end != std::u8string::npos) {
+      single = single.substr(start, end - start);
+    } else {
+      single = single.substr(start);
+    }
+
+    int stat = handle_single_command(body, std::u8string(single), mind);
+    if (stat < 0)
+      return stat;
+    else if (ret == 0)
+      ret = stat;
+    if (end != std::u8string::npos) {
+      start = cl.find_first_not_of(u8"; \t\r\n", end + 1);
+    } else {
+      start = std::u8string::npos;
+    }
+  }
+  return ret;
+}
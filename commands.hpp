@@ -0,0 +1,703 @@
+// *************************************************************************
+//  This file is part of AcidMUD by Steaphan Greene
+//
+//  Copyright 1999-2022 Steaphan Greene <steaphan@gmail.com>
+//
+//  AcidMUD is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  AcidMUD is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with AcidMUD (see the file named "COPYING");
+//  If not, see <http://www.gnu.org/licenses/>.
+//
+// *************************************************************************
+
+#include <string>
+
+#include "mind.hpp"
+#include "object.hpp"
+
+typedef enum {
+  COM_NONE = 0,
+  COM_HELP,
+  COM_QUIT,
+  COM_PASSWORD,
+
+  COM_NORTH,
+  COM_SOUTH,
+  COM_EAST,
+  COM_WEST,
+  COM_UP,
+  COM_DOWN,
+
+  COM_LOOK,
+  COM_EXAMINE,
+  COM_CONSIDER,
+  COM_INVENTORY,
+  COM_EQUIPMENT,
+  COM_SEARCH,
+  COM_HIDE,
+
+  COM_LEAVE,
+  COM_ENTER,
+  COM_SELECT,
+
+  COM_OPEN,
+  COM_CLOSE,
+  COM_UNLOCK,
+  COM_LOCK,
+
+  COM_GET,
+  COM_HOLD,
+  COM_OFFER,
+
+  COM_DRAG,
+  COM_PUT,
+  COM_DROP,
+  COM_STASH,
+  COM_WIELD,
+  COM_UNWIELD,
+  COM_LIGHT,
+  COM_WEAR,
+  COM_REMOVE,
+  COM_LABEL,
+  COM_UNLABEL,
+  COM_HEAL,
+
+  COM_SLEEP,
+  COM_WAKE,
+  COM_LIE,
+  COM_REST,
+  COM_SIT,
+  COM_STAND,
+  COM_USE,
+  COM_STOP,
+  COM_CAST,
+  COM_PRAY,
+
+  COM_SHOUT,
+  COM_YELL,
+  COM_CALL,
+  COM_SAY,
+  COM_EMOTE,
+  COM_INTRODUCE,
+
+  COM_EAT,
+  COM_DRINK,
+  COM_FILL,
+  COM_DUMP,
+
+  COM_POINT,
+  COM_FOLLOW,
+  COM_ATTACK,
+  COM_KILL,
+  COM_PUNCH,
+  COM_KICK,
+  COM_FLEE,
+
+  COM_LIST,
+  COM_BUY,
+  COM_VALUE,
+  COM_SELL,
+
+  COM_TOGGLE,
+
+  COM_WHO,
+  COM_OOC,
+  COM_NEWBIE,
+
+  COM_NEWCHARACTER,
+  COM_RAISE,
+  COM_LOWER,
+  COM_RESETCHARACTER,
+  COM_RANDOMIZE,
+  COM_ARCHETYPE,
+
+  COM_SCORE,
+  COM_TIME,
+  COM_WORLD,
+  COM_ZONE,
+  COM_VERSION,
+
+  COM_SKILLLIST,
+
+  COM_RECALL,
+  COM_TELEPORT,
+  COM_RESURRECT,
+
+  COM_NINJAMODE,
+  COM_MAKENINJA,
+  COM_MAKESUPERNINJA,
+
+  COM_CREATE,
+  COM_DCREATE,
+  COM_CCREATE,
+  COM_WLOAD,
+  COM_ANCHOR,
+  COM_LINK,
+  COM_CONNECT,
+  COM_COMMAND,
+  COM_CONTROL,
+  COM_CLONE,
+  COM_MIRROR,
+  COM_JUNK,
+  COM_PROD,
+
+  COM_RESET,
+  COM_PLAYERS,
+  COM_DELPLAYER,
+  COM_CHARACTERS,
+
+  COM_JACK,
+  COM_CHUMP,
+  COM_INCREMENT,
+  COM_DECREMENT,
+  COM_DOUBLE,
+  COM_SETSTATS,
+  COM_BRIEF,
+  COM_NAME,
+  COM_UNNAME,
+  COM_UNDESCRIBE,
+  COM_DESCRIBE,
+  COM_UNDEFINE,
+  COM_DEFINE,
+
+  COM_STATS,
+  COM_SHUTDOWN,
+  COM_RESTART,
+  COM_SAVEALL,
+
+  COM_MAKESTART,
+
+  COM_TLOAD,
+  COM_TCLEAN,
+  COM_TPROFILE,
+
+  COM_LAST_STANDARD = COM_TPROFILE, // Standard commands end here.
+
+  // The rest are commands, loaded from TBA, which all have no real effect.
+  COM_SOCIAL____,
+  COM_SOCIAL_ABC,
+  COM_SOCIAL_ABRAC,
+  COM_SOCIAL_ACCUSE,
+  COM_SOCIAL_ACK,
+  COM_SOCIAL_ADIEU,
+  COM_SOCIAL_ADMIRE,
+  COM_SOCIAL_ADORING,
+  COM_SOCIAL_AGREE,
+  COM_SOCIAL_AHEM,
+  COM_SOCIAL_AIM,
+  COM_SOCIAL_AMUSED,
+  COM_SOCIAL_APOLOGIZE,
+  COM_SOCIAL_APPLAUD,
+  COM_SOCIAL_ARCH,
+  COM_SOCIAL_ARGH,
+  COM_SOCIAL_ARMCROSS,
+  COM_SOCIAL_ARREST,
+  COM_SOCIAL_AVSALUTE,
+  COM_SOCIAL_AWW,
+  COM_SOCIAL_BABBLE,
+  COM_SOCIAL_BACKCLAP,
+  COM_SOCIAL_BARK,
+  COM_SOCIAL_BAT,
+  COM_SOCIAL_BATMAN,
+  COM_SOCIAL_BATTLECRY,
+  COM_SOCIAL_BEAM,
+  COM_SOCIAL_BEARHUG,
+  COM_SOCIAL_BECKON,
+  COM_SOCIAL_BEER,
+  COM_SOCIAL_BEG,
+  COM_SOCIAL_BEHIND,
+  COM_SOCIAL_BELCH,
+  COM_SOCIAL_BITE,
+  COM_SOCIAL_BLAH,
+  COM_SOCIAL_BLAME,
+  COM_SOCIAL_BLEED,
+  COM_SOCIAL_BLINK,
+  COM_SOCIAL_BLOOB,
+  COM_SOCIAL_BLUE,
+  COM_SOCIAL_BLUSH,
+  COM_SOCIAL_BOUNCE,
+  COM_SOCIAL_BOAST,
+  COM_SOCIAL_BOGGLE,
+  COM_SOCIAL_BOINK,
+  COM_SOCIAL_BONK,
+  COM_SOCIAL_BOO,
+  COM_SOCIAL_BOOGER,
+  COM_SOCIAL_BOP,
+  COM_SOCIAL_BORED,
+  COM_SOCIAL_BOW,
+  COM_SOCIAL_BOX,
+  COM_SOCIAL_BRAG,
+  COM_SOCIAL_BRB,
+  COM_SOCIAL_BREATHE,
+  COM_SOCIAL_BURN,
+  COM_SOCIAL_BURP,
+  COM_SOCIAL_BUZZ,
+  COM_SOCIAL_CACKLE,
+  COM_SOCIAL_CAKE,
+  COM_SOCIAL_CALM,
+  COM_SOCIAL_CARESS,
+  COM_SOCIAL_CARROT,
+  COM_SOCIAL_CARTWHEEL,
+  COM_SOCIAL_CHALLENGE,
+  COM_SOCIAL_CHANNEL,
+  COM_SOCIAL_CHARGE,
+  COM_SOCIAL_CHARM,
+  COM_SOCIAL_CHEERS,
+  COM_SOCIAL_CHITTER,
+  COM_SOCIAL_CHOKE,
+  COM_SOCIAL_CHORTLE,
+  COM_SOCIAL_CHRISTMAS,
+  COM_SOCIAL_CHUCKLES,
+  COM_SOCIAL_CLAP,
+  COM_SOCIAL_CLOBBER,
+  COM_SOCIAL_COFFEE,
+  COM_SOCIAL_COLD,
+  COM_SOCIAL_COLLAPSE,
+  COM_SOCIAL_COMFORT,
+  COM_SOCIAL_COMB,
+  COM_SOCIAL_CONFUSE,
+  COM_SOCIAL_CONGA,
+  COM_SOCIAL_CONGA2,
+  COM_SOCIAL_CONSOLE,
+  COM_SOCIAL_CONTEMPLATE,
+  COM_SOCIAL_COUGH,
+  COM_SOCIAL_COWER,
+  COM_SOCIAL_CRADLE,
+  COM_SOCIAL_CRAZED,
+  COM_SOCIAL_CRAZY,
+  COM_SOCIAL_CREEP,
+  COM_SOCIAL_CRINGE,
+  COM_SOCIAL_CRITICIZE,
+  COM_SOCIAL_CROON,
+  COM_SOCIAL_CROSSFINGER,
+  COM_SOCIAL_CRUSHED,
+  COM_SOCIAL_CRY,
+  COM_SOCIAL_CRYLAUGH,
+  COM_SOCIAL_CUDDLE,
+  COM_SOCIAL_CURIOUS,
+  COM_SOCIAL_CURL,
+  COM_SOCIAL_CURSE,
+  COM_SOCIAL_CURTSEY,
+  COM_SOCIAL_CUSTARD,
+  COM_SOCIAL_DANCE,
+  COM_SOCIAL_DARK,
+  COM_SOCIAL_DAYDREAM,
+  COM_SOCIAL_DBC,
+  COM_SOCIAL_DEAD,
+  COM_SOCIAL_DEAF,
+  COM_SOCIAL_DEFIB,
+  COM_SOCIAL_DESPAIR,
+  COM_SOCIAL_DESPINE,
+  COM_SOCIAL_DIFFER,
+  COM_SOCIAL_DISAPPROVE,
+  COM_SOCIAL_DISCOMBOB,
+  COM_SOCIAL_DISTURBED,
+  COM_SOCIAL_DIVE,
+  COM_SOCIAL_DOH,
+  COM_SOCIAL_DOODLE,
+  COM_SOCIAL_DREAD,
+  COM_SOCIAL_DROOL,
+  COM_SOCIAL_DRUMROLL,
+  COM_SOCIAL_DUCK,
+  COM_SOCIAL_DUH,
+  COM_SOCIAL_EARLICK,
+  COM_SOCIAL_EEK,
+  COM_SOCIAL_EEP,
+  COM_SOCIAL_EGO,
+  COM_SOCIAL_EGRIN,
+  COM_SOCIAL_ELEPHANTMA,
+  COM_SOCIAL_EMBRACE,
+  COM_SOCIAL_ENTHUSE,
+  COM_SOCIAL_ENVY,
+  COM_SOCIAL_EVILEYE,
+  COM_SOCIAL_EWW,
+  COM_SOCIAL_EXCUSE,
+  COM_SOCIAL_EYE,
+  COM_SOCIAL_EYEBROW,
+  COM_SOCIAL_EYEROLL,
+  COM_SOCIAL_FACEGRAB,
+  COM_SOCIAL_FACEPALM,
+  COM_SOCIAL_FADE,
+  COM_SOCIAL_FAINT,
+  COM_SOCIAL_FALL,
+  COM_SOCIAL_FAN,
+  COM_SOCIAL_FART,
+  COM_SOCIAL_FISH,
+  COM_SOCIAL_FLAIL,
+  COM_SOCIAL_FLAME,
+  COM_SOCIAL_FLARE,
+  COM_SOCIAL_FLASH,
+  COM_SOCIAL_FLEX,
+  COM_SOCIAL_FLICK,
+  COM_SOCIAL_FLINCH,
+  COM_SOCIAL_FLIP,
+  COM_SOCIAL_FLIRT,
+  COM_SOCIAL_FLOOR,
+  COM_SOCIAL_FLOP,
+  COM_SOCIAL_FLUTTER,
+  COM_SOCIAL_FOAM,
+  COM_SOCIAL_FONDLE,
+  COM_SOCIAL_FOOT,
+  COM_SOCIAL_FORGIVE,
+  COM_SOCIAL_FRENCH,
+  COM_SOCIAL_FROTH,
+  COM_SOCIAL_FROWN,
+  COM_SOCIAL_FUME,
+  COM_SOCIAL_FURROW,
+  COM_SOCIAL_FUSS,
+  COM_SOCIAL_FWAP,
+  COM_SOCIAL_GAG,
+  COM_SOCIAL_GASP,
+  COM_SOCIAL_GAZE,
+  COM_SOCIAL_GHUG,
+  COM_SOCIAL_GIBBER,
+  COM_SOCIAL_GIGGLE,
+  COM_SOCIAL_GLARE,
+  COM_SOCIAL_GLEAM,
+  COM_SOCIAL_GOODBYE,
+  COM_SOCIAL_GOOSE,
+  COM_SOCIAL_GREED,
+  COM_SOCIAL_GREET,
+  COM_SOCIAL_GRIMACE,
+  COM_SOCIAL_GRIN,
+  COM_SOCIAL_GROAN,
+  COM_SOCIAL_GROPE,
+  COM_SOCIAL_GROVEL,
+  COM_SOCIAL_GROWL,
+  COM_SOCIAL_GRUMBLES,
+  COM_SOCIAL_GRUNTS,
+  COM_SOCIAL_HAIRCUT,
+  COM_SOCIAL_HALO,
+  COM_SOCIAL_HANDRAISE,
+  COM_SOCIAL_HANDSHAKE,
+  COM_SOCIAL_HAPPY,
+  COM_SOCIAL_HATE,
+  COM_SOCIAL_HEADACHE,
+  COM_SOCIAL_HEH,
+  COM_SOCIAL_HICCUP,
+  COM_SOCIAL_HIGHFIVE,
+  COM_SOCIAL_HISS,
+  COM_SOCIAL_HMMMMM,
+  COM_SOCIAL_HONEY,
+  COM_SOCIAL_HOP,
+  COM_SOCIAL_HOTFOOT,
+  COM_SOCIAL_HOWL,
+  COM_SOCIAL_HRMPH,
+  COM_SOCIAL_HUG,
+  COM_SOCIAL_HUGGLE,
+  COM_SOCIAL_HULA,
+  COM_SOCIAL_HUM,
+  COM_SOCIAL_HUMANS,
+  COM_SOCIAL_HUSH,
+  COM_SOCIAL_HUSTLE,
+  COM_SOCIAL_HUZZAH,
+  COM_SOCIAL_HYSTERICAL,
+  COM_SOCIAL_IGNORE,
+  COM_SOCIAL_INNOCENT,
+  COM_SOCIAL_INSANE,
+  COM_SOCIAL_INSOMNIA,
+  COM_SOCIAL_JAW,
+  COM_SOCIAL_JEER,
+  COM_SOCIAL_JEST,
+  COM_SOCIAL_JOB,
+  COM_SOCIAL_JOG,
+  COM_SOCIAL_JOINT,
+  COM_SOCIAL_JOKE,
+  COM_SOCIAL_JUGGLE,
+  COM_SOCIAL_KISS,
+  COM_SOCIAL_KNEEL,
+  COM_SOCIAL_KNIGHT,
+  COM_SOCIAL_KNUCKLE,
+  COM_SOCIAL_LALA,
+  COM_SOCIAL_LAME,
+  COM_SOCIAL_LAUGHS,
+  COM_SOCIAL_LEAN,
+  COM_SOCIAL_LICKS,
+  COM_SOCIAL_LISTEN,
+  COM_SOCIAL_LOFR,
+  COM_SOCIAL_LOL,
+  COM_SOCIAL_LOST,
+  COM_SOCIAL_LOVE,
+  COM_SOCIAL_LUST,
+  COM_SOCIAL_LAG,
+  COM_SOCIAL_MACE,
+  COM_SOCIAL_MADGIGGLE,
+  COM_SOCIAL_MAKEOUT,
+  COM_SOCIAL_MASSAGE,
+  COM_SOCIAL_MEDS,
+  COM_SOCIAL_MEEP,
+  COM_SOCIAL_MEOW,
+  COM_SOCIAL_MIC,
+  COM_SOCIAL_MOAN,
+  COM_SOCIAL_MOCK,
+  COM_SOCIAL_MODEL,
+  COM_SOCIAL_MODEST,
+  COM_SOCIAL_MOO,
+  COM_SOCIAL_MOOCH,
+  COM_SOCIAL_MOON,
+  COM_SOCIAL_MORTALS,
+  COM_SOCIAL_MOSH,
+  COM_SOCIAL_MUAHAHA,
+  COM_SOCIAL_MUFFLE,
+  COM_SOCIAL_MUMBLE,
+  COM_SOCIAL_MUSS,
+  COM_SOCIAL_MUTTER,
+  COM_SOCIAL_NAILFILE,
+  COM_SOCIAL_NEEDLE,
+  COM_SOCIAL_NEWIDEA,
+  COM_SOCIAL_NIBBLE,
+  COM_SOCIAL_NIGHT,
+  COM_SOCIAL_NODS,
+  COM_SOCIAL_NODRUGS,
+  COM_SOCIAL_NONO,
+  COM_SOCIAL_NOOGIE,
+  COM_SOCIAL_NUDGE,
+  COM_SOCIAL_NUZZLE,
+  COM_SOCIAL_NYUK,
+  COM_SOCIAL_OGLE,
+  COM_SOCIAL_OH,
+  COM_SOCIAL_OK,
+  COM_SOCIAL_ORCS,
+  COM_SOCIAL_OUCH,
+  COM_SOCIAL_PAT,
+  COM_SOCIAL_PACE,
+  COM_SOCIAL_PANIC,
+  COM_SOCIAL_PANT,
+  COM_SOCIAL_PECK,
+  COM_SOCIAL_PEER,
+  COM_SOCIAL_PERSPIRE,
+  COM_SOCIAL_PET,
+  COM_SOCIAL_PHEW,
+  COM_SOCIAL_PHLEGM,
+  COM_SOCIAL_PICKNOSE,
+  COM_SOCIAL_PIE,
+  COM_SOCIAL_PILLOW,
+  COM_SOCIAL_PINDROP,
+  COM_SOCIAL_PINCH,
+  COM_SOCIAL_PITY,
+  COM_SOCIAL_POINT,
+  COM_SOCIAL_POKE,
+  COM_SOCIAL_PONDER,
+  COM_SOCIAL_POOH,
+  COM_SOCIAL_POP,
+  COM_SOCIAL_POSE,
+  COM_SOCIAL_POSTAL,
+  COM_SOCIAL_POUNCE,
+  COM_SOCIAL_POUND,
+  COM_SOCIAL_POUT,
+  COM_SOCIAL_PRAY,
+  COM_SOCIAL_PRIDE,
+  COM_SOCIAL_PROPOSE,
+  COM_SOCIAL_PROZAC,
+  COM_SOCIAL_PUKE,
+  COM_SOCIAL_PULL,
+  COM_SOCIAL_PULSE,
+  COM_SOCIAL_PUPPYEYES,
+  COM_SOCIAL_PURR,
+  COM_SOCIAL_PUSHUP,
+  COM_SOCIAL_PUZZLE,
+  COM_SOCIAL_QUIVER,
+  COM_SOCIAL_RAINBOW,
+  COM_SOCIAL_RAISE,
+  COM_SOCIAL_RASPBERRY,
+  COM_SOCIAL_REBUKE,
+  COM_SOCIAL_RECONNECT,
+  COM_SOCIAL_RELAX,
+  COM_SOCIAL_RELIEF,
+  COM_SOCIAL_REN,
+  COM_SOCIAL_REVOLVE,
+  COM_SOCIAL_ROAR,
+  COM_SOCIAL_ROFL,
+  COM_SOCIAL_ROLL,
+  COM_SOCIAL_ROMP,
+  COM_SOCIAL_ROSE,
+  COM_SOCIAL_RUFFLE,
+  COM_SOCIAL_RUN,
+  COM_SOCIAL_SAD,
+  COM_SOCIAL_SAGE,
+  COM_SOCIAL_SALUTE,
+  COM_SOCIAL_SCAB,
+  COM_SOCIAL_SCOLD,
+  COM_SOCIAL_SCOUT,
+  COM_SOCIAL_SCRATCH,
+  COM_SOCIAL_SCREAM,
+  COM_SOCIAL_SCUFFLE,
+  COM_SOCIAL_SECRET,
+  COM_SOCIAL_SEDUCE,
+  COM_SOCIAL_SEX,
+  COM_SOCIAL_SHAKE,
+  COM_SOCIAL_SHAME,
+  COM_SOCIAL_SHEATHE,
+  COM_SOCIAL_SHH,
+  COM_SOCIAL_SHISKABOB,
+  COM_SOCIAL_SHIVERS,
+  COM_SOCIAL_SHOCK,
+  COM_SOCIAL_SHOOTOUT,
+  COM_SOCIAL_SHRUGS,
+  COM_SOCIAL_SHUDDER,
+  COM_SOCIAL_SHY,
+  COM_SOCIAL_SIDLE,
+  COM_SOCIAL_SIGH,
+  COM_SOCIAL_SING,
+  COM_SOCIAL_SKIP,
+  COM_SOCIAL_SLAP,
+  COM_SOCIAL_SLIPPERS,
+  COM_SOCIAL_SLOUCH,
+  COM_SOCIAL_SLUMP,
+  COM_SOCIAL_SMILE,
+  COM_SOCIAL_SMACK,
+  COM_SOCIAL_SMASH,
+  COM_SOCIAL_SMIRKS,
+  COM_SOCIAL_SMITE,
+  COM_SOCIAL_SMOKE,
+  COM_SOCIAL_SMOOCH,
+  COM_SOCIAL_SMUG,
+  COM_SOCIAL_SNAP,
+  COM_SOCIAL_SNARL,
+  COM_SOCIAL_SNEER,
+  COM_SOCIAL_SNEEZE,
+  COM_SOCIAL_SNICKER,
+  COM_SOCIAL_SNIFF,
+  COM_SOCIAL_SNIGGER,
+  COM_SOCIAL_SNOG,
+  COM_SOCIAL_SNOOPY,
+  COM_SOCIAL_SNORE,
+  COM_SOCIAL_SNORT,
+  COM_SOCIAL_SNOWBALL,
+  COM_SOCIAL_SNUGGLE,
+  COM_SOCIAL_SOB,
+  COM_SOCIAL_SORRY,
+  COM_SOCIAL_SPANK,
+  COM_SOCIAL_SPEW,
+  COM_SOCIAL_SPIN,
+  COM_SOCIAL_SPIT,
+  COM_SOCIAL_SPLASH,
+  COM_SOCIAL_SPONGEBATH,
+  COM_SOCIAL_SPORK,
+  COM_SOCIAL_SQUEAK,
+  COM_SOCIAL_SQUEAL,
+  COM_SOCIAL_SQUEEZE,
+  COM_SOCIAL_STARE,
+  COM_SOCIAL_STEAM,
+  COM_SOCIAL_STOMP,
+  COM_SOCIAL_STONE,
+  COM_SOCIAL_STRANGLE,
+  COM_SOCIAL_STRETCH,
+  COM_SOCIAL_STROKE,
+  COM_SOCIAL_STRUT,
+  COM_SOCIAL_SUCKIT_UP,
+  COM_SOCIAL_SUE,
+  COM_SOCIAL_SULK,
+  COM_SOCIAL_SUNDANCE,
+  COM_SOCIAL_SUNSET,
+  COM_SOCIAL_SUNSHADE,
+  COM_SOCIAL_SWAT,
+  COM_SOCIAL_SWAYS,
+  COM_SOCIAL_SWEAR,
+  COM_SOCIAL_SWEAT,
+  COM_SOCIAL_SWEETSMILE,
+  COM_SOCIAL_SWOON,
+  COM_SOCIAL_SWORD,
+  COM_SOCIAL_TACKLE,
+  COM_SOCIAL_TADA,
+  COM_SOCIAL_TAG,
+  COM_SOCIAL_TANGO,
+  COM_SOCIAL_TANTRUM,
+  COM_SOCIAL_TAP,
+  COM_SOCIAL_TAPDANCE,
+  COM_SOCIAL_TARGET,
+  COM_SOCIAL_TAUNT,
+  COM_SOCIAL_TEASE,
+  COM_SOCIAL_TESTSOCIAL,
+  COM_SOCIAL_THANKS,
+  COM_SOCIAL_THINK,
+  COM_SOCIAL_THREATEN,
+  COM_SOCIAL_THUMBSUP,
+  COM_SOCIAL_THWAP,
+  COM_SOCIAL_TICKLE,
+  COM_SOCIAL_TIE,
+  COM_SOCIAL_TIP,
+  COM_SOCIAL_TITTER,
+  COM_SOCIAL_TOAST,
+  COM_SOCIAL_TONGUE,
+  COM_SOCIAL_TOUCH,
+  COM_SOCIAL_TRANCE,
+  COM_SOCIAL_TSK,
+  COM_SOCIAL_TUCK,
+  COM_SOCIAL_TUG,
+  COM_SOCIAL_TUMMY,
+  COM_SOCIAL_TWEAK,
+  COM_SOCIAL_TWIDDLE,
+  COM_SOCIAL_TWITCH,
+  COM_SOCIAL_TYPE,
+  COM_SOCIAL_UNDERSTAND,
+  COM_SOCIAL_UNSHEATHE,
+  COM_SOCIAL_VAMPIRE,
+  COM_SOCIAL_VICE,
+  COM_SOCIAL_WAGGLE,
+  COM_SOCIAL_WAIT,
+  COM_SOCIAL_WAKKA,
+  COM_SOCIAL_WALTZ,
+  COM_SOCIAL_WARSCREAM,
+  COM_SOCIAL_WAVES,
+  COM_SOCIAL_WB,
+  COM_SOCIAL_WEDGIE,
+  COM_SOCIAL_WEEP,
+  COM_SOCIAL_WELCOME,
+  COM_SOCIAL_WHACK,
+  COM_SOCIAL_WHIMPER,
+  COM_SOCIAL_WHINE,
+  COM_SOCIAL_WHIP,
+  COM_SOCIAL_WHISTLE,
+  COM_SOCIAL_WHOO,
+  COM_SOCIAL_WIGGLE,
+  COM_SOCIAL_WINCE,
+  COM_SOCIAL_WINKS,
+  COM_SOCIAL_WIPE,
+  COM_SOCIAL_WOMEN,
+  COM_SOCIAL_WONDER,
+  COM_SOCIAL_WORRY,
+  COM_SOCIAL_WORSHIP,
+  COM_SOCIAL_WRONG,
+  COM_SOCIAL_YAWN,
+  COM_SOCIAL_YAYFOR,
+  COM_SOCIAL_YES,
+  COM_SOCIAL_YODEL,
+  COM_SOCIAL_ZAPS,
+  COM_SOCIAL_ZIP,
+
+  COM_MAX,
+} com_t;
+const auto COM_MAX_STANDARD = COM_LAST_STANDARD + 1;
+const auto NUM_SOCIALS = COM_MAX - COM_MAX_STANDARD;
+
+int handle_command(Object*, const std::u8string_view&, std::shared_ptr<Mind> mind = nullptr);
+com_t identify_command(const std::u8string_view line, bool corporeal);
+
+// Which commands a lookup can match: those usable without a body, with one, or in ninja mode.
+enum com_mode_t : uint8_t {
+  COM_MODE_ETHEREAL = 0,
+  COM_MODE_CORPOREAL,
+  COM_MODE_NINJA,
+  COM_MODE_MAX,
+};
+com_t identify_command(const std::u8string_view line, com_mode_t mode);
+
+// A command list entry, as command lookup sees it (so lookups can be checked against the list).
+struct com_entry {
+  std::u8string_view command;
+  com_t id;
+  bool ethereal;
+  bool corporeal;
+  bool ninja;
+};
+com_entry command_entry(int cnum);
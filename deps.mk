@@ -0,0 +1,112 @@
+command_ccreate.o: command_ccreate.cpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ dice.hpp properties.hpp utils.hpp
+command_other.o: command_other.cpp color.hpp commands.hpp mind.hpp \
+ player.hpp infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp \
+ outfile.hpp dice.hpp global.hpp log.hpp net.hpp properties.hpp utils.hpp \
+ version.hpp
+command_shops.o: command_shops.cpp color.hpp commands.hpp mind.hpp \
+ player.hpp infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp \
+ outfile.hpp properties.hpp utils.hpp tags.hpp
+command_social.o: command_social.cpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ utils.hpp
+command_wload.o: command_wload.cpp color.hpp commands.hpp mind.hpp \
+ player.hpp infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp \
+ outfile.hpp dice.hpp log.hpp properties.hpp utils.hpp tags.hpp
+commands.o: commands.cpp color.hpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ dice.hpp global.hpp log.hpp net.hpp properties.hpp utils.hpp version.hpp
+dice.o: dice.cpp dice.hpp
+global.o: global.cpp global.hpp
+infile.o: infile.cpp infile.hpp
+log.o: log.cpp log.hpp color.hpp
+main.o: main.cpp color.hpp global.hpp log.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ net.hpp
+mind.o: mind.cpp color.hpp commands.hpp mind.hpp player.hpp infile.hpp \
+ object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp dice.hpp \
+ global.hpp log.hpp net.hpp properties.hpp utils.hpp
+mind_craft.o: mind_craft.cpp color.hpp log.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ properties.hpp utils.hpp tags.hpp
+mind_tba.o: mind_tba.cpp color.hpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ dice.hpp log.hpp net.hpp properties.hpp utils.hpp
+net.o: net.cpp commands.hpp mind.hpp player.hpp infile.hpp object.hpp \
+ darr32.hpp darr64.hpp stats.hpp outfile.hpp log.hpp color.hpp net.hpp \
+ utils.hpp version.hpp
+npc.o: npc.cpp color.hpp commands.hpp mind.hpp player.hpp infile.hpp \
+ object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp dice.hpp log.hpp \
+ properties.hpp utils.hpp tags.hpp
+object.o: object.cpp color.hpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ dice.hpp global.hpp log.hpp net.hpp properties.hpp utils.hpp
+object_acid.o: object_acid.cpp color.hpp dice.hpp enum_utils.hpp \
+ infile.hpp log.hpp mind.hpp player.hpp object.hpp darr32.hpp darr64.hpp \
+ stats.hpp outfile.hpp properties.hpp utils.hpp version.hpp
+object_dynamic.o: object_dynamic.cpp color.hpp commands.hpp mind.hpp \
+ player.hpp infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp \
+ outfile.hpp dice.hpp log.hpp properties.hpp utils.hpp
+object_tba.o: object_tba.cpp color.hpp commands.hpp mind.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ dice.hpp log.hpp properties.hpp utils.hpp
+outfile.o: outfile.cpp outfile.hpp
+player.o: player.cpp color.hpp dice.hpp log.hpp net.hpp player.hpp \
+ infile.hpp object.hpp darr32.hpp darr64.hpp stats.hpp outfile.hpp \
+ utils.hpp version.hpp
+properties.o: properties.cpp color.hpp log.hpp outfile.hpp properties.hpp \
+ utils.hpp
+skills.o: skills.cpp properties.hpp utils.hpp
+stats.o: stats.cpp color.hpp dice.hpp log.hpp object.hpp darr32.hpp \
+ darr64.hpp stats.hpp outfile.hpp properties.hpp utils.hpp
+tags.o: tags.cpp tags.hpp object.hpp darr32.hpp darr64.hpp stats.hpp \
+ outfile.hpp dice.hpp log.hpp color.hpp properties.hpp utils.hpp
+utils.o: utils.cpp color.hpp utils.hpp
+version.o: version.cpp version.hpp
+tests/test_benchmarks.o: tests/test_benchmarks.cpp tests/test_main.hpp \
+ tests/../mind.hpp tests/../player.hpp tests/../infile.hpp \
+ tests/../object.hpp tests/../darr32.hpp tests/../darr64.hpp \
+ tests/../stats.hpp tests/../outfile.hpp tests/../object.hpp \
+ tests/../properties.hpp tests/../utils.hpp
+tests/test_combat.o: tests/test_combat.cpp tests/test_main.hpp \
+ tests/../commands.hpp tests/../mind.hpp tests/../player.hpp \
+ tests/../infile.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp \
+ tests/../dice.hpp tests/../global.hpp tests/../mind.hpp \
+ tests/../object.hpp tests/../properties.hpp tests/../utils.hpp
+tests/test_commands.o: tests/test_commands.cpp tests/test_main.hpp \
+ tests/../commands.hpp tests/../mind.hpp tests/../player.hpp \
+ tests/../infile.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp
+tests/test_darr.o: tests/test_darr.cpp tests/../darr32.hpp tests/../darr64.hpp \
+ tests/../darr64.hpp
+tests/test_dice.o: tests/test_dice.cpp tests/../dice.hpp
+tests/test_enums.o: tests/test_enums.cpp tests/test_main.hpp \
+ tests/../enum_utils.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp
+tests/test_main.o: tests/test_main.cpp tests/test_main.hpp
+tests/test_object.o: tests/test_object.cpp tests/test_main.hpp \
+ tests/../mind.hpp tests/../player.hpp tests/../infile.hpp \
+ tests/../object.hpp tests/../darr32.hpp tests/../darr64.hpp \
+ tests/../stats.hpp tests/../outfile.hpp tests/../object.hpp \
+ tests/../properties.hpp tests/../utils.hpp
+tests/test_shop_commands.o: tests/test_shop_commands.cpp tests/test_main.hpp \
+ tests/../commands.hpp tests/../mind.hpp tests/../player.hpp \
+ tests/../infile.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp \
+ tests/../mind.hpp tests/../object.hpp tests/../properties.hpp \
+ tests/../utils.hpp
+tests/test_socials.o: tests/test_socials.cpp tests/test_main.hpp \
+ tests/../commands.hpp tests/../mind.hpp tests/../player.hpp \
+ tests/../infile.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp \
+ tests/../mind.hpp tests/../object.hpp tests/../properties.hpp \
+ tests/../utils.hpp
+tests/test_utils.o: tests/test_utils.cpp tests/test_main.hpp tests/../utils.hpp
+tests/test_view_commands.o: tests/test_view_commands.cpp tests/test_main.hpp \
+ tests/../commands.hpp tests/../mind.hpp tests/../player.hpp \
+ tests/../infile.hpp tests/../object.hpp tests/../darr32.hpp \
+ tests/../darr64.hpp tests/../stats.hpp tests/../outfile.hpp \
+ tests/../mind.hpp tests/../object.hpp tests/../properties.hpp \
+ tests/../utils.hpp
@@ -40,6 +40,7 @@
 #include "color.hpp"
 #include "global.hpp"
 #include "log.hpp"
+#include "mind.hpp"
 #include "net.hpp"
 #include "object.hpp"
 #include "player.hpp"
@@ -122,6 +123,10 @@ int main(int argc, char** argv) {
 
     auto last_time = current_time;
     current_time = get_time();
+    if (last_time + TICK_USECS > current_time) {
+      Object::ReclaimTrash(); // Spend a bit of the idle time freeing old trash
+      current_time = get_time();
+    }
     if (last_time + TICK_USECS > current_time) {
       usleep(last_time + TICK_USECS - current_time);
       current_time = get_time();
@@ -144,6 +149,11 @@ int main(int argc, char** argv) {
           (current_time - before_save) / 1000000,
           ((current_time - before_save) / 1000) % 1000,
           (current_time - before_save) % 1000);
+      Object::ReportNounCache();
+      Object::ReportSightCache();
+      if (Mind::TBAProfiling()) {
+        Mind::DumpTBAProfile(u8"acid/tba_profile.txt");
+      }
       lastsave_time = current_time;
     }
   }
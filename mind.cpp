@@ -42,8 +42,6 @@
 static const std::u8string dirnames[6] =
     {u8"north", u8"south", u8"east", u8"west", u8"up", u8"down"};
 
-std::map<std::u8string, std::u8string> Mind::cvars;
-
 Mind::~Mind() {
   if (type == mind_t::REMOTE)
     close_socket(pers);
@@ -59,9 +57,6 @@ Mind::~Mind() {
     // Set it for u8"never", so it won't run, and will be purged
     itr->first = std::numeric_limits<int64_t>::max();
   }
-
-  svars = cvars; // Reset all variables
-  ovars.clear();
 }
 
 void Mind::SetRemote(int fd) {
@@ -136,7 +131,7 @@ bool Mind::Send(const std::u8string_view& mes) {
         Object* door = body->PickObject(dir, LOC_NEARBY);
 
         if (door && door->ActTarg(act_t::SPECIAL_LINKED)) {
-          svars[u8"path"] = dir.substr(0, 1);
+          SetSVar(u8"path", std::u8string(dir.substr(0, 1)));
         }
       } else if (!body->IsAct(act_t::FIGHT)) { // Guards help others in fights
         // FIXME: Ability to 'hear' directly who is fighting
@@ -162,7 +157,7 @@ bool Mind::Send(const std::u8string_view& mes) {
         Object* door = body->PickObject(dir, LOC_NEARBY);
 
         if (door && door->ActTarg(act_t::SPECIAL_LINKED)) {
-          svars[u8"path"] = dir.substr(0, 1);
+          SetSVar(u8"path", std::u8string(dir.substr(0, 1)));
         }
       } else if (!body->IsAct(act_t::FIGHT)) { // Soldiers help their own (and guards) in fights
         // FIXME: Ability to 'hear' directly who is fighting
@@ -258,7 +253,7 @@ void Mind::SetPPass(const std::u8string_view& ppass) {
   }
 
   SendOut(pers, u8"");
-  svars = player->Vars();
+  SetSVars(player->Vars());
   player->Room()->SendDesc(shared_from_this());
   player->Room()->SendContents(shared_from_this());
 }
@@ -267,7 +262,7 @@ void Mind::SetPlayer(const std::u8string_view& pn) {
   if (player_exists(pn)) {
     pname = pn;
     player = get_player(pname);
-    svars = player->Vars();
+    SetSVars(player->Vars());
   }
 }
 
@@ -319,33 +314,33 @@ bool Mind::Think(int istick) {
     }
 
     // Currently Travelling
-    if (svars.contains(u8"path")) {
-      if (svars[u8"path"].length() < 1) {
-        svars.erase(u8"path");
+    if (IsSVar(u8"path")) {
+      if (SVar(u8"path").length() < 1) {
+        ClearSVar(u8"path");
       } else if (body->Room() != body->Parent()) { // Get out of bed?
         handle_command(body, u8"leave");
       } else {
         auto old = body->Parent();
-        handle_command(body, fmt::format(u8"{}", svars[u8"path"][0]));
+        handle_command(body, fmt::format(u8"{}", SVar(u8"path")[0]));
         if (old != body->Parent()) { // Actually went somewhere
-          svars[u8"path"] = svars[u8"path"].substr(1);
+          SetSVar(u8"path", SVar(u8"path").substr(1));
         } else {
           // TODO: Open/Unlock Doors, Reroute, Etc.
           std::u8string_view dir = u8"north";
           std::u8string_view odir = u8"south";
-          if (svars[u8"path"][0] == 's') {
+          if (SVar(u8"path")[0] == 's') {
             dir = u8"south";
             odir = u8"north";
-          } else if (svars[u8"path"][0] == 'e') {
+          } else if (SVar(u8"path")[0] == 'e') {
             dir = u8"east";
             odir = u8"west";
-          } else if (svars[u8"path"][0] == 'w') {
+          } else if (SVar(u8"path")[0] == 'w') {
             dir = u8"west";
             odir = u8"east";
-          } else if (svars[u8"path"][0] == 'u') {
+          } else if (SVar(u8"path")[0] == 'u') {
             dir = u8"up";
             odir = u8"down";
-          } else if (svars[u8"path"][0] == 'd') {
+          } else if (SVar(u8"path")[0] == 'd') {
             dir = u8"down";
             odir = u8"up";
           }
@@ -353,12 +348,12 @@ bool Mind::Think(int istick) {
           handle_command(body, fmt::format(u8"open {0};{0}", dir));
           if (old != body->Parent()) { // Actually went somewhere
             handle_command(body, fmt::format(u8"close {0}", odir));
-            svars[u8"path"] = svars[u8"path"].substr(1);
+            SetSVar(u8"path", SVar(u8"path").substr(1));
           } else {
             handle_command(body, fmt::format(u8"unlock {0};open {0};{0}", dir));
             if (old != body->Parent()) { // Actually went somewhere
               handle_command(body, fmt::format(u8"close {0};lock {0}", odir));
-              svars[u8"path"] = svars[u8"path"].substr(1);
+              SetSVar(u8"path", SVar(u8"path").substr(1));
             } else {
               // Object* door = PickObject(dir, LOC_NEARBY);
               // if (door) {
@@ -399,10 +394,10 @@ bool Mind::Think(int istick) {
             return true;
           }
         } else if (body->Room() != body->ActTarg(act_t::SPECIAL_WORK)->Room()) {
-          if (!svars.contains(u8"path")) {
+          if (!IsSVar(u8"path")) {
             auto path =
                 body->Room()->DirectionsTo(body->ActTarg(act_t::SPECIAL_WORK)->Room(), body);
-            svars[u8"path"] = path;
+            SetSVar(u8"path", path);
           }
         } else if (!body->IsAct(act_t::WORK)) {
           body->AddAct(act_t::WORK);
@@ -412,10 +407,10 @@ bool Mind::Think(int istick) {
         // Night (10PM-4AM)
       } else if (time > 11 * day / 12 - early || time < day / 6 + late) {
         if (body->Room() != body->ActTarg(act_t::SPECIAL_HOME)->Room()) {
-          if (!svars.contains(u8"path")) {
+          if (!IsSVar(u8"path")) {
             auto path =
                 body->Room()->DirectionsTo(body->ActTarg(act_t::SPECIAL_HOME)->Room(), body);
-            svars[u8"path"] = path;
+            SetSVar(u8"path", path);
           }
         } else if (body->Position() != pos_t::LIE) {
           if (body->Room() != body->ActTarg(act_t::SPECIAL_HOME)) { // Need to get in bed?
@@ -463,8 +458,9 @@ bool Mind::Think(int istick) {
             area = body->ActTarg(act_t::SPECIAL_WORK)->Room()->ShortDesc();
           }
           if (area.length() > 0 && body->Room()->ShortDesc() != area) { // Out of position, go back.
-            svars[u8"path"] =
-                body->Room()->DirectionsTo(body->ActTarg(act_t::SPECIAL_WORK)->Room(), body);
+            SetSVar(
+                u8"path",
+                body->Room()->DirectionsTo(body->ActTarg(act_t::SPECIAL_WORK)->Room(), body));
           } else {
             for (int d = 0; d < 6; ++d) {
               if (conns[d] && (area.length() == 0 || conns[d]->ShortDesc() == area)) {
@@ -475,7 +471,7 @@ bool Mind::Think(int istick) {
               Dice::Shuffle(options);
             }
             if (options.size() > 0) {
-              svars[u8"path"] = options.front().substr(0, 1);
+              SetSVar(u8"path", std::u8string(options.front().substr(0, 1)));
             }
           }
         }
@@ -589,6 +585,9 @@ void Mind::Resume() {
   for (; itr != waiting.end() && itr->first != std::numeric_limits<int64_t>::max(); ++itr) {
   }
   if (itr != waiting.end()) {
+    for (auto done = itr; done != waiting.end(); ++done) {
+      recycle_mind(std::move(done->second));
+    }
     waiting.erase(itr, waiting.end());
   }
 
@@ -614,29 +613,41 @@ void Mind::ClearStatus() {
 
 static const std::u8string blank = u8"";
 void Mind::SetSVar(const std::u8string& var, const std::u8string& val) {
-  svars[var] = val;
+  if (!svars) {
+    svars = std::make_unique<std::map<std::u8string, std::u8string>>();
+  }
+  (*svars)[var] = val;
 }
 
 void Mind::ClearSVar(const std::u8string& var) {
-  svars.erase(var);
+  if (svars) {
+    svars->erase(var);
+  }
 }
 
 const std::u8string& Mind::SVar(const std::u8string& var) const {
-  if (svars.count(var) <= 0)
+  if (!svars || svars->count(var) <= 0)
     return blank;
-  return svars.at(var);
+  return svars->at(var);
 }
 
 int Mind::IsSVar(const std::u8string& var) const {
-  return (svars.count(var) > 0);
+  return (svars && svars->count(var) > 0);
 }
 
 const std::map<std::u8string, std::u8string> Mind::SVars() const {
-  return svars;
+  if (!svars) {
+    return {};
+  }
+  return *svars;
 }
 
 void Mind::SetSVars(const std::map<std::u8string, std::u8string>& sv) {
-  svars = sv;
+  if (sv.empty()) {
+    svars.reset();
+  } else {
+    svars = std::make_unique<std::map<std::u8string, std::u8string>>(sv);
+  }
 }
 
 static std::shared_ptr<Mind> mob_mind = std::make_shared<Mind>(mind_t::MOB);
@@ -21,6 +21,9 @@
 
 class Mind;
 class Object;
+struct tba_expr;
+struct tba_line;
+struct tba_program;
 
 #ifndef MIND_HPP
 #define MIND_HPP
@@ -33,6 +36,7 @@ class Object;
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 enum class mind_t : uint8_t {
@@ -82,6 +86,10 @@ class Mind : public std::enable_shared_from_this<Mind> {
   mind_t Type() const {
     return type;
   };
+  // MOB/TBAMOB minds are one shared brain each, driven by whatever body calls them.
+  bool Shared() const {
+    return type == mind_t::MOB || type == mind_t::TBAMOB;
+  };
   int LogFD() const {
     return log;
   };
@@ -102,6 +110,13 @@ class Mind : public std::enable_shared_from_this<Mind> {
   static void Resume();
   void Suspend(int msec);
 
+  // Per-script costs of TBA triggers, by TBAScript vnum (off by default, see "tprofile").
+  static void SetTBAProfiling(bool on);
+  static bool TBAProfiling();
+  static void ClearTBAProfile();
+  static std::u8string TBAProfileReport(const std::u8string_view& sort, size_t max = 20);
+  static bool DumpTBAProfile(const std::u8string_view& filename);
+
   void SetSpecialPrompt(const std::u8string& newp);
   std::u8string SpecialPrompt() const;
 
@@ -129,14 +144,26 @@ class Mind : public std::enable_shared_from_this<Mind> {
   bool TBAMOBSend(const std::u8string_view&); // Returns false when mind needs to be deleted
   bool TBAMOBThink(int istick); // Returns false when mind needs to be deleted
   bool TBATriggerThink(int istick); // Returns false when mind needs to be deleted
+  bool TBATriggerRun(); // Returns false when mind needs to be deleted
 
   int TBACanWanderTo(Object* dest) const;
 
-  std::u8string TBAComp(const std::u8string_view& expr) const;
-  int TBAEval(const std::u8string_view& expr) const;
-  bool TBAVarSub(std::u8string& line) const; // Returns false when mind needs to be deleted
+  // Returns false when mind needs to be deleted.  With the line of the script it came from, its
+  // variables are already looked up.
+  bool TBAVarSub(std::u8string& line, const tba_line* ln = nullptr) const;
+
+  // The value of the variable reference at cur in line, in slot vid, and where it ends.
+  bool TBAVarRef(
+      const std::u8string_view& line,
+      size_t cur,
+      uint32_t vid,
+      size_t& end,
+      std::u8string& val) const; // Returns false when mind needs to be deleted
 
-  int TBARunLine(std::u8string line);
+  // The values of a compiled expression's variable references, as they are now, into tba->refs.
+  bool TBAVarRefs(const tba_expr& ex, const std::u8string_view& line) const;
+
+  int TBARunLine(std::u8string_view line, const tba_line* ln = nullptr);
 
   std::u8string pname;
   std::u8string prompt;
@@ -144,17 +171,47 @@ class Mind : public std::enable_shared_from_this<Mind> {
   Object* body = nullptr;
   friend class Object;
 
-  static std::map<std::u8string, std::u8string> cvars;
-  std::map<std::u8string, std::u8string> svars;
-  std::map<std::u8string, Object*> ovars;
+  std::unique_ptr<std::map<std::u8string, std::u8string>> svars; // Only once any are set
+
+  // Running script state, only allocated for TBA trigger minds.  Variables are kept in slots,
+  // numbered by the script when it's compiled, each holding an object, some text, or both.
+  struct tba_state {
+    struct var {
+      bool set = false; // Set or unset by this run, which hides any built-in of the same name
+      bool has_obj = false;
+      bool has_str = false;
+      Object* obj = nullptr;
+      std::u8string str;
+    };
+    std::vector<var> vars; // By slot, then runtime-built names after the script's own
+    std::vector<std::u8string> names; // Runtime-built names, after the script's own slots
+    std::vector<std::u8string> refs; // Values of the running line's compiled %var%s
+    std::vector<size_t> spos_s;
+    std::shared_ptr<tba_program> prog;
+    int quota = 0; // Lines left to run this time
+
+    void Reset(std::shared_ptr<tba_program> p); // To run p, keeping all the storage
+
+    uint32_t VarId(const std::u8string_view& name); // Numbering it here, if no script names it
+    uint32_t KnownVarId(const std::u8string_view& name) const;
+    bool IsObj(uint32_t id) const;
+    Object* Obj(uint32_t id) const;
+    const std::u8string* Str(uint32_t id) const; // Including the built-ins, nullptr if unset
+    void SetObj(uint32_t id, Object* obj);
+    void SetStr(uint32_t id, const std::u8string_view& str);
+    void ClearObj(uint32_t id);
+    void ClearStr(uint32_t id);
+
+   private:
+    var& Slot(uint32_t id);
+  };
+  std::unique_ptr<tba_state> tba;
 
   mind_t type = mind_t::NONE;
   int status = 0; // AI Failures
   int pers = 0; // File Descriptor
   int log = -1; // File Descriptor
 
-  std::vector<size_t> spos_s;
-
   static std::vector<std::pair<int64_t, std::shared_ptr<Mind>>> waiting;
 };
 
@@ -168,6 +225,17 @@ std::shared_ptr<Mind> new_mind(
     Object* obj2 = nullptr,
     Object* obj3 = nullptr,
     const std::u8string_view& text = u8"");
+void recycle_mind(std::shared_ptr<Mind> m); // Keeps finished trigger minds for new_mind()
+void forget_tba_program(const Object* trigger); // Once its script is changed, or it's gone
+
+// TBA script expressions, compiled and run (with vals for each %var% in them, in order), and the
+// original evaluator they must match.
+std::u8string tba_comp(const std::u8string_view& expr);
+int tba_eval(const std::u8string_view& expr);
+std::u8string tba_comp(const std::u8string_view& expr, const std::vector<std::u8string>& vals);
+int tba_eval(const std::u8string_view& expr, const std::vector<std::u8string>& vals);
+std::u8string tba_comp_text(const std::u8string_view& expr);
+int tba_eval_text(const std::u8string_view& expr);
 int new_trigger(
     int msec,
     Object* obj,
@@ -25,6 +25,8 @@
 // I actually have no plans to maintain or improve this, though may fix bugs.
 
 #include <algorithm>
+#include <chrono>
+#include <unordered_map>
 
 #include "color.hpp"
 #include "commands.hpp"
@@ -33,6 +35,7 @@
 #include "mind.hpp"
 #include "net.hpp"
 #include "object.hpp"
+#include "outfile.hpp"
 #include "properties.hpp"
 #include "utils.hpp"
 
@@ -40,8 +43,8 @@
 #define QUOTAERROR2 body->Skill(prhash(u8"TBAScript"))
 #define PING_QUOTA()                  \
   {                                   \
-    --quota;                          \
-    if (quota < 1) {                  \
+    --tba->quota;                     \
+    if (tba->quota < 1) {             \
       loge(QUOTAERROR1, QUOTAERROR2); \
       return -1;                      \
     }                                 \
@@ -263,7 +266,10 @@ static std::u8string tba_spellconvert(const std::u8string_view& tba) {
   return acid;
 }
 
-std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
+// The original TBA expression evaluator, which works directly on the text: strictly left to right,
+// with each result written back into the text and the remainder parsed again.  Scripts no longer
+// use it, it's kept as the reference their compiled expressions are tested against.
+std::u8string tba_comp_text(const std::u8string_view& in_expr) {
   std::u8string expr(in_expr);
   size_t end = expr.find_first_of(u8"\n\r");
   if (end != std::u8string::npos)
@@ -278,8 +284,8 @@ std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
       opn = expr.find('(', opn + 1);
     }
     if (cls == std::u8string::npos)
-      return TBAComp(expr.substr(1));
-    expr = TBAComp(fmt::format(u8"{} {}", expr.substr(1, cls - 1), expr.substr(cls + 1)));
+      return tba_comp_text(expr.substr(1));
+    expr = tba_comp_text(fmt::format(u8"{} {}", expr.substr(1, cls - 1), expr.substr(cls + 1)));
     trim_string(expr);
   }
 
@@ -341,14 +347,14 @@ std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
     if (expr[0] == '(') {
       size_t cls = expr.find(u8")"); // FIXME: Nested
       if (cls == std::u8string::npos)
-        arg2 = TBAComp(expr.substr(1));
+        arg2 = tba_comp_text(expr.substr(1));
       else {
-        arg2 = TBAComp(expr.substr(1, cls - 1));
+        arg2 = tba_comp_text(expr.substr(1, cls - 1));
         expr.replace(0, cls + 1, arg2);
       }
     }
     if (weak) {
-      arg2 = TBAComp(expr);
+      arg2 = tba_comp_text(expr);
       expr = u8"";
     } else {
       arg2 = expr;
@@ -370,27 +376,27 @@ std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
       comp = u8"1";
     } else if (oper == 3 && (arg1 != arg2)) {
       comp = u8"1";
-    } else if (oper == 4 && (TBAEval(arg1) <= TBAEval(arg2))) {
+    } else if (oper == 4 && (tba_eval_text(arg1) <= tba_eval_text(arg2))) {
       comp = u8"1";
-    } else if (oper == 5 && (TBAEval(arg1) >= TBAEval(arg2))) {
+    } else if (oper == 5 && (tba_eval_text(arg1) >= tba_eval_text(arg2))) {
       comp = u8"1";
-    } else if (oper == -1 && (TBAEval(arg1) < TBAEval(arg2))) {
+    } else if (oper == -1 && (tba_eval_text(arg1) < tba_eval_text(arg2))) {
       comp = u8"1";
-    } else if (oper == -2 && (TBAEval(arg1) > TBAEval(arg2))) {
+    } else if (oper == -2 && (tba_eval_text(arg1) > tba_eval_text(arg2))) {
       comp = u8"1";
-    } else if (oper == 6 && (TBAEval(arg1) && TBAEval(arg2))) {
+    } else if (oper == 6 && (tba_eval_text(arg1) && tba_eval_text(arg2))) {
       comp = u8"1";
-    } else if (oper == 7 && (TBAEval(arg1) || TBAEval(arg2))) {
+    } else if (oper == 7 && (tba_eval_text(arg1) || tba_eval_text(arg2))) {
       comp = u8"1";
     } else if (oper == -3) {
-      res = TBAEval(arg1) + TBAEval(arg2);
+      res = tba_eval_text(arg1) + tba_eval_text(arg2);
     } else if (oper == -4) {
-      res = TBAEval(arg1) - TBAEval(arg2);
+      res = tba_eval_text(arg1) - tba_eval_text(arg2);
     } else if (oper == -5) {
-      res = TBAEval(arg1) * TBAEval(arg2);
+      res = tba_eval_text(arg1) * tba_eval_text(arg2);
     } else if (oper == -6) { // Protect from div by zero
-      int val2 = TBAEval(arg2);
-      res = TBAEval(arg1);
+      int val2 = tba_eval_text(arg2);
+      res = tba_eval_text(arg1);
       if (val2 != 0)
         res /= val2;
     }
@@ -402,7 +408,7 @@ std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
 
     if (expr != u8"") {
       expr = comp + u8" " + expr;
-      return TBAComp(expr);
+      return tba_comp_text(expr);
     }
     return comp;
   }
@@ -410,9 +416,8 @@ std::u8string Mind::TBAComp(const std::u8string_view& in_expr) const {
   return u8"0";
 }
 
-int Mind::TBAEval(const std::u8string_view& expr) const {
-  std::u8string basestr = TBAComp(expr);
-  std::u8string_view base(basestr);
+// The numeric value of a final TBA expression result.
+static int tba_value(std::u8string_view base) {
   trim_string(base);
 
   if (base.length() == 0) {
@@ -459,6 +464,389 @@ int Mind::TBAEval(const std::u8string_view& expr) const {
   return 1; // Non-Numeric, Non-nullptr, Non-Object
 }
 
+int tba_eval_text(const std::u8string_view& expr) {
+  return tba_value(tba_comp_text(expr));
+}
+
+// TBA expressions, compiled to a small tree of operations on integers, and on text where they
+// compare it.  The compiler follows tba_comp_text() step for step, so they always agree on text,
+// even where that parses oddly, and any part of it that only involves constants is done while
+// compiling.  Script lines compile their expressions once, with each %var% in them as a single
+// operand, filled in with its value when run.  So a value is never parsed as part of the
+// expression itself, as substituting it into the text would: operators or parentheses in it are
+// just text, it's not substituted again, and a parenthesized result is one value, even when it's
+// negative.  In the text being compiled, markers stand in for these operands (and for results
+// not known until run).  They are a byte never found in UTF-8, then the node's number, and are
+// neither operators, letters, nor spaces, so they never change how the text around them is split.
+
+// Where a %var% reference starting at cur ends, as TBAVarSub() reads it if the variable is set.
+static size_t tba_ref_end(const std::u8string_view& line, size_t cur) {
+  size_t end = line.find_first_of(u8"%. \t", cur + 1);
+  while (end < line.length() && line[end] == '.') {
+    end = line.find_first_of(u8"%. \t(", end + 1);
+    if (end != std::u8string::npos && line[end] == '(') {
+      int paren_depth = 0;
+      do {
+        if (line[end] == '(')
+          ++paren_depth;
+        else if (line[end] == ')')
+          --paren_depth;
+        if (paren_depth > 0)
+          end = line.find_first_of(u8"()", end + 1);
+      } while (end != std::u8string::npos && paren_depth > 0);
+      if (end != std::u8string::npos)
+        end = line.find_first_of(u8"%", end + 1);
+    }
+  }
+  if (end >= line.length())
+    return line.length();
+  return (line[end] == '%') ? end + 1 : end;
+}
+
+static constexpr char8_t TBA_MARK = 0xFE;
+static constexpr size_t TBA_MARK_LEN = 4;
+
+// The operations, as tba_comp_text() does them: on text for /=, == and !=, otherwise on numbers.
+static int tba_apply(int oper, const std::u8string_view& text1, const std::u8string_view& text2) {
+  if (oper == 1) {
+    return text2.contains(text1);
+  } else if (oper == 2) {
+    return text1 == text2;
+  }
+  return text1 != text2;
+}
+
+static int tba_apply(int oper, int num1, int num2) {
+  switch (oper) {
+    case (4):
+      return num1 <= num2;
+    case (5):
+      return num1 >= num2;
+    case (-1):
+      return num1 < num2;
+    case (-2):
+      return num1 > num2;
+    case (6):
+      return num1 && num2;
+    case (7):
+      return num1 || num2;
+    case (-3):
+      return num1 + num2;
+    case (-4):
+      return num1 - num2;
+    case (-5):
+      return num1 * num2;
+    case (-6): // Protect from div by zero
+      return (num2 != 0) ? num1 / num2 : num1;
+  }
+  return 0;
+}
+
+struct tba_ref {
+  uint32_t start; // Where its '%' is in the line
+  uint32_t end; // Just past its end, as read if it's set
+  uint32_t slot;
+};
+
+struct tba_expr {
+  enum kind_t : uint8_t { TEXT, REF, CONCAT, OPER };
+  struct node {
+    kind_t kind = TEXT;
+    int8_t oper = 0; // For OPER, as in tba_comp_text()
+    int num = 0; // For TEXT, its value as an operand (or as the final result, for the root)
+    uint32_t arg[2] = {0, 0}; // For OPER, its operands, for REF, which reference
+    std::u8string text; // For TEXT
+    std::vector<uint32_t> parts; // For CONCAT, what it's made of, in order
+  };
+  std::vector<node> nodes;
+  std::vector<tba_ref> refs; // Its %var% references, where they are in the line
+  uint32_t root = 0;
+
+  tba_expr() = default;
+  explicit tba_expr(const std::u8string_view& expr) { // Not part of any script's line
+    std::u8string marked;
+    Text(marked, expr);
+    Compile(marked);
+  }
+
+  // Adds literal text to the text to be compiled.
+  void Text(std::u8string& marked, const std::u8string_view& text) const {
+    for (auto ch : text) {
+      marked += (ch < TBA_MARK) ? ch : u8'?'; // Not UTF-8, and could be mistaken for a marker
+    }
+  }
+
+  // Adds a line, from 'from' on, to the text to be compiled, with each %var% in it a reference
+  // to the variable in slot(where its '%' is).
+  template <typename F>
+  void Mark(std::u8string& marked, const std::u8string_view& line, size_t from, F slot) {
+    for (size_t pos = from; pos < line.length();) {
+      size_t cur = std::min(line.find('%', pos), line.length());
+      Text(marked, line.substr(pos, cur - pos));
+      if (cur < line.length()) {
+        size_t end = tba_ref_end(line, cur);
+        refs.push_back({uint32_t(cur), uint32_t(end), slot(cur)});
+        node ref{REF};
+        ref.arg[0] = refs.size() - 1;
+        marked += Marker(Add(std::move(ref)));
+        cur = end;
+      }
+      pos = cur;
+    }
+  }
+
+  void Compile(const std::u8string_view& marked) {
+    std::u8string res;
+    Compile(marked, res);
+    if (res.contains(TBA_MARK)) {
+      root = Operand(res);
+    } else {
+      root = Add({TEXT, 0, tba_value(res), {0, 0}, res});
+    }
+  }
+
+ private:
+  static std::u8string Marker(uint32_t id) {
+    return std::u8string{
+        TBA_MARK,
+        char8_t(0x80 | (id >> 14)),
+        char8_t(0x80 | ((id >> 7) & 0x7F)),
+        char8_t(0x80 | (id & 0x7F))};
+  }
+  static uint32_t Marked(const std::u8string_view& text, size_t pos) {
+    return ((text[pos + 1] & 0x7F) << 14) | ((text[pos + 2] & 0x7F) << 7) | (text[pos + 3] & 0x7F);
+  }
+
+  uint32_t Add(node&& n) {
+    nodes.emplace_back(std::move(n));
+    return nodes.size() - 1;
+  }
+
+  // The value of some constant text, as an operand.
+  int Fold(const std::u8string_view& text) {
+    std::u8string res;
+    Compile(text, res);
+    return tba_value(res);
+  }
+
+  uint32_t Operand(const std::u8string_view& text) {
+    if (!text.contains(TBA_MARK)) {
+      return Add({TEXT, 0, Fold(text), {0, 0}, std::u8string(text)});
+    } else if (text.length() == TBA_MARK_LEN && text.front() == TBA_MARK) {
+      return Marked(text, 0);
+    }
+    node cat{CONCAT};
+    for (size_t pos = 0; pos < text.length();) {
+      if (text[pos] == TBA_MARK) {
+        cat.parts.push_back(Marked(text, pos));
+        pos += TBA_MARK_LEN;
+      } else {
+        size_t end = std::min(text.find(TBA_MARK, pos), text.length());
+        cat.parts.push_back(Add({TEXT, 0, 0, {0, 0}, std::u8string(text.substr(pos, end - pos))}));
+        pos = end;
+      }
+    }
+    return Add(std::move(cat));
+  }
+
+  // Mirrors tba_comp_text(), but adds the operations to the tree instead of doing them (unless
+  // they only involve constants), and puts their markers into the text in place of their results.
+  void Compile(const std::u8string_view& in_expr, std::u8string& out) {
+    std::u8string expr(in_expr);
+    size_t end = expr.find_first_of(u8"\n\r");
+    if (end != std::u8string::npos)
+      expr = expr.substr(0, end);
+    trim_string(expr);
+
+    if (expr[0] == '(') {
+      size_t cls = expr.find(')');
+      size_t opn = expr.find('(', 1);
+      while (cls != std::u8string::npos && opn != std::u8string::npos && opn < cls) {
+        cls = expr.find(')', cls + 1);
+        opn = expr.find('(', opn + 1);
+      }
+      if (cls == std::u8string::npos) {
+        Compile(expr.substr(1), out);
+        return;
+      }
+      Compile(fmt::format(u8"{} {}", expr.substr(1, cls - 1), expr.substr(cls + 1)), expr);
+      trim_string(expr);
+    }
+
+    size_t skip = 0;
+    if (expr[0] == '-' || expr[0] == '!')
+      skip = 1;
+    size_t op = expr.find_first_of(u8"|&=!<>/-+*", skip);
+    while (op != std::u8string::npos && expr[op] == '-' && ascii_isalpha(expr[op - 1]) &&
+           ascii_isalpha(expr[op + 1])) {
+      op = expr.find_first_of(u8"|&=!<>/-+*", op + 1); // Skip Hyphens
+    }
+    if (op == std::u8string::npos) {
+      out = expr; // No ops, just val
+      return;
+    }
+
+    static const std::vector<std::pair<std::u8string_view, int>> opers = {
+        {u8"/=", 1},
+        {u8"==", 2},
+        {u8"!=", 3},
+        {u8"<=", 4},
+        {u8">=", 5},
+        {u8"&&", 6},
+        {u8"||", 7},
+        {u8"<", -1},
+        {u8">", -2},
+        {u8"+", -3},
+        {u8"-", -4},
+        {u8"*", -5},
+        {u8"/", -6},
+    };
+    int oper = 0;
+    for (const auto& o : opers) {
+      if (expr.substr(op).starts_with(o.first)) {
+        oper = o.second;
+        break;
+      }
+    }
+    if (oper == 0) {
+      out = u8"0";
+      return;
+    }
+
+    std::u8string arg1 = expr.substr(0, op);
+    trim_string(arg1);
+    expr = expr.substr(op + ((oper > 0) ? 2 : 1));
+    trim_string(expr);
+    if (expr[0] == '(') {
+      size_t cls = expr.find(u8")"); // FIXME: Nested
+      if (cls != std::u8string::npos) {
+        std::u8string inner;
+        Compile(expr.substr(1, cls - 1), inner);
+        expr.replace(0, cls + 1, inner);
+      }
+    }
+    std::u8string arg2;
+    if (oper == 6 || oper == 7) { // Reverse-Precedence!
+      Compile(expr, arg2);
+      expr = u8"";
+    } else {
+      arg2 = expr;
+      op = expr.find_first_of(u8"|&=!<>/-+*)\n\r");
+      if (op != std::u8string::npos) {
+        arg2 = expr.substr(0, op);
+        expr = expr.substr(op);
+      } else {
+        expr = u8"";
+      }
+    }
+    trim_string(arg2);
+
+    std::u8string comp;
+    if (arg1.contains(TBA_MARK) || arg2.contains(TBA_MARK)) {
+      node n{OPER, int8_t(oper)};
+      n.arg[0] = Operand(arg1);
+      n.arg[1] = Operand(arg2);
+      comp = Marker(Add(std::move(n)));
+    } else if (oper >= 1 && oper <= 3) { // Constant: do it now
+      comp = itos(tba_apply(oper, arg1, arg2));
+    } else {
+      comp = itos(tba_apply(oper, Fold(arg1), Fold(arg2)));
+    }
+
+    if (expr != u8"") {
+      Compile(comp + u8" " + expr, out);
+      return;
+    }
+    out = comp;
+  }
+};
+
+static int tba_num(const tba_expr& ex, uint32_t n, const std::vector<std::u8string>& refs);
+
+static std::u8string_view tba_text(
+    const tba_expr& ex,
+    uint32_t n,
+    const std::vector<std::u8string>& refs,
+    std::u8string& buf) {
+  const auto& node = ex.nodes[n];
+  if (node.kind == tba_expr::TEXT) {
+    return node.text;
+  } else if (node.kind == tba_expr::REF) {
+    std::u8string_view val = refs[node.arg[0]];
+    trim_string(val); // As it would be, alone, after substitution
+    return val;
+  } else if (node.kind == tba_expr::OPER) {
+    buf = itos(tba_num(ex, n, refs));
+    return buf;
+  }
+  buf.clear();
+  for (auto part : node.parts) {
+    if (ex.nodes[part].kind == tba_expr::REF) {
+      buf += refs[ex.nodes[part].arg[0]];
+    } else {
+      std::u8string pbuf;
+      buf += tba_text(ex, part, refs, pbuf);
+    }
+  }
+  return buf;
+}
+
+static int tba_num(const tba_expr& ex, uint32_t n, const std::vector<std::u8string>& refs) {
+  const auto& node = ex.nodes[n];
+  if (node.kind == tba_expr::TEXT) {
+    return node.num;
+  } else if (node.kind == tba_expr::REF) {
+    return tba_value(refs[node.arg[0]]);
+  } else if (node.kind == tba_expr::CONCAT) {
+    std::u8string buf;
+    return tba_value(tba_text(ex, n, refs, buf));
+  } else if (node.oper >= 1 && node.oper <= 3) {
+    std::u8string buf1, buf2;
+    return tba_apply(
+        node.oper, tba_text(ex, node.arg[0], refs, buf1), tba_text(ex, node.arg[1], refs, buf2));
+  }
+  return tba_apply(node.oper, tba_num(ex, node.arg[0], refs), tba_num(ex, node.arg[1], refs));
+}
+
+// Runs a compiled expression, with the values of its %var% references.
+static std::u8string tba_comp(const tba_expr& ex, const std::vector<std::u8string>& refs) {
+  std::u8string buf;
+  return std::u8string(tba_text(ex, ex.root, refs, buf));
+}
+
+static int tba_eval(const tba_expr& ex, const std::vector<std::u8string>& refs) {
+  const auto& root = ex.nodes[ex.root];
+  if (root.kind == tba_expr::TEXT || root.kind == tba_expr::OPER) {
+    return tba_num(ex, ex.root, refs);
+  }
+  std::u8string buf;
+  return tba_value(tba_text(ex, ex.root, refs, buf));
+}
+
+std::u8string tba_comp(const std::u8string_view& expr) {
+  return tba_comp(tba_expr(expr), {});
+}
+
+int tba_eval(const std::u8string_view& expr) {
+  return tba_eval(tba_expr(expr), {});
+}
+
+static tba_expr tba_expr_refs(const std::u8string_view& expr) {
+  tba_expr ex;
+  std::u8string marked;
+  ex.Mark(marked, expr, 0, [](size_t) { return 0U; });
+  ex.Compile(marked);
+  return ex;
+}
+
+std::u8string tba_comp(const std::u8string_view& expr, const std::vector<std::u8string>& vals) {
+  return tba_comp(tba_expr_refs(expr), vals);
+}
+
+int tba_eval(const std::u8string_view& expr, const std::vector<std::u8string>& vals) {
+  return tba_eval(tba_expr_refs(expr), vals);
+}
+
 std::u8string Mind::TBAMOBTactics(int phase) const {
   if (type == mind_t::TBAMOB) {
     // NON-HELPER and NON-AGGRESSIVE TBA Mobs (Innocent MOBs)
@@ -471,6 +859,471 @@ std::u8string Mind::TBAMOBTactics(int phase) const {
   return u8"attack";
 }
 
+// Every variable name a script names literally gets a slot when the script is compiled, and
+// every '%' in each of its lines notes which slot the name after it has, so a running trigger
+// keeps its variables in a flat list, and finds them without building or hashing any strings.
+// Names only built at runtime (like "seen_%actor.id%") each running trigger numbers for itself,
+// after the script's own (see tba_state::VarId()).
+enum tba_var_t : uint32_t {
+  TBA_SELF = 0,
+  TBA_CONTEXT,
+  TBA_ACTOR,
+  TBA_OBJECT,
+  TBA_SPEECH,
+  TBA_DIRECTION,
+  TBA_CMD,
+  TBA_ARG,
+  TBA_FIXED_VARS, // Every script has these slots, set before it runs
+  TBA_NO_VAR = ~0U
+};
+static const std::u8string_view tba_fixed_vars[TBA_FIXED_VARS] = {
+    u8"self",
+    u8"context",
+    u8"actor",
+    u8"object",
+    u8"speech",
+    u8"direction",
+    u8"cmd",
+    u8"arg",
+};
+struct tba_name_hash {
+  using is_transparent = void;
+  size_t operator()(const std::u8string_view& name) const {
+    return std::hash<std::u8string_view>{}(name);
+  }
+};
+using tba_names = std::unordered_map<std::u8string, uint32_t, tba_name_hash, std::equal_to<>>;
+
+// The built-in variables, what they hold until a script sets them itself.
+static const std::unordered_map<std::u8string, std::u8string, tba_name_hash, std::equal_to<>>
+    tba_builtins = {
+        {u8"damage", u8"wdamage"},
+        {u8"echo", u8"mecho"},
+        {u8"send", u8"send"},
+        {u8"force", u8"force"},
+        {u8"echoaround", u8"echoaround"},
+        {u8"teleport", u8"transport"},
+        {u8"zoneecho", u8"zoneecho"},
+        {u8"asound", u8"asound"},
+        {u8"door", u8"door"},
+        {u8"load", u8"load"},
+        {u8"purge", u8"purge"},
+        {u8"at", u8"at"},
+        {u8"", u8"%"},
+};
+
+struct tba_case {
+  size_t pos; // Where its value starts (npos for "default")
+  size_t start; // Where it starts running
+  std::unique_ptr<tba_expr> expr; // Whether it's the one, compiled, if its "switch" is
+};
+
+// One line of a trigger script, as compiled.
+struct tba_line {
+  static constexpr size_t UNSCANNED = std::u8string::npos - 1;
+  enum scan_t : uint8_t { SKIP_IF = 0, SKIP_ELSE, SKIP_LOOP, TO_DONE, SCAN_MAX };
+
+  size_t start; // Where it starts in the text
+  size_t end; // Where it ends (the next newline)
+  size_t next; // Where the next line starts, as skip_line() finds it
+  int com; // Its command, or -1 if that's only known after variable substitution
+  uint32_t target = TBA_NO_VAR; // The variable it sets, unsets, or globalizes, if named literally
+  std::vector<std::pair<uint32_t, uint32_t>> vars; // Each '%' in it, and the slot named after it
+  std::unique_ptr<tba_expr> expr; // Its if/while/switch condition, or eval value, compiled
+  size_t jump[SCAN_MAX] = {UNSCANNED, UNSCANNED, UNSCANNED, UNSCANNED};
+  bool cased = false;
+  std::vector<tba_case> cases; // Its "case"s and "default"s, if it's a "switch"
+};
+
+// A trigger script, split into its lines once, each with its command pre-identified (if it has
+// no variables to substitute first), its variables looked up, and with the jumps its control
+// flow takes from each line worked out the first time they are needed.  Running scripts still
+// keep their place as offsets into the text, so this is shared by every copy of its trigger.
+struct tba_program {
+  using line = tba_line;
+  using scan_t = tba_line::scan_t;
+  using enum tba_line::scan_t;
+  static constexpr size_t UNSCANNED = tba_line::UNSCANNED;
+
+  tba_program(int num, const std::u8string_view& src)
+      : vnum(num), text(fmt::format(u8"{}\n", src)) {
+    for (const auto& name : tba_fixed_vars) {
+      Intern(name);
+    }
+    std::u8string_view script = text;
+    for (size_t pos = 0; pos < script.length() && pos != std::u8string::npos;
+         pos = skip_line(script, pos)) {
+      AddLine(pos);
+      if (script.substr(pos).starts_with(u8"elseif ")) {
+        AddLine(pos + 4); // Where a false "if" jumps to, to run it as an "if"
+      }
+    }
+  }
+
+  bool Runs(const std::u8string_view& src) const {
+    return text.length() == src.length() + 1 && text.starts_with(src);
+  }
+
+  uint32_t Slots() const {
+    return builtins.size();
+  }
+  uint32_t Slot(const std::u8string_view& name) const {
+    auto slot = slots.find(name);
+    return (slot == slots.end()) ? TBA_NO_VAR : slot->second;
+  }
+  const std::u8string* Builtin(uint32_t slot) const {
+    return (slot < builtins.size()) ? builtins[slot] : nullptr;
+  }
+
+  line* At(size_t pos) {
+    auto ln = std::lower_bound(
+        lines.begin(), lines.end(), pos, [](const line& l, size_t p) { return l.start < p; });
+    return (ln == lines.end() || ln->start != pos) ? nullptr : &(*ln);
+  }
+
+  // Where a false "if" goes: past its "else", or its "end", or to its next "elseif".
+  size_t SkipIf(size_t spos) {
+    return Scan(SKIP_IF, spos, [this](size_t pos) {
+      std::u8string_view script = text;
+      int depth = 0;
+      while (pos != std::u8string::npos) { // Skip to end/elseif
+        if ((!depth) && (script.substr(pos).starts_with(u8"elseif "))) {
+          pos += 4; // Make it into an u8"if" and go
+          break;
+        } else if (script.substr(pos).starts_with(u8"else")) {
+          if (!depth) { // Only right if all the way back
+            pos = skip_line(script, pos);
+            break;
+          }
+        } else if (script.substr(pos).starts_with(u8"end")) {
+          if (!depth) { // Only done if all the way back
+            pos = skip_line(script, pos);
+            break;
+          }
+          --depth; // Otherwise am just 1 nesting level less deep
+        } else if (script.substr(pos).starts_with(u8"if ")) {
+          ++depth; // Am now 1 nesting level deeper!
+        }
+        pos = skip_line(script, pos);
+      }
+      return pos;
+    });
+  }
+
+  // Where an "else" goes: past its "end".
+  size_t SkipElse(size_t spos) {
+    return Scan(SKIP_ELSE, spos, [this](size_t pos) {
+      std::u8string_view script = text;
+      int depth = 0;
+      while (pos != std::u8string::npos) { // Skip to end (considering nesting)
+        if (script.substr(pos).starts_with(u8"end")) {
+          if (depth == 0) { // Only done if all the way back
+            pos = skip_line(script, pos);
+            break;
+          }
+          --depth; // Otherwise am just 1 nesting level less deep
+        } else if (script.substr(pos).starts_with(u8"if ")) {
+          ++depth; // Am now 1 nesting level deeper!
+        }
+        pos = skip_line(script, pos);
+      }
+      return pos;
+    });
+  }
+
+  // Where a finished "while" or "switch" goes: past its "done".
+  size_t SkipLoop(size_t spos) {
+    return Scan(SKIP_LOOP, spos, [this](size_t pos) { return FindDone(pos, true); });
+  }
+
+  // Where a "break" goes: to its "done".
+  size_t ToDone(size_t spos) {
+    return Scan(TO_DONE, spos, [this](size_t pos) { return FindDone(pos, false); });
+  }
+
+  // The "case"s and "default"s of a "switch" (sw, if compiled), in order, with where each would
+  // start running.
+  const std::vector<tba_case>& Cases(size_t spos, const line* sw) {
+    static const std::vector<tba_case> none;
+    line* ln = At(spos);
+    if (!ln) {
+      return none;
+    } else if (!ln->cased) {
+      std::u8string_view script = text;
+      int depth = 0;
+      size_t pos = spos;
+      while (pos != std::u8string::npos) { // Skip to end (considering nesting)
+        if (script.substr(pos).starts_with(u8"done")) {
+          if (depth == 0) { // Only done if all the way back
+            break;
+          }
+          --depth; // Otherwise am just 1 nesting level less deep
+        } else if (script.substr(pos).starts_with(u8"switch ")) {
+          ++depth; // Am now 1 nesting level deeper!
+        } else if (script.substr(pos).starts_with(u8"while ")) {
+          ++depth; // Am now 1 nesting level deeper!
+        } else if (depth == 0 && (script.substr(pos).starts_with(u8"case "))) {
+          ln->cases.push_back({pos + 5, skip_line(script, pos), Case(sw, pos + 5)});
+        } else if (depth == 0 && (script.substr(pos).starts_with(u8"default"))) {
+          ln->cases.push_back({std::u8string::npos, skip_line(script, pos)});
+        }
+        pos = skip_line(script, pos);
+      }
+      ln->cased = true;
+    }
+    return ln->cases;
+  }
+
+  const int vnum; // Of the trigger it was compiled for
+  const std::u8string text;
+  std::vector<line> lines; // In order, by where they start
+
+ private:
+  tba_names slots; // Every variable the script names literally, and its slot
+  std::vector<const std::u8string*> builtins; // By slot, the built-in value, if it has one
+
+  uint32_t Intern(const std::u8string_view& name) {
+    auto slot = slots.find(name);
+    if (slot == slots.end()) {
+      auto builtin = tba_builtins.find(name);
+      builtins.push_back((builtin == tba_builtins.end()) ? nullptr : &builtin->second);
+      slot = slots.emplace(name, builtins.size() - 1).first;
+    }
+    return slot->second;
+  }
+
+  void AddLine(size_t pos) {
+    std::u8string_view script = text;
+    size_t end = script.find_first_of(u8"\n\r", pos);
+    if (end == std::u8string::npos) {
+      end = script.length();
+    }
+    const auto ltext = script.substr(pos, end - pos);
+    int com = -1;
+    if (!ltext.contains('%')) {
+      com = COM_NONE;
+      auto c1 = ltext.find_first_not_of(u8" \t\n\r;");
+      if (c1 != std::u8string::npos) {
+        auto c2 = ltext.find_first_of(u8" \t\n\r;", c1 + 1);
+        com = identify_command(
+            (c2 == std::u8string::npos) ? ltext.substr(c1) : ltext.substr(c1, c2 - c1), true);
+      }
+    }
+    lines.push_back({pos, end, skip_line(script, pos), com});
+
+    // Look up every variable named after a '%', as TBAVarSub() would find it.
+    for (size_t cur = ltext.find('%'); cur != std::u8string::npos; cur = ltext.find('%', cur + 1)) {
+      auto name = ltext.substr(cur + 1);
+      name = name.substr(0, name.find_first_of(u8"%. \t"));
+      lines.back().vars.emplace_back(cur, Intern(name));
+    }
+
+    // Note the variable this line sets (or globalizes), if it's literally there.
+    auto words = ltext.substr(std::min(ltext.length(), ltext.find_first_not_of(u8" \t")));
+    for (std::u8string_view assign :
+         {u8"set ", u8"eval ", u8"unset ", u8"extract ", u8"global ", u8"remote "}) {
+      if (words.starts_with(assign)) {
+        auto name = words.substr(assign.length());
+        name = name.substr(std::min(name.length(), name.find_first_not_of(u8" \t")));
+        name = name.substr(0, name.find_first_of(u8" \t"));
+        if (!name.empty() && !name.contains('%')) {
+          lines.back().target = Intern(name);
+        }
+        break;
+      }
+    }
+
+    // Compile the condition of an "if", "while", or "switch", or the value of an "eval".
+    size_t expr = std::u8string::npos;
+    if (ltext.starts_with(u8"if ")) {
+      expr = 3;
+    } else if (ltext.starts_with(u8"while ")) {
+      expr = 6;
+    } else if (ltext.starts_with(u8"switch ")) {
+      expr = 7;
+    } else if (ltext.starts_with(u8"eval ") && lines.back().target != TBA_NO_VAR) {
+      size_t gap = ltext.find_first_of(u8" \t", ltext.find_first_not_of(u8" \t", 4));
+      if (gap != std::u8string::npos) {
+        expr = ltext.find_first_not_of(u8" \t", gap + 1);
+      }
+    }
+    if (expr != std::u8string::npos) {
+      auto ex = std::make_unique<tba_expr>();
+      std::u8string marked;
+      Mark(*ex, lines.back(), expr, marked);
+      ex->Compile(marked);
+      lines.back().expr = std::move(ex);
+    }
+  }
+
+  // Adds the rest of a line, from 'from' on, to an expression's text, with its %var%s as such.
+  void Mark(tba_expr& ex, const line& ln, size_t from, std::u8string& marked) const {
+    size_t var = 0;
+    auto ltext = std::u8string_view(text).substr(ln.start, ln.end - ln.start);
+    ex.Mark(marked, ltext, from, [&ln, &var](size_t cur) {
+      while (ln.vars[var].first < cur) {
+        ++var;
+      }
+      return ln.vars[var].second;
+    });
+  }
+
+  // Compiles a "case" of a compiled "switch": whether the switch's value == what follows it.
+  std::unique_ptr<tba_expr> Case(const line* sw, size_t cpos) const {
+    if (!sw || !sw->expr) {
+      return nullptr;
+    }
+    auto ex = std::make_unique<tba_expr>();
+    std::u8string marked;
+    Mark(*ex, *sw, 7, marked);
+    trim_string(marked);
+    marked += u8" == ";
+    auto value = std::u8string_view(text).substr(cpos);
+    ex->Text(marked, value.substr(0, value.find_first_of(u8"\n\r")));
+    ex->Compile(marked);
+    return ex;
+  }
+
+  size_t FindDone(size_t pos, bool past) const {
+    std::u8string_view script = text;
+    int depth = 0;
+    while (pos != std::u8string::npos) { // Skip to end (considering nesting)
+      if (script.substr(pos).starts_with(u8"done")) {
+        if (depth == 0) { // Only done if all the way back
+          if (past) {
+            pos = skip_line(script, pos);
+          }
+          break;
+        }
+        --depth; // Otherwise am just 1 nesting level less deep
+      } else if (script.substr(pos).starts_with(u8"switch ")) {
+        ++depth; // Am now 1 nesting level deeper!
+      } else if (script.substr(pos).starts_with(u8"while ")) {
+        ++depth; // Am now 1 nesting level deeper!
+      }
+      pos = skip_line(script, pos);
+    }
+    return pos;
+  }
+
+  template <typename F>
+  size_t Scan(scan_t type, size_t spos, F scan) {
+    if (spos == std::u8string::npos) {
+      return spos;
+    }
+    line* ln = At(spos);
+    if (!ln) {
+      return scan(spos);
+    } else if (ln->jump[type] == UNSCANNED) {
+      ln->jump[type] = scan(spos);
+    }
+    return ln->jump[type];
+  }
+};
+
+// Compiled scripts, for each trigger that has run one.  Copies of a trigger share one, as long as
+// their scripts still match, which is freed once no trigger (or running mind) still uses it.
+static std::unordered_map<const Object*, std::shared_ptr<tba_program>> trigger_programs;
+static std::unordered_map<int, std::weak_ptr<tba_program>> tba_programs; // By TBAScript vnum
+
+void forget_tba_program(const Object* trigger) {
+  if (trigger_programs.empty()) {
+    return;
+  }
+  auto prog = trigger_programs.find(trigger);
+  if (prog != trigger_programs.end()) {
+    auto shared = tba_programs.find(prog->second->vnum);
+    trigger_programs.erase(prog);
+    if (shared != tba_programs.end() && shared->second.expired()) {
+      tba_programs.erase(shared);
+    }
+  }
+}
+
+uint32_t Mind::tba_state::VarId(const std::u8string_view& name) {
+  uint32_t id = KnownVarId(name);
+  if (id == TBA_NO_VAR) {
+    id = prog->Slots() + names.size();
+    names.emplace_back(name);
+  }
+  return id;
+}
+
+uint32_t Mind::tba_state::KnownVarId(const std::u8string_view& name) const {
+  uint32_t id = prog->Slot(name);
+  if (id == TBA_NO_VAR) {
+    auto local = std::find(names.begin(), names.end(), name);
+    if (local != names.end()) {
+      id = prog->Slots() + (local - names.begin());
+    }
+  }
+  return id;
+}
+
+Mind::tba_state::var& Mind::tba_state::Slot(uint32_t id) {
+  if (id >= vars.size()) {
+    vars.resize(id + 1);
+  }
+  vars[id].set = true;
+  return vars[id];
+}
+
+// Forget every variable and the place in the script, but keep all their storage.
+void Mind::tba_state::Reset(std::shared_ptr<tba_program> p) {
+  for (auto& v : vars) {
+    v.set = false;
+    v.has_obj = false;
+    v.has_str = false;
+    v.obj = nullptr;
+    v.str.clear();
+  }
+  prog = std::move(p);
+  if (vars.size() < prog->Slots()) {
+    vars.resize(prog->Slots());
+  }
+  names.clear();
+  spos_s.clear();
+}
+
+bool Mind::tba_state::IsObj(uint32_t id) const {
+  return id < vars.size() && vars[id].has_obj;
+}
+
+Object* Mind::tba_state::Obj(uint32_t id) const {
+  return (id < vars.size() && vars[id].has_obj) ? vars[id].obj : nullptr;
+}
+
+const std::u8string* Mind::tba_state::Str(uint32_t id) const {
+  if (id < vars.size() && vars[id].set) { // Once set or cleared, built-ins no longer show.
+    return vars[id].has_str ? &vars[id].str : nullptr;
+  }
+  return prog->Builtin(id);
+}
+
+void Mind::tba_state::SetObj(uint32_t id, Object* obj) {
+  auto& v = Slot(id);
+  v.has_obj = true;
+  v.obj = obj;
+}
+
+void Mind::tba_state::SetStr(uint32_t id, const std::u8string_view& str) {
+  auto& v = Slot(id);
+  v.has_str = true;
+  v.str = str;
+}
+
+void Mind::tba_state::ClearObj(uint32_t id) {
+  if (IsObj(id)) {
+    Slot(id).has_obj = false;
+  }
+}
+
+void Mind::tba_state::ClearStr(uint32_t id) {
+  auto& v = Slot(id); // Kept, to hide any built-in of the same name.
+  v.has_str = false;
+  v.str.clear();
+}
+
 bool Mind::TBAMOBSend(const std::u8string_view& mes) {
   // HELPER TBA Mobs
   if (body && body->Parent() && (body->Skill(prhash(u8"TBAAction")) & 4096) // Helpers
@@ -680,53 +1533,171 @@ bool Mind::TBAMOBThink(int istick) {
   return true;
 }
 
+static constexpr int SCRIPT_QUOTA = 1024; // Lines a trigger may run before it has to stop
+
+// What each TBA trigger script has cost, since profiling was last turned on or cleared.
+struct tba_profile {
+  uint64_t fires = 0; // Times triggered
+  uint64_t runs = 0; // Times run, including the first, and again after each wait
+  uint64_t lines = 0;
+  uint64_t quotas = 0; // Runs killed for going over the quota
+  uint64_t waits = 0; // Runs that ended suspended, for a wait, or to go again later
+  uint64_t total_ns = 0;
+  uint64_t max_ns = 0;
+};
+static bool tba_profiling = false;
+static std::unordered_map<int, tba_profile> tba_profiles;
+
+void Mind::SetTBAProfiling(bool on) {
+  tba_profiling = on;
+}
+
+bool Mind::TBAProfiling() {
+  return tba_profiling;
+}
+
+void Mind::ClearTBAProfile() {
+  tba_profiles.clear();
+}
+
+std::u8string Mind::TBAProfileReport(const std::u8string_view& sort, size_t max) {
+  static const std::vector<std::pair<std::u8string_view, uint64_t tba_profile::*>> keys = {
+      {u8"time", &tba_profile::total_ns},
+      {u8"max", &tba_profile::max_ns},
+      {u8"lines", &tba_profile::lines},
+      {u8"fires", &tba_profile::fires},
+      {u8"runs", &tba_profile::runs},
+      {u8"quota", &tba_profile::quotas},
+      {u8"waits", &tba_profile::waits},
+  };
+  auto key = keys.front();
+  for (const auto& k : keys) {
+    if (!sort.empty() && k.first.starts_with(sort)) {
+      key = k;
+      break;
+    }
+  }
+
+  std::vector<std::pair<int, const tba_profile*>> order;
+  order.reserve(tba_profiles.size());
+  for (const auto& prof : tba_profiles) {
+    order.emplace_back(prof.first, &prof.second);
+  }
+  std::sort(order.begin(), order.end(), [field = key.second](const auto& a, const auto& b) {
+    return (a.second->*field != b.second->*field) ? (a.second->*field > b.second->*field)
+                                                   : (a.first < b.first);
+  });
+
+  std::u8string ret = fmt::format(
+      u8"TBA trigger profile ({}), {} scripts, by {}:\n"
+      u8"  Script     Fires      Runs       Lines  Quota     Waits   Total ms   Max us\n",
+      (tba_profiling) ? u8"on" : u8"off",
+      order.size(),
+      key.first);
+  for (const auto& prof : order) {
+    if (max-- == 0) {
+      break;
+    }
+    ret += fmt::format(
+        u8"{:8} {:9} {:9} {:11} {:6} {:9} {:10.3f} {:8.1f}\n",
+        prof.first,
+        prof.second->fires,
+        prof.second->runs,
+        prof.second->lines,
+        prof.second->quotas,
+        prof.second->waits,
+        double(prof.second->total_ns) / 1000000.0,
+        double(prof.second->max_ns) / 1000.0);
+  }
+  return ret;
+}
+
+bool Mind::DumpTBAProfile(const std::u8string_view& filename) {
+  outfile fl(filename);
+  if (!fl) {
+    loger(u8"Error: Can't write TBA trigger profile to '{}'", filename);
+    return false;
+  }
+  fl.append(TBAProfileReport(u8"time", tba_profiles.size()));
+  return true;
+}
+
 bool Mind::TBATriggerThink(int istick) {
-  if (body && body->Parent() && spos_s.size() > 0) {
-    //      logeg(u8"#{} Debug: Running Trigger.",
-    //	body->Skill(prhash(u8"TBAScript"))
-    //	);
-    ovars[u8"self"] = body->Parent();
-    ovars[u8"context"] = ovars[u8"self"]; // Initial global var context
-    std::u8string_view script = svars[u8"script"];
-
-    int quota = 1024;
-    int stype = body->Skill(prhash(u8"TBAScriptType"));
-    while (spos_s.size() > 0 && spos_s.back() < script.length() &&
-           spos_s.back() != std::u8string::npos) {
-      std::u8string line;
-      size_t endl = script.find_first_of(u8"\n\r", spos_s.back());
+  if (tba && body && body->Parent() && tba->spos_s.size() > 0) {
+    if (!tba_profiling) {
+      return TBATriggerRun();
+    }
+
+    int vnum = body->Skill(prhash(u8"TBAScript"));
+    auto start = std::chrono::steady_clock::now();
+    bool alive = TBATriggerRun();
+    uint64_t spent = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+    auto& prof = tba_profiles[vnum];
+    ++prof.runs;
+    prof.lines += SCRIPT_QUOTA - std::max(0, tba->quota);
+    prof.quotas += (tba->quota < 1);
+    prof.waits += (alive && tba->quota > 0);
+    prof.total_ns += spent;
+    prof.max_ns = std::max(prof.max_ns, spent);
+    return alive;
+  }
+  return false;
+}
+
+bool Mind::TBATriggerRun() {
+  //      logeg(u8"#{} Debug: Running Trigger.",
+  //	body->Skill(prhash(u8"TBAScript"))
+  //	);
+  tba->SetObj(TBA_SELF, body->Parent());
+  tba->SetObj(TBA_CONTEXT, body->Parent()); // Initial global var context
+  std::u8string_view script = tba->prog->text;
+
+  tba->quota = SCRIPT_QUOTA;
+  int stype = body->Skill(prhash(u8"TBAScriptType"));
+  while (tba->spos_s.size() > 0 && tba->spos_s.back() < script.length() &&
+         tba->spos_s.back() != std::u8string::npos) {
+    std::u8string_view line;
+    const auto* ln = tba->prog->At(tba->spos_s.back());
+    if (ln) {
+      line = script.substr(ln->start, ln->end - ln->start);
+      tba->spos_s.back() = ln->next;
+    } else { // Not the start of a line, so find the rest of it the long way
+      size_t endl = script.find_first_of(u8"\n\r", tba->spos_s.back());
       if (endl == std::u8string::npos)
-        line = script.substr(spos_s.back());
+        line = script.substr(tba->spos_s.back());
       else
-        line = script.substr(spos_s.back(), endl - spos_s.back());
+        line = script.substr(tba->spos_s.back(), endl - tba->spos_s.back());
 
-      spos_s.back() = skip_line(script, spos_s.back());
+      tba->spos_s.back() = skip_line(script, tba->spos_s.back());
+    }
 
-      if (line[0] == '*')
-        continue; // Comments
+    if (line.starts_with('*'))
+      continue; // Comments
 
-      PING_QUOTA();
+    PING_QUOTA();
 
-      int ret = TBARunLine(line);
-      if (ret < 0) {
-        return false;
-      } else if (ret > 0) {
-        return true;
-      }
+    int ret = TBARunLine(line, ln);
+    if (ret < 0) {
+      return false;
+    } else if (ret > 0) {
+      return true;
     }
-    if (stype & 2) { // Random Triggers
-      if (!Body()->HasMultipleMinds()) { // Not Already Being Covered
-        int chance = body->Skill(prhash(u8"TBAScriptNArg")); // Percent Chance
-        if (chance > 0) {
-          int delay = 13000; // Next try in 13 seconds.
-          while (delay < 1300000 && (!Dice::Percent(chance))) {
-            delay += 13000;
-          }
-          spos_s.clear();
-          spos_s.push_back(0); // We never die!
-          Suspend(delay); // We'll be back!
-          return true;
+  }
+  if (stype & 2) { // Random Triggers
+    if (!Body()->HasMultipleMinds()) { // Not Already Being Covered
+      int chance = body->Skill(prhash(u8"TBAScriptNArg")); // Percent Chance
+      if (chance > 0) {
+        int delay = 13000; // Next try in 13 seconds.
+        while (delay < 1300000 && (!Dice::Percent(chance))) {
+          delay += 13000;
         }
+        tba->spos_s.clear();
+        tba->spos_s.push_back(0); // We never die!
+        Suspend(delay); // We'll be back!
+        return true;
       }
     }
   }
@@ -737,17 +1708,8 @@ bool Mind::TBATriggerThink(int istick) {
 // 0 to continue running
 // 1 to be done now (suspend)
 // -1 to destroy mind (error/done)
-int Mind::TBARunLine(std::u8string linestr) {
-  if (0
-      //	|| body->Skill(prhash(u8"TBAScript")) == 5000099
-      //	|| linestr.contains(u8"eval loc ")
-      //	|| linestr.contains(u8"set first ")
-      //	|| linestr.contains(u8"exclaim")
-      //	|| linestr.contains(u8"speech")
-  ) {
-    logeg(u8"#{} Debug: Running '{}'", body->Skill(prhash(u8"TBAScript")), linestr);
-  }
-  Object* room = ovars.at(u8"self");
+int Mind::TBARunLine(std::u8string_view line, const tba_line* ln) {
+  Object* room = tba->Obj(TBA_SELF);
   while (room && room->Skill(prhash(u8"TBARoom")) == 0) {
     if (room->Skill(prhash(u8"Invisible")) > 999)
       room = nullptr; // Not really there
@@ -756,44 +1718,65 @@ int Mind::TBARunLine(std::u8string linestr) {
   }
   if (!room) { // Not in a room (dup clone, in a popper, etc...).
     //    loger(u8"#{} Error: No room in '{}'",
-    //	body->Skill(prhash(u8"TBAScript")), linestr
+    //	body->Skill(prhash(u8"TBAScript")), line
     //	);
     return -1;
   }
   // Needs to be alive! MOB & MOB-* (Not -DEATH or -GLOBAL)
   if ((body->Skill(prhash(u8"TBAScriptType")) & 0x103FFDE) > 0x1000000) {
-    if (ovars.at(u8"self")->IsAct(act_t::DEAD) || ovars.at(u8"self")->IsAct(act_t::DYING) ||
-        ovars.at(u8"self")->IsAct(act_t::UNCONSCIOUS)) {
+    if (tba->Obj(TBA_SELF)->IsAct(act_t::DEAD) ||
+        tba->Obj(TBA_SELF)->IsAct(act_t::DYING) ||
+        tba->Obj(TBA_SELF)->IsAct(act_t::UNCONSCIOUS)) {
       //      logeg(u8"#{} Debug: Triggered on downed MOB.",
       //	body->Skill(prhash(u8"TBAScript"))
       //	);
-      spos_s.back() = std::u8string::npos; // Jump to End
+      tba->spos_s.back() = std::u8string::npos; // Jump to End
       return 0; // Allow re-run (in case of resurrection/waking/etc...).
     }
   }
 
-  size_t spos = spos_s.back();
+  size_t spos = tba->spos_s.back();
   int vnum = body->Skill(prhash(u8"TBAScript"));
-  if (!TBAVarSub(linestr)) {
-    loger(u8"#{} Error: VarSub failed in '{}'", vnum, linestr);
-    return -1;
-  }
-
-  int com = COM_NONE; // ComNum for Pass-Through
-  std::u8string_view line = linestr;
-  std::u8string_view cmd = line;
-  std::u8string_view script = svars[u8"script"];
-
-  auto c1 = cmd.find_first_not_of(u8" \t\n\r;");
-  if (c1 != std::u8string::npos) {
-    auto c2 = cmd.find_first_of(u8" \t\n\r;", c1 + 1);
-    if (c2 == std::u8string::npos) {
-      cmd = cmd.substr(c1);
-    } else {
-      cmd = cmd.substr(c1, c2 - c1);
+  std::u8string_view script = tba->prog->text;
+  const tba_expr* ex = (ln && ln->expr) ? ln->expr.get() : nullptr; // Compiled with the script
+  std::u8string subst; // Only needed if it has variables in it, and nothing compiled uses them
+  if (ex) {
+    if (!TBAVarRefs(*ex, line)) {
+      loger(u8"#{} Error: VarSub failed in '{}'", vnum, line);
+      return -1;
     }
+  } else if (ln ? !ln->vars.empty() : line.contains('%')) {
+    subst = line;
+    if (!TBAVarSub(subst, ln)) {
+      loger(u8"#{} Error: VarSub failed in '{}'", vnum, subst);
+      return -1;
+    }
+    line = subst;
+  }
+
+  // The variable this line sets, looked up already if it names one literally.
+  auto var_id = [this, ln](const std::u8string_view& var) {
+    return (ln && ln->target != TBA_NO_VAR) ? ln->target : tba->VarId(var);
+  };
+  auto known_var_id = [this, ln](const std::u8string_view& var) {
+    return (ln && ln->target != TBA_NO_VAR) ? ln->target : tba->KnownVarId(var);
+  };
+
+  int com = ln ? ln->com : -1;
+  if (com < 0) { // Not known in advance, so find the ComNum for Pass-Through
+    com = COM_NONE;
+    std::u8string_view cmd = line;
+    auto c1 = cmd.find_first_not_of(u8" \t\n\r;");
+    if (c1 != std::u8string::npos) {
+      auto c2 = cmd.find_first_of(u8" \t\n\r;", c1 + 1);
+      if (c2 == std::u8string::npos) {
+        cmd = cmd.substr(c1);
+      } else {
+        cmd = cmd.substr(c1, c2 - c1);
+      }
 
-    com = identify_command(cmd, true);
+      com = identify_command(cmd, true);
+    }
   }
 
   //  //Start of script command if/else if/else
@@ -809,9 +1792,10 @@ int Mind::TBARunLine(std::u8string linestr) {
     if (lpos != std::u8string::npos) {
       std::u8string_view var = line.substr(lpos);
       trim_string(var);
-      svars.erase(std::u8string(var));
-      ovars.erase(std::u8string(var));
-      ovars[u8"context"]->ClearSkill(fmt::format(u8"TBA:{}", var));
+      uint32_t vid = var_id(var);
+      tba->ClearStr(vid);
+      tba->ClearObj(vid);
+      tba->Obj(TBA_CONTEXT)->ClearSkill(fmt::format(u8"TBA:{}", var));
     } else {
       loger(u8"#{} Error: Malformed unset '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return -1;
@@ -829,36 +1813,33 @@ int Mind::TBARunLine(std::u8string linestr) {
         std::u8string_view var = line.substr(0, end1);
         lpos = line.find_first_not_of(u8" \t", end1 + 1);
         if (lpos != std::u8string::npos) {
-          std::u8string val(line.substr(lpos));
-          if (0
-              //		|| var.contains(u8"midgaard")
-              //		|| var.contains(u8"exclaim")
-              //		|| var.contains(u8"speech")
-          ) {
-            logeg(u8"#{} Debug: '{}' = '{}'", body->Skill(prhash(u8"TBAScript")), var, val);
-          }
-          if (coml == 'e') {
+          std::u8string val = (coml == 'e' && ex) ? tba_comp(*ex, tba->refs)
+                                                  : std::u8string(line.substr(lpos));
+          if (coml == 'e' && !ex) {
             int valnum = body->Skill(prhash(u8"TBAScript"));
             if (!TBAVarSub(val)) {
               loger(u8"#{} Error: Eval failed in '{}'", valnum, line);
               return -1;
             }
-            val = TBAComp(val);
+            val = tba_comp(val);
           }
+          uint32_t vid = var_id(var);
           if (val.starts_with(u8"obj:")) { // Encoded Object
-            ovars[std::u8string(var)] = decode_object(val);
-            svars.erase(std::u8string(var));
+            tba->SetObj(vid, decode_object(val));
+            tba->ClearStr(vid);
           } else {
-            svars[std::u8string(var)] = val;
-            ovars.erase(std::u8string(var));
+            tba->SetStr(vid, val);
+            tba->ClearObj(vid);
           }
         } else { // Only space after varname
-          svars[std::u8string(var)] = u8"";
-          ovars.erase(std::u8string(var));
+          uint32_t vid = var_id(var);
+          tba->SetStr(vid, u8"");
+          tba->ClearObj(vid);
         }
       } else { // Nothing after varname
-        svars[std::u8string(line)] = u8"";
-        ovars.erase(std::u8string(line));
+        uint32_t vid = var_id(line);
+        tba->SetStr(vid, u8"");
+        tba->ClearObj(vid);
       }
     }
     return 0;
@@ -889,11 +1870,11 @@ int Mind::TBARunLine(std::u8string linestr) {
               end1 = line.find_first_of(u8" \t\n\r", lpos);
               if (end1 == std::u8string::npos)
                 end1 = line.length();
-              svars[std::u8string(var)] = line.substr(lpos, end1 - lpos);
+              tba->SetStr(var_id(var), line.substr(lpos, end1 - lpos));
             } else {
-              svars[std::u8string(var)] = u8"";
+              tba->SetStr(var_id(var), u8"");
             }
-            ovars.erase(std::u8string(var));
+            tba->ClearObj(var_id(var));
           } else if (wnum < 0) { // Bad number after varname
             loger(u8"#{} Error: Malformed extract '{}'", body->Skill(prhash(u8"TBAScript")), line);
             return -1;
@@ -934,15 +1915,15 @@ int Mind::TBARunLine(std::u8string linestr) {
       return -1;
     }
     Object* oldp = nullptr;
-    if (ovars.at(u8"self")->Parent() != room) {
-      oldp = ovars.at(u8"self")->Parent();
-      oldp->RemoveLink(ovars.at(u8"self"));
-      ovars.at(u8"self")->SetParent(room);
+    if (tba->Obj(TBA_SELF)->Parent() != room) {
+      oldp = tba->Obj(TBA_SELF)->Parent();
+      oldp->RemoveLink(tba->Obj(TBA_SELF));
+      tba->Obj(TBA_SELF)->SetParent(room);
     }
-    int ret = TBARunLine(std::u8string(line));
+    int ret = TBARunLine(line);
     if (oldp) {
-      ovars.at(u8"self")->Parent()->RemoveLink(ovars.at(u8"self"));
-      ovars.at(u8"self")->SetParent(oldp);
+      tba->Obj(TBA_SELF)->Parent()->RemoveLink(tba->Obj(TBA_SELF));
+      tba->Obj(TBA_SELF)->SetParent(oldp);
     }
     return ret;
   }
@@ -951,7 +1932,7 @@ int Mind::TBARunLine(std::u8string linestr) {
     skipspace(line);
     Object* con = decode_object(line);
     if (con != nullptr) {
-      ovars[u8"context"] = con;
+      tba->SetObj(TBA_CONTEXT, con);
     } else {
       loger(u8"#{} Error: No Context Object '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return 1;
@@ -982,8 +1963,9 @@ int Mind::TBARunLine(std::u8string linestr) {
     skipspace(line);
     Object* con = decode_object(line);
     if (var.length() > 0 && con != nullptr) {
-      if (svars.contains(std::u8string(var))) {
-        int val = getnum(svars[std::u8string(var)]);
+      const std::u8string* sval = tba->Str(known_var_id(var));
+      if (sval) {
+        int val = getnum(*sval);
         con->SetSkill(fmt::format(u8"TBA:{}", var), val);
         if (con->IsAnimate()) {
           con->Accomplish(body->Skill(prhash(u8"Accomplishment")), u8"role playing");
@@ -1005,11 +1987,12 @@ int Mind::TBARunLine(std::u8string linestr) {
   }
 
   else if (process(line, u8"global ")) {
-    Object* con = ovars[u8"context"];
+    Object* con = tba->Obj(TBA_CONTEXT);
     if (con != nullptr) {
       std::u8string_view var = getgraph(line);
-      if (svars.count(std::u8string(var)) > 0) {
-        int val = getnum(svars[std::u8string(var)]);
+      const std::u8string* sval = tba->Str(known_var_id(var));
+      if (sval) {
+        int val = getnum(*sval);
         con->SetSkill(fmt::format(u8"TBA:{}", var), val);
         //	logeg(u8"#{} Debug: Global {}={} '{}'",
         //		body->Skill(prhash(u8"TBAScript")), var, val, line);
@@ -1078,16 +2061,16 @@ int Mind::TBARunLine(std::u8string linestr) {
     int v1 = nextnum(line);
     skipspace(line);
     int v2 = nextnum(line);
-    if (ovars[u8"self"]->Skill(prhash(u8"Liquid Source")) && v1 == 0) {
+    if (tba->Obj(TBA_SELF)->Skill(prhash(u8"Liquid Source")) && v1 == 0) {
       if (v2 < 0)
         v2 = 1 << 30;
-      ovars[u8"self"]->SetSkill(prhash(u8"Liquid Source"), v2 + 1);
-    } else if (ovars[u8"self"]->Skill(prhash(u8"Liquid Source")) && v1 == 1) {
-      if (ovars[u8"self"]->Contents().size() < 1) {
+      tba->Obj(TBA_SELF)->SetSkill(prhash(u8"Liquid Source"), v2 + 1);
+    } else if (tba->Obj(TBA_SELF)->Skill(prhash(u8"Liquid Source")) && v1 == 1) {
+      if (tba->Obj(TBA_SELF)->Contents().size() < 1) {
         logey(u8"#{} Warning: Empty fountain '{}'", body->Skill(prhash(u8"TBAScript")), line);
         return -1;
       }
-      ovars[u8"self"]->Contents().front()->SetQuantity(v2 + 1);
+      tba->Obj(TBA_SELF)->Contents().front()->SetQuantity(v2 + 1);
     } else {
       loger(u8"#{} Error: Unimplemented oset '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return -1;
@@ -1095,135 +2078,48 @@ int Mind::TBARunLine(std::u8string linestr) {
   }
 
   else if (line.starts_with(u8"if ")) {
-    if (!TBAEval(line.substr(3))) { // Was false
-      int depth = 0;
-      while (spos != std::u8string::npos) { // Skip to end/elseif
-        //        PING_QUOTA();
-        if ((!depth) && (script.substr(spos).starts_with(u8"elseif "))) {
-          spos += 4; // Make it into an u8"if" and go
-          break;
-        } else if (script.substr(spos).starts_with(u8"else")) {
-          if (!depth) { // Only right if all the way back
-            spos = skip_line(script, spos);
-            break;
-          }
-        } else if (script.substr(spos).starts_with(u8"end")) {
-          if (!depth) { // Only done if all the way back
-            spos = skip_line(script, spos);
-            break;
-          }
-          --depth; // Otherwise am just 1 nesting level less deep
-        } else if (script.substr(spos).starts_with(u8"if ")) {
-          ++depth; // Am now 1 nesting level deeper!
-        }
-        spos = skip_line(script, spos);
-      }
-      spos_s.back() = spos; // Save skip-to position in real PC
+    if (!(ex ? tba_eval(*ex, tba->refs) : tba_eval(line.substr(3)))) { // Was false
+      tba->spos_s.back() = tba->prog->SkipIf(spos); // Skip to end/elseif
     }
   }
 
   else if (line.starts_with(u8"else")) { // else/elseif
-    int depth = 0;
-    while (spos != std::u8string::npos) { // Skip to end (considering nesting)
-      //      PING_QUOTA();
-      if (script.substr(spos).starts_with(u8"end")) {
-        if (depth == 0) { // Only done if all the way back
-          spos = skip_line(script, spos);
-          break;
-        }
-        --depth; // Otherwise am just 1 nesting level less deep
-      } else if (script.substr(spos).starts_with(u8"if ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      }
-      spos = skip_line(script, spos);
-    }
-    spos_s.back() = spos; // Save skip-to position in real PC
+    tba->spos_s.back() = tba->prog->SkipElse(spos); // Skip to end (considering nesting)
   }
 
   else if (line.starts_with(u8"while ")) {
-    int depth = 0;
     size_t rep = prev_line(script, spos);
     size_t begin = spos;
-    while (spos != std::u8string::npos) { // Skip to end (considering nesting)
-      //      PING_QUOTA();
-      if (script.substr(spos).starts_with(u8"done")) {
-        if (depth == 0) { // Only done if all the way back
-          spos = skip_line(script, spos);
-          break;
-        }
-        --depth; // Otherwise am just 1 nesting level less deep
-      } else if (script.substr(spos).starts_with(u8"switch ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      } else if (script.substr(spos).starts_with(u8"while ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      }
-      spos = skip_line(script, spos);
-    }
-    if (TBAEval(line.substr(6))) {
-      spos_s.back() = rep; // Will repeat the u8"while"
-      spos_s.push_back(begin); // But run the inside of the loop first.
+    if (ex ? tba_eval(*ex, tba->refs) : tba_eval(line.substr(6))) {
+      tba->spos_s.back() = rep; // Will repeat the u8"while"
+      tba->spos_s.push_back(begin); // But run the inside of the loop first.
     } else {
-      spos_s.back() = spos; // Save after-done position in real PC
+      tba->spos_s.back() = tba->prog->SkipLoop(spos); // Save after-done position in real PC
     }
   }
 
   else if (!!line.starts_with(u8"switch ")) {
-    int depth = 0;
     size_t targ = 0;
     std::u8string_view value = line.substr(7);
     trim_string(value);
-    while (spos != std::u8string::npos) { // Skip to end (considering nesting)
-      //      PING_QUOTA();
-      if (script.substr(spos).starts_with(u8"done")) {
-        if (depth == 0) { // Only done if all the way back
-          spos = skip_line(script, spos);
-          break;
-        }
-        --depth; // Otherwise am just 1 nesting level less deep
-      } else if (script.substr(spos).starts_with(u8"switch ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      } else if (script.substr(spos).starts_with(u8"while ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      } else if (
-          depth == 0 && (script.substr(spos).starts_with(u8"case ")) &&
-          TBAEval(fmt::format(u8"{} == {}", value, script.substr(spos + 5)))) {
-        // The actual case I want!
-        spos = skip_line(script, spos);
-        targ = spos;
-        continue;
-      } else if (depth == 0 && (script.substr(spos).starts_with(u8"default"))) {
-        // Maybe the case I want
-        if (targ == 0) {
-          spos = skip_line(script, spos);
-          targ = spos;
-          continue;
+    for (const auto& cs : tba->prog->Cases(spos, ln)) {
+      if (cs.pos != std::u8string::npos) {
+        if (cs.expr ? tba_eval(*cs.expr, tba->refs)
+                    : tba_eval(fmt::format(u8"{} == {}", value, script.substr(cs.pos)))) {
+          targ = cs.start; // The actual case I want!
         }
+      } else if (targ == 0) {
+        targ = cs.start; // Maybe the case I want
       }
-      spos = skip_line(script, spos);
     }
-    spos_s.back() = spos; // Save after-done position in real PC
+    tba->spos_s.back() = tba->prog->SkipLoop(spos); // Save after-done position in real PC
     if (targ != 0) { // Got a case to go to
-      spos_s.push_back(targ); // Push jump-to position above real PC
+      tba->spos_s.push_back(targ); // Push jump-to position above real PC
     }
   }
 
   else if (line.starts_with(u8"break")) { // Skip to done
-    int depth = 0;
-    while (spos != std::u8string::npos) { // Skip to end (considering nesting)
-      //      PING_QUOTA();
-      if (script.substr(spos).starts_with(u8"done")) {
-        if (depth == 0) { // Only done if all the way back
-          break;
-        }
-        --depth; // Otherwise am just 1 nesting level less deep
-      } else if (script.substr(spos).starts_with(u8"switch ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      } else if (script.substr(spos).starts_with(u8"while ")) {
-        ++depth; // Am now 1 nesting level deeper!
-      }
-      spos = skip_line(script, spos);
-    }
-    spos_s.back() = spos; // Save done position in real PC
+    tba->spos_s.back() = tba->prog->ToDone(spos); // Save done position in real PC
   }
 
   else if ((!!line.starts_with(u8"asound "))) {
@@ -1318,7 +2214,7 @@ int Mind::TBARunLine(std::u8string linestr) {
     if (tname == u8"all") {
       tname = u8"everyone";
     }
-    dam = TBAEval(line);
+    dam = tba_eval(line);
     if (dam > 0)
       dam = (dam + 180) / 100;
     if (dam < 0)
@@ -1530,7 +2426,7 @@ int Mind::TBARunLine(std::u8string linestr) {
       tname = u8"everyone";
       nocheck = 1;
     }
-    Object* dest = ovars[u8"self"]->World();
+    Object* dest = tba->Obj(TBA_SELF)->World();
     auto zones = dest->Contents();
     dest = nullptr;
     dnum += 1000000;
@@ -1597,7 +2493,7 @@ int Mind::TBARunLine(std::u8string linestr) {
   else if (process(line, u8"load ")) {
     int mask = 0;
     act_t loc = act_t::NONE;
-    Object* dest = ovars[u8"self"];
+    Object* dest = tba->Obj(TBA_SELF);
     Object* item = nullptr;
     int params = 1;
     int tbatype = ascii_tolower(getgraph(line)[0]);
@@ -1762,18 +2658,18 @@ int Mind::TBARunLine(std::u8string linestr) {
       auto spell = tba_spellconvert(line.substr(0, splen));
       // logeb(u8"Cast[Acid]: {}", spell);
       // logey(u8"Cast[TBA]: {}", line.substr(splen));
-      ovars[u8"self"]->SetSkill(spell + u8" Spell", 5);
+      tba->Obj(TBA_SELF)->SetSkill(spell + u8" Spell", 5);
       std::u8string cline = u8"shout " + spell;
       if (splen + 1 < line.length()) {
         line = line.substr(splen + 1);
         skipspace(line);
         Object* targ = decode_object(line);
         if (targ) {
-          ovars[u8"self"]->AddAct(act_t::POINT, targ);
+          tba->Obj(TBA_SELF)->AddAct(act_t::POINT, targ);
         }
       }
       cline += u8";cast " + spell + u8";point";
-      handle_command(ovars[u8"self"], cline);
+      handle_command(tba->Obj(TBA_SELF), cline);
     } else {
       loger(u8"Error: Bad casting command: '{}'", line);
     }
@@ -1787,13 +2683,13 @@ int Mind::TBARunLine(std::u8string linestr) {
     // Ignore these, as the varsub should have done all that's needed
   } else if (line.starts_with(u8"done")) {
     // Means we should be within a while(), pop up a level.
-    if (spos_s.size() < 2) {
+    if (tba->spos_s.size() < 2) {
       loger(u8"#{} Error: Not in while/switch, but '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return -1;
     }
-    spos_s.pop_back();
+    tba->spos_s.pop_back();
   } else if (!!line.starts_with(u8"return ")) {
-    int retval = TBAEval(line.substr(7));
+    int retval = tba_eval(line.substr(7));
     if (retval == 0) {
       status = 1; // Set special state
     }
@@ -1808,7 +2704,7 @@ int Mind::TBARunLine(std::u8string linestr) {
       stuff = line.find_first_not_of(u8" \t\r\n", stuff);
     }
     if (stuff != std::u8string::npos) {
-      handle_command(ovars[u8"self"], line.substr(1));
+      handle_command(tba->Obj(TBA_SELF), line.substr(1));
     } else {
       loger(u8"#{} Error: Told just '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return -1;
@@ -1821,18 +2717,19 @@ int Mind::TBARunLine(std::u8string linestr) {
     if (start != std::u8string::npos) {
       size_t end = line.find_first_of(u8" \t\r\n", start);
       if (end != std::u8string::npos) {
-        handle_command(ovars[u8"self"], fmt::format(u8"hold {}", line.substr(start, end - start)));
+        handle_command(
+            tba->Obj(TBA_SELF), fmt::format(u8"hold {}", line.substr(start, end - start)));
       } else {
-        handle_command(ovars[u8"self"], fmt::format(u8"hold {}", line.substr(start)));
+        handle_command(tba->Obj(TBA_SELF), fmt::format(u8"hold {}", line.substr(start)));
       }
       start = line.find_first_not_of(u8" \t\r\n", end);
       if (start != std::u8string::npos) {
         end = line.find_first_of(u8" \t\r\n", start);
         if (end != std::u8string::npos) {
           handle_command(
-              ovars[u8"self"], fmt::format(u8"offer {}", line.substr(start, end - start)));
+              tba->Obj(TBA_SELF), fmt::format(u8"offer {}", line.substr(start, end - start)));
         } else {
-          handle_command(ovars[u8"self"], fmt::format(u8"offer {}", line.substr(start)));
+          handle_command(tba->Obj(TBA_SELF), fmt::format(u8"offer {}", line.substr(start)));
         }
       } else {
         loger(u8"#{} Error: Told just '{}'", body->Skill(prhash(u8"TBAScript")), line);
@@ -1862,7 +2759,7 @@ int Mind::TBARunLine(std::u8string linestr) {
       stuff = line.find_first_not_of(u8" \t\r\n", stuff);
     }
     if (stuff != std::u8string::npos) {
-      handle_command(ovars[u8"self"], line);
+      handle_command(tba->Obj(TBA_SELF), line);
     } else {
       loger(u8"#{} Error: Told just '{}'", body->Skill(prhash(u8"TBAScript")), line);
       return -1;
@@ -1875,11 +2772,11 @@ int Mind::TBARunLine(std::u8string linestr) {
       com == COM_DOWN || com == COM_SLEEP || com == COM_REST || com == COM_WAKE ||
       com == COM_STAND || com == COM_SIT || com == COM_LIE || com == COM_LOOK || com == COM_FLEE ||
       com > COM_LAST_STANDARD) {
-    handle_command(ovars[u8"self"], line);
+    handle_command(tba->Obj(TBA_SELF), line);
   }
 
   // Trigger-Supported (only) commands (not shared with real acid commands).
-  else if (com == COM_NONE && handle_command(ovars[u8"self"], line) != 1) {
+  else if (com == COM_NONE && handle_command(tba->Obj(TBA_SELF), line) != 1) {
     // Do Nothing, as handle_command already did it.
   }
 
@@ -1890,814 +2787,840 @@ int Mind::TBARunLine(std::u8string linestr) {
   return 0;
 }
 
-bool Mind::TBAVarSub(std::u8string& edit) const {
+bool Mind::TBAVarSub(std::u8string& edit, const tba_line* ln) const {
+  // Until a value put in brings a '%' of its own, each '%' found is still one of the line's own
+  // (just moved), so the variable named after it was already looked up.
+  size_t known = 0; // The next of the line's own '%'s
+  size_t moved = 0; // How far the rest of the line has moved (wrapping, if back)
+  std::u8string val;
   size_t cur = edit.find('%');
-  size_t end;
   while (cur != std::u8string::npos) {
     std::u8string_view line(edit);
-    end = line.find_first_of(u8"%. \t", cur + 1);
-    if (end == std::u8string::npos)
-      end = line.length();
-    if (0
-        //	|| body->Skill(prhash(u8"TBAScript")) == 5000099
-        //	|| line.contains(u8"eval loc ")
-        //	|| line.contains(u8"set first ")
-        //	|| line.contains(u8"exclaim")
-        //	|| line.contains(u8"speech")
-    ) {
-      logeg(u8"#{} Debug: '{}'", body->Skill(prhash(u8"TBAScript")), line);
-    }
-    std::u8string_view vname = line.substr(cur + 1, end - cur - 1);
-    Object* obj = nullptr;
-    std::u8string val = u8"";
-    int is_obj = 0;
-    if (ovars.count(std::u8string(vname)) > 0) {
-      obj = ovars.at(std::u8string(vname));
-      is_obj = 1;
-    } else if (svars.count(std::u8string(vname)) > 0) {
-      val = svars.at(std::u8string(vname));
-    } else if (line.substr(cur).starts_with(u8"%time.hour%")) {
-      Object* world = body->World();
-      if (world->Skill(prhash(u8"Day Time")) && world->Skill(prhash(u8"Day Length"))) {
-        int hour = world->Skill(prhash(u8"Day Time"));
-        hour *= 24;
-        hour /= world->Skill(prhash(u8"Day Length"));
-        val = itos(hour);
-      }
-      end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
-    } else if (line.substr(cur).starts_with(u8"%random.char%")) {
-      DArr64<Object*> others;
-      if (ovars.at(u8"self")->HasSkill(prhash(u8"TBARoom"))) {
-        others = ovars.at(u8"self")->PickObjects(u8"everyone", LOC_INTERNAL);
-      } else if (ovars.at(u8"self")->Owner()) {
-        others = ovars.at(u8"self")->Owner()->PickObjects(u8"everyone", LOC_NEARBY);
-      } else {
-        others = ovars.at(u8"self")->PickObjects(u8"everyone", LOC_NEARBY);
+    if (ln) {
+      while (known < ln->vars.size() && ln->vars[known].first < cur - moved) {
+        ++known;
+      }
+    }
+    uint32_t vid = TBA_NO_VAR;
+    if (ln && known < ln->vars.size() && ln->vars[known].first == cur - moved) {
+      vid = ln->vars[known].second;
+    } else {
+      vid = tba->KnownVarId(line.substr(cur + 1, line.find_first_of(u8"%. \t", cur + 1) - cur - 1));
+    }
+    size_t end;
+    if (!TBAVarRef(line, cur, vid, end, val)) {
+      return false;
+    }
+    if (ln && val.find('%', 1) != std::u8string::npos) {
+      ln = nullptr; // The rest will have to be looked up by name
+    }
+    moved += val.length() - (end - cur);
+    edit.replace(cur, end - cur, val);
+    cur = edit.find('%', cur + 1);
+  }
+  return true;
+}
+
+bool Mind::TBAVarRefs(const tba_expr& ex, const std::u8string_view& line) const {
+  if (tba->refs.size() < ex.refs.size()) {
+    tba->refs.resize(ex.refs.size());
+  }
+  for (size_t r = 0; r < ex.refs.size(); ++r) {
+    size_t end;
+    if (!TBAVarRef(line, ex.refs[r].start, ex.refs[r].slot, end, tba->refs[r])) {
+      return false;
+    }
+    if (end < ex.refs[r].end) { // Not set now, so it ends sooner: the rest is just text
+      std::u8string rest(line.substr(end, ex.refs[r].end - end));
+      if (!TBAVarSub(rest)) {
+        return false;
+      }
+      tba->refs[r] += rest;
+    }
+  }
+  return true;
+}
+
+bool Mind::TBAVarRef(
+    const std::u8string_view& line,
+    size_t cur,
+    uint32_t vid,
+    size_t& end,
+    std::u8string& val) const {
+  end = line.find_first_of(u8"%. \t", cur + 1);
+  if (end == std::u8string::npos)
+    end = line.length();
+  Object* obj = nullptr;
+  val.clear();
+  int is_obj = 0;
+  const std::u8string* sval = nullptr;
+  if (tba->IsObj(vid)) {
+    obj = tba->Obj(vid);
+    is_obj = 1;
+  } else if ((sval = tba->Str(vid))) {
+    val = *sval;
+  } else if (line.substr(cur).starts_with(u8"%time.hour%")) {
+    Object* world = body->World();
+    if (world->Skill(prhash(u8"Day Time")) && world->Skill(prhash(u8"Day Length"))) {
+      int hour = world->Skill(prhash(u8"Day Time"));
+      hour *= 24;
+      hour /= world->Skill(prhash(u8"Day Length"));
+      val = itos(hour);
+    }
+    end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
+  } else if (line.substr(cur).starts_with(u8"%random.char%")) {
+    DArr64<Object*> others;
+    if (tba->Obj(TBA_SELF)->HasSkill(prhash(u8"TBARoom"))) {
+      others = tba->Obj(TBA_SELF)->PickObjects(u8"everyone", LOC_INTERNAL);
+    } else if (tba->Obj(TBA_SELF)->Owner()) {
+      others = tba->Obj(TBA_SELF)->Owner()->PickObjects(u8"everyone", LOC_NEARBY);
+    } else {
+      others = tba->Obj(TBA_SELF)->PickObjects(u8"everyone", LOC_NEARBY);
+    }
+    if (others.size() > 0) {
+      int num = Dice::Rand(0, others.size() - 1);
+      auto item = others.begin();
+      for (; num > 0; --num) {
+        ++item;
       }
-      if (others.size() > 0) {
-        int num = Dice::Rand(0, others.size() - 1);
-        auto item = others.begin();
+      obj = (*item);
+    } else {
+      obj = nullptr;
+    }
+    is_obj = 1;
+    end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
+  } else if (line.substr(cur).starts_with(u8"%random.dir%")) {
+    Object* room = tba->Obj(TBA_SELF);
+    while (room && room->Skill(prhash(u8"TBARoom")) == 0)
+      room = room->Parent();
+    if (room) {
+      std::set<Object*> options;
+      options.insert(room->PickObject(u8"north", LOC_INTERNAL));
+      options.insert(room->PickObject(u8"south", LOC_INTERNAL));
+      options.insert(room->PickObject(u8"east", LOC_INTERNAL));
+      options.insert(room->PickObject(u8"west", LOC_INTERNAL));
+      options.insert(room->PickObject(u8"up", LOC_INTERNAL));
+      options.insert(room->PickObject(u8"down", LOC_INTERNAL));
+      options.erase(nullptr);
+      if (options.size() > 0) {
+        int num = Dice::Rand(0, options.size() - 1);
+        std::set<Object*>::iterator item = options.begin();
         for (; num > 0; --num) {
           ++item;
         }
-        obj = (*item);
-        if (0
-            //		|| script.find(u8"%damage% %actor% -%actor.level%") !=
-            // std::u8string::npos
-        ) {
-          logeg(u8"#{} Random: '{}'", body->Skill(prhash(u8"TBAScript")), obj->Noun());
+        val = (*item)->ShortDesc();
+      }
+    }
+    end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
+  } else if (line.substr(cur).starts_with(u8"%random.")) {
+    if (isdigit(line[cur + 8])) {
+      size_t vend = line.find_first_not_of(u8"0123456789", cur + 8);
+      if (vend != std::u8string::npos && line[vend] == '%') {
+        int div = getnum(line.substr(cur + 8));
+        if (div > 0) {
+          val = itos(Dice::Rand(1, div));
+        } else {
+          loger(
+              u8"#{} Error: Division by zero in '{}'\n",
+              body->Skill(prhash(u8"TBAScript")),
+              line);
+          return false;
         }
-      } else {
-        obj = nullptr;
       }
-      is_obj = 1;
-      end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
-    } else if (line.substr(cur).starts_with(u8"%random.dir%")) {
-      Object* room = ovars.at(u8"self");
-      while (room && room->Skill(prhash(u8"TBARoom")) == 0)
-        room = room->Parent();
-      if (room) {
-        std::set<Object*> options;
-        options.insert(room->PickObject(u8"north", LOC_INTERNAL));
-        options.insert(room->PickObject(u8"south", LOC_INTERNAL));
-        options.insert(room->PickObject(u8"east", LOC_INTERNAL));
-        options.insert(room->PickObject(u8"west", LOC_INTERNAL));
-        options.insert(room->PickObject(u8"up", LOC_INTERNAL));
-        options.insert(room->PickObject(u8"down", LOC_INTERNAL));
-        options.erase(nullptr);
-        if (options.size() > 0) {
-          int num = Dice::Rand(0, options.size() - 1);
-          std::set<Object*>::iterator item = options.begin();
-          for (; num > 0; --num) {
-            ++item;
+    }
+    end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
+  } else { // Undefined base var
+    end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
+  }
+  while (line[end] == '.') {
+    size_t start = end + 1;
+    end = line.find_first_of(u8"%. \t(", start);
+    if (end != std::u8string::npos && line[end] == '(') {
+      int paren_depth = 0;
+      do {
+        if (line[end] == '(')
+          ++paren_depth;
+        else if (line[end] == ')')
+          --paren_depth;
+        if (paren_depth > 0)
+          end = line.find_first_of(u8"()", end + 1);
+      } while (end != std::u8string::npos && paren_depth > 0);
+      if (end != std::u8string::npos)
+        end = line.find_first_of(u8"%", end + 1);
+    }
+    if (end == std::u8string::npos)
+      end = line.length();
+    std::u8string_view field = line.substr(start, end - start);
+    if (is_obj) {
+      if (field == u8"id") {
+        // obj is already right
+      } else if (field == u8"vnum") {
+        int vnum = 0;
+        if (obj) {
+          vnum = obj->Skill(prhash(u8"TBAMOB"));
+          if (vnum < 1)
+            vnum = obj->Skill(prhash(u8"TBAObject"));
+          if (vnum < 1)
+            vnum = obj->Skill(prhash(u8"TBARoom"));
+          if (vnum > 0)
+            vnum %= 1000000; // Convert from Acid number
+        }
+        val = itos(vnum);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"gold") {
+        int gold = 0;
+        if (obj) {
+          auto pay = obj->PickObjects(u8"all a gold piece", LOC_INTERNAL);
+          for (auto coin : pay) {
+            gold += coin->Quantity();
           }
-          val = (*item)->ShortDesc();
         }
-      }
-      end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
-    } else if (line.substr(cur).starts_with(u8"%random.")) {
-      if (isdigit(line[cur + 8])) {
-        size_t vend = line.find_first_not_of(u8"0123456789", cur + 8);
-        if (vend != std::u8string::npos && line[vend] == '%') {
-          int div = getnum(line.substr(cur + 8));
-          if (div > 0) {
-            val = itos(Dice::Rand(1, div));
+        val = itos(gold);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"type") {
+        val = u8"OTHER";
+        if (obj) {
+          if (obj->HasSkill(prhash(u8"Container")))
+            val = u8"CONTAINER";
+          else if (obj->HasSkill(prhash(u8"Liquid Source")))
+            val = u8"FOUNTAIN";
+          else if (obj->HasSkill(prhash(u8"Liquid Container")))
+            val = u8"LIQUID CONTAINER";
+          else if (obj->HasSkill(prhash(u8"Ingestible")) <= 0)
+            val = u8"FOOD";
+          else if (obj->Value() <= 0)
+            val = u8"TRASH";
+          // FIXME: More Types!
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"cost_per_day") {
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"cost") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Value());
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"count") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Quantity());
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"weight") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Weight());
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"sex") {
+        val = u8"";
+        if (obj) {
+          if (obj->Gender() == gender_t::MALE)
+            val = u8"male";
+          else if (obj->Gender() == gender_t::FEMALE)
+            val = u8"female";
+          else if (obj->Gender() == gender_t::NEITHER)
+            val = u8"other";
+          else
+            val = u8"none";
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"race") {
+        val = u8"";
+        if (obj && obj->IsAnimate()) {
+          val = u8"human"; // FIXME: Implement Race!
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"level") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->TotalExp() / 10 + 1);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"name") {
+        val = u8"";
+        if (obj)
+          val = obj->Noun();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"shortdesc") {
+        val = u8"";
+        if (obj)
+          val = obj->ShortDesc();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"alias") {
+        val = u8"";
+        if (obj)
+          val = obj->ShortDesc();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"heshe") {
+        val = u8"";
+        if (obj)
+          val = obj->Pron();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"hisher") {
+        val = u8"";
+        if (obj)
+          val = obj->Poss();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"himher") {
+        val = u8"";
+        if (obj)
+          val = obj->Obje();
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"maxhitp") {
+        val = itos(1000); // Everybody has 1000 HP.
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"hitp") {
+        val = u8"";
+        if (obj)
+          val = itos(1000 - 50 * (obj->Phys() + obj->Stun()));
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"align") {
+        val = u8"";
+        if (obj) {
+          int align = 0;
+          align = obj->Skill(prhash(u8"Honor"));
+          if (align == 0)
+            align = -(obj->Skill(prhash(u8"Dishonor")));
+          val = itos(align);
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"is_pc") {
+        val = u8"";
+        if (obj)
+          val = bstr[is_pc(obj)];
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"is_killer") {
+        val = u8"0"; // FIXME: Real value?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"is_thief") {
+        val = u8"0"; // FIXME: Real value?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"con") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(0) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"dex") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(1) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"str") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(2) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"stradd") { // D&D is Dumb
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"cha") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(3) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"int") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(4) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"wis") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->NormAttribute(5) * 3);
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"pos") {
+        val = u8"";
+        if (obj) {
+          if (obj->IsAct(act_t::SLEEP))
+            val = u8"sleeping";
+          else if (obj->IsAct(act_t::REST))
+            val = u8"resting";
+          else if (obj->IsAct(act_t::FIGHT))
+            val = u8"fighting";
+          else if (obj->Position() == pos_t::LIE)
+            val = u8"resting";
+          else if (obj->Position() == pos_t::SIT)
+            val = u8"sitting";
+          else if (obj->Position() == pos_t::STAND)
+            val = u8"standing";
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"title") {
+        val = u8"";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"val0") { // FIXME: Implement?
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"val1") { // FIXME: Implement?
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"val2") { // FIXME: Implement?
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"val3") { // FIXME: Implement?
+        val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"timer") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Skill(prhash(u8"Temporary"))); // FIXME: More Kinds?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"move") {
+        val = u8"";
+        if (obj)
+          val = itos(10 - obj->Stun());
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"maxmove") {
+        val = u8"";
+        if (obj)
+          val = u8"10";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"mana") {
+        val = u8"";
+        if (obj) {
+          if (obj->HasSkill(prhash(u8"Faith"))) {
+            val = itos(obj->Skill(prhash(u8"Faith Remaining")));
           } else {
-            loger(
-                u8"#{} Error: Division by zero in '{}'\n",
-                body->Skill(prhash(u8"TBAScript")),
-                line);
-            return false;
+            val = itos(10 - obj->Stun());
           }
         }
-      }
-      end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
-    } else { // Undefined base var
-      end = line.find_first_of(u8"% \t", cur + 1); // Done.  Replace All.
-    }
-    while (line[end] == '.') {
-      size_t start = end + 1;
-      end = line.find_first_of(u8"%. \t(", start);
-      if (end != std::u8string::npos && line[end] == '(') {
-        int paren_depth = 0;
-        do {
-          if (line[end] == '(')
-            ++paren_depth;
-          else if (line[end] == ')')
-            --paren_depth;
-          if (paren_depth > 0)
-            end = line.find_first_of(u8"()", end + 1);
-        } while (end != std::u8string::npos && paren_depth > 0);
-        if (end != std::u8string::npos)
-          end = line.find_first_of(u8"%", end + 1);
-      }
-      if (end == std::u8string::npos)
-        end = line.length();
-      std::u8string_view field = line.substr(start, end - start);
-      if (is_obj) {
-        if (field == u8"id") {
-          // obj is already right
-        } else if (field == u8"vnum") {
-          int vnum = 0;
-          if (obj) {
-            vnum = obj->Skill(prhash(u8"TBAMOB"));
-            if (vnum < 1)
-              vnum = obj->Skill(prhash(u8"TBAObject"));
-            if (vnum < 1)
-              vnum = obj->Skill(prhash(u8"TBARoom"));
-            if (vnum > 0)
-              vnum %= 1000000; // Convert from Acid number
-          }
-          val = itos(vnum);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"gold") {
-          int gold = 0;
-          if (obj) {
-            auto pay = obj->PickObjects(u8"all a gold piece", LOC_INTERNAL);
-            for (auto coin : pay) {
-              gold += coin->Quantity();
-            }
-          }
-          val = itos(gold);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"type") {
-          val = u8"OTHER";
-          if (obj) {
-            if (obj->HasSkill(prhash(u8"Container")))
-              val = u8"CONTAINER";
-            else if (obj->HasSkill(prhash(u8"Liquid Source")))
-              val = u8"FOUNTAIN";
-            else if (obj->HasSkill(prhash(u8"Liquid Container")))
-              val = u8"LIQUID CONTAINER";
-            else if (obj->HasSkill(prhash(u8"Ingestible")) <= 0)
-              val = u8"FOOD";
-            else if (obj->Value() <= 0)
-              val = u8"TRASH";
-            // FIXME: More Types!
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"maxmana") {
+        val = u8"";
+        if (obj) {
+          if (obj->HasSkill(prhash(u8"Faith"))) {
+            val = itos(obj->Skill(prhash(u8"Faith")) * obj->Skill(prhash(u8"Faith")));
+          } else {
+            val = u8"10";
           }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"cost_per_day") {
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"saving_para") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"cost") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Value());
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"count") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Quantity());
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"weight") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Weight());
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"sex") {
-          val = u8"";
-          if (obj) {
-            if (obj->Gender() == gender_t::MALE)
-              val = u8"male";
-            else if (obj->Gender() == gender_t::FEMALE)
-              val = u8"female";
-            else if (obj->Gender() == gender_t::NEITHER)
-              val = u8"other";
-            else
-              val = u8"none";
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"race") {
-          val = u8"";
-          if (obj && obj->IsAnimate()) {
-            val = u8"human"; // FIXME: Implement Race!
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"level") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->TotalExp() / 10 + 1);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"name") {
-          val = u8"";
-          if (obj)
-            val = obj->Noun();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"shortdesc") {
-          val = u8"";
-          if (obj)
-            val = obj->ShortDesc();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"alias") {
-          val = u8"";
-          if (obj)
-            val = obj->ShortDesc();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"heshe") {
-          val = u8"";
-          if (obj)
-            val = obj->Pron();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"hisher") {
-          val = u8"";
-          if (obj)
-            val = obj->Poss();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"himher") {
-          val = u8"";
-          if (obj)
-            val = obj->Obje();
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"maxhitp") {
-          val = itos(1000); // Everybody has 1000 HP.
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"hitp") {
-          val = u8"";
-          if (obj)
-            val = itos(1000 - 50 * (obj->Phys() + obj->Stun()));
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"align") {
-          val = u8"";
-          if (obj) {
-            int align = 0;
-            align = obj->Skill(prhash(u8"Honor"));
-            if (align == 0)
-              align = -(obj->Skill(prhash(u8"Dishonor")));
-            val = itos(align);
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"is_pc") {
-          val = u8"";
-          if (obj)
-            val = bstr[is_pc(obj)];
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"is_killer") {
-          val = u8"0"; // FIXME: Real value?
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"is_thief") {
-          val = u8"0"; // FIXME: Real value?
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"con") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(0) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"dex") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(1) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"str") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(2) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"stradd") { // D&D is Dumb
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"saving_rod") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"cha") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(3) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"int") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(4) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"wis") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->NormAttribute(5) * 3);
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"pos") {
-          val = u8"";
-          if (obj) {
-            if (obj->IsAct(act_t::SLEEP))
-              val = u8"sleeping";
-            else if (obj->IsAct(act_t::REST))
-              val = u8"resting";
-            else if (obj->IsAct(act_t::FIGHT))
-              val = u8"fighting";
-            else if (obj->Position() == pos_t::LIE)
-              val = u8"resting";
-            else if (obj->Position() == pos_t::SIT)
-              val = u8"sitting";
-            else if (obj->Position() == pos_t::STAND)
-              val = u8"standing";
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"title") {
-          val = u8"";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"val0") { // FIXME: Implement?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"saving_petri") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"val1") { // FIXME: Implement?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"saving_breath") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"val2") { // FIXME: Implement?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"saving_spell") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"val3") { // FIXME: Implement?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"prac") {
+        val = u8"";
+        if (obj)
           val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"timer") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Skill(prhash(u8"Temporary"))); // FIXME: More Kinds?
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"move") {
-          val = u8"";
-          if (obj)
-            val = itos(10 - obj->Stun());
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"maxmove") {
-          val = u8"";
-          if (obj)
-            val = u8"10";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"mana") {
-          val = u8"";
-          if (obj) {
-            if (obj->HasSkill(prhash(u8"Faith"))) {
-              val = itos(obj->Skill(prhash(u8"Faith Remaining")));
-            } else {
-              val = itos(10 - obj->Stun());
-            }
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"maxmana") {
-          val = u8"";
-          if (obj) {
-            if (obj->HasSkill(prhash(u8"Faith"))) {
-              val = itos(obj->Skill(prhash(u8"Faith")) * obj->Skill(prhash(u8"Faith")));
-            } else {
-              val = u8"10";
-            }
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"saving_para") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"saving_rod") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"saving_petri") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"saving_breath") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"saving_spell") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"prac") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"questpoints") {
-          val = u8"";
-          if (obj)
-            val = u8"0";
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"exp") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->TotalExp());
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"hunger") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Skill(prhash(u8"Hungry"))); // FIXME: Convert
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"thirst") {
-          val = u8"";
-          if (obj)
-            val = itos(obj->Skill(prhash(u8"Thirsty"))); // FIXME: Convert
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"drunk") {
-          val = u8"";
-          if (obj)
-            val = u8"0"; // FIXME: Query Drunkenness Here
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"class") {
-          val = u8"";
-          if (obj) {
-            if (obj->HasSkill(prhash(u8"Spellcasting")) || obj->HasSkill(prhash(u8"Spellcraft"))) {
-              val = u8"magic user";
-            } else if (
-                obj->HasSkill(prhash(u8"Perception")) || obj->HasSkill(prhash(u8"Stealth"))) {
-              val = u8"thief";
-            } else if (obj->HasSkill(prhash(u8"Faith"))) {
-              val = u8"priest";
-            } else {
-              val = u8"warrior";
-            }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"questpoints") {
+        val = u8"";
+        if (obj)
+          val = u8"0";
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"exp") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->TotalExp());
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"hunger") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Skill(prhash(u8"Hungry"))); // FIXME: Convert
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"thirst") {
+        val = u8"";
+        if (obj)
+          val = itos(obj->Skill(prhash(u8"Thirsty"))); // FIXME: Convert
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"drunk") {
+        val = u8"";
+        if (obj)
+          val = u8"0"; // FIXME: Query Drunkenness Here
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"class") {
+        val = u8"";
+        if (obj) {
+          if (obj->HasSkill(prhash(u8"Spellcasting")) || obj->HasSkill(prhash(u8"Spellcraft"))) {
+            val = u8"magic user";
+          } else if (
+              obj->HasSkill(prhash(u8"Perception")) || obj->HasSkill(prhash(u8"Stealth"))) {
+            val = u8"thief";
+          } else if (obj->HasSkill(prhash(u8"Faith"))) {
+            val = u8"priest";
+          } else {
+            val = u8"warrior";
           }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"canbeseen") {
-          val = u8"";
-          if (obj)
-            val =
-                bstr[!(obj->HasSkill(prhash(u8"Invisible")) || obj->HasSkill(prhash(u8"Hidden")))];
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"affect") {
-          val = u8""; // FIXME: Translate & List Spell Effects?
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"fighting") {
-          if (obj)
-            obj = obj->ActTarg(act_t::FIGHT);
-        } else if (field == u8"worn_by") {
-          if (obj) {
-            Object* owner = obj->Owner();
-            if (owner && owner->Wearing(obj))
-              obj = owner;
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"canbeseen") {
+        val = u8"";
+        if (obj)
+          val =
+              bstr[!(obj->HasSkill(prhash(u8"Invisible")) || obj->HasSkill(prhash(u8"Hidden")))];
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"affect") {
+        val = u8""; // FIXME: Translate & List Spell Effects?
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"fighting") {
+        if (obj)
+          obj = obj->ActTarg(act_t::FIGHT);
+      } else if (field == u8"worn_by") {
+        if (obj) {
+          Object* owner = obj->Owner();
+          if (owner && owner->Wearing(obj))
+            obj = owner;
+          else
+            obj = nullptr;
+        } else
+          obj = nullptr;
+      } else if (field == u8"room") {
+        while (obj && obj->Skill(prhash(u8"TBARoom")) == 0)
+          obj = obj->Parent();
+      } else if (field == u8"people") {
+        if (obj)
+          obj = obj->PickObject(u8"someone", LOC_INTERNAL);
+      } else if (field == u8"contents") {
+        if (obj)
+          obj = obj->PickObject(u8"something", LOC_INTERNAL);
+      } else if (field == u8"inventory") {
+        if (obj)
+          obj = obj->PickObject(u8"something", LOC_INTERNAL | LOC_NOTWORN);
+      } else if ((field == u8"eq(*)") || (field == u8"eq")) {
+        if (obj)
+          obj = obj->PickObject(u8"something", LOC_INTERNAL | LOC_NOTUNWORN);
+      } else if (
+          (field == u8"eq(light)") || (field == u8"eq(hold)") || (field == u8"eq(0)") ||
+          (field == u8"eq(17)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::HOLD);
+      } else if ((field == u8"eq(wield)") || (field == u8"eq(16)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WIELD);
+      } else if ((field == u8"eq(rfinger)") || (field == u8"eq(1)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_RFINGER);
+      } else if ((field == u8"eq(lfinger)") || (field == u8"eq(2)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LFINGER);
+      } else if ((field == u8"eq(neck1)") || (field == u8"eq(3)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_NECK);
+      } else if ((field == u8"eq(neck2)") || (field == u8"eq(4)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_COLLAR);
+      } else if ((field == u8"eq(body)") || (field == u8"eq(5)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_CHEST);
+      } else if ((field == u8"eq(head)") || (field == u8"eq(6)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_HEAD);
+      } else if ((field == u8"eq(legs)") || (field == u8"eq(7)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LLEG);
+      } else if ((field == u8"eq(feet)") || (field == u8"eq(8)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LFOOT);
+      } else if ((field == u8"eq(hands)") || (field == u8"eq(9)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LHAND);
+      } else if ((field == u8"eq(arms)") || (field == u8"eq(10)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LARM);
+      } else if ((field == u8"eq(shield)") || (field == u8"eq(11)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_SHIELD);
+      } else if ((field == u8"eq(about)") || (field == u8"eq(12)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LSHOULDER);
+      } else if ((field == u8"eq(waits)") || (field == u8"eq(13)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_WAIST);
+      } else if ((field == u8"eq(rwrist)") || (field == u8"eq(14)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_RWRIST);
+      } else if ((field == u8"eq(lwrist)") || (field == u8"eq(15)")) {
+        if (obj)
+          obj = obj->ActTarg(act_t::WEAR_LWRIST);
+      } else if (field == u8"carried_by") {
+        if (obj)
+          obj = obj->Owner();
+      } else if (field == u8"next_in_list") {
+        if (obj) {
+          Object* par = obj->Owner();
+          if (!par)
+            par = obj->Parent();
+          if (par) {
+            auto stf = par->PickObjects(u8"everything", LOC_INTERNAL);
+            auto item = stf.begin();
+            while (item != stf.end() && (*item) != obj)
+              ++item;
+            if (item != stf.end())
+              ++item;
+            if (item != stf.end())
+              obj = (*item);
             else
               obj = nullptr;
           } else
             obj = nullptr;
-        } else if (field == u8"room") {
-          while (obj && obj->Skill(prhash(u8"TBARoom")) == 0)
-            obj = obj->Parent();
-        } else if (field == u8"people") {
-          if (obj)
-            obj = obj->PickObject(u8"someone", LOC_INTERNAL);
-        } else if (field == u8"contents") {
-          if (obj)
-            obj = obj->PickObject(u8"something", LOC_INTERNAL);
-        } else if (field == u8"inventory") {
-          if (obj)
-            obj = obj->PickObject(u8"something", LOC_INTERNAL | LOC_NOTWORN);
-        } else if ((field == u8"eq(*)") || (field == u8"eq")) {
-          if (obj)
-            obj = obj->PickObject(u8"something", LOC_INTERNAL | LOC_NOTUNWORN);
-        } else if (
-            (field == u8"eq(light)") || (field == u8"eq(hold)") || (field == u8"eq(0)") ||
-            (field == u8"eq(17)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::HOLD);
-        } else if ((field == u8"eq(wield)") || (field == u8"eq(16)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WIELD);
-        } else if ((field == u8"eq(rfinger)") || (field == u8"eq(1)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_RFINGER);
-        } else if ((field == u8"eq(lfinger)") || (field == u8"eq(2)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LFINGER);
-        } else if ((field == u8"eq(neck1)") || (field == u8"eq(3)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_NECK);
-        } else if ((field == u8"eq(neck2)") || (field == u8"eq(4)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_COLLAR);
-        } else if ((field == u8"eq(body)") || (field == u8"eq(5)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_CHEST);
-        } else if ((field == u8"eq(head)") || (field == u8"eq(6)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_HEAD);
-        } else if ((field == u8"eq(legs)") || (field == u8"eq(7)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LLEG);
-        } else if ((field == u8"eq(feet)") || (field == u8"eq(8)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LFOOT);
-        } else if ((field == u8"eq(hands)") || (field == u8"eq(9)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LHAND);
-        } else if ((field == u8"eq(arms)") || (field == u8"eq(10)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LARM);
-        } else if ((field == u8"eq(shield)") || (field == u8"eq(11)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_SHIELD);
-        } else if ((field == u8"eq(about)") || (field == u8"eq(12)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LSHOULDER);
-        } else if ((field == u8"eq(waits)") || (field == u8"eq(13)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_WAIST);
-        } else if ((field == u8"eq(rwrist)") || (field == u8"eq(14)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_RWRIST);
-        } else if ((field == u8"eq(lwrist)") || (field == u8"eq(15)")) {
-          if (obj)
-            obj = obj->ActTarg(act_t::WEAR_LWRIST);
-        } else if (field == u8"carried_by") {
-          if (obj)
-            obj = obj->Owner();
-        } else if (field == u8"next_in_list") {
-          if (obj) {
-            Object* par = obj->Owner();
-            if (!par)
-              par = obj->Parent();
-            if (par) {
-              auto stf = par->PickObjects(u8"everything", LOC_INTERNAL);
-              auto item = stf.begin();
-              while (item != stf.end() && (*item) != obj)
-                ++item;
-              if (item != stf.end())
-                ++item;
-              if (item != stf.end())
-                obj = (*item);
-              else
-                obj = nullptr;
-            } else
-              obj = nullptr;
-          }
-        } else if (field == u8"next_in_room") {
-          if (obj) {
-            Object* room = obj->Parent();
-            while (room && room->Skill(prhash(u8"TBARoom")) == 0)
-              room = room->Parent();
-            if (room) {
-              auto stf = room->PickObjects(u8"everyone", LOC_INTERNAL);
-              auto item = stf.begin();
-              while (item != stf.end() && (*item) != obj)
-                ++item;
-              if (item != stf.end())
-                ++item;
-              if (item != stf.end())
-                obj = (*item);
-              else
-                obj = nullptr;
-            } else
-              obj = nullptr;
-          }
-        } else if (field == u8"master") {
-          if (obj)
-            obj = obj->ActTarg(act_t::FOLLOW); // FIXME: More Kinds?
-        } else if (field == u8"follower") {
-          if (obj) {
-            auto touch = obj->Touching();
-            bool found = false;
-            for (auto tent : touch) {
-              if (tent->ActTarg(act_t::FOLLOW) == obj) {
-                obj = tent;
-                found = true;
-                break;
-              }
-            }
-            if (!found) {
+        }
+      } else if (field == u8"next_in_room") {
+        if (obj) {
+          Object* room = obj->Parent();
+          while (room && room->Skill(prhash(u8"TBARoom")) == 0)
+            room = room->Parent();
+          if (room) {
+            auto stf = room->PickObjects(u8"everyone", LOC_INTERNAL);
+            auto item = stf.begin();
+            while (item != stf.end() && (*item) != obj)
+              ++item;
+            if (item != stf.end())
+              ++item;
+            if (item != stf.end())
+              obj = (*item);
+            else
               obj = nullptr;
-            }
           } else
             obj = nullptr;
-        } else if (field.starts_with(u8"skill(")) {
-          val = u8"";
-          if (obj) {
-            size_t num = field.find_first_of(u8") .%", 6);
-            auto skl = get_skill(field.substr(6, num - 6));
-            val = itos(obj->Skill(skl));
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field.starts_with(u8"varexists(")) {
-          val = u8"";
-          if (obj) {
-            size_t num = field.find_first_of(u8") .%", 10);
-            std::u8string_view var = field.substr(10, num - 10); // FIXME: Variables!
-            val = bstr[obj->HasSkill(crc32c(fmt::format(u8"TBA:{}", var)))];
-          }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (process(field, u8"has_item(")) {
-          int vnum = getnum(field);
-          val = u8"";
-          if (obj && vnum != 0 && field[0] == ')') {
-            vnum += 1000000;
-            auto pos = obj->PickObjects(u8"all", LOC_INTERNAL);
-            for (auto item : pos) {
-              if (vnum == item->Skill(prhash(u8"TBAObject"))) {
-                val = u8"1";
-                break;
-              }
+        }
+      } else if (field == u8"master") {
+        if (obj)
+          obj = obj->ActTarg(act_t::FOLLOW); // FIXME: More Kinds?
+      } else if (field == u8"follower") {
+        if (obj) {
+          auto touch = obj->Touching();
+          bool found = false;
+          for (auto tent : touch) {
+            if (tent->ActTarg(act_t::FOLLOW) == obj) {
+              obj = tent;
+              found = true;
+              break;
             }
           }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (!!field.starts_with(u8"affect(")) {
-          size_t len = field.find_first_not_of(u8"abcdefghijklmnopqrstuvwxyz-", 7);
-          auto spell = tba_spellconvert(field.substr(7, len - 7));
-          // logeb(
-          //    CBLU u8"Interpreting '{}' as 'spell = {}'\n",
-          //    field,
-          //    spell);
-          val = u8"";
-          if (obj) {
-            val = itos(obj->Power(crc32c(spell)));
+          if (!found) {
+            obj = nullptr;
           }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field.starts_with(u8"vnum(")) {
-          val = u8"0"; // Default - in case it doesn't have a vnum
-          if (obj) {
-            int vnum = obj->Skill(prhash(u8"TBAMOB"));
-            if (vnum < 1)
-              vnum = obj->Skill(prhash(u8"TBAObject"));
-            if (vnum < 1)
-              vnum = obj->Skill(prhash(u8"TBARoom"));
-            if (vnum > 0) {
-              vnum %= 1000000; // Convert from Acid number
-              int off = field.find_first_of(u8")", 5);
-              std::u8string_view query = field.substr(5, off - 5);
-              int qnum = TBAEval(std::u8string(query));
-              val = bstr[(vnum == qnum)];
+        } else
+          obj = nullptr;
+      } else if (field.starts_with(u8"skill(")) {
+        val = u8"";
+        if (obj) {
+          size_t num = field.find_first_of(u8") .%", 6);
+          auto skl = get_skill(field.substr(6, num - 6));
+          val = itos(obj->Skill(skl));
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field.starts_with(u8"varexists(")) {
+        val = u8"";
+        if (obj) {
+          size_t num = field.find_first_of(u8") .%", 10);
+          std::u8string_view var = field.substr(10, num - 10); // FIXME: Variables!
+          val = bstr[obj->HasSkill(crc32c(fmt::format(u8"TBA:{}", var)))];
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (process(field, u8"has_item(")) {
+        int vnum = getnum(field);
+        val = u8"";
+        if (obj && vnum != 0 && field[0] == ')') {
+          vnum += 1000000;
+          auto pos = obj->PickObjects(u8"all", LOC_INTERNAL);
+          for (auto item : pos) {
+            if (vnum == item->Skill(prhash(u8"TBAObject"))) {
+              val = u8"1";
+              break;
             }
           }
-          obj = nullptr;
-          is_obj = 0;
-        } else if (field == u8"pos(sleeping)") {
-          if (obj) {
-            obj->SetPosition(pos_t::LIE);
-            obj->StopAct(act_t::REST);
-            obj->AddAct(act_t::SLEEP);
-          }
-          obj = nullptr;
-          val = u8"";
-          is_obj = 0;
-        } else if (field == u8"pos(resting)") {
-          if (obj) {
-            obj->StopAct(act_t::SLEEP);
-            obj->SetPosition(pos_t::SIT);
-            obj->AddAct(act_t::REST);
-          }
-          obj = nullptr;
-          val = u8"";
-          is_obj = 0;
-        } else if (field == u8"pos(sitting)") {
-          if (obj) {
-            obj->StopAct(act_t::SLEEP);
-            obj->StopAct(act_t::REST);
-            obj->SetPosition(pos_t::SIT);
-          }
-          obj = nullptr;
-          val = u8"";
-          is_obj = 0;
-        } else if (field == u8"pos(fighting)") {
-          if (obj) {
-            obj->StopAct(act_t::SLEEP);
-            obj->StopAct(act_t::REST);
-            obj->SetPosition(pos_t::STAND);
-          }
-          obj = nullptr;
-          val = u8"";
-          is_obj = 0;
-        } else if (field == u8"pos(standing)") {
-          if (obj) {
-            obj->StopAct(act_t::SLEEP);
-            obj->StopAct(act_t::REST);
-            obj->SetPosition(pos_t::STAND);
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (!!field.starts_with(u8"affect(")) {
+        size_t len = field.find_first_not_of(u8"abcdefghijklmnopqrstuvwxyz-", 7);
+        auto spell = tba_spellconvert(field.substr(7, len - 7));
+        // logeb(
+        //    CBLU u8"Interpreting '{}' as 'spell = {}'\n",
+        //    field,
+        //    spell);
+        val = u8"";
+        if (obj) {
+          val = itos(obj->Power(crc32c(spell)));
+        }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field.starts_with(u8"vnum(")) {
+        val = u8"0"; // Default - in case it doesn't have a vnum
+        if (obj) {
+          int vnum = obj->Skill(prhash(u8"TBAMOB"));
+          if (vnum < 1)
+            vnum = obj->Skill(prhash(u8"TBAObject"));
+          if (vnum < 1)
+            vnum = obj->Skill(prhash(u8"TBARoom"));
+          if (vnum > 0) {
+            vnum %= 1000000; // Convert from Acid number
+            int off = field.find_first_of(u8")", 5);
+            std::u8string_view query = field.substr(5, off - 5);
+            int qnum = tba_eval(std::u8string(query));
+            val = bstr[(vnum == qnum)];
           }
-          obj = nullptr;
-          val = u8"";
-          is_obj = 0;
-          // Is no general fighting state, must fight someone!
-        } else {
-          loger(
-              u8"#{} Error: Bad sub-obj '{}' in '{}'\n",
-              body->Skill(prhash(u8"TBAScript")),
-              field,
-              line);
-          return false;
         }
+        obj = nullptr;
+        is_obj = 0;
+      } else if (field == u8"pos(sleeping)") {
+        if (obj) {
+          obj->SetPosition(pos_t::LIE);
+          obj->StopAct(act_t::REST);
+          obj->AddAct(act_t::SLEEP);
+        }
+        obj = nullptr;
+        val = u8"";
+        is_obj = 0;
+      } else if (field == u8"pos(resting)") {
+        if (obj) {
+          obj->StopAct(act_t::SLEEP);
+          obj->SetPosition(pos_t::SIT);
+          obj->AddAct(act_t::REST);
+        }
+        obj = nullptr;
+        val = u8"";
+        is_obj = 0;
+      } else if (field == u8"pos(sitting)") {
+        if (obj) {
+          obj->StopAct(act_t::SLEEP);
+          obj->StopAct(act_t::REST);
+          obj->SetPosition(pos_t::SIT);
+        }
+        obj = nullptr;
+        val = u8"";
+        is_obj = 0;
+      } else if (field == u8"pos(fighting)") {
+        if (obj) {
+          obj->StopAct(act_t::SLEEP);
+          obj->StopAct(act_t::REST);
+          obj->SetPosition(pos_t::STAND);
+        }
+        obj = nullptr;
+        val = u8"";
+        is_obj = 0;
+      } else if (field == u8"pos(standing)") {
+        if (obj) {
+          obj->StopAct(act_t::SLEEP);
+          obj->StopAct(act_t::REST);
+          obj->SetPosition(pos_t::STAND);
+        }
+        obj = nullptr;
+        val = u8"";
+        is_obj = 0;
+        // Is no general fighting state, must fight someone!
       } else {
-        if (field == u8"mudcommand") {
-          // val is already right
-        } else if (field == u8"car") {
-          size_t apos = val.find_first_of(u8" \t\n\r");
-          if (apos != std::u8string::npos) {
-            val = val.substr(0, apos);
-          }
-        } else if (field == u8"cdr") {
-          size_t apos = val.find_first_of(u8" \t\n\r");
-          if (apos != std::u8string::npos) {
-            apos = val.find_first_not_of(u8" \t\n\r", apos);
-            if (apos != std::u8string::npos)
-              val = val.substr(apos);
-            else
-              val = u8"";
-          } else
-            val = u8"";
-        } else if (field == u8"trim") {
-          trim_string(val);
-        } else {
-          loger(
-              u8"#{} Error: Bad sub-str '{}' in '{}'\n",
-              body->Skill(prhash(u8"TBAScript")),
-              field,
-              line);
-          return false;
+        loger(
+            u8"#{} Error: Bad sub-obj '{}' in '{}'\n",
+            body->Skill(prhash(u8"TBAScript")),
+            field,
+            line);
+        return false;
+      }
+    } else {
+      if (field == u8"mudcommand") {
+        // val is already right
+      } else if (field == u8"car") {
+        size_t apos = val.find_first_of(u8" \t\n\r");
+        if (apos != std::u8string::npos) {
+          val = val.substr(0, apos);
         }
+      } else if (field == u8"cdr") {
+        size_t apos = val.find_first_of(u8" \t\n\r");
+        if (apos != std::u8string::npos) {
+          apos = val.find_first_not_of(u8" \t\n\r", apos);
+          if (apos != std::u8string::npos)
+            val = val.substr(apos);
+          else
+            val = u8"";
+        } else
+          val = u8"";
+      } else if (field == u8"trim") {
+        trim_string(val);
+      } else {
+        loger(
+            u8"#{} Error: Bad sub-str '{}' in '{}'\n",
+            body->Skill(prhash(u8"TBAScript")),
+            field,
+            line);
+        return false;
       }
     }
-    if (end == std::u8string::npos)
-      end = line.length();
-    else if (line[end] == '%')
-      ++end;
-    if (is_obj) {
-      edit.replace(cur, end - cur, fmt::format(u8"obj:{}", reinterpret_cast<void*>(obj)));
-    } else { // std::u8string OR u8""
-      edit.replace(cur, end - cur, val);
-    }
-    line = edit;
-    cur = line.find('%', cur + 1);
-  }
-  if (0
-      //	|| body->Skill(prhash(u8"TBAScript")) == 5000099
-      //	|| line.contains(u8"eval loc ")
-      //	|| line.contains(u8"set first ")
-      //	|| line.contains(u8"exclaim")
-      //	|| line.contains(u8"speech")
-  ) {
-    logeg(u8"#{} Debug: '{}' <-Final", body->Skill(prhash(u8"TBAScript")), edit);
+  }
+  if (end == std::u8string::npos)
+    end = line.length();
+  else if (line[end] == '%')
+    ++end;
+  if (is_obj) {
+    val = fmt::format(u8"obj:{}", reinterpret_cast<void*>(obj));
   }
   return true;
 }
@@ -2730,54 +3653,54 @@ void Mind::SetTBATrigger(
     return;
 
   type = mind_t::TBATRIG;
-  if (cvars.size() < 1) {
-    cvars[u8"damage"] = u8"wdamage";
-    cvars[u8"echo"] = u8"mecho";
-    cvars[u8"send"] = u8"send";
-    cvars[u8"force"] = u8"force";
-    cvars[u8"echoaround"] = u8"echoaround";
-    cvars[u8"teleport"] = u8"transport";
-    cvars[u8"zoneecho"] = u8"zoneecho";
-    cvars[u8"asound"] = u8"asound";
-    cvars[u8"door"] = u8"door";
-    cvars[u8"load"] = u8"load";
-    cvars[u8"purge"] = u8"purge";
-    cvars[u8"at"] = u8"at";
-    cvars[u8""] = u8"%";
-  }
-  svars = cvars;
+  status = 0;
+  auto& prog = trigger_programs[tr];
+  if (!prog) {
+    int vnum = tr->Skill(prhash(u8"TBAScript"));
+    auto& shared = tba_programs[vnum];
+    prog = shared.lock();
+    if (!prog || !prog->Runs(tr->LongDesc())) {
+      prog = std::make_shared<tba_program>(vnum, tr->LongDesc());
+      shared = prog;
+    }
+  }
+  if (!tba) {
+    tba = std::make_unique<tba_state>();
+  }
+  tba->Reset(prog); // Even a recycled trigger mind starts over
   pers = fileno(stderr);
-  spos_s.clear();
-  spos_s.push_back(0);
-  svars[u8"script"] = fmt::format(u8"{}\n", tr->LongDesc());
+  tba->spos_s.push_back(0);
+  if (tba_profiling) {
+    ++tba_profiles[tr->Skill(prhash(u8"TBAScript"))].fires;
+  }
 
   if (tripper)
-    ovars[u8"actor"] = tripper;
+    tba->SetObj(TBA_ACTOR, tripper);
 
   int stype = tr->Skill(prhash(u8"TBAScriptType"));
   if ((stype & 0x2000008) == 0x0000008) { //-SPEECH MOB/ROOM Triggers
-    svars[u8"speech"] = text;
+    tba->SetStr(TBA_SPEECH, text);
   }
   if ((stype & 0x4000040) == 0x4000040 // ROOM-ENTER Triggers
       || (stype & 0x1000040) == 0x1000040 // MOB-GREET Triggers
       || stype & 0x0010000) { //*-LEAVE Triggers
-    svars[u8"direction"] = text;
+    tba->SetStr(TBA_DIRECTION, text);
   }
   if ((stype & 0x4000080) == 0x4000080) { // ROOM-DROP Triggers
-    ovars[u8"object"] = targ;
+    tba->SetObj(TBA_OBJECT, targ);
   }
   if ((stype & 0x1000200) == 0x1000200) { // MOB-RECEIVE Triggers
-    ovars[u8"object"] = targ;
+    tba->SetObj(TBA_OBJECT, targ);
   }
   if (stype & 0x0000004) { //-COMMAND Triggers
     size_t part = text.find_first_of(u8" \t\n\r");
     if (part == std::u8string::npos)
-      svars[u8"cmd"] = text;
+      tba->SetStr(TBA_CMD, text);
     else {
-      svars[u8"cmd"] = text.substr(0, part);
+      tba->SetStr(TBA_CMD, text.substr(0, part));
       part = text.find_first_not_of(u8" \t\n\r", part);
       if (part != std::u8string::npos)
-        svars[u8"arg"] = text.substr(part);
+        tba->SetStr(TBA_ARG, text.substr(part));
     }
   }
 }
@@ -2792,9 +3715,27 @@ std::shared_ptr<Mind> get_tbamob_mind() {
   return tbamob_mind;
 }
 
+// Finished trigger minds, with their script state, ready to run the next trigger that fires.
+static std::vector<std::shared_ptr<Mind>> trigger_pool;
+static constexpr size_t TRIGGER_POOL_MAX = 1024;
+
+void recycle_mind(std::shared_ptr<Mind> m) {
+  // Only if nothing else can still see it: not a body, a wait, or anyone else holding it.
+  if (m && m->Type() == mind_t::TBATRIG && m->Body() == nullptr && m.use_count() == 1 &&
+      trigger_pool.size() < TRIGGER_POOL_MAX) {
+    trigger_pool.emplace_back(std::move(m));
+  }
+}
+
 std::shared_ptr<Mind>
 new_mind(mind_t tp, Object* obj, Object* obj2, Object* obj3, const std::u8string_view& text) {
-  std::shared_ptr<Mind> m = std::make_shared<Mind>(tp);
+  std::shared_ptr<Mind> m;
+  if (tp == mind_t::TBATRIG && obj && !trigger_pool.empty()) {
+    m = std::move(trigger_pool.back());
+    trigger_pool.pop_back();
+  } else {
+    m = std::make_shared<Mind>(tp);
+  }
   if (tp == mind_t::TBATRIG && obj) {
     m->SetTBATrigger(obj, obj2, obj3, text);
     obj->Attach(m);
@@ -2827,6 +3768,7 @@ int new_trigger(
       if (m->Body()) {
         m->Body()->Detach(m);
       }
+      recycle_mind(std::move(m));
     }
     in_new_trigger = false;
   } else {
@@ -20,10 +20,14 @@
 // *************************************************************************
 
 #include <algorithm>
+#include <array>
+#include <deque>
 #include <filesystem>
 #include <limits>
 #include <queue>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "color.hpp"
@@ -73,7 +77,11 @@ static_assert(std::size(act_str) == std::to_underlying(act_t::MAX));
 static Object* universe = nullptr;
 static Object* trash_bin = nullptr;
 
-static std::set<Object*> busylist;
+struct busy_state {
+  std::u8string dowhenfree;
+  std::u8string defact;
+};
+static std::map<Object*, busy_state> busylist;
 
 Object* Object::Universe() {
   return universe;
@@ -83,7 +91,562 @@ Object* Object::TrashBin() {
   return trash_bin;
 }
 
+// Recycled objects wait in the trash bin for at least one full tick, then
+// are freed in batches, once nothing else is still using them.  The bin also
+// holds objects which never die (like coin prototypes), so only those that
+// were actually recycled into it are tracked here.
+struct trash_entry {
+  uint64_t seq;
+  uint64_t tick;
+  Object* obj;
+};
+static std::deque<trash_entry> trash_queue;
+static std::unordered_map<Object*, uint64_t> trash_pending; // Newest seq for each
+static uint64_t trash_seq = 0;
+static uint64_t trash_tick = 0;
+
+size_t Object::TrashPending() {
+  return trash_pending.size();
+}
+
+size_t Object::ReclaimTrash(size_t max) {
+  std::vector<Object*> batch;
+  std::set<const Object*> held;
+  bool held_known = false;
+  while (batch.size() < max && !trash_queue.empty()) {
+    auto entry = trash_queue.front();
+    if (entry.tick + 2 > trash_tick) {
+      break; // Everything from here on is too new
+    }
+    trash_queue.pop_front();
+
+    auto itr = trash_pending.find(entry.obj);
+    if (itr == trash_pending.end() || itr->second != entry.seq) {
+      continue; // Already gone, or re-recycled (and queued again) since.
+    }
+    Object* obj = entry.obj;
+    if (obj->parent != trash_bin) {
+      trash_pending.erase(itr); // Something pulled it back out of the trash.
+      continue;
+    }
+
+    // Suspended minds (triggers, mostly) can still refer to recycled objects.
+    if (!held_known) {
+      for (const auto& wait : Mind::waiting) {
+        held.insert(wait.second->body);
+        if (wait.second->tba) {
+          for (const auto& var : wait.second->tba->vars) {
+            if (var.has_obj) {
+              held.insert(var.obj);
+            }
+          }
+        }
+      }
+      held_known = true;
+    }
+    if (held.contains(obj) || !obj->minds.empty() || !obj->actions.empty() ||
+        !obj->contents.empty() || obj->IsActive() || busylist.contains(obj)) {
+      itr->second = ++trash_seq; // Still in use, try again later.
+      trash_queue.push_back({trash_seq, trash_tick, obj});
+      continue;
+    }
+    trash_pending.erase(itr);
+    batch.push_back(obj);
+  }
+  if (batch.empty()) {
+    return 0;
+  }
+
+  // Pull the whole batch out of the trash bin in one pass, then free them.
+  std::sort(batch.begin(), batch.end());
+  auto keep = trash_bin->contents.begin();
+  for (auto item : trash_bin->contents) {
+    if (std::binary_search(batch.begin(), batch.end(), item)) {
+      trash_bin->contained_weight -= item->weight;
+      trash_bin->contained_volume -= item->volume;
+      item->parent = nullptr;
+      item->InvalidateTriggers(trash_bin);
+    } else {
+      *keep = item;
+      ++keep;
+    }
+  }
+  trash_bin->contents.erase(keep, trash_bin->contents.end());
+  trash_bin->KeywordDrop();
+  trash_bin->InvalidateContents();
+  for (auto item : batch) {
+    delete item;
+  }
+  return batch.size();
+}
+
+// Room() results are cached per object, along with the ancestry_epoch its parent had then.
+// Moving something only bumps its own ancestry_epoch, so a cache is good while everything from
+// it up to its room has the same room cached, and none of them moved since (see Room()).
+// Moving a room, or anything above the rooms, can turn other things into rooms, or stop them
+// being rooms, so that drops every cache within it instead.  Zero is reserved as "never valid".
+void Object::InvalidateAncestry(const Object* oldp) {
+  room_epoch = 0;
+  if (contents.empty()) {
+    return; // Only I moved, so only my cache is stale.
+  }
+  auto holds_rooms = [](const Object* obj) { // Is a child of obj its own room?
+    return !obj || !obj->parent || !obj->parent->parent || !obj->parent->parent->parent;
+  };
+  if (holds_rooms(oldp) || holds_rooms(parent)) {
+    ForgetRooms();
+  } else if (++ancestry_epoch == 0) { // When it wraps, old caches could match again
+    ancestry_epoch = 1;
+    for (auto item : contents) {
+      item->room_epoch = 0;
+    }
+  }
+}
+
+void Object::ForgetRooms() {
+  room_epoch = 0;
+  for (auto item : contents) {
+    item->ForgetRooms();
+  }
+}
+
+// Rendered Noun()s, per object, for every form which doesn't depend on who is looking (beyond
+// which of the names involved they know).  Each is only good for the owner it was rendered
+// with, and while noun_epoch is unchanged, which bumps whenever anything animate is renamed.
+struct noun_memo {
+  const Object* owner = nullptr;
+  uint32_t epoch = 0;
+  std::vector<std::pair<uint8_t, std::u8string>> forms;
+};
+static std::unordered_map<const Object*, noun_memo> noun_memos;
+static uint32_t noun_epoch = 1;
+static uint64_t noun_hits = 0;
+static uint64_t noun_misses = 0;
+
+// The light from everything within each object (in thousandths, as LightLevel() adds it up),
+// kept only for objects with something in them, and only when everything in there really is
+// in there (not player rooms, etc.), so any change to it will pass through here going up.
+static std::unordered_map<const Object*, int> light_memos;
+static uint64_t light_hits = 0;
+static uint64_t light_misses = 0;
+static uint64_t light_invalidations = 0;
+
+// What each object has in it that can be seen normally [0], or by heat or touch [1], built on
+// demand, and dropped whenever something enters or leaves, or anything in it turns invisible.
+struct sight_memo {
+  uint8_t known = 0;
+  DArr64<Object*, 3> seen[2];
+};
+static std::unordered_map<const Object*, sight_memo> sight_memos;
+static uint64_t sight_hits = 0;
+static uint64_t sight_misses = 0;
+static uint64_t sight_invalidations = 0;
+static uint64_t sight_since = 0; // trash_tick at the last report
+
+// Speech and act triggers of an indexed room, with all of their phrases and words compiled into
+// one Aho-Corasick automaton, so a single pass over a message finds every one it would set off.
+struct speech_matcher {
+  struct entry {
+    Object* script;
+    bool act; // MOB-ACT
+    bool speech; // MOB-SPEECH or ROOM-SPEECH
+    bool all; // Desc() starts with '*', so anything at all sets it off
+    std::vector<uint32_t> patterns; // Matching any one of these sets it off
+  };
+  struct state {
+    std::vector<std::pair<char8_t, uint32_t>> next;
+    uint32_t fail = 0;
+    uint32_t dict = 0; // Longest proper suffix state which ends a pattern, 0 if none
+    std::vector<uint32_t> ends; // Patterns ending here
+  };
+  std::vector<entry> entries;
+  std::vector<state> states = {state()};
+  std::vector<uint32_t> lengths; // Of each pattern
+
+  // The last message matched, as the same one is sent out to everyone in the room in turn.
+  std::u8string last;
+  bool last_speech = false;
+  bool last_valid = false;
+  std::vector<Object*> fired;
+
+  uint32_t Step(uint32_t st, char8_t chr) const {
+    for (const auto& tr : states[st].next) {
+      if (tr.first == chr) {
+        return tr.second;
+      }
+    }
+    return 0;
+  }
+  uint32_t AddPattern(std::u8string_view pat) {
+    uint32_t st = 0;
+    for (auto chr : pat) {
+      uint32_t nst = Step(st, chr);
+      if (nst == 0) {
+        nst = states.size();
+        states[st].next.emplace_back(chr, nst);
+        states.emplace_back();
+      }
+      st = nst;
+    }
+    if (states[st].ends.empty()) {
+      states[st].ends.push_back(lengths.size());
+      lengths.push_back(pat.length());
+    }
+    return states[st].ends.front();
+  }
+  void Link() {
+    std::vector<uint32_t> queue;
+    for (const auto& tr : states[0].next) {
+      queue.push_back(tr.second);
+    }
+    for (size_t qpos = 0; qpos < queue.size(); ++qpos) {
+      const uint32_t par = queue[qpos];
+      for (const auto& tr : states[par].next) {
+        queue.push_back(tr.second);
+        uint32_t fst = states[par].fail;
+        while (fst != 0 && Step(fst, tr.first) == 0) {
+          fst = states[fst].fail;
+        }
+        fst = Step(fst, tr.first);
+        states[tr.second].fail = fst;
+        states[tr.second].dict = (states[fst].ends.empty()) ? states[fst].dict : fst;
+      }
+    }
+  }
+  void Build(const std::vector<Object*>& scripts) {
+    for (auto script : scripts) {
+      const uint32_t type = script->Skill(prhash(u8"TBAScriptType"));
+      entry ent = {
+          script,
+          (type & 0x1000010) == 0x1000010,
+          (type & 0x1000008) == 0x1000008 || (type & 0x4000008) == 0x4000008,
+          script->Desc().starts_with('*'),
+          {}};
+      if (!ent.act && !ent.speech) {
+        continue;
+      }
+      const auto words = script->Desc();
+      if (ent.all) {
+      } else if (script->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
+        if (!words.empty()) {
+          ent.patterns.push_back(AddPattern(words));
+        }
+      } else { // Match Words, split exactly as words_match() does
+        auto start = std::ranges::find_if(words, ascii_isalpha);
+        while (start != words.end()) {
+          auto end = std::find_if_not(start, words.end(), ascii_isalnum);
+          ent.patterns.push_back(AddPattern(words.substr(start - words.begin(), end - start)));
+          start = std::find_if(end, words.end(), ascii_isalpha);
+        }
+      }
+      entries.emplace_back(std::move(ent));
+    }
+    Link();
+  }
+
+  // Same answers as phrase_match(text, pattern) for every pattern at once.
+  const std::vector<Object*>& Match(std::u8string_view text, bool speech) {
+    if (last_valid && last_speech == speech && last == text) {
+      return fired;
+    }
+    std::vector<bool> hit(lengths.size(), false);
+    uint32_t st = 0;
+    for (size_t pos = 0; pos < text.length(); ++pos) {
+      const char8_t chr = ascii_tolower(text[pos]);
+      while (st != 0 && Step(st, chr) == 0) {
+        st = states[st].fail;
+      }
+      st = Step(st, chr);
+      if (pos + 1 < text.length() && ascii_isalnum(text[pos + 1])) {
+        continue; // Nothing can end mid-word
+      }
+      for (uint32_t out = (states[st].ends.empty()) ? states[st].dict : st; out != 0;
+           out = states[out].dict) {
+        for (auto pat : states[out].ends) {
+          const size_t beg = pos + 1 - lengths[pat];
+          if (beg == 0 || (ascii_isalnum(text[beg]) && !ascii_isalnum(text[beg - 1]))) {
+            hit[pat] = true;
+          }
+        }
+      }
+    }
+    fired.clear();
+    for (const auto& ent : entries) {
+      if ((speech) ? ent.speech : ent.act) {
+        if (ent.all || std::ranges::any_of(ent.patterns, [&hit](auto pat) { return hit[pat]; })) {
+          fired.push_back(ent.script);
+        }
+      }
+    }
+    last = text;
+    last_speech = speech;
+    last_valid = true;
+    return fired;
+  }
+};
+
+// Each room's TBA trigger scripts, anywhere within it, so rooms without any triggers of a
+// type can skip looking for them.  Built on demand, and dropped whenever something holding
+// a trigger script enters or leaves the room, or a trigger script within changes its type.
+struct trigger_index {
+  uint32_t types = 0; // All of their TBAScriptTypes, or'd together
+  std::vector<Object*> scripts;
+  std::unique_ptr<speech_matcher> speech; // Built the first time anything is said here
+};
+static std::unordered_map<const Object*, trigger_index> room_triggers;
+
+uint32_t Object::CollectTriggers(std::vector<Object*>* scripts) const {
+  uint32_t types = Skill(prhash(u8"TBAScriptType"));
+  if (types && scripts) {
+    scripts->push_back(const_cast<Object*>(this));
+  }
+  for (auto item : contents) {
+    if (!item->HasSkill(prhash(u8"TBAZoneLifespan"))) { // Zone resetters' templates never fire
+      types |= item->CollectTriggers(scripts);
+    }
+  }
+  return types;
+}
+
+// Returns all bits set for anything but a closed room, as only those are indexed.
+uint32_t Object::TriggerTypesWithin() const {
+  if (!parent || !parent->parent || !parent->parent->parent || Room() != this ||
+      Skill(prhash(u8"Open")) || Skill(prhash(u8"Transparent"))) {
+    return ~0U; // Searches from within here could reach things outside of here.
+  }
+  auto index = room_triggers.find(this);
+  if (index == room_triggers.end()) {
+    index = room_triggers.emplace(this, trigger_index()).first;
+    index->second.types = CollectTriggers(&index->second.scripts);
+  }
+  return index->second.types;
+}
+
+// Speech (or act) triggers in this indexed room which text sets off, in index order.
+const std::vector<Object*>& Object::TriggersSetOff(std::u8string_view text, bool speech) const {
+  auto& index = room_triggers.at(this);
+  if (!index.speech) {
+    index.speech = std::make_unique<speech_matcher>();
+    index.speech->Build(index.scripts);
+  }
+  return index.speech->Match(text, speech);
+}
+
+// My parent was oldp, if I brought trigger scripts along, the rooms involved need reindexing.
+void Object::InvalidateTriggers(const Object* oldp) {
+  if (room_triggers.empty()) {
+    return;
+  }
+  room_triggers.erase(this); // In case I was a room, and won't be (or will be elsewhere)
+  const Object* from = (oldp) ? oldp->Room() : nullptr;
+  const Object* to = (parent) ? parent->Room() : nullptr;
+  if (from == to || (!room_triggers.contains(from) && !room_triggers.contains(to))) {
+    return;
+  }
+  if (CollectTriggers(nullptr) != 0) {
+    room_triggers.erase(from);
+    room_triggers.erase(to);
+  }
+}
+
+// My own TBAScriptType (or what I listen for) changed, so my room needs reindexing.
+void Object::InvalidateTriggerType() {
+  if (!room_triggers.empty() && parent) {
+    room_triggers.erase(parent->Room());
+  }
+}
+
+// Each zone's rooms, numbered, with where each of their six exits lead, so searches across
+// them don't need to pick out doors by name at every step.  All of these are rebuilt on
+// demand once exits_epoch changes, which bumps whenever a door is linked, unlinked or moved,
+// or when a whole room is.  The state of each door is not kept, it's checked when needed.
+static constexpr uint32_t NO_ROOM = std::numeric_limits<uint32_t>::max();
+struct exit_graph {
+  struct exit {
+    Object* door = nullptr; // In this room
+    Object* odoor = nullptr; // Its other side, in the room it leads to
+    uint32_t dest = NO_ROOM; // Index of the room it leads to, if that's in this zone
+    Object* way = nullptr; // The door a traveller would see here (but maybe can't use)
+    Object* way_to = nullptr; // The room it leads to
+    uint32_t way_dest = NO_ROOM; // And its index, if that's in this zone
+  };
+  uint32_t epoch = 0;
+  std::vector<Object*> rooms;
+  std::unordered_map<const Object*, uint32_t> index;
+  std::vector<std::array<exit, 6>> exits;
+  std::vector<uint32_t> stamp; // Last search to reach each room
+  std::vector<int> best; // And how well that search reached it
+};
+static std::unordered_map<const Object*, exit_graph> exit_graphs;
+static uint32_t exits_epoch = 1;
+static uint32_t exits_search = 0;
+
+static void exits_changed() {
+  if (!exit_graphs.empty()) {
+    ++exits_epoch;
+    if (exits_epoch == 0) {
+      exits_epoch = 1; // Zero is reserved as "never valid"
+    }
+  }
+}
+
+// The graph a room is part of, and its index there, or nullptr if it isn't in a zone.
+static exit_graph* exits_of(const Object* room, uint32_t& idx) {
+  const Object* zone = room->Parent();
+  if (!zone || !zone->Parent() || !zone->Parent()->Parent() || room->Room() != room) {
+    return nullptr;
+  }
+  auto& graph = exit_graphs[zone];
+  if (graph.epoch != exits_epoch) {
+    graph.epoch = exits_epoch;
+    graph.rooms.clear();
+    graph.index.clear();
+    graph.exits.clear();
+    for (auto rm : zone->Contents()) {
+      graph.index.emplace(rm, graph.rooms.size());
+      graph.rooms.push_back(rm);
+    }
+    graph.exits.resize(graph.rooms.size());
+    graph.stamp.assign(graph.rooms.size(), 0);
+    graph.best.assign(graph.rooms.size(), 0);
+    for (size_t rnum = 0; rnum < graph.rooms.size(); ++rnum) {
+      auto exit = graph.exits[rnum].begin();
+      for (std::u8string dir : {u8"north", u8"south", u8"east", u8"west", u8"up", u8"down"}) {
+        exit->door = graph.rooms[rnum]->PickObject(dir, LOC_NINJA | LOC_INTERNAL);
+        exit->odoor = (exit->door) ? exit->door->ActTarg(act_t::SPECIAL_LINKED) : nullptr;
+        if (exit->odoor && !exit->odoor->Parent()) {
+          exit->odoor = nullptr;
+        } else if (exit->odoor) {
+          auto dest = graph.index.find(exit->odoor->Parent());
+          exit->dest = (dest == graph.index.end()) ? NO_ROOM : dest->second;
+        }
+        exit->way = graph.rooms[rnum]->PickObject(dir, LOC_INTERNAL);
+        auto oway = (exit->way) ? exit->way->ActTarg(act_t::SPECIAL_LINKED) : nullptr;
+        exit->way_to = (oway) ? oway->Parent() : nullptr;
+        if (exit->way_to) {
+          auto dest = graph.index.find(exit->way_to);
+          exit->way_dest = (dest == graph.index.end()) ? NO_ROOM : dest->second;
+        }
+        ++exit;
+      }
+    }
+  }
+  auto found = graph.index.find(room);
+  if (found == graph.index.end()) {
+    return nullptr;
+  }
+  idx = found->second;
+  return &graph;
+}
+
+// If a door (or a whole room) was just moved from oldp, the exit graphs could be stale.
+void Object::InvalidateExits(const Object* oldp) {
+  if (exit_graphs.empty()) {
+    return;
+  }
+  auto zone_level = [](const Object* obj) {
+    return obj && obj != trash_bin &&
+        !(obj->parent && obj->parent->parent && obj->parent->parent->parent);
+  };
+  if (zone_level(oldp) || zone_level(parent) || IsAct(act_t::SPECIAL_LINKED)) {
+    exits_changed();
+  }
+}
+
+// Can traveller (or anyone, if nullptr) get through door, as it is now?
+static bool passable(const Object* door, const Object* traveller) {
+  return door &&
+      (door->Skill(prhash(u8"Open")) >= 1000 ||
+       (door->HasSkill(prhash(u8"Closeable")) &&
+        ((!door->HasSkill(prhash(u8"Locked"))) ||
+         (door->HasSkill(prhash(u8"Locked")) && traveller && traveller->HasKeyFor(door)))));
+}
+
+// Routes already found, by where from, where to, and which keys the traveller had, all of
+// which are good until exits_epoch changes, or some door changes who it lets through.
+static std::map<std::tuple<const Object*, const Object*, uint32_t>, std::u8string> routes;
+static uint32_t routes_epoch = 0;
+
+// Travellers with the same keys can all get through exactly the same doors, so routes are
+// found per distinct set of keys.  Each traveller's set is kept until anything within them
+// (at any depth) comes, goes, or changes as a key or container.  Once there are too many
+// sets, they are all dropped, along with the routes and travellers using them.
+static std::map<std::vector<int>, uint32_t> key_sets = {{{}, 0}};
+static std::unordered_map<const Object*, uint32_t> traveller_keys;
+static constexpr size_t key_sets_max = 4096;
+
+static uint32_t key_set(const Object* traveller) {
+  if (!traveller) {
+    return 0;
+  }
+  auto known = traveller_keys.find(traveller);
+  if (known != traveller_keys.end()) {
+    return known->second;
+  }
+  if (key_sets.size() >= key_sets_max) {
+    routes.clear();
+    key_sets = {{{}, 0}};
+    traveller_keys.clear();
+  }
+  std::vector<int> keys;
+  for (auto item : traveller->PickObjects(u8"all", LOC_INTERNAL)) {
+    keys.push_back(item->Skill(prhash(u8"Key")));
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  const uint32_t set = key_sets.emplace(std::move(keys), key_sets.size()).first->second;
+  traveller_keys[traveller] = set;
+  return set;
+}
+
+// Something within obj, or obj itself, changed, so it and everything it is in may now have
+// different keys.
+static void keys_changed(const Object* obj) {
+  for (; obj && !traveller_keys.empty(); obj = obj->Parent()) {
+    traveller_keys.erase(obj);
+  }
+}
+
+// One of my skills (stok) was set or cleared, so forget anything worked out from it.
+void Object::SkillChanged(uint32_t stok) {
+  if (stok == prhash(u8"Key") || stok == prhash(u8"Container")) {
+    keys_changed(this);
+  }
+  if (stok == prhash(u8"TBAScriptType") || stok == prhash(u8"TBAScriptNArg")) {
+    InvalidateTriggerType();
+    return;
+  }
+  if (stok == prhash(u8"Light Source") || stok == prhash(u8"Open") ||
+      stok == prhash(u8"Transparent") || stok == prhash(u8"Translucent")) {
+    InvalidateLight();
+  }
+  if (stok == prhash(u8"Invisible")) {
+    InvalidateSight();
+  }
+  if (stok == prhash(u8"Open") || stok == prhash(u8"Closeable") || stok == prhash(u8"Locked") ||
+      stok == prhash(u8"Lock") || stok == prhash(u8"Invisible") || stok == prhash(u8"Hidden")) {
+    InvalidateRoutes(stok);
+  }
+}
+
+// One of my door properties (stok) changed, which could change who can get through me.
+void Object::InvalidateRoutes(uint32_t stok) {
+  if (!IsAct(act_t::SPECIAL_LINKED)) {
+    return;
+  } else if (stok == prhash(u8"Invisible") || stok == prhash(u8"Hidden")) {
+    exits_changed(); // Can't even be found as an exit, now, or now can be
+    return;
+  } else if (stok == prhash(u8"Open") && HasSkill(prhash(u8"Closeable"))) {
+    return; // Anyone who could get through me still can, they just have to open me first
+  }
+  routes.clear();
+}
+
 const Object* Object::World() const {
+  const Object* room = Room();
+  if (room != this) {
+    return room->parent->parent;
+  }
   const Object* world = this;
   if (world->Parent()) {
     while (world->Parent()->Parent())
@@ -93,15 +656,14 @@ const Object* Object::World() const {
 }
 
 Object* Object::World() {
-  Object* world = this;
-  if (world->Parent()) {
-    while (world->Parent()->Parent())
-      world = world->Parent();
-  }
-  return world;
+  return const_cast<Object*>(std::as_const(*this).World());
 }
 
 const Object* Object::Zone() const {
+  const Object* room = Room();
+  if (room != this) {
+    return room->parent;
+  }
   const Object* zone = this;
   if (zone->Parent()) {
     if (zone->Parent()->Parent()) {
@@ -113,17 +675,19 @@ const Object* Object::Zone() const {
 }
 
 Object* Object::Zone() {
-  Object* zone = this;
-  if (zone->Parent()) {
-    if (zone->Parent()->Parent()) {
-      while (zone->Parent()->Parent()->Parent())
-        zone = zone->Parent();
-    }
-  }
-  return zone;
+  return const_cast<Object*>(std::as_const(*this).Zone());
 }
 
 const Object* Object::Room() const {
+  // Good if each step up to my room still agrees on it, and hasn't moved since it looked.
+  for (const Object* obj = this; obj->room_epoch != 0 && obj->room_cache == room_cache;) {
+    if (obj == room_cache) {
+      return room_cache;
+    } else if (!obj->parent || obj->room_epoch != obj->parent->ancestry_epoch) {
+      break;
+    }
+    obj = obj->parent;
+  }
   const Object* room = this;
   if (room->Parent()) {
     if (room->Parent()->Parent()) {
@@ -133,20 +697,99 @@ const Object* Object::Room() const {
       }
     }
   }
+  for (const Object* obj = this; obj != room; obj = obj->parent) { // Cache it all the way up
+    obj->room_cache = room;
+    obj->room_epoch = obj->parent->ancestry_epoch;
+  }
+  room->room_cache = room;
+  room->room_epoch = 1; // A room is its own as long as it doesn't move
   return room;
 }
 
 Object* Object::Room() {
-  Object* room = this;
-  if (room->Parent()) {
-    if (room->Parent()->Parent()) {
-      if (room->Parent()->Parent()->Parent()) {
-        while (room->Parent()->Parent()->Parent()->Parent())
-          room = room->Parent();
-      }
+  return const_cast<Object*>(std::as_const(*this).Room());
+}
+
+// Seek words which also match the end of a longer word ("smith" finds "blacksmith").
+static constexpr std::u8string_view match_suffixes[] = {
+    u8"guard",
+    u8"smith",
+    u8"master",
+    u8"sword",
+    u8"hammer",
+    u8"axe",
+    u8"bow",
+    u8"staff",
+    u8"keeper",
+};
+
+// Seek phrases which also match other phrases: special SMART[TM] searches, and spelling variants.
+static constexpr std::pair<std::u8string_view, std::u8string_view> match_aliases[] = {
+    {u8"guard", u8"guardian"},
+    {u8"guard", u8"guardsman"},
+    {u8"guard", u8"guardswoman"},
+    {u8"merc", u8"mercenary"},
+    {u8"bolt", u8"thunderbolt"},
+    {u8"battle hammer", u8"battlehammer"},
+    {u8"battlehammer", u8"battle hammer"},
+    {u8"war hammer", u8"warhammer"},
+    {u8"warhammer", u8"war hammer"},
+    {u8"battle axe", u8"battleaxe"},
+    {u8"battleaxe", u8"battle axe"},
+    {u8"war axe", u8"waraxe"},
+    {u8"waraxe", u8"war axe"},
+    {u8"morning star", u8"morningstar"},
+    {u8"morningstar", u8"morning star"},
+    {u8"bisarme", u8"gisarme"},
+    {u8"bisarme", u8"guisarme"},
+    {u8"gisarme", u8"bisarme"},
+    {u8"gisarme", u8"guisarme"},
+    {u8"guisarme", u8"bisarme"},
+    {u8"guisarme", u8"gisarme"},
+    {u8"bill-bisarme", u8"bill-gisarme"},
+    {u8"bill-bisarme", u8"bill-guisarme"},
+    {u8"bill-gisarme", u8"bill-bisarme"},
+    {u8"bill-gisarme", u8"bill-guisarme"},
+    {u8"bill-guisarme", u8"bill-bisarme"},
+    {u8"bill-guisarme", u8"bill-gisarme"},
+    {u8"grey", u8"gray"},
+    {u8"gray", u8"grey"},
+    {u8"bread", u8"waybread"},
+
+    // One-way purposeful mis-spellings to silence some extra labelling from TBA
+    {u8"potatoe", u8"potato"},
+};
+
+// Both tables above, compiled into one lookup by crc32c of the seek phrase.
+struct match_rule {
+  bool suffix = false;
+  std::vector<std::u8string_view> aliases;
+};
+static const std::unordered_map<uint32_t, match_rule> match_rules = [] {
+  std::unordered_map<uint32_t, match_rule> rules;
+  for (const auto& suffix : match_suffixes) {
+    rules[crc32c(suffix)].suffix = true;
+  }
+  for (const auto& alias : match_aliases) {
+    rules[crc32c(alias.first)].aliases.push_back(alias.second);
+  }
+  return rules;
+}();
+
+// Does part (any case) appear in name (any case) as, or at the end of, a word?
+static bool suffix_match(const std::u8string_view& name, const std::u8string_view& part) {
+  for (size_t pos = 0; pos + part.length() <= name.length(); ++pos) {
+    size_t end = pos + part.length();
+    if (end < name.length() && name[end] != ' ') {
+      continue;
+    }
+    if (std::equal(part.begin(), part.end(), name.begin() + pos, [](char8_t p, char8_t n) {
+          return ascii_tolower(p) == ascii_tolower(n);
+        })) {
+      return true;
     }
   }
-  return room;
+  return false;
 }
 
 int matches(const std::u8string_view& name, const std::u8string_view& seek) {
@@ -160,100 +803,18 @@ int matches(const std::u8string_view& name, const std::u8string_view& seek) {
   if (phrase_match(name, seek))
     return 1;
 
-  static bool dont_recur = false;
-  if (dont_recur)
+  auto rule = match_rules.find(stok);
+  if (rule == match_rules.end())
     return 0;
-  dont_recur = true;
 
-  int ret = 0;
+  if (rule->second.suffix && suffix_match(name, seek))
+    return 1;
 
-  // suffix-word searches
-  if (stok == crc32c(u8"guard") || stok == crc32c(u8"smith") || stok == crc32c(u8"master") ||
-      stok == crc32c(u8"sword") || stok == crc32c(u8"hammer") || stok == crc32c(u8"axe") ||
-      stok == crc32c(u8"bow") || stok == crc32c(u8"staff") || stok == crc32c(u8"keeper")) {
-    std::u8string part(seek);
-    std::transform(part.begin(), part.end(), part.begin(), ascii_tolower);
-    std::u8string word(name);
-    std::transform(word.begin(), word.end(), word.begin(), ascii_tolower);
-
-    auto cont = word.find(part);
-    while (cont != std::u8string::npos) {
-      if (word.length() == cont + part.length() || word[cont + part.length()] == ' ') {
-        ret = 1;
-        break;
-      }
-      cont = word.find(part, cont + 1);
-    }
+  for (const auto& alias : rule->second.aliases) {
+    if (phrase_match(name, alias))
+      return 1;
   }
-
-  // special SMART[TM] searches
-  if ((stok == crc32c(u8"guard")) && matches(name, u8"guardian"))
-    ret = 1;
-  else if ((stok == crc32c(u8"guard")) && matches(name, u8"guardsman"))
-    ret = 1;
-  else if ((stok == crc32c(u8"guard")) && matches(name, u8"guardswoman"))
-    ret = 1;
-  else if ((stok == crc32c(u8"merc")) && matches(name, u8"mercenary"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bolt")) && matches(name, u8"thunderbolt"))
-    ret = 1;
-  else if ((stok == crc32c(u8"battle hammer")) && matches(name, u8"battlehammer"))
-    ret = 1;
-  else if ((stok == crc32c(u8"battlehammer")) && matches(name, u8"battle hammer"))
-    ret = 1;
-  else if ((stok == crc32c(u8"war hammer")) && matches(name, u8"warhammer"))
-    ret = 1;
-  else if ((stok == crc32c(u8"warhammer")) && matches(name, u8"war hammer"))
-    ret = 1;
-  else if ((stok == crc32c(u8"battle axe")) && matches(name, u8"battleaxe"))
-    ret = 1;
-  else if ((stok == crc32c(u8"battleaxe")) && matches(name, u8"battle axe"))
-    ret = 1;
-  else if ((stok == crc32c(u8"war axe")) && matches(name, u8"waraxe"))
-    ret = 1;
-  else if ((stok == crc32c(u8"waraxe")) && matches(name, u8"war axe"))
-    ret = 1;
-  else if ((stok == crc32c(u8"morning star")) && matches(name, u8"morningstar"))
-    ret = 1;
-  else if ((stok == crc32c(u8"morningstar")) && matches(name, u8"morning star"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bisarme")) && matches(name, u8"gisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bisarme")) && matches(name, u8"guisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"gisarme")) && matches(name, u8"bisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"gisarme")) && matches(name, u8"guisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"guisarme")) && matches(name, u8"bisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"guisarme")) && matches(name, u8"gisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-bisarme")) && matches(name, u8"bill-gisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-bisarme")) && matches(name, u8"bill-guisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-gisarme")) && matches(name, u8"bill-bisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-gisarme")) && matches(name, u8"bill-guisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-guisarme")) && matches(name, u8"bill-bisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bill-guisarme")) && matches(name, u8"bill-gisarme"))
-    ret = 1;
-  else if ((stok == crc32c(u8"grey")) && matches(name, u8"gray"))
-    ret = 1;
-  else if ((stok == crc32c(u8"gray")) && matches(name, u8"grey"))
-    ret = 1;
-  else if ((stok == crc32c(u8"bread")) && matches(name, u8"waybread"))
-    ret = 1;
-
-  // One-way purposeful mis-spellings to silence some extra labelling from TBA
-  else if ((stok == crc32c(u8"potatoe")) && matches(name, u8"potato"))
-    ret = 1;
-
-  dont_recur = false;
-  return ret;
+  return 0;
 }
 
 int Object::Matches(const std::u8string_view& intarg, bool knows) const {
@@ -328,6 +889,187 @@ int Object::Matches(const std::u8string_view& intarg, bool knows) const {
   return (knows && matches(Name(), targ)) || matches(ShortDesc(), targ);
 }
 
+// Per-container keyword index, so PickObjects() in crowded places only has to try Matches()
+// on things which share a word with what was asked for.  Each word (a run of letters and
+// digits) of each child's name and short description is keyed by its crc32c, which ignores
+// case.  Indexes are only built for containers searched while holding keyword_index_min or
+// more things, and are kept current from then on.  Things only linked in (not really there,
+// like characters in player rooms) aren't filed by keyword, they're always candidates.
+struct keyword_index {
+  std::unordered_map<uint32_t, std::vector<Object*>> words;
+  std::unordered_map<const Object*, std::vector<uint32_t>> keys; // Words each child is under
+  std::vector<Object*> guests; // Linked in, but with some other parent
+};
+static std::unordered_map<const Object*, keyword_index> keyword_indexes;
+static constexpr size_t keyword_index_min = 32;
+
+static void add_keyword(std::vector<uint32_t>& keys, uint32_t key) {
+  if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+    keys.push_back(key);
+  }
+}
+
+static void add_keywords(std::vector<uint32_t>& keys, const std::u8string_view& text) {
+  auto start = std::ranges::find_if(text, ascii_isalnum);
+  while (start != text.end()) {
+    auto end = std::find_if_not(start, text.end(), ascii_isalnum);
+    auto word = text.substr(start - text.begin(), end - start);
+    add_keyword(keys, crc32c(word));
+
+    // Also file it under any suffix-word it ends with, since those match there too.
+    for (const auto& suffix : match_suffixes) {
+      if (word.length() > suffix.length() &&
+          crc32c(word.substr(word.length() - suffix.length())) == crc32c(suffix)) {
+        add_keyword(keys, crc32c(suffix));
+      }
+    }
+    start = std::find_if(end, text.end(), ascii_isalnum);
+  }
+}
+
+static void keyword_index_add(keyword_index& index, const Object* cont, Object* ob) {
+  if (ob->Parent() != cont) {
+    if (std::find(index.guests.begin(), index.guests.end(), ob) == index.guests.end()) {
+      index.guests.push_back(ob);
+    }
+    return;
+  }
+  auto& keys = index.keys[ob];
+  if (!keys.empty()) {
+    return; // Already indexed
+  }
+  add_keywords(keys, ob->ShortDesc());
+  add_keywords(keys, ob->Name());
+  for (auto key : keys) {
+    index.words[key].push_back(ob);
+  }
+}
+
+static void keyword_index_remove(keyword_index& index, const Object* ob) {
+  auto guest = std::find(index.guests.begin(), index.guests.end(), ob);
+  if (guest != index.guests.end()) {
+    index.guests.erase(guest);
+  }
+  auto keys = index.keys.find(ob);
+  if (keys == index.keys.end()) {
+    return;
+  }
+  for (auto key : keys->second) {
+    auto& bucket = index.words[key];
+    bucket.erase(std::find(bucket.begin(), bucket.end(), ob));
+    if (bucket.empty()) {
+      index.words.erase(key);
+    }
+  }
+  index.keys.erase(keys);
+}
+
+void Object::KeywordLink(Object* ob) {
+  if (keyword_indexes.empty()) {
+    return;
+  }
+  auto index = keyword_indexes.find(this);
+  if (index != keyword_indexes.end()) {
+    keyword_index_add(index->second, this, ob);
+  }
+}
+
+void Object::KeywordUnlink(const Object* ob) {
+  if (keyword_indexes.empty()) {
+    return;
+  }
+  auto index = keyword_indexes.find(this);
+  if (index != keyword_indexes.end()) {
+    keyword_index_remove(index->second, ob);
+  }
+}
+
+void Object::KeywordDrop() {
+  if (!keyword_indexes.empty()) {
+    keyword_indexes.erase(this);
+  }
+}
+
+// My name or short description changed, so re-file me.  Only my parent files me by keyword.
+void Object::KeywordRefresh() {
+  if (!parent || keyword_indexes.empty()) {
+    return;
+  }
+  auto index = keyword_indexes.find(parent);
+  if (index != keyword_indexes.end() && index->second.keys.contains(this)) {
+    keyword_index_remove(index->second, this);
+    keyword_index_add(index->second, parent, this);
+  }
+}
+
+static void add_keyword_candidates(
+    const keyword_index& index,
+    const std::u8string_view& phrase,
+    DArr64<Object*>& cands) {
+  auto first = std::ranges::find_if_not(phrase, ascii_isalnum);
+  auto bucket = index.words.find(crc32c(phrase.substr(0, first - phrase.begin())));
+  if (bucket != index.words.end()) {
+    cands.insert(cands.end(), bucket->second.begin(), bucket->second.end());
+  }
+}
+
+// Returns false if the index can't narrow this search.  Otherwise fills cands, sorted, with
+// every one of my contents which could possibly Match(name).
+bool Object::KeywordCandidates(std::u8string_view name, DArr64<Object*>& cands) const {
+  if (contents.size() < keyword_index_min) {
+    return false;
+  }
+  trim_string(name);
+  if (name.empty() || !ascii_isalnum(name.front()) || name.starts_with(u8"obj:")) {
+    return false;
+  }
+
+  // Keywords can match things without sharing a word with them.
+  switch (crc32c(name)) {
+    case (crc32c(u8"all")):
+    case (crc32c(u8"everyone")):
+    case (crc32c(u8"someone")):
+    case (crc32c(u8"anyone")):
+    case (crc32c(u8"everything")):
+    case (crc32c(u8"something")):
+    case (crc32c(u8"anything")):
+    case (crc32c(u8"everywhere")):
+    case (crc32c(u8"somewhere")):
+    case (crc32c(u8"anywhere")):
+    case (crc32c(u8"man")):
+    case (crc32c(u8"boy")):
+    case (crc32c(u8"woman")):
+    case (crc32c(u8"girl")):
+    case (crc32c(u8"corpse")):
+    case (crc32c(u8"money")):
+      return false;
+    default:
+      break;
+  }
+
+  auto& index = keyword_indexes[this];
+  if (index.keys.empty()) {
+    for (auto item : contents) {
+      keyword_index_add(index, this, item);
+    }
+  }
+  cands.insert(cands.end(), index.guests.begin(), index.guests.end());
+
+  // A phrase can only match starting at the beginning of a word, and has to end
+  // where a word ends, so its first word must be one of the candidate's words.
+  // Suffix-words are filed under their own words, aliases need their words too.
+  add_keyword_candidates(index, name, cands);
+  auto rule = match_rules.find(crc32c(name));
+  if (rule != match_rules.end()) {
+    for (const auto& alias : rule->second.aliases) {
+      add_keyword_candidates(index, alias, cands);
+    }
+  }
+  std::sort(cands.begin(), cands.end());
+  cands.erase(std::unique(cands.begin(), cands.end()), cands.end());
+  return true;
+}
+
 Object* new_body(Object* world) {
   Object* body = new Object();
   body->SetAttribute(0, 3);
@@ -424,18 +1166,37 @@ void tick_universe() {
     tickstage = 0;
   }
   Mind::Resume(); // Tell suspended minds to resume if their time is up
+  ++trash_tick;
 }
 
 // Returns: [bool] Should object be deleted?
 bool Object::Tick() {
   UpdateTime();
+  if (HasSkill(prhash(u8"TBAZoneLifespan"))) { // Zone resetters keep time every tick
+    UpdateTBAZone();
+  }
 
   if (Dice::Odds(1, 20)) { // roughly once per min
-    auto mnds = minds;
-    for (auto m : mnds) {
-      m->body = this;
-      if (!m->Think(1)) {
-        Detach(m);
+    // Thinking can attach or detach minds, so work from a snapshot of raw pointers.  Shared
+    // minds live forever, anything else is pinned only while it thinks.
+    DArr64<Mind*, 3> mnds;
+    for (const auto& m : minds) {
+      mnds.push_back(m.get());
+    }
+    for (auto mp : mnds) {
+      auto itr = minds.begin();
+      for (; itr != minds.end() && itr->get() != mp; ++itr) {
+      }
+      if (itr == minds.end()) {
+        continue; // Detached by an earlier mind
+      }
+      std::shared_ptr<Mind> pin;
+      if (!mp->Shared()) {
+        pin = *itr;
+      }
+      mp->body = this;
+      if (!mp->Think(1)) {
+        DetachMind(mp);
       }
     }
   }
@@ -523,25 +1284,138 @@ void Object::UpdateMental() {
   }
 }
 
-void Object::UpdateTBA() {
+// Bring a TBA MOB, just cloned into its room, to life.
+static void start_tba_mob(Object* mob) {
+  mob->Attach(get_tbamob_mind());
+  mob->Activate();
+  mob->Parent()->SendOut(ALL, -1, u8";s arrives.\n", u8"", mob, nullptr);
+  for (auto trg : mob->Contents()) { // Enable any untriggered triggers
+    if (trg->HasSkill(prhash(u8"TBAScript")) &&
+        (trg->Skill(prhash(u8"TBAScriptType")) & 0x0000002)) {
+      trg->Activate();
+      new_trigger(Dice::Rand(13000, 25999), trg, nullptr, nullptr, u8"");
+    }
+  }
+}
+
+void Object::UpdateTBA() { // Poppers, which worlds imported before zone resetters still have
   if (parent && Skill(prhash(u8"TBAPopper")) > 0 && contents.size() > 0) {
     if (!ActTarg(act_t::SPECIAL_MONITOR)) {
       Object* obj = new Object(*(contents.front()));
       obj->SetParent(this);
       obj->Travel(parent);
       AddAct(act_t::SPECIAL_MONITOR, obj);
-      obj->Attach(get_tbamob_mind());
-      obj->Activate();
-      parent->SendOut(ALL, -1, u8";s arrives.\n", u8"", obj, nullptr);
-      for (auto trg : obj->Contents()) { // Enable any untriggered triggers
-        if (trg->HasSkill(prhash(u8"TBAScript")) &&
-            (trg->Skill(prhash(u8"TBAScriptType")) & 0x0000002)) {
-          trg->Activate();
-          new_trigger(Dice::Rand(13000, 25999), trg, nullptr, nullptr, u8"");
-        }
+      start_tba_mob(obj);
+    }
+  }
+}
+
+// How much work (cloning things into place, or changing doors) a zone reset does per tick, so
+// resetting even the biggest zone is spread out, instead of making one tick slow.
+static constexpr int zone_reset_work = 16;
+
+// Is a player anywhere in the rooms of this zone resetter's zone?
+static bool tba_zone_occupied(const Object* resetter) {
+  int bot = resetter->Skill(prhash(u8"TBAZoneBottom")) + 1000000;
+  int top = resetter->Skill(prhash(u8"TBAZoneTop")) + 1000000;
+  for (const auto& mind : get_human_minds()) {
+    if (mind->Body()) {
+      int room = mind->Body()->Room()->Skill(prhash(u8"TBARoom"));
+      if (room >= bot && room <= top) {
+        return true;
       }
     }
   }
+  return false;
+}
+
+// Set a TBA door, and the other side of it, open (0), closed (1), or locked (2).
+static bool reset_tba_door(Object* door, int state) {
+  bool changed = false;
+  for (auto side : {door, door->ActTarg(act_t::SPECIAL_LINKED)}) {
+    if (side &&
+        (side->HasSkill(prhash(u8"Open")) != (state == 0) ||
+         side->HasSkill(prhash(u8"Locked")) != (state == 2))) {
+      if (state == 0) {
+        side->SetSkill(prhash(u8"Open"), 1000);
+      } else {
+        side->ClearSkill(prhash(u8"Open"));
+      }
+      if (state == 2) {
+        side->SetSkill(prhash(u8"Locked"), 1);
+      } else {
+        side->ClearSkill(prhash(u8"Locked"));
+      }
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+// Do one step of a zone reset.  Returns whether that had anything to do.
+static bool reset_tba_zone_step(const Object* resetter, Object* step) {
+  Object* targ = step->ActTarg(act_t::SPECIAL_HOME);
+  if (!targ) { // What this was for is gone
+    return false;
+  } else if (step->HasSkill(prhash(u8"TBAZoneDoor"))) {
+    return reset_tba_door(targ, step->Skill(prhash(u8"TBAZoneDoor")) - 1);
+  } else if (targ->HasSkill(prhash(u8"TBAScript"))) { // ROOM-ZONE trigger
+    if (!resetter->IsActive()) { // Not for the first reset, at import
+      return false;
+    }
+    new_trigger(Dice::Rand(300, 699), targ, nullptr, nullptr, u8"");
+  } else if (step->HasSkill(prhash(u8"TBAMOB"))) { // Unless the last one is still around
+    if (step->ActTarg(act_t::SPECIAL_MONITOR)) {
+      return false;
+    }
+    Object* mob = new Object(*step);
+    mob->SetParent(targ);
+    step->AddAct(act_t::SPECIAL_MONITOR, mob);
+    start_tba_mob(mob);
+  } else { // Unless the last one is still where it goes
+    Object* obj = step->ActTarg(act_t::SPECIAL_MONITOR);
+    if (obj && obj->Parent() == targ) {
+      return false;
+    }
+    obj = new Object(*step);
+    obj->SetParent(targ);
+    step->AddAct(act_t::SPECIAL_MONITOR, obj);
+    if (obj->HasSkill(prhash(u8"Liquid Source"))) {
+      obj->Activate();
+    }
+  }
+  return true;
+}
+
+void Object::UpdateTBAZone() {
+  if (!HasSkill(prhash(u8"TBAZoneStep"))) { // Not in the middle of a reset
+    int mode = Skill(prhash(u8"TBAZoneResetMode"));
+    int age = Skill(prhash(u8"TBAZoneAge"));
+    if (mode == 0) { // Never resets again
+      return;
+    } else if (age < std::max(Skill(prhash(u8"TBAZoneLifespan")), 1) * 20) { // 20 ticks/min
+      SetSkill(prhash(u8"TBAZoneAge"), age + 1);
+      return;
+    } else if (mode == 1 && tba_zone_occupied(this)) {
+      return; // Wait for the players to leave first
+    }
+    ClearSkill(prhash(u8"TBAZoneAge"));
+  }
+  ResetTBAZone(zone_reset_work);
+}
+
+void Object::ResetTBAZone(int work) {
+  size_t step = std::max(Skill(prhash(u8"TBAZoneStep")), 1) - 1;
+  for (; step < contents.size() && work > 0; ++step) {
+    if (reset_tba_zone_step(this, contents[step])) {
+      --work;
+    }
+  }
+  if (step < contents.size()) {
+    SetSkill(prhash(u8"TBAZoneStep"), step + 1);
+  } else {
+    ClearSkill(prhash(u8"TBAZoneStep"));
+  }
 }
 
 void Object::UpdateGrowth() {
@@ -824,6 +1698,36 @@ void Object::UpdateIllness() {
   }
 }
 
+// Descriptions never change in place (SetDescs() always builds new ones), so copies of an
+// object, like every MOB cloned from the same template, all share one block of them.  Each block
+// starts with a count of the objects using it, just before the text they point to.
+static char8_t* new_descs(size_t len) {
+  char8_t* block = new char8_t[sizeof(uint32_t) + len];
+  const uint32_t refs = 1;
+  std::memcpy(block, &refs, sizeof(refs));
+  return block + sizeof(uint32_t);
+}
+
+static const char8_t* share_descs(const char8_t* descs) {
+  char8_t* block = const_cast<char8_t*>(descs) - sizeof(uint32_t);
+  uint32_t refs;
+  std::memcpy(&refs, block, sizeof(refs));
+  ++refs;
+  std::memcpy(block, &refs, sizeof(refs));
+  return descs;
+}
+
+static void release_descs(const char8_t* descs) {
+  char8_t* block = const_cast<char8_t*>(descs) - sizeof(uint32_t);
+  uint32_t refs;
+  std::memcpy(&refs, block, sizeof(refs));
+  if (--refs == 0) {
+    delete[] block;
+  } else {
+    std::memcpy(block, &refs, sizeof(refs));
+  }
+}
+
 Object::Object() {
   parent = nullptr;
   position = pos_t::NONE;
@@ -855,7 +1759,6 @@ Object::Object() {
 
 Object::Object(Object* o) {
   parent = nullptr;
-  SetParent(o);
   position = pos_t::NONE;
   cur_skill = prhash(u8"None");
 
@@ -881,17 +1784,17 @@ Object::Object(Object* o) {
   no_seek = false;
   no_hear = false;
   tickstep = -1;
+
+  SetParent(o);
 }
 
 Object::Object(const Object& o) {
+  parent = nullptr; // Copied contents look up through me, even before I'm put anywhere
   dlens = o.dlens;
   if (o.descriptions == default_descriptions) {
     descriptions = default_descriptions;
   } else {
-    const size_t len = dlens.sd + dlens.n + dlens.d + dlens.ld + 4;
-    char8_t* new_descs = new char8_t[len];
-    std::memcpy(new_descs, o.descriptions, len);
-    descriptions = new_descs;
+    descriptions = share_descs(o.descriptions);
   }
 
   actions.clear();
@@ -923,13 +1826,14 @@ Object::Object(const Object& o) {
   for (auto ind : o.contents) {
     Object* nobj = new Object(*ind);
     nobj->SetParent(this);
-    if (o.ActTarg(act_t::HOLD) == ind)
-      AddAct(act_t::HOLD, nobj);
-    if (o.ActTarg(act_t::WIELD) == ind)
-      AddAct(act_t::WIELD, nobj);
-    for (act_t actt = act_t::WEAR_BACK; actt < act_t::WEAR_MAX; actt = act_t(int(actt) + 1))
-      if (o.ActTarg(actt) == ind)
-        AddAct(actt, nobj);
+  }
+  for (auto aind : o.actions) { // Hold, wield, and wear the copies of what it did, in one pass
+    if (aind.act() >= act_t::HOLD && aind.act() < act_t::WEAR_MAX) {
+      auto ind = std::find(o.contents.begin(), o.contents.end(), aind.obj());
+      if (ind != o.contents.end()) {
+        AddAct(aind.act(), contents[ind - o.contents.begin()]);
+      }
+    }
   }
   if (o.IsAct(act_t::DEAD))
     AddAct(act_t::DEAD);
@@ -943,6 +1847,7 @@ Object::Object(const Object& o) {
     AddAct(act_t::REST);
 
   parent = nullptr;
+  InvalidateAncestry(nullptr);
 
   if (o.IsActive())
     Activate();
@@ -1027,6 +1932,32 @@ std::u8string Object::Noun(bool definite, bool verbose, const Object* rel, const
   else if (sub == this)
     return u8"itself";
 
+  Object* own = (IsAnimate()) ? nullptr : Owner();
+  noun_memo* memo = nullptr;
+  uint8_t form = 0;
+  if (!own || (own != rel && own != sub)) { // Only "your"/"his"/etc. depend on who is looking
+    form = (definite ? 1 : 0) | (verbose ? 2 : 0);
+    if (HasName() && (rel == nullptr || rel->Knows(this))) {
+      form |= 4;
+    }
+    if (own && own->HasName() && (rel == nullptr || rel->Knows(own))) {
+      form |= 8;
+    }
+    memo = &noun_memos[this];
+    if (memo->owner != own || memo->epoch != noun_epoch) {
+      memo->owner = own;
+      memo->epoch = noun_epoch;
+      memo->forms.clear();
+    }
+    for (const auto& seen : memo->forms) {
+      if (seen.first == form) {
+        ++noun_hits;
+        return seen.second;
+      }
+    }
+    ++noun_misses;
+  }
+
   if (ShortDesc().starts_with(u8"a ")) {
     ret = ShortDesc().substr(2);
     need_an = false;
@@ -1042,7 +1973,6 @@ std::u8string Object::Noun(bool definite, bool verbose, const Object* rel, const
   }
 
   if (!IsAnimate()) {
-    Object* own = Owner();
     if (own && own == rel) {
       ret = fmt::format(u8"your {}", ret);
     } else if (own && own == sub && own->Gender() == gender_t::FEMALE) {
@@ -1078,9 +2008,35 @@ std::u8string Object::Noun(bool definite, bool verbose, const Object* rel, const
     }
   }
 
+  if (memo) {
+    memo->forms.emplace_back(form, ret);
+  }
   return ret;
 }
 
+// Something I would be called changed, and if I'm animate, that can include what I own.
+void Object::NounChanged() {
+  noun_memos.erase(this);
+  if (IsAnimate()) {
+    ++noun_epoch;
+    if (noun_epoch == 0) {
+      noun_epoch = 1; // Zero is reserved as "never valid"
+    }
+  }
+}
+
+void Object::ReportNounCache() {
+  const uint64_t total = noun_hits + noun_misses;
+  logec(
+      u8"Noun cache: {} hits, {} misses ({}% hit rate), {} objects.",
+      noun_hits,
+      noun_misses,
+      (total > 0) ? (noun_hits * 100 / total) : 0,
+      noun_memos.size());
+  noun_hits = 0;
+  noun_misses = 0;
+}
+
 void Object::SetDescs(
     std::u8string_view sd,
     std::u8string_view n,
@@ -1112,20 +2068,26 @@ void Object::SetDescs(
   dlens.ld = ld.length();
   const size_t len = dlens.sd + dlens.n + dlens.d + dlens.ld + 4;
 
-  char8_t* new_descs = new char8_t[len];
-  std::memcpy(new_descs, sd.data(), dlens.sd);
-  new_descs[dlens.sd] = 0;
-  std::memcpy(new_descs + dlens.sd + 1, n.data(), dlens.n);
-  new_descs[dlens.sd + dlens.n + 1] = 0;
-  std::memcpy(new_descs + dlens.sd + dlens.n + 2, d.data(), dlens.d);
-  new_descs[dlens.sd + dlens.n + dlens.d + 2] = 0;
-  std::memcpy(new_descs + dlens.sd + dlens.n + dlens.d + 3, ld.data(), dlens.ld);
-  new_descs[dlens.sd + dlens.n + dlens.d + dlens.ld + 3] = 0;
+  char8_t* descs = new_descs(len);
+  std::memcpy(descs, sd.data(), dlens.sd);
+  descs[dlens.sd] = 0;
+  std::memcpy(descs + dlens.sd + 1, n.data(), dlens.n);
+  descs[dlens.sd + dlens.n + 1] = 0;
+  std::memcpy(descs + dlens.sd + dlens.n + 2, d.data(), dlens.d);
+  descs[dlens.sd + dlens.n + dlens.d + 2] = 0;
+  std::memcpy(descs + dlens.sd + dlens.n + dlens.d + 3, ld.data(), dlens.ld);
+  descs[dlens.sd + dlens.n + dlens.d + dlens.ld + 3] = 0;
 
   if (descriptions != default_descriptions) {
-    delete[] descriptions;
+    release_descs(descriptions);
+  }
+  descriptions = descs;
+  KeywordRefresh();
+  NounChanged();
+  forget_tba_program(this); // My script may have changed
+  if (!room_triggers.empty() && HasSkill(prhash(u8"TBAScriptType"))) {
+    InvalidateTriggerType(); // What I listen for may have changed
   }
-  descriptions = new_descs;
 }
 
 void Object::SetShortDesc(const std::u8string_view& sd) {
@@ -1145,44 +2107,48 @@ void Object::SetLongDesc(const std::u8string_view& ld) {
 }
 
 void Object::SetParent(Object* o) {
+  Object* oldp = parent;
   parent = o;
+  InvalidateAncestry(oldp);
   if (o)
     o->AddLink(this);
+  InvalidateTriggers(oldp);
+  InvalidateExits(oldp);
 }
 
 void Object::SendContents(Object* targ, Object* o, int vmode, std::u8string b) {
-  for (auto m : targ->minds) {
+  for (const auto& m : targ->minds) {
     SendContents(m, o, vmode, b);
   }
 }
 
 void Object::SendShortDesc(Object* targ, Object* o) {
-  for (auto m : targ->minds) {
+  for (const auto& m : targ->minds) {
     SendShortDesc(m, o);
   }
 }
 
 void Object::SendDesc(Object* targ, Object* o) {
-  for (auto m : targ->minds) {
+  for (const auto& m : targ->minds) {
     SendDesc(m, o);
   }
 }
 
 void Object::SendDescSurround(Object* targ, Object* o, int vmode) {
-  for (auto m : targ->minds) {
+  for (const auto& m : targ->minds) {
     SendDescSurround(m, o, vmode);
   }
 }
 
 void Object::SendLongDesc(Object* targ, Object* o) {
-  for (auto m : targ->minds) {
+  for (const auto& m : targ->minds) {
     SendLongDesc(m, o);
   }
 }
 
 static std::u8string base = u8"";
 
-void Object::SendActions(std::shared_ptr<Mind> m) {
+void Object::SendActions(const std::shared_ptr<Mind>& m) {
   for (auto cur : actions) {
     if (cur.act() < act_t::WEAR_BACK) {
       std::u8string targ;
@@ -1244,7 +2210,7 @@ void Object::SendActions(std::shared_ptr<Mind> m) {
   m->Send(u8".\n");
 }
 
-void Object::SendExtendedActions(std::shared_ptr<Mind> m, int vmode) {
+void Object::SendExtendedActions(const std::shared_ptr<Mind>& m, int vmode) {
   std::map<Object*, std::u8string> shown;
   for (auto cur : actions) {
     if ((vmode & (LOC_TOUCH | LOC_HEAT | LOC_NINJA)) == 0 // Can't See/Feel Invis
@@ -1348,7 +2314,7 @@ void Object::SendExtendedActions(std::shared_ptr<Mind> m, int vmode) {
   }
 }
 
-void Object::SendContents(std::shared_ptr<Mind> m, Object* o, int vmode, std::u8string b) {
+void Object::SendContents(const std::shared_ptr<Mind>& m, Object* o, int vmode, std::u8string b) {
   auto cont = contents;
 
   if (!b.empty())
@@ -1484,11 +2450,11 @@ void Object::SendContents(std::shared_ptr<Mind> m, Object* o, int vmode, std::u8
     base = u8"";
 }
 
-void Object::SendShortDesc(std::shared_ptr<Mind> m, Object* o) {
+void Object::SendShortDesc(const std::shared_ptr<Mind>& m, Object* o) {
   m->Send(fmt::format(u8"{}\n", ShortDesc()));
 }
 
-void Object::SendFullSituation(std::shared_ptr<Mind> m, Object* o) {
+void Object::SendFullSituation(const std::shared_ptr<Mind>& m, Object* o) {
   std::u8string pname = u8"its";
   if (Owner()) {
     if (Owner() == o) {
@@ -1600,7 +2566,7 @@ void Object::SendFullSituation(std::shared_ptr<Mind> m, Object* o) {
   m->Send(buf);
 }
 
-void Object::SendDesc(std::shared_ptr<Mind> m, Object* o) {
+void Object::SendDesc(const std::shared_ptr<Mind>& m, Object* o) {
   if (position != pos_t::NONE) {
     m->Send(CCYN);
     SendFullSituation(m, o);
@@ -1619,7 +2585,7 @@ void Object::SendDesc(std::shared_ptr<Mind> m, Object* o) {
   m->Send(CNRM);
 }
 
-void Object::SendDescSurround(std::shared_ptr<Mind> m, Object* o, int vmode) {
+void Object::SendDescSurround(const std::shared_ptr<Mind>& m, Object* o, int vmode) {
   if (no_seek)
     return;
 
@@ -1657,7 +2623,7 @@ void Object::SendDescSurround(std::shared_ptr<Mind> m, Object* o, int vmode) {
   m->Send(CNRM);
 }
 
-void Object::SendLongDesc(std::shared_ptr<Mind> m, Object* o) {
+void Object::SendLongDesc(const std::shared_ptr<Mind>& m, Object* o) {
   if (position != pos_t::NONE) {
     m->Send(CCYN);
     SendFullSituation(m, o);
@@ -1677,7 +2643,7 @@ void Object::SendLongDesc(std::shared_ptr<Mind> m, Object* o) {
 }
 
 static const std::u8string atnames[] = {u8"Bod", u8"Qui", u8"Str", u8"Cha", u8"Int", u8"Wil"};
-void Object::SendScore(std::shared_ptr<Mind> m, Object* o) {
+void Object::SendScore(const std::shared_ptr<Mind>& m, Object* o) {
   if (!m)
     return;
   m->Send(u8"\n{}", CNRM);
@@ -1828,7 +2794,7 @@ void Object::SendScore(std::shared_ptr<Mind> m, Object* o) {
     if (IsActive())
       m->Send(CCYN u8"  ACTIVE\n" CNRM);
 
-    for (auto mind : minds) {
+    for (const auto& mind : minds) {
       if (mind->Owner()) {
         m->Send(CBLU u8"->Player Connected: {}\n" CNRM, mind->Owner()->Name());
       } else if (mind->Type() == mind_t::NPC) {
@@ -2185,6 +3151,12 @@ void Object::AddLink(Object* ob) {
   auto ind = std::find(contents.begin(), contents.end(), ob);
   if (ind == contents.end()) {
     contents.push_back(ob);
+    KeywordLink(ob);
+    InvalidateContents();
+    if (ob->parent == this) { // Only count things really here (not player rooms, etc.)
+      contained_weight += ob->weight;
+      contained_volume += ob->volume;
+    }
     //    auto place = contents.end();
     //    for(ind = contents.begin(); ind != contents.end(); ++ind) {
     //      if(ind == ob) return;				//Already there!
@@ -2199,6 +3171,12 @@ void Object::RemoveLink(Object* ob) {
     --ind;
     if (*ind == ob) {
       contents.erase(ind);
+      KeywordUnlink(ob);
+      InvalidateContents();
+      if (ob->parent == this) {
+        contained_weight -= ob->weight;
+        contained_volume -= ob->volume;
+      }
       return;
     }
   }
@@ -2346,7 +3324,7 @@ int Object::Travel(Object* dest) {
     }
   }
 
-  if (IsAnimate()) {
+  if (IsAnimate() && (parent->Room()->TriggerTypesWithin() & 0x0010000)) {
     auto trigs = parent->contents;
     for (auto src : parent->contents) {
       trigs.insert(trigs.end(), src->contents.begin(), src->contents.end());
@@ -2367,6 +3345,9 @@ int Object::Travel(Object* dest) {
   Object* oldp = parent;
   parent->RemoveLink(this);
   parent = dest;
+  InvalidateAncestry(oldp);
+  InvalidateTriggers(oldp);
+  InvalidateExits(oldp);
   oldp->NotifyGone(this, dest);
   parent->AddLink(this);
 
@@ -2391,14 +3372,14 @@ int Object::Travel(Object* dest) {
   }
 
   if (parent->Skill(prhash(u8"Accomplishment"))) {
-    for (auto m : minds) {
+    for (const auto& m : minds) {
       if (m->Owner()) {
         Accomplish(parent->Skill(prhash(u8"Accomplishment")), u8"finding a secret");
       }
     }
   }
 
-  if (IsAnimate()) {
+  if (IsAnimate() && (parent->Room()->TriggerTypesWithin() & 0x0000040)) {
     auto trigs = parent->contents;
     for (auto src : parent->contents) {
       trigs.insert(trigs.end(), src->contents.begin(), src->contents.end());
@@ -2425,6 +3406,18 @@ int Object::Travel(Object* dest) {
 }
 
 Object::~Object() {
+  trash_pending.erase(this);
+  KeywordDrop();
+  NounChanged();
+  if (!room_triggers.empty()) {
+    room_triggers.erase(this);
+  }
+  exit_graphs.erase(this);
+  light_memos.erase(this);
+  sight_memos.erase(this);
+  traveller_keys.erase(this);
+  forget_tba_program(this);
+
   while (!contents.empty()) {
     if (contents.back()->parent == this) {
       delete contents.back();
@@ -2436,20 +3429,17 @@ Object::~Object() {
   Recycle(0);
 
   if (descriptions != default_descriptions) {
-    delete[] descriptions;
-  }
-  if (dowhenfree[0] != '\0') {
-    delete[] dowhenfree;
-  }
-  if (defact[0] != '\0') {
-    delete[] defact;
+    release_descs(descriptions);
   }
 }
 
 void Object::Recycle(int inbin) {
+  if (parent && parent == trash_bin) {
+    trash_pending.erase(this);
+  }
   if (is_pc(this)) {
     std::set<std::shared_ptr<Mind>> removals;
-    for (auto mnd : minds) {
+    for (const auto& mnd : minds) {
       if (mnd->Type() == mind_t::REMOTE) {
         removals.insert(mnd);
       }
@@ -2461,20 +3451,25 @@ void Object::Recycle(int inbin) {
   }
   Deactivate();
 
-  std::set<Object*> killers;
-  for (auto ind : contents) {
-    killers.insert(ind);
+  KeywordDrop(); // Nobody will be searching in here again
+  if (!room_triggers.empty()) {
+    room_triggers.erase(this);
   }
-
-  for (auto indk : killers) {
-    if (std::find(contents.begin(), contents.end(), indk) != contents.end()) {
-      indk->SetParent(nullptr);
-      RemoveLink(indk);
-      indk->Recycle();
-    }
+  exit_graphs.erase(this);
+  light_memos.erase(this);
+  sight_memos.erase(this);
+  traveller_keys.erase(this);
+  forget_tba_program(this);
+  // Recycling one may take others with it (linked doors, etc.), so always take the last one left.
+  while (!contents.empty()) {
+    auto indk = contents.back();
+    RemoveLink(indk);
+    indk->SetParent(nullptr);
+    indk->Recycle();
   }
-  killers.clear();
   contents.clear();
+  contained_weight = 0;
+  contained_volume = 0;
 
   auto todo = minds;
   for (auto mind : todo) {
@@ -2483,45 +3478,77 @@ void Object::Recycle(int inbin) {
   minds.clear();
 
   if (parent) {
+    Object* oldp = parent;
     parent->RemoveLink(this);
     parent = nullptr;
+    InvalidateAncestry(oldp);
+    InvalidateTriggers(oldp);
+    InvalidateExits(oldp);
   }
 
-  auto acts = actions;
-  for (auto a : acts) {
-    if (a.act() != act_t::SPECIAL_ACTEE) {
-      StopAct(a.act());
+  // Drop everything I am doing, leaving only the reverse (SPECIAL_ACTEE) references.
+  auto keep = actions.begin();
+  for (auto a : actions) {
+    if (a.act() == act_t::SPECIAL_ACTEE) {
+      *keep = a;
+      ++keep;
+    } else if (a.obj() && a.obj() != this) {
+      a.obj()->NotTouching(this);
     }
   }
+  actions.erase(keep, actions.end());
+
+  // Then, visit each thing doing something to me exactly once, and make it stop.
+  while (!actions.empty()) {
+    Object* touch = actions.back().obj();
+    actions.pop_back();
 
-  auto touches = Touching();
-  for (auto touch : touches) {
     bool linked = false;
-    auto other_acts = touch->actions;
-    for (auto a : other_acts) {
+    bool held = false;
+    auto other_keep = touch->actions.begin();
+    for (auto a : touch->actions) {
       if (a.act() != act_t::SPECIAL_ACTEE && a.obj() == this) {
         linked = (linked || a.act() == act_t::SPECIAL_LINKED);
-        touch->StopAct(a.act());
+        held = (held || a.act() == act_t::HOLD);
+      } else {
+        *other_keep = a;
+        ++other_keep;
       }
     }
+    touch->actions.erase(other_keep, touch->actions.end());
+    touch->InvalidateLight();
+
+    if (held && touch->IsAct(act_t::OFFER)) {
+      touch->StopAct(act_t::OFFER);
+    }
     if (linked) {
       touch->Recycle();
     }
   }
+  actions.clear();
 
   busylist.erase(this);
 
   if (inbin && trash_bin) {
     if (parent != trash_bin) {
+      Object* oldp = parent;
       parent = trash_bin;
+      InvalidateAncestry(oldp);
+      InvalidateTriggers(nullptr);
       parent->contents.push_back(this);
+      parent->KeywordLink(this);
+      parent->InvalidateContents();
+      parent->contained_weight += weight;
+      parent->contained_volume += volume;
+      trash_pending[this] = ++trash_seq;
+      trash_queue.push_back({trash_seq, trash_tick, this});
     }
   }
 
   // loge(u8"Done deleting: {}", Noun(0));
 }
 
-void Object::Attach(std::shared_ptr<Mind> m) {
+void Object::Attach(const std::shared_ptr<Mind>& m) {
   auto itr = minds.begin();
   for (; itr != minds.end() && (*itr) != m; ++itr) {
   }
@@ -2531,41 +3558,53 @@ void Object::Attach(std::shared_ptr<Mind> m) {
   m->body = this;
 }
 
-void Object::Detach(std::shared_ptr<Mind> m) {
-  auto itr = minds.begin();
-  if (itr != minds.end()) {
-    if (*itr == m) {
-      minds.pop_front();
-    } else {
-      auto prev = itr;
-      ++itr;
-      for (; itr != minds.end() && (*itr) != m; ++itr) {
-        prev = itr;
-      }
-      if (itr != minds.end()) {
-        minds.erase_after(prev);
-      }
-    }
-  }
+void Object::Detach(const std::shared_ptr<Mind>& m) {
+  DetachMind(m.get());
+}
+
+void Object::DetachMind(Mind* m) {
   if (m->body == this) {
     m->body = nullptr;
   }
+  // This can drop the last reference to m, so it must come last.
+  minds.remove_if([m](const std::shared_ptr<Mind>& mnd) { return mnd.get() == m; });
 }
 
-uint32_t Object::ContainedWeight() {
-  uint32_t ret = 0;
-  for (auto ind : contents) {
-    ret += ind->weight;
-  }
-  return ret;
+uint32_t Object::ContainedWeight() const {
+#ifdef ACIDMUD_DEBUG
+  ContainedTotalsValid();
+#endif
+  return contained_weight;
 }
 
-uint32_t Object::ContainedVolume() {
-  uint32_t ret = 0;
+uint32_t Object::ContainedVolume() const {
+#ifdef ACIDMUD_DEBUG
+  ContainedTotalsValid();
+#endif
+  return contained_volume;
+}
+
+// Slow full recount, used to verify the running totals in debug builds and tests.
+bool Object::ContainedTotalsValid() const {
+  uint32_t wt = 0;
+  uint32_t vol = 0;
   for (auto ind : contents) {
-    ret += ind->volume;
+    if (ind->parent == this) {
+      wt += ind->weight;
+      vol += ind->volume;
+    }
+  }
+  if (wt != contained_weight || vol != contained_volume) {
+    loger(
+        u8"Error: Contained totals for '{}' are {}/{}, but should be {}/{}!",
+        ShortDesc(),
+        contained_weight,
+        contained_volume,
+        wt,
+        vol);
+    return false;
   }
-  return ret;
+  return true;
 }
 
 static int get_ordinal(const std::u8string_view& t) {
@@ -2827,12 +3866,15 @@ DArr64<Object*> Object::PickObjects(const std::u8string_view& inname, int loc, i
 
   if ((loc & LOC_NEARBY) && (parent != nullptr)) {
     auto cont = parent->Contents(loc); //"loc" includes vmode.
+    DArr64<Object*> cands;
+    bool indexed = parent->KeywordCandidates(name, cands);
 
     for (auto ind : cont)
       if (!ind->no_seek) {
         if (ind == this)
           continue; // Must use u8"self" to pick self!
-        if (ind->Filter(loc) && ind->Matches(name, (loc & LOC_NINJA) || Knows(ind))) {
+        if ((!indexed || std::binary_search(cands.begin(), cands.end(), ind)) &&
+            ind->Filter(loc) && ind->Matches(name, (loc & LOC_NINJA) || Knows(ind))) {
           if (tag(ind, ret, ordinal, (parent->Parent() == nullptr) | (loc & LOC_SPECIAL))) {
             return ret;
           }
@@ -2884,10 +3926,13 @@ DArr64<Object*> Object::PickObjects(const std::u8string_view& inname, int loc, i
       }
     }
 
+    DArr64<Object*> cands;
+    bool indexed = KeywordCandidates(name, cands);
     for (auto ind : cont) {
       if (ind == this)
         continue; // Must use u8"self" to pick self!
-      if (ind->Filter(loc) && ind->Matches(name, (loc & LOC_NINJA) || Knows(ind))) {
+      if ((!indexed || std::binary_search(cands.begin(), cands.end(), ind)) &&
+          ind->Filter(loc) && ind->Matches(name, (loc & LOC_NINJA) || Knows(ind))) {
         if (tag(ind, ret, ordinal, (Parent() == nullptr) | (loc & LOC_SPECIAL))) {
           return ret;
         }
@@ -3049,6 +4094,11 @@ void Object::NotifyGone(Object* obj, Object* newloc, int up) {
 void Object::AddAct(act_t a, Object* o) {
   StopAct(a);
   actions.push_back(act_pair(a, o));
+  if (a == act_t::SPECIAL_LINKED) {
+    exits_changed();
+  } else if (a >= act_t::HOLD && a < act_t::WEAR_MAX) {
+    InvalidateLight();
+  }
   if (o) {
     o->NowTouching(this);
   }
@@ -3061,6 +4111,11 @@ void Object::StopAct(act_t a) {
   if (itr != actions.end()) {
     Object* obj = itr->obj();
     actions.erase(itr);
+    if (a == act_t::SPECIAL_LINKED) {
+      exits_changed();
+    } else if (a >= act_t::HOLD && a < act_t::WEAR_MAX) {
+      InvalidateLight();
+    }
     if (a == act_t::HOLD && IsAct(act_t::OFFER)) {
       // obj->SendOut(0, 0, u8";s stops offering.\n", u8"", obj, nullptr);
       StopAct(act_t::OFFER);
@@ -3155,7 +4210,7 @@ void Object::UpdateDamage() {
       Collapse();
       AddAct(act_t::DEAD);
       std::set<std::shared_ptr<Mind>> removals;
-      for (auto mnd : minds) {
+      for (const auto& mnd : minds) {
         if (mnd->Type() == mind_t::REMOTE)
           removals.insert(mnd);
       }
@@ -3336,11 +4391,15 @@ void Object::Send(int tnum, int rsucc, const std::u8string_view& mes) {
     return;
   }
 
-  for (auto mind : minds) {
-    Object* body = mind->Body();
-    mind->body = this;
-    mind->Send(mes);
-    mind->body = body;
+  for (const auto& mind : minds) {
+    if (mind->Shared()) {
+      Object* body = mind->Body();
+      mind->body = this;
+      mind->Send(mes);
+      mind->body = body;
+    } else {
+      mind->Send(mes);
+    }
   }
 }
 
@@ -3355,16 +4414,127 @@ void Object::Send(channel_t channel, const std::u8string_view& mes) {
     return Send(channel, tosend);
   }
 
-  for (auto mind : minds) {
+  for (const auto& mind : minds) {
     if (channel == CHANNEL_ROLLS && mind->IsSVar(u8"combatinfo")) {
-      Object* body = mind->Body();
-      mind->body = this;
       mind->Send(mes);
-      mind->body = body;
     }
   }
 }
 
+// A SendOut() message, with its ;s markers found once, and the nouns filled into them
+// remembered, as most of those who see it will see exactly the same thing.
+struct outgoing_message {
+  // A Noun(), which only varies between viewers for those who are (or own) it, or who
+  // know the names of those involved.
+  struct noun_view {
+    const Object* obj;
+    const Object* owner;
+    bool verbose;
+    const Object* sub;
+    std::u8string seen[4];
+    bool have[4] = {false, false, false, false};
+
+    noun_view(const Object* o, bool v, const Object* s)
+        : obj(o), owner((o) ? o->Owner() : nullptr), verbose(v), sub(s) {}
+    std::u8string For(const Object* viewer) {
+      if (!obj) {
+        return u8"";
+      } else if (viewer == obj || viewer == owner) {
+        return obj->Noun(false, verbose, viewer, sub);
+      }
+      const int known = (viewer->Knows(obj) ? 1 : 0) | ((owner && viewer->Knows(owner)) ? 2 : 0);
+      if (!have[known]) {
+        seen[known] = obj->Noun(false, verbose, viewer, sub);
+        have[known] = true;
+      }
+      return seen[known];
+    }
+  };
+
+  // A message with each ;s swapped to {}, split at those, to be filled with nouns.
+  struct message_template {
+    std::u8string text;
+    std::u8string_view pieces[3];
+    int slots = 0;
+
+    bool Parse(const std::u8string& mes, int max_slots, std::u8string_view which) {
+      text = mes;
+      size_t start = 0;
+      bool just_swapped = false;
+      int num_braces[] = {0, 0};
+      for (size_t pos = 0; pos < text.length(); ++pos) {
+        auto& ctr = text[pos];
+        if (just_swapped) {
+          ctr = '}';
+          just_swapped = false;
+          ++num_braces[1];
+        } else if (ctr == ';') {
+          ctr = '{';
+          just_swapped = true;
+          ++num_braces[0];
+          if (slots < 2) {
+            pieces[slots++] = std::u8string_view(text).substr(start, pos - start);
+          }
+          start = pos + 2;
+        } else if (ctr == '{' || ctr == '}') {
+          ctr = ';';
+          just_swapped = false;
+        }
+      }
+      if (num_braces[0] != num_braces[1]) {
+        loger(u8"ERROR: Mismatched braces in SendOut() {}: '{}'!", which, text);
+        return false; // Abort sending, this may throw an exception!
+      } else if (num_braces[0] > max_slots) {
+        loger(u8"ERROR: Too many opening braces in SendOut() {}: '{}'!", which, text);
+        return false; // Abort sending, this may throw an exception!
+      }
+      pieces[slots] = std::u8string_view(text).substr(std::min(start, text.length()));
+      return true;
+    }
+    std::u8string Fill(const std::u8string& first, const std::u8string& second = u8"") const {
+      std::u8string ret(pieces[0]);
+      if (slots > 0) {
+        ret += first;
+        ret += pieces[1];
+      }
+      if (slots > 1) {
+        ret += second;
+        ret += pieces[2];
+      }
+      return ret;
+    }
+  };
+
+  int tnum;
+  int rsucc;
+  const std::u8string& mes;
+  const std::u8string& youmes;
+  Object* actor;
+  Object* targ;
+  message_template str;
+  message_template youstr;
+  bool valid;
+  noun_view anoun;
+  noun_view tnoun;
+
+  outgoing_message(
+      int tn,
+      int rs,
+      const std::u8string& m,
+      const std::u8string& ym,
+      Object* a,
+      Object* t)
+      : tnum(tn),
+        rsucc(rs),
+        mes(m),
+        youmes(ym),
+        actor(a),
+        targ(t),
+        valid(str.Parse(m, 2, u8"str") && youstr.Parse(ym, 1, u8"youstr")),
+        anoun(a, true, nullptr),
+        tnoun(t, false, a) {}
+};
+
 void Object::SendOut(
     int tnum,
     int rsucc,
@@ -3376,208 +4546,232 @@ void Object::SendOut(
   if (no_seek)
     return;
 
-  if (this != actor) { // Don't trigger yourself!
-    for (auto trig : contents) {
-      if (!mes.starts_with(u8";s says '")) {
-        // Type 0x1000010 (MOB + MOB-ACT)
-        if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x1000010) == 0x1000010) {
-          if (trig->Desc()[0] == '*') { // All Actions
-            new_trigger(Dice::Rand(300, 699), trig, actor, mes);
-          } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
-            if (phrase_match(mes, trig->Desc())) {
-              new_trigger(Dice::Rand(300, 699), trig, actor, mes);
-            }
-          } else { // Match Words
-            if (words_match(mes, trig->Desc())) {
-              new_trigger(Dice::Rand(300, 699), trig, actor, mes);
+  outgoing_message out(tnum, rsucc, mes, youmes, actor, targ);
+  SendOut(out, expanding);
+}
+
+void Object::SendOut(outgoing_message& out, bool expanding) {
+  if (no_seek)
+    return;
+
+  if (this != out.actor) { // Don't trigger yourself!
+    const uint32_t types = Room()->TriggerTypesWithin();
+    if (types == ~0U) { // Not indexed, check them all, directly
+      for (auto trig : contents) {
+        if (!out.mes.starts_with(u8";s says '")) {
+          // Type 0x1000010 (MOB + MOB-ACT)
+          if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x1000010) == 0x1000010) {
+            if (trig->Desc()[0] == '*') { // All Actions
+              new_trigger(Dice::Rand(300, 699), trig, out.actor, out.mes);
+            } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
+              if (phrase_match(out.mes, trig->Desc())) {
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, out.mes);
+              }
+            } else { // Match Words
+              if (words_match(out.mes, trig->Desc())) {
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, out.mes);
+              }
             }
           }
-        }
-      } else {
-        // Type 0x1000008 (MOB + MOB-SPEECH)
-        if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x1000008) == 0x1000008) {
-          // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
-          // trig->Skill(prhash(u8"TBAScript"))
-          // <= 5034507)
-          //  logeb(u8"[#{}] Got message: '{}'",
-          //  trig->Skill(prhash(u8"TBAScript")), mes);
-          std::u8string_view speech = mes;
-          speech = speech.substr(9);
-          while (!speech.empty() && speech.back() != '\'') {
-            speech = speech.substr(0, speech.length() - 1);
-          }
-          if (!speech.empty()) {
-            speech = speech.substr(0, speech.length() - 1);
-          }
-
-          if (trig->Desc()[0] == '*') { // All Speech
-            new_trigger(Dice::Rand(300, 699), trig, actor, speech);
-          } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
-            if (phrase_match(speech, trig->Desc())) {
-              // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
-              // trig->Skill(prhash(u8"TBAScript"))
-              // <= 5034507)
-              //  logeb(u8"Triggering(f): {}", trig->Noun());
-              new_trigger(Dice::Rand(300, 699), trig, actor, speech);
+        } else {
+          // Type 0x1000008 (MOB + MOB-SPEECH)
+          if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x1000008) == 0x1000008) {
+            // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
+            // trig->Skill(prhash(u8"TBAScript"))
+            // <= 5034507)
+            //  logeb(u8"[#{}] Got message: '{}'",
+            //  trig->Skill(prhash(u8"TBAScript")), mes);
+            std::u8string_view speech = out.mes;
+            speech = speech.substr(9);
+            while (!speech.empty() && speech.back() != '\'') {
+              speech = speech.substr(0, speech.length() - 1);
             }
-          } else { // Match Words
-            if (words_match(speech, trig->Desc())) {
-              // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
-              // trig->Skill(prhash(u8"TBAScript"))
-              // <= 5034507)
-              //  logeb(u8"Triggering(w): {}", trig->Noun());
-              new_trigger(Dice::Rand(300, 699), trig, actor, speech);
+            if (!speech.empty()) {
+              speech = speech.substr(0, speech.length() - 1);
             }
-          }
 
-          // Type 0x4000008 (ROOM + ROOM-SPEECH)
-        } else if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x4000008) == 0x4000008) {
-          std::u8string_view speech = mes;
-          speech = speech.substr(9);
-          while (!speech.empty() && speech.back() != '\'') {
-            speech = speech.substr(0, speech.length() - 1);
-          }
-          if (!speech.empty()) {
-            speech = speech.substr(0, speech.length() - 1);
-          }
+            if (trig->Desc()[0] == '*') { // All Speech
+              new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+            } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
+              if (phrase_match(speech, trig->Desc())) {
+                // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
+                // trig->Skill(prhash(u8"TBAScript"))
+                // <= 5034507)
+                //  logeb(u8"Triggering(f): {}", trig->Noun());
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+              }
+            } else { // Match Words
+              if (words_match(speech, trig->Desc())) {
+                // if (trig->Skill(prhash(u8"TBAScript")) >= 5034503 &&
+                // trig->Skill(prhash(u8"TBAScript"))
+                // <= 5034507)
+                //  logeb(u8"Triggering(w): {}", trig->Noun());
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+              }
+            }
 
-          if (trig->Desc()[0] == '*') { // All Speech
-            new_trigger(Dice::Rand(300, 699), trig, actor, speech);
-          } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
-            if (phrase_match(speech, trig->Desc())) {
-              new_trigger(Dice::Rand(300, 699), trig, actor, speech);
+            // Type 0x4000008 (ROOM + ROOM-SPEECH)
+          } else if ((trig->Skill(prhash(u8"TBAScriptType")) & 0x4000008) == 0x4000008) {
+            std::u8string_view speech = out.mes;
+            speech = speech.substr(9);
+            while (!speech.empty() && speech.back() != '\'') {
+              speech = speech.substr(0, speech.length() - 1);
+            }
+            if (!speech.empty()) {
+              speech = speech.substr(0, speech.length() - 1);
             }
-          } else { // Match Words
-            if (words_match(speech, trig->Desc())) {
-              new_trigger(Dice::Rand(300, 699), trig, actor, speech);
+
+            if (trig->Desc()[0] == '*') { // All Speech
+              new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+            } else if (trig->Skill(prhash(u8"TBAScriptNArg")) == 0) { // Match Full Phrase
+              if (phrase_match(speech, trig->Desc())) {
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+              }
+            } else { // Match Words
+              if (words_match(speech, trig->Desc())) {
+                new_trigger(Dice::Rand(300, 699), trig, out.actor, speech);
+              }
             }
           }
         }
       }
+    } else if (types & 0x0000018) { // Someone here is listening for speech or actions
+      const bool speaking = out.mes.starts_with(u8";s says '");
+      std::u8string_view text = out.mes;
+      if (speaking) {
+        text = text.substr(9);
+        const auto quote = text.rfind('\'');
+        text = (quote == std::u8string_view::npos) ? u8"" : text.substr(0, quote);
+      }
+      const auto& fired = Room()->TriggersSetOff(text, speaking);
+      if (std::ranges::any_of(fired, [this](auto trig) { return trig->parent == this; })) {
+        for (auto trig : contents) { // Fire them in the same order as always
+          if (std::ranges::find(fired, trig) != fired.end()) {
+            new_trigger(Dice::Rand(300, 699), trig, out.actor, text);
+          }
+        }
+      }
     }
   }
 
-  std::u8string tstr = u8"";
-  if (targ) {
-    tstr = targ->Noun(0, 0, this, actor);
-  }
-  std::u8string astr = u8"";
-  if (actor) {
-    astr = actor->Noun(0, 1, this);
-  }
-
-  auto str = mes;
-  auto youstr = youmes;
-
-  bool just_swapped = false;
-  int num_braces[] = {0, 0};
-  for (auto& ctr : str) {
-    if (just_swapped) {
-      ctr = '}';
-      just_swapped = false;
-      ++num_braces[1];
-    } else if (ctr == ';') {
-      ctr = '{';
-      just_swapped = true;
-      ++num_braces[0];
-    } else if (ctr == '{' || ctr == '}') {
-      ctr = ';';
-      just_swapped = false;
-    }
-  }
-  if (num_braces[0] != num_braces[1]) {
-    loger(u8"ERROR: Mismatched braces in SendOut() str: '{}'!", str);
-    return; // Abort sending, this may throw an exception!
-  } else if (num_braces[0] > 2) {
-    loger(u8"ERROR: Too many opening braces in SendOut() str: '{}'!", str);
-    return; // Abort sending, this may throw an exception!
-  }
-
-  just_swapped = false;
-  num_braces[0] = 0;
-  num_braces[1] = 0;
-  for (auto& ctr : youstr) {
-    if (just_swapped) {
-      ctr = '}';
-      just_swapped = false;
-      ++num_braces[1];
-
-    } else if (ctr == ';') {
-      ctr = '{';
-      just_swapped = true;
-      ++num_braces[0];
-    } else if (ctr == '{' || ctr == '}') {
-      ctr = ';';
-      just_swapped = false;
-    }
-  }
-  if (num_braces[0] != num_braces[1]) {
-    loger(u8"ERROR: Mismatched braces in SendOut() youstr: '{}'!", youstr);
-    return; // Abort sending, this may throw an exception!
-  } else if (num_braces[0] > 1) {
-    loger(u8"ERROR: Too many opening braces in SendOut() youstr: '{}'!", youstr);
-    return; // Abort sending, this may throw an exception!
-  }
-
-  if (youstr[0] == '*' && this == actor) {
-    Send(ALL, -1, CGRN);
-    Send(ALL, -1, youstr.substr(1), tstr);
-    Send(ALL, -1, CNRM);
-  } else if (this == actor) {
-    Send(ALL, -1, youstr, tstr);
-  } else if (str[0] == '*' && targ == this) {
-    Send(ALL, -1, CRED);
-    Send(tnum, rsucc, str.substr(1), astr, tstr);
-    Send(ALL, -1, CNRM);
-  } else if (str[0] == '*') {
-    Send(ALL, -1, CMAG);
-    Send(tnum, rsucc, str.substr(1), astr, tstr);
-    Send(ALL, -1, CNRM);
-  } else {
-    Send(tnum, rsucc, str, astr, tstr);
+  if (!out.valid) {
+    return;
+  }
+
+  if (HasMind()) { // Nobody to see it here, so don't bother to describe it here
+    Object* actor = out.actor;
+    Object* targ = out.targ;
+    const auto& str = out.str;
+    const auto& youstr = out.youstr;
+    if (youstr.text[0] == '*' && this == actor) {
+      Send(ALL, -1, CGRN);
+      Send(ALL, -1, std::u8string_view(youstr.Fill(out.tnoun.For(this))).substr(1));
+      Send(ALL, -1, CNRM);
+    } else if (this == actor) {
+      Send(ALL, -1, youstr.Fill(out.tnoun.For(this)));
+    } else if (str.text[0] == '*' && targ == this) {
+      Send(ALL, -1, CRED);
+      Send(
+          out.tnum,
+          out.rsucc,
+          std::u8string_view(str.Fill(out.anoun.For(this), out.tnoun.For(this))).substr(1));
+      Send(ALL, -1, CNRM);
+    } else if (str.text[0] == '*') {
+      Send(ALL, -1, CMAG);
+      Send(
+          out.tnum,
+          out.rsucc,
+          std::u8string_view(str.Fill(out.anoun.For(this), out.tnoun.For(this))).substr(1));
+      Send(ALL, -1, CNRM);
+    } else {
+      Send(out.tnum, out.rsucc, str.Fill(out.anoun.For(this), out.tnoun.For(this)));
+    }
   }
 
   for (auto ind : contents) {
     if (ind->Skill(prhash(u8"Open")) || ind->Skill(prhash(u8"Transparent")))
-      ind->SendOut(tnum, rsucc, mes, youmes, actor, targ, false);
+      ind->SendOut(out, false);
     else if (ind->Position() != pos_t::NONE) // FIXME - Understand Transparency
-      ind->SendOut(tnum, rsucc, mes, youmes, actor, targ, false);
+      ind->SendOut(out, false);
   }
 
   if (expanding && parent && (Skill(prhash(u8"Open")) || Skill(prhash(u8"Transparent")))) {
     no_seek = true;
-    parent->SendOut(tnum, rsucc, mes, youmes, actor, targ, true);
+    parent->SendOut(out, true);
     no_seek = false;
   }
 
-  if (targ && targ != this && HasMind() && targ->HasSkill(prhash(u8"Object ID")) &&
-      mes.starts_with(u8";s introduces ;s as")) {
-    Learn(targ->Skill(prhash(u8"Object ID")), targ->Name());
+  if (out.targ && out.targ != this && HasMind() && out.targ->HasSkill(prhash(u8"Object ID")) &&
+      out.mes.starts_with(u8";s introduces ;s as")) {
+    Learn(out.targ->Skill(prhash(u8"Object ID")), out.targ->Name());
   }
 }
 
 void Object::Loud(int str, const std::u8string& mes) {
-  std::set<Object*> visited;
-  Loud(visited, str, mes);
-}
+  uint32_t idx = 0;
+  exit_graph* graph = exits_of(this, idx);
+  if (!graph || str <= 0) {
+    return; // Not a room in a zone, so it has nowhere to echo to
+  }
+  ++exits_search;
+  if (exits_search == 0) { // Wrapped around, so forget every search, to start over
+    for (auto& zone : exit_graphs) {
+      std::fill(zone.second.stamp.begin(), zone.second.stamp.end(), 0);
+    }
+    exits_search = 1;
+  }
 
-void Object::Loud(std::set<Object*>& visited, int str, const std::u8string& mes) {
-  visited.insert(this);
-  auto targs = ConnectionExits();
-  for (auto dest : targs) {
-    if (dest && dest->Parent()) {
-      if (!visited.contains(dest->Parent())) {
+  // Spread out loudest-first, so everywhere hears it as loudly as it can get there.
+  struct hop {
+    exit_graph* graph;
+    uint32_t idx;
+    Object* door; // Where it was heard from
+  };
+  std::vector<std::vector<hop>> by_str(str + 1);
+  std::vector<hop> heard;
+  graph->stamp[idx] = exits_search;
+  graph->best[idx] = str;
+  by_str[str].push_back({graph, idx, nullptr});
+  for (int cur = str; cur > 0; --cur) {
+    for (size_t pos = 0; pos < by_str[cur].size(); ++pos) {
+      const hop here = by_str[cur][pos];
+      if (here.graph->best[here.idx] != cur) {
+        continue; // Got there louder some other way
+      }
+      if (here.door) {
+        heard.push_back(here);
+      }
+      for (const auto& exit : here.graph->exits[here.idx]) {
+        if (!exit.odoor) {
+          continue;
+        }
+        exit_graph* dgraph = here.graph;
+        uint32_t didx = exit.dest;
+        if (didx == NO_ROOM) {
+          dgraph = exits_of(exit.odoor->Parent(), didx);
+          if (!dgraph) {
+            continue;
+          }
+        }
         int sound_reduction = 1;
-        if (dest->Skill(prhash(u8"Open")) < 1 && dest->Skill(prhash(u8"Transparent")) < 1) {
+        if (exit.odoor->Skill(prhash(u8"Open")) < 1 &&
+            exit.odoor->Skill(prhash(u8"Transparent")) < 1) {
           sound_reduction = 2; // TODO: Transparent is wrong prop: Soundproof Glass, etc.
         }
-        if ((str - sound_reduction) > 0) {
-          dest->Parent()->SendOut(ALL, 0, u8"From ;s you hear {}\n", u8"", dest, dest, mes);
-          dest->Parent()->Loud(visited, str - sound_reduction, mes);
+        const int next = cur - sound_reduction;
+        if (next > 0 && (dgraph->stamp[didx] != exits_search || dgraph->best[didx] < next)) {
+          dgraph->stamp[didx] = exits_search;
+          dgraph->best[didx] = next;
+          by_str[next].push_back({dgraph, didx, exit.odoor});
         }
       }
     }
   }
+
+  const auto from = fmt::format(u8"From ;s you hear {}\n", mes);
+  for (const auto& here : heard) {
+    here.graph->rooms[here.idx]->SendOut(ALL, 0, from, u8"", here.door, here.door);
+  }
 }
 
 void init_universe() {
@@ -3595,6 +4789,8 @@ void destroy_universe() {
   universe = nullptr;
   delete trash_bin;
   trash_bin = nullptr;
+  trash_queue.clear();
+  trash_pending.clear();
 }
 void start_universe() {
   if (!universe->Load(u8"acid/current.wld")) {
@@ -3669,33 +4865,13 @@ void Object::BusyFor(long msec, const std::u8string& default_next) {
   if (busy_until == 0) {
     busy_until = 1; // Avoid Special Case
   }
-  if (defact[0] != '\0') {
-    delete[] defact;
-  }
-  if (default_next.length() == 0) {
-    defact = u8"";
-  } else {
-    auto new_d = new char8_t[default_next.length() + 1];
-    std::memcpy(new_d, default_next.c_str(), default_next.length() + 1);
-    defact = new_d;
-  }
-  busylist.insert(this);
+  busylist[this].defact = default_next;
 }
 
 void Object::BusyWith(Object* other, const std::u8string& default_next) {
   // loge(u8"Holding {}, will default do '{}'!", reinterpret_cast<void*>(this), default_next);
   busy_until = other->busy_until;
-  if (defact[0] != '\0') {
-    delete[] defact;
-  }
-  if (default_next.length() == 0) {
-    defact = u8"";
-  } else {
-    auto new_d = new char8_t[default_next.length() + 1];
-    std::memcpy(new_d, default_next.c_str(), default_next.length() + 1);
-    defact = new_d;
-  }
-  busylist.insert(this);
+  busylist[this].defact = default_next;
 }
 
 bool Object::StillBusy() const {
@@ -3712,38 +4888,19 @@ bool Object::StillBusy() const {
 
 void Object::DoWhenFree(const std::u8string& action) {
   // loge(u8"Adding busyact for {} of '{}'!", reinterpret_cast<void*>(this), action);
-  std::u8string dwf = dowhenfree;
+  auto& dwf = busylist[this].dowhenfree;
   dwf += u8";";
   dwf += action;
-  if (dwf.length() == 0) {
-    if (dowhenfree[0] != '\0') {
-      delete[] dowhenfree;
-    }
-    dowhenfree = u8"";
-  } else {
-    if (dowhenfree[0] != '\0') {
-      delete[] dowhenfree;
-    }
-    auto new_d = new char8_t[dwf.length() + 1];
-    std::memcpy(new_d, dwf.c_str(), dwf.length() + 1);
-    dowhenfree = new_d;
-  }
-  busylist.insert(this);
 }
 
 bool Object::BusyAct() {
   // loge(u8"Taking busyact {}!", reinterpret_cast<void*>(this));
-  busylist.erase(this);
-
-  std::u8string comm = dowhenfree;
-  std::u8string def = defact;
-  if (dowhenfree[0] != '\0') {
-    delete[] dowhenfree;
-    dowhenfree = u8"";
-  }
-  if (defact[0] != '\0') {
-    delete[] defact;
-    defact = u8"";
+  std::u8string comm;
+  std::u8string def;
+  auto busy = busylist.extract(this);
+  if (!busy.empty()) {
+    comm = std::move(busy.mapped().dowhenfree);
+    def = std::move(busy.mapped().defact);
   }
 
   // loge(u8"Act is {} [{}]!", comm, def);
@@ -3770,10 +4927,10 @@ void Object::FreeActions() {
   int maxinit = 0;
   std::map<Object*, int> initlist;
   for (auto busy : busylist) {
-    if (!busy->StillBusy()) {
-      initlist[busy] = busy->RollInitiative();
-      if (maxinit < initlist[busy]) {
-        maxinit = initlist[busy];
+    if (!busy.first->StillBusy()) {
+      initlist[busy.first] = busy.first->RollInitiative();
+      if (maxinit < initlist[busy.first]) {
+        maxinit = initlist[busy.first];
       }
     }
   }
@@ -3811,7 +4968,10 @@ std::u8string Object::Tactics(int phase) {
   if (!HasMind()) {
     return u8"attack";
   }
-  std::shared_ptr<Mind> mind = minds.front(); // FIXME: Handle Multiple Minds
+  Mind* mind = minds.front().get(); // FIXME: Handle Multiple Minds
+  if (!mind->Shared()) {
+    return mind->Tactics();
+  }
   Object* body = mind->Body();
   mind->body = this;
   std::u8string ret = mind->Tactics();
@@ -3832,8 +4992,9 @@ bool Object::IsSameAs(const Object& in) const {
   if (dlens.ld != in.dlens.ld) {
     return false;
   }
-  if (std::memcmp(descriptions, in.descriptions, dlens.sd + dlens.n + dlens.d + dlens.ld + 4) !=
-      0) {
+  if (descriptions != in.descriptions && // Copies of one thing share them, so are quick
+      std::memcmp(descriptions, in.descriptions, dlens.sd + dlens.n + dlens.d + dlens.ld + 4) !=
+          0) {
     return false;
   }
   if (weight != in.weight) {
@@ -3899,28 +5060,30 @@ bool Object::IsSameAs(const Object& in) const {
     }
   }
 
-  auto sk1 = skills;
-  auto sk2 = in.skills;
-  for (auto sk = sk1.begin(); sk != sk1.end();) {
-    if (sk->first == prhash(u8"Hungry") || sk->first == prhash(u8"Bored") ||
-        sk->first == prhash(u8"Needy") || sk->first == prhash(u8"Tired")) {
-      sk1.erase(sk);
-    } else {
-      ++sk;
+  if (skills != in.skills) { // Copies of one thing usually still have exactly the same ones
+    auto sk1 = skills;
+    auto sk2 = in.skills;
+    for (auto sk = sk1.begin(); sk != sk1.end();) {
+      if (sk->first == prhash(u8"Hungry") || sk->first == prhash(u8"Bored") ||
+          sk->first == prhash(u8"Needy") || sk->first == prhash(u8"Tired")) {
+        sk1.erase(sk);
+      } else {
+        ++sk;
+      }
     }
-  }
-  for (auto sk = sk2.begin(); sk != sk2.end();) {
-    if (sk->first == prhash(u8"Hungry") || sk->first == prhash(u8"Bored") ||
-        sk->first == prhash(u8"Needy") || sk->first == prhash(u8"Tired")) {
-      sk2.erase(sk);
-    } else {
-      ++sk;
+    for (auto sk = sk2.begin(); sk != sk2.end();) {
+      if (sk->first == prhash(u8"Hungry") || sk->first == prhash(u8"Bored") ||
+          sk->first == prhash(u8"Needy") || sk->first == prhash(u8"Tired")) {
+        sk2.erase(sk);
+      } else {
+        ++sk;
+      }
+    }
+    std::sort(sk1.begin(), sk1.end());
+    std::sort(sk2.begin(), sk2.end());
+    if (sk1 != sk2) {
+      return false;
     }
-  }
-  std::sort(sk1.begin(), sk1.end());
-  std::sort(sk2.begin(), sk2.end());
-  if (sk1 != sk2) {
-    return false;
   }
 
   // Also only allow objects to contain identical things.
@@ -3941,20 +5104,18 @@ void Object::operator=(const Object& in) {
   }
 
   dlens = in.dlens;
-  if (descriptions != default_descriptions) {
-    delete[] descriptions;
+  if (in.descriptions != default_descriptions) {
+    share_descs(in.descriptions); // First, in case they were already mine too
   }
-  if (in.descriptions == default_descriptions) {
-    descriptions = default_descriptions;
-  } else {
-    const size_t len = dlens.sd + dlens.n + dlens.d + dlens.ld + 4;
-    char8_t* new_descs = new char8_t[len];
-    std::memcpy(new_descs, in.descriptions, len);
-    descriptions = new_descs;
+  if (descriptions != default_descriptions) {
+    release_descs(descriptions);
   }
+  descriptions = in.descriptions;
+  KeywordRefresh();
+  NounChanged();
 
-  weight = in.weight;
-  volume = in.volume;
+  SetWeight(in.weight);
+  SetVolume(in.volume);
   size = in.size;
   value = in.value;
   gender = in.gender;
@@ -3966,7 +5127,13 @@ void Object::operator=(const Object& in) {
   attr[4] = in.attr[4];
   attr[5] = in.attr[5];
 
+  bool triggers = HasSkill(prhash(u8"TBAScriptType")) || in.HasSkill(prhash(u8"TBAScriptType"));
   skills = in.skills;
+  if (triggers) {
+    InvalidateTriggerType();
+  }
+  InvalidateLight();
+  InvalidateSight();
 
   position = in.position;
 
@@ -3980,32 +5147,111 @@ void Object::operator=(const Object& in) {
 }
 
 DArr64<Object*, 3> Object::Contents(int vmode) const {
-  DArr64<Object*, 3> ret;
   if (vmode & LOC_NINJA) {
-    ret = contents;
+    return contents;
+  }
+
+  const int sense = ((vmode & (LOC_HEAT | LOC_TOUCH)) == 0) ? 0 : 1;
+  DArr64<Object*, 3> seen;
+  auto memo = sight_memos.find(this);
+  if (memo != sight_memos.end() && (memo->second.known & (1 << sense))) {
+    ++sight_hits;
+    if ((vmode & (LOC_FIXED | LOC_NOTFIXED)) == 0) {
+      return memo->second.seen[sense];
+    }
+    seen = memo->second.seen[sense];
   } else {
+    ++sight_misses;
+    bool mine = true;
     for (auto item : contents) {
+      mine = mine && item->parent == this;
       if (item->Skill(prhash(u8"Invisible")) >= 1000)
         continue; // Not Really There
-      if ((vmode & (LOC_HEAT | LOC_TOUCH)) == 0 && item->Skill(prhash(u8"Invisible"))) {
+      if (sense == 0 && item->Skill(prhash(u8"Invisible"))) {
         continue;
       }
-      if ((vmode & LOC_FIXED) && item->Position() != pos_t::NONE)
-        continue;
-      if ((vmode & LOC_NOTFIXED) && item->Position() == pos_t::NONE)
-        continue;
-      ret.push_back(item);
+      seen.push_back(item);
+    }
+    if (mine && !contents.empty()) {
+      auto& keep = sight_memos[this];
+      keep.known |= (1 << sense);
+      keep.seen[sense] = seen;
     }
   }
+
+  if ((vmode & (LOC_FIXED | LOC_NOTFIXED)) == 0) {
+    return seen;
+  }
+  DArr64<Object*, 3> ret;
+  for (auto item : seen) {
+    if ((vmode & LOC_FIXED) && item->Position() != pos_t::NONE)
+      continue;
+    if ((vmode & LOC_NOTFIXED) && item->Position() == pos_t::NONE)
+      continue;
+    ret.push_back(item);
+  }
   return ret;
 }
 
+// Something in or on me, or me, that lights things, or lets light through, changed.
+void Object::InvalidateLight() {
+  if (light_memos.empty()) {
+    return;
+  }
+  for (const Object* obj = this; obj; obj = obj->parent) {
+    light_invalidations += light_memos.erase(obj);
+  }
+}
+
+// I became visible, or invisible, so whatever I'm in has a different view.
+void Object::InvalidateSight() {
+  if (parent && !sight_memos.empty()) {
+    sight_invalidations += sight_memos.erase(parent);
+  }
+}
+
+// Something entered or left me, so neither my light nor my view are the same.
+void Object::InvalidateContents() {
+  if (!sight_memos.empty()) {
+    sight_invalidations += sight_memos.erase(this);
+  }
+  keys_changed(this);
+  InvalidateLight();
+}
+
+void Object::ReportSightCache() {
+  const uint64_t ticks = std::max(uint64_t(1), trash_tick - sight_since);
+  const uint64_t lights = light_hits + light_misses;
+  const uint64_t sights = sight_hits + sight_misses;
+  logec(
+      u8"Sight cache: {:.1f} light and {:.1f} contents invalidations per tick, {}% and {}% hits.",
+      double(light_invalidations) / double(ticks),
+      double(sight_invalidations) / double(ticks),
+      (lights > 0) ? (light_hits * 100 / lights) : 0,
+      (sights > 0) ? (sight_hits * 100 / sights) : 0);
+  light_hits = 0;
+  light_misses = 0;
+  light_invalidations = 0;
+  sight_hits = 0;
+  sight_misses = 0;
+  sight_invalidations = 0;
+  sight_since = trash_tick;
+}
+
 DArr64<Object*, 3> Object::Contents() const {
   return contents;
 }
 
 DArr64<Object*, 7> Object::Connections(const Object* traveller) const {
   DArr64<Object*, 7> ret; // Includes nulls for unconnected dirs
+  uint32_t idx = 0;
+  const exit_graph* graph = exits_of(this, idx);
+  if (graph) {
+    for (const auto& exit : graph->exits[idx]) {
+      ret.push_back((passable(exit.way, traveller)) ? exit.way_to : nullptr);
+    }
+    return ret;
+  }
   for (std::u8string dir : {u8"north", u8"south", u8"east", u8"west", u8"up", u8"down"}) {
     Object* conn = nullptr;
     Object* door = PickObject(dir, LOC_INTERNAL);
@@ -4026,6 +5272,14 @@ DArr64<Object*, 7> Object::Connections(const Object* traveller) const {
 
 DArr64<Object*, 7> Object::ConnectionExits() const {
   DArr64<Object*, 7> ret; // Includes nulls for unconnected dirs
+  uint32_t idx = 0;
+  const exit_graph* graph = exits_of(this, idx);
+  if (graph) {
+    for (const auto& exit : graph->exits[idx]) {
+      ret.push_back(exit.odoor); // Returns the exit door in dest, not the actual dest.
+    }
+    return ret;
+  }
   for (std::u8string dir : {u8"north", u8"south", u8"east", u8"west", u8"up", u8"down"}) {
     Object* door = PickObject(dir, LOC_NINJA | LOC_INTERNAL);
     Object* odoor = nullptr;
@@ -4058,17 +5312,11 @@ size_t Object::ManhattanDistance(const Object* dest) const {
   return xoff + yoff + zoff;
 }
 
-// Letters from "nsewud", or empty if there, or unreachable
-std::u8string Object::DirectionsTo(const Object* dest, const Object* traveller) const {
-  if (!dest) {
-    return u8""; // You can't go to nowhere.
-  } else if (Zone() != dest->Zone()) {
-    // TODO: Navigation between zones.
-    return u8""; // You can't get there from here.
-  } else if (this == dest) {
-    return u8""; // Already there
-  }
-
+// A* search for the way from one room to another, by looking at each room's exits directly.
+static std::u8string search_directions(
+    const Object* from,
+    const Object* dest,
+    const Object* traveller) {
   struct step {
     size_t est_cost;
     size_t base_cost;
@@ -4082,8 +5330,8 @@ std::u8string Object::DirectionsTo(const Object* dest, const Object* traveller)
   std::set<const Object*> visited;
   std::priority_queue<step, std::vector<step>, std::greater<step>> totry;
 
-  visited.insert(this);
-  totry.push({ManhattanDistance(dest), 0, this, u8""});
+  visited.insert(from);
+  totry.push({from->ManhattanDistance(dest), 0, from, u8""});
 
   while (totry.size() > 0) {
     auto cand = totry.top();
@@ -4110,6 +5358,113 @@ std::u8string Object::DirectionsTo(const Object* dest, const Object* traveller)
   return u8""; // You can't get there from here.
 }
 
+// Letters from "nsewud", or empty if there, or unreachable
+std::u8string Object::DirectionsTo(const Object* dest, const Object* traveller) const {
+  if (!dest) {
+    return u8""; // You can't go to nowhere.
+  } else if (Zone() != dest->Zone()) {
+    // TODO: Navigation between zones.
+    return u8""; // You can't get there from here.
+  } else if (this == dest) {
+    return u8""; // Already there
+  }
+
+  uint32_t idx = 0;
+  exit_graph* graph = exits_of(this, idx);
+  if (!graph) {
+    return search_directions(this, dest, traveller);
+  }
+
+  if (routes_epoch != exits_epoch || routes.size() >= 65536) {
+    routes.clear();
+    routes_epoch = exits_epoch;
+  }
+  const auto key = std::make_tuple(this, dest, key_set(traveller));
+  auto route = routes.find(key);
+  if (route != routes.end()) {
+    return route->second;
+  }
+
+  ++exits_search;
+  if (exits_search == 0) { // Wrapped around, so forget every search, to start over
+    for (auto& zone : exit_graphs) {
+      std::fill(zone.second.stamp.begin(), zone.second.stamp.end(), 0);
+    }
+    exits_search = 1;
+  }
+
+  // The same A* search as search_directions(), in the same order, but over the exit graphs,
+  // with each step just noting where it came from, instead of carrying the whole path along.
+  struct place {
+    exit_graph* graph;
+    uint32_t idx;
+    uint32_t from; // Index into places, of the place before this one
+    char8_t dir;
+  };
+  struct step {
+    size_t est_cost;
+    size_t base_cost;
+    uint32_t place;
+    bool operator>(const step& o) const {
+      return (est_cost > o.est_cost);
+    };
+  };
+  std::vector<place> places;
+  std::priority_queue<step, std::vector<step>, std::greater<step>> totry;
+
+  auto path_to = [&places](uint32_t plc, char8_t last) {
+    std::u8string path(1, last);
+    for (; places[plc].from != NO_ROOM; plc = places[plc].from) {
+      path += places[plc].dir;
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+  };
+
+  std::u8string found;
+  graph->stamp[idx] = exits_search;
+  places.push_back({graph, idx, NO_ROOM, 0});
+  totry.push({ManhattanDistance(dest), 0, 0});
+  while (totry.size() > 0) {
+    auto cand = totry.top();
+    totry.pop();
+    const auto here = places[cand.place];
+    const auto& exits = here.graph->exits[here.idx];
+    bool done = false;
+    for (int dnum = 5; dnum >= 0 && !done; --dnum) {
+      const auto& exit = exits[dnum];
+      if (!exit.way_to || !passable(exit.way, traveller)) {
+        continue;
+      } else if (exit.way_to == dest) {
+        found = path_to(cand.place, u8"nsewud"[dnum]);
+        done = true;
+        continue;
+      }
+      exit_graph* ngraph = here.graph;
+      uint32_t nidx = exit.way_dest;
+      if (nidx == NO_ROOM) {
+        ngraph = exits_of(exit.way_to, nidx);
+        if (!ngraph) { // Leads somewhere that isn't a room in a zone, so do it the long way.
+          return search_directions(this, dest, traveller);
+        }
+      }
+      if (ngraph->stamp[nidx] != exits_search) {
+        ngraph->stamp[nidx] = exits_search;
+        places.push_back({ngraph, nidx, cand.place, u8"nsewud"[dnum]});
+        totry.push(
+            {cand.base_cost + 10 + exit.way_to->ManhattanDistance(dest),
+             cand.base_cost + 10,
+             static_cast<uint32_t>(places.size() - 1)});
+      }
+    }
+    if (done) {
+      break;
+    }
+  }
+  routes.emplace(key, found);
+  return found;
+}
+
 int Object::Contains(const Object* obj) const {
   return (std::find(contents.begin(), contents.end(), obj) != contents.end());
 }
@@ -4135,7 +5490,7 @@ bool Object::Accomplish(uint64_t acc, const std::u8string_view& why) {
     return false;
   }
   completed.push_back(acc);
-  for (auto m : minds) {
+  for (const auto& m : minds) {
     if (m->Owner()) {
       m->Send(CYEL u8"You gain an experience point for {}!\n" CNRM, why);
     }
@@ -4169,7 +5524,7 @@ bool Object::Learn(uint64_t k, const std::u8string_view& what) {
     return false;
   }
   known.push_back(k);
-  for (auto m : minds) {
+  for (const auto& m : minds) {
     if (m->Owner()) {
       m->Send(CYEL u8"You now know {}!\n" CNRM, what);
     }
@@ -4503,29 +5858,61 @@ int Object::LightLevel(int updown) {
     }
   }
   if (updown != 1) { // Go Down
-    for (auto item : contents) {
-      if (!Wearing(item)) { // Containing it (internal)
-        int fac = item->Skill(prhash(u8"Open")) + item->Skill(prhash(u8"Transparent")) +
-            item->Skill(prhash(u8"Translucent"));
-        if (fac > 1000) {
-          fac = 1000;
-        }
-        if (fac > 0) {
-          level += (fac * item->LightLevel(-1));
-        }
-        level += 1000 * item->Skill(prhash(u8"Light Source"));
+    bool settled = true;
+    level += LightWithin(settled);
+  }
+  level /= 1000;
+  level += Skill(prhash(u8"Light Source"));
+  if (level > 1000)
+    level = 1000;
+  return level;
+}
+
+// The light from everything in me, and worn by those, in thousandths.  Clears settled if any
+// of it isn't really in here, as then it couldn't be kept, and neither could anything around it.
+int Object::LightWithin(bool& settled) {
+  auto memo = light_memos.find(this);
+  if (memo != light_memos.end()) {
+    ++light_hits;
+    return memo->second;
+  }
+  ++light_misses;
+
+  int level = 0;
+  bool mine = true;
+  for (auto item : contents) {
+    mine = mine && item->parent == this;
+    if (!Wearing(item)) { // Containing it (internal)
+      int fac = item->Skill(prhash(u8"Open")) + item->Skill(prhash(u8"Transparent")) +
+          item->Skill(prhash(u8"Translucent"));
+      if (fac > 1000) {
+        fac = 1000;
       }
+      if (fac > 0) {
+        level += (fac * item->LightFrom(mine));
+      }
+      level += 1000 * item->Skill(prhash(u8"Light Source"));
+    }
 
-      auto subitem = item->contents.begin();
-      for (; subitem != item->contents.end(); ++subitem) {
-        // Wearing it (external - so reaching one level further)
-        if (item->Wearing(*subitem)) {
-          level += (1000 * (*subitem)->LightLevel(-1));
-        }
+    auto subitem = item->contents.begin();
+    for (; subitem != item->contents.end(); ++subitem) {
+      // Wearing it (external - so reaching one level further)
+      if (item->Wearing(*subitem)) {
+        mine = mine && (*subitem)->parent == item;
+        level += (1000 * (*subitem)->LightFrom(mine));
       }
     }
   }
-  level /= 1000;
+  if (mine && !contents.empty()) {
+    light_memos[this] = level;
+  }
+  settled = settled && mine;
+  return level;
+}
+
+// The same as LightLevel(-1), but passing along whether it could be kept.
+int Object::LightFrom(bool& settled) {
+  int level = LightWithin(settled) / 1000;
   level += Skill(prhash(u8"Light Source"));
   if (level > 1000)
     level = 1000;
@@ -5209,7 +6596,7 @@ DArr64<Object*, 3> Object::PayFor(size_t amount) {
 
 size_t Object::WouldBuyFor(const Object* item) {
   size_t ret = 0;
-  for (auto m : minds) {
+  for (const auto& m : minds) {
     ret = m->WouldBuyFor(item);
     return ret;
   }
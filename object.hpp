@@ -41,6 +41,8 @@ class Object;
 class Player;
 class Mind;
 class ObjectTag;
+struct outgoing_message;
+struct tba_parsed;
 
 #ifndef OBJECT_HPP
 #define OBJECT_HPP
@@ -200,12 +202,15 @@ class alignas(256) Object {
 
   static Object* Universe();
   static Object* TrashBin();
+  static size_t TrashPending(); // Recycled objects not yet reclaimed
+  static size_t ReclaimTrash(size_t max = 256); // Frees up to max old trash, returns count
   const Object* Room() const;
   Object* Room();
   const Object* World() const;
   Object* World();
   const Object* Zone() const;
   Object* Zone();
+  uint32_t TriggerTypesWithin() const; // TBAScriptTypes of all trigger scripts in this room
 
   Object* Next(std::u8string&);
   Object* Split(int nqty);
@@ -286,17 +291,20 @@ class alignas(256) Object {
     }
   };
 
-  void SendActions(std::shared_ptr<Mind> m);
-  void SendExtendedActions(std::shared_ptr<Mind> m, int vmode = 0);
-  void SendFullSituation(std::shared_ptr<Mind> m, Object* o = nullptr);
-  void
-  SendContents(std::shared_ptr<Mind> m, Object* o = nullptr, int vmode = 0, std::u8string b = u8"");
+  void SendActions(const std::shared_ptr<Mind>& m);
+  void SendExtendedActions(const std::shared_ptr<Mind>& m, int vmode = 0);
+  void SendFullSituation(const std::shared_ptr<Mind>& m, Object* o = nullptr);
+  void SendContents(
+      const std::shared_ptr<Mind>& m,
+      Object* o = nullptr,
+      int vmode = 0,
+      std::u8string b = u8"");
 
-  void SendShortDesc(std::shared_ptr<Mind> m, Object* o = nullptr);
-  void SendDesc(std::shared_ptr<Mind> m, Object* o = nullptr);
-  void SendDescSurround(std::shared_ptr<Mind> m, Object* o = nullptr, int vmode = 0);
-  void SendLongDesc(std::shared_ptr<Mind> m, Object* o = nullptr);
-  void SendScore(std::shared_ptr<Mind> m, Object* o = nullptr);
+  void SendShortDesc(const std::shared_ptr<Mind>& m, Object* o = nullptr);
+  void SendDesc(const std::shared_ptr<Mind>& m, Object* o = nullptr);
+  void SendDescSurround(const std::shared_ptr<Mind>& m, Object* o = nullptr, int vmode = 0);
+  void SendLongDesc(const std::shared_ptr<Mind>& m, Object* o = nullptr);
+  void SendScore(const std::shared_ptr<Mind>& m, Object* o = nullptr);
 
   void SendShortDesc(Object* m, Object* o = nullptr);
   void SendDesc(Object* m, Object* o = nullptr);
@@ -324,8 +332,8 @@ class alignas(256) Object {
   int Travel(Object*);
   void AddLink(Object*);
   void RemoveLink(Object*);
-  void Attach(std::shared_ptr<Mind> mind);
-  void Detach(std::shared_ptr<Mind> mind);
+  void Attach(const std::shared_ptr<Mind>& mind);
+  void Detach(const std::shared_ptr<Mind>& mind);
 
   void TryCombine();
 
@@ -380,8 +388,9 @@ class alignas(256) Object {
   // Returns how much NPC/MOB would pay for item, or 0.
   size_t WouldBuyFor(const Object* item);
 
-  uint32_t ContainedWeight();
-  uint32_t ContainedVolume();
+  uint32_t ContainedWeight() const;
+  uint32_t ContainedVolume() const;
+  bool ContainedTotalsValid() const; // Recomputes from contents, for debug checking
 
   uint32_t Weight() const {
     return weight;
@@ -400,8 +409,8 @@ class alignas(256) Object {
   };
 
   void SetCoords(uint32_t x, uint32_t y, uint32_t z = 0) {
-    weight = x;
-    volume = y;
+    SetWeight(x);
+    SetVolume(y);
     size = z;
   };
   uint32_t X() const {
@@ -415,9 +424,15 @@ class alignas(256) Object {
   };
 
   void SetWeight(uint32_t w) {
+    if (parent) {
+      parent->contained_weight += w - weight;
+    }
     weight = w;
   };
   void SetVolume(uint32_t v) {
+    if (parent) {
+      parent->contained_volume += v - volume;
+    }
     volume = v;
   };
   void SetSize(uint32_t s) {
@@ -474,6 +489,8 @@ class alignas(256) Object {
   void UpdatePhysical();
   void UpdateMental();
   void UpdateTBA();
+  void UpdateTBAZone();
+  void ResetTBAZone(int work); // Continue (or start) a zone reset, doing at most this much
   void UpdateGrowth();
   void UpdateSustenance();
   void UpdateLiquids();
@@ -641,7 +658,7 @@ class alignas(256) Object {
     Loud(str, fmt::vformat(mes, fmt::make_args_checked<Args...>(mes, args...)));
   };
 
-  void TBALoadAll();
+  void TBALoadAll(const std::u8string& cache_dir = u8"acid"); // Empty: Always import
   void TBALoadWLD(const std::u8string&);
   void TBALoadOBJ(const std::u8string&);
   void TBALoadMOB(const std::u8string&);
@@ -650,6 +667,7 @@ class alignas(256) Object {
   void TBALoadSHP(const std::u8string&);
   void TBALoadTRG(const std::u8string&);
   static void TBAFinalizeTriggers();
+  static void TBAResetZones();
   static void TBACleanup();
 
   int Load(const std::u8string&);
@@ -687,14 +705,46 @@ class alignas(256) Object {
   bool LoadTags();
 
   static void FreeActions();
+  static void ReportNounCache();
+  static void ReportSightCache();
 
  private:
   void GenerateNPC(const ObjectTag&);
   void GenerateRoom(const ObjectTag&);
 
+  void TBALoadWLD(const tba_parsed&);
+  void TBALoadOBJ(const tba_parsed&);
+  void TBALoadMOB(const tba_parsed&);
+  void TBALoadZON(const tba_parsed&);
+  void TBALoadSHP(const tba_parsed&);
+  void TBALoadTRG(const tba_parsed&);
+
   void NotifyLeft(Object* obj, Object* newloc = nullptr);
+  void InvalidateAncestry(const Object* oldp);
+  void ForgetRooms();
+  void DetachMind(Mind* mind);
+  void SendOut(outgoing_message& out, bool expanding);
+  void NounChanged();
+
+  void KeywordLink(Object* ob);
+  void KeywordUnlink(const Object* ob);
+  void KeywordDrop();
+  void KeywordRefresh();
+  bool KeywordCandidates(std::u8string_view name, DArr64<Object*>& cands) const;
+
+  uint32_t CollectTriggers(std::vector<Object*>* scripts) const;
+  const std::vector<Object*>& TriggersSetOff(std::u8string_view text, bool speech) const;
+  void InvalidateTriggers(const Object* oldp);
+  void InvalidateTriggerType();
+  void InvalidateExits(const Object* oldp);
+  void InvalidateRoutes(uint32_t stok);
+  void InvalidateLight();
+  void InvalidateSight();
+  void InvalidateContents();
+  void SkillChanged(uint32_t stok);
+  int LightWithin(bool& settled);
+  int LightFrom(bool& settled);
 
-  void Loud(std::set<Object*>& visited, int str, const std::u8string& mes);
 
   bool Filter(int loc) const;
 
@@ -729,11 +779,16 @@ class alignas(256) Object {
   uint32_t cur_skill;
 
   uint32_t busy_until = 0; // Encoded
-  const char8_t* dowhenfree = u8"";
-  const char8_t* defact = u8"";
+
+  uint32_t contained_weight = 0; // Running total of Weight() of everything parented here
+  uint32_t contained_volume = 0; // Running total of Volume() of everything parented here
 
   int sexp;
 
+  uint16_t ancestry_epoch = 1; // Bumped whenever I move, never zero
+  mutable uint16_t room_epoch = 0; // My parent's ancestry_epoch when room_cache was found
+  mutable const Object* room_cache = nullptr;
+
   std::forward_list<std::shared_ptr<Mind>> minds;
 
   DArr32<uint32_t> known;
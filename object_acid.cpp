@@ -19,7 +19,7 @@
 //
 // *************************************************************************
 
-#include <map>
+#include <unordered_map>
 
 #include "color.hpp"
 #include "dice.hpp"
@@ -44,19 +44,25 @@ const struct {
 
 static std::vector<Object*> todo;
 
-static std::map<int, Object*> num2obj;
+// Object numbers are handed out densely from 1, so these are indexed directly.
+static std::vector<Object*> num2obj;
 Object* getbynum(int num) {
-  if (num2obj.count(num) < 1)
+  if (num <= 0)
+    return nullptr;
+  if (num2obj.size() <= size_t(num))
+    num2obj.resize(num + 1, nullptr);
+  if (!num2obj[num])
     num2obj[num] = new Object();
   return num2obj[num];
 }
 
 static int last_object_number = 0;
-static std::map<Object*, int> obj2num;
+static std::unordered_map<Object*, int> obj2num;
 int getonum(Object* obj) {
-  if (!obj2num.count(obj))
-    obj2num[obj] = ++last_object_number;
-  return obj2num[obj];
+  auto [itr, added] = obj2num.try_emplace(obj, last_object_number + 1);
+  if (added)
+    ++last_object_number;
+  return itr->second;
 }
 
 int Object::Save(const std::u8string& fn) {
@@ -144,9 +150,17 @@ int Object::SaveTo(outfile& fl) {
 
   fl.append(u8"{}\n", enum_save(position));
 
-  fl.append(u8"{}\n", (int)(actions.size()));
+  // SPECIAL_ACTEEs aren't saved, since loading rebuilds them from the acts they mirror, in
+  // whatever order those load in, so the same world always saves the same way.
+  int acts = 0;
   for (auto aind : actions) {
-    fl.append(u8"{};{}\n", enum_save(aind.act()), getonum(aind.obj()));
+    acts += (aind.act() != act_t::SPECIAL_ACTEE);
+  }
+  fl.append(u8"{}\n", acts);
+  for (auto aind : actions) {
+    if (aind.act() != act_t::SPECIAL_ACTEE) {
+      fl.append(u8"{};{}\n", enum_save(aind.act()), getonum(aind.obj()));
+    }
   }
 
   fl.append(u8"\n");
@@ -173,7 +187,7 @@ int Object::Load(const std::u8string& fn) {
 
   todo.clear();
   num2obj.clear();
-  num2obj[0] = nullptr;
+  num2obj.resize(2, nullptr);
   num2obj[1] = this;
   if (LoadFrom(fl)) {
     return -1;
@@ -216,7 +230,7 @@ int Object::LoadFrom(std::u8string_view& fl) {
 
   int num = nextnum(fl);
   skipspace(fl);
-  if (num2obj[num] != this) {
+  if (num <= 0 || size_t(num) >= num2obj.size() || num2obj[num] != this) {
     loger(u8"Error: Acid number mismatch ({})!", num);
   }
   todo.push_back(this);
@@ -237,11 +251,11 @@ int Object::LoadFrom(std::u8string_view& fl) {
 
   // loge(u8"{}Loading {}:{}", debug_indent, num, buf);
 
-  weight = nextnum(fl);
+  SetWeight(nextnum(fl));
   skipspace(fl);
   size = nextnum(fl);
   skipspace(fl);
-  volume = nextnum(fl);
+  SetVolume(nextnum(fl));
   skipspace(fl);
   value = nextnum(fl);
   skipspace(fl);
@@ -334,7 +348,13 @@ int Object::LoadFrom(std::u8string_view& fl) {
   for (int ctr = 0; ctr < num; ++ctr) {
     Object* obj = getbynum(nextnum(fl));
     obj->parent = this;
+    obj->InvalidateAncestry(nullptr);
+    obj->InvalidateTriggers(nullptr);
+    obj->InvalidateExits(nullptr);
     contents.push_back(obj);
+    KeywordLink(obj);
+    contained_weight += obj->weight;
+    contained_volume += obj->volume;
     toload.push_back(obj);
     skipspace(fl);
   }
@@ -353,6 +373,7 @@ int Object::LoadFrom(std::u8string_view& fl) {
     int onum = nextnum(fl);
     skipspace(fl);
     act_t a = enum_load<act_t>(acts);
+    // Prior to v0x001E, SPECIAL_ACTEEs were saved too.  They're rebuilt by AddAct() either way.
     if (a != act_t::SPECIAL_ACTEE && a != act_t::NONE) {
       AddAct(a, getbynum(onum));
     }
@@ -391,6 +412,7 @@ int Object::LoadFrom(std::u8string_view& fl) {
     //	);
     //      }
   }
+  InvalidateContents(); // Now that all of them, and their lights, are here
   //  if(parent && (!(parent->parent))) {
   //    loge(u8"\nLoaded.");
   //    }
@@ -25,6 +25,14 @@
 // I actually have no plans to maintain or improve this, though may fix bugs.
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include <fcntl.h>
@@ -33,6 +41,7 @@
 #include "color.hpp"
 #include "commands.hpp"
 #include "dice.hpp"
+#include "infile.hpp"
 #include "log.hpp"
 #include "mind.hpp"
 #include "object.hpp"
@@ -48,106 +57,208 @@ static const std::u8string dirname[6] =
     {u8"north", u8"east", u8"south", u8"west", u8"up", u8"down"};
 
 static int untrans_trig = 0;
-void Object::TBALoadAll() {
-  infile mudt(u8"tba/trg/index");
-  if (mudt) {
-    while (mudt.length() > 3) {
-      TBALoadTRG(fmt::format(u8"tba/trg/{}", getuntil(mudt, '\n')));
+
+// Import is done in two phases.  First each file is parsed into the plain records below, which
+// touches no Objects or shared state, so all files can be parsed at once on a pool of threads.
+// Then, in index order on the main thread, the TBALoad*() members turn those records into
+// Objects and link them up through the vnum maps.
+struct tba_trg_rec {
+  int tnum = 0;
+  int atype = 0;
+  int ttype = 0;
+  int narg = 0;
+  std::u8string arg;
+  std::u8string script;
+};
+
+struct tba_wld_exit {
+  int dir = 0;
+  int type = 0;
+  int key = 0;
+  int to = 0;
+  std::u8string name;
+};
+
+struct tba_wld_rec {
+  int onum = 0;
+  uint32_t flags = 0;
+  int sector = 0;
+  std::u8string name;
+  std::u8string desc;
+  std::vector<tba_wld_exit> exits;
+  std::vector<int> trigs;
+};
+
+struct tba_obj_extra {
+  char8_t tag = 0; // 'A' (affect), 'T' (trigger), or 'E' (extra description)
+  int num = 0;
+  int val = 0;
+  std::vector<std::u8string> words;
+  std::u8string desc;
+};
+
+struct tba_obj_rec {
+  int onum = 0;
+  int tp = 0;
+  uint32_t flags = 0;
+  uint32_t wear = 0;
+  int val[4] = {0, 0, 0, 0};
+  int wt = 0;
+  int vl = 0;
+  std::vector<std::u8string> aliases;
+  std::u8string name;
+  std::u8string desc;
+  std::u8string field;
+  std::vector<tba_obj_extra> extras;
+};
+
+struct tba_mob_rec {
+  int onum = 0;
+  uint32_t flags = 0;
+  uint32_t aff = 0;
+  int align = 0;
+  char8_t tp = 0;
+  int level = 0;
+  int thac0 = 0;
+  int ac = 0;
+  int hp[3] = {0, 0, 0};
+  int dam[3] = {0, 0, 0};
+  int gold = 0;
+  int pos = 0;
+  int gender = 0;
+  std::vector<std::u8string> aliases;
+  std::u8string name;
+  std::u8string desc;
+  std::u8string field;
+  std::vector<std::pair<std::u8string, int>> espec;
+  std::vector<int> trigs;
+};
+
+struct tba_zon_hdr {
+  int bot = 0; // The zone's range of room vnums
+  int top = -1;
+  int lifespan = 0; // Minutes between resets
+  int mode = 0; // Reset never (0), only when no players are in the zone (1), or always (2)
+};
+
+struct tba_zon_cmd {
+  char8_t type = 0;
+  int arg[3] = {0, 0, 0};
+};
+
+struct tba_shp_rec {
+  int num = 0;
+  int keeper = 0;
+  double sell = 0.0;
+  double buy = 0.0;
+  std::vector<int> items;
+  std::vector<std::u8string> types;
+};
+
+struct tba_parsed {
+  std::u8string fn;
+  bool found = false;
+  std::vector<tba_trg_rec> trgs;
+  std::vector<tba_wld_rec> wlds;
+  std::vector<tba_obj_rec> objs;
+  std::vector<tba_mob_rec> mobs;
+  tba_zon_hdr zon_hdr;
+  std::vector<tba_zon_cmd> zons;
+  std::vector<tba_shp_rec> shps;
+};
+
+// A vnum -> Object* table, kept in flat pages, since TBA vnums come in dense runs per zone.
+class tba_vnums {
+ public:
+  Object* get(int vnum) const {
+    size_t page = vnum >> page_bits;
+    if (vnum < 0 || page >= pages.size() || !pages[page]) {
+      return nullptr;
     }
+    return (*pages[page])[vnum & page_mask];
   }
-  infile mudw(u8"tba/wld/index");
-  if (mudw) {
-    while (mudw.length() > 3) {
-      TBALoadWLD(fmt::format(u8"tba/wld/{}", getuntil(mudw, '\n')));
-    }
+  bool contains(int vnum) const {
+    return get(vnum) != nullptr;
   }
-  infile mudo(u8"tba/obj/index");
-  if (mudo) {
-    while (mudo.length() > 3) {
-      TBALoadOBJ(fmt::format(u8"tba/obj/{}", getuntil(mudo, '\n')));
+  void set(int vnum, Object* obj) {
+    if (vnum < 0) {
+      return;
     }
-  }
-  infile mudm(u8"tba/mob/index");
-  if (mudm) {
-    while (mudm.length() > 3) {
-      TBALoadMOB(fmt::format(u8"tba/mob/{}", getuntil(mudm, '\n')));
+    size_t page = vnum >> page_bits;
+    if (page >= pages.size()) {
+      pages.resize(page + 1);
     }
-  }
-  infile mudz(u8"tba/zon/index");
-  if (mudz) {
-    while (mudz.length() > 3) {
-      TBALoadZON(fmt::format(u8"tba/zon/{}", getuntil(mudz, '\n')));
+    if (!pages[page]) {
+      pages[page] = std::make_unique<std::array<Object*, page_size>>();
     }
+    (*pages[page])[vnum & page_mask] = obj;
   }
-  TBAFinalizeTriggers();
-  infile muds(u8"tba/shp/index");
-  if (muds) {
-    while (muds.length() > 3) {
-      TBALoadSHP(fmt::format(u8"tba/shp/{}", getuntil(muds, '\n')));
+  template <typename F>
+  void for_each(F func) const { // In vnum order
+    for (const auto& page : pages) {
+      if (page) {
+        for (auto obj : *page) {
+          if (obj) {
+            func(obj);
+          }
+        }
+      }
     }
   }
-  TBACleanup();
-  logeyy(u8"Warning: {} untranslated triggers!", untrans_trig);
-  logeyy(u8"Warning: {} tacked-on object aliases!", obj_aliases);
-  logeyy(u8"Warning: {} tacked-on mob aliases!", mob_aliases);
-}
+  void clear() {
+    pages.clear();
+    pages.shrink_to_fit();
+  }
+
+ private:
+  static constexpr int page_bits = 8;
+  static constexpr int page_size = 1 << page_bits;
+  static constexpr int page_mask = page_size - 1;
+  std::vector<std::unique_ptr<std::array<Object*, page_size>>> pages;
+};
+
+// A room's exits which aren't linked yet, because the room they lead to isn't loaded yet.
+struct tba_room_exits {
+  Object* room;
+  tba_wld_exit exits[6]; // By direction, .to is -1 when there is nothing (left) to link
+};
 
 static std::vector<Object*> todotrg;
-static std::map<int, Object*> bynumtrg;
-static std::map<int, Object*> bynumwld;
-static std::map<int, Object*> bynumobj;
-static std::map<int, Object*> bynummob;
-static std::map<int, Object*> bynummobinst;
-static std::map<Object*, int> tonum[6];
-static std::map<Object*, int> tynum[6];
-static std::map<Object*, int> knum[6];
-static std::map<Object*, std::u8string> nmnum[6];
-static std::vector<Object*> olist;
+static tba_vnums bynumtrg;
+static tba_vnums bynumwld;
+static tba_vnums bynumobj;
+static tba_vnums bynummob;
+static tba_vnums bynummobinst;
+static tba_vnums lastobj;
+static Object *lastmob = nullptr, *lastbag = nullptr;
+static std::vector<tba_room_exits> unlinked;
 static Object* objroom = nullptr;
 static Object* mobroom = nullptr;
+static std::vector<Object*> resetters;
 
 void Object::TBACleanup() {
-  //  for(ind : bynumobj) {
-  //    ind.second->Recycle();
-  //    }
-  //  for(ind : bynummob) {
-  //    ind.second->Recycle();
-  //    }
-  for (auto ind : bynumtrg) {
-    ind.second->Recycle();
-  }
+  //  bynumobj.for_each([](Object* obj) {
+  //    obj->Recycle();
+  //  });
+  //  bynummob.for_each([](Object* obj) {
+  //    obj->Recycle();
+  //  });
+  bynumtrg.for_each([](Object* trg) { trg->Recycle(); });
 
   bynumwld.clear();
   bynumobj.clear();
   bynummob.clear();
   bynumtrg.clear();
   bynummobinst.clear();
-  tonum[0].clear();
-  tonum[1].clear();
-  tonum[2].clear();
-  tonum[3].clear();
-  tonum[4].clear();
-  tonum[5].clear();
-  tynum[0].clear();
-  tynum[1].clear();
-  tynum[2].clear();
-  tynum[3].clear();
-  tynum[4].clear();
-  tonum[5].clear();
-  knum[0].clear();
-  knum[1].clear();
-  knum[2].clear();
-  knum[3].clear();
-  knum[4].clear();
-  knum[5].clear();
-  nmnum[0].clear();
-  nmnum[1].clear();
-  nmnum[2].clear();
-  nmnum[3].clear();
-  nmnum[4].clear();
-  nmnum[5].clear();
-  olist.clear();
+  lastobj.clear();
+  lastmob = nullptr;
+  lastbag = nullptr;
+  objroom = nullptr; // These stay in the world they were made in
+  mobroom = nullptr;
+  unlinked.clear();
+  unlinked.shrink_to_fit();
   todotrg.clear();
+  resetters.clear();
 }
 
 void Object::TBAFinalizeTriggers() {
@@ -160,8 +271,8 @@ void Object::TBAFinalizeTriggers() {
       trg->Parent()->SetSkill(prhash(u8"Teleport"), 10);
       trg->Parent()->SetSkill(prhash(u8"Restricted Item"), 1);
       int rnum = nextnum(script);
-      if (bynumwld.count(rnum) > 0) {
-        newtext += std::u8string(u8"teleport ") + bynumwld[rnum]->Noun() + u8"\n";
+      if (bynumwld.contains(rnum)) {
+        newtext += std::u8string(u8"teleport ") + bynumwld.get(rnum)->Noun() + u8"\n";
       } else {
         loge(u8"Error: Can't find teleport dest: {}", rnum);
       }
@@ -179,6 +290,15 @@ void Object::TBAFinalizeTriggers() {
   todotrg.clear();
 }
 
+// Make the Void the start room of its world, and that world home if it is the first one.
+static void tba_set_home(Object* room) {
+  Object* world = room->World();
+  world->AddAct(act_t::SPECIAL_HOME, room);
+  if (!world->Parent()->IsAct(act_t::SPECIAL_HOME)) { // If is first world
+    world->Parent()->AddAct(act_t::SPECIAL_HOME, world);
+  }
+}
+
 static Object* gold = nullptr;
 static void init_gold() {
   gold = new Object();
@@ -224,6 +344,431 @@ std::u8string load_tba_field(std::u8string_view& mud) {
   return ret;
 }
 
+using tba_parser = void (*)(std::u8string_view, tba_parsed&);
+
+static tba_parsed parse_tba_file(const std::u8string& fn, tba_parser parse) {
+  tba_parsed ret;
+  ret.fn = fn;
+  infile mud(fn);
+  if (mud) {
+    ret.found = true;
+    parse(mud, ret);
+  }
+  return ret;
+}
+
+static std::vector<std::u8string> load_tba_aliases(std::u8string_view& mud) {
+  std::vector<std::u8string> aliases;
+  std::u8string buffer(load_tba_field(mud));
+  std::transform(buffer.begin(), buffer.end(), buffer.begin(), ascii_tolower);
+  std::u8string_view line = buffer;
+
+  size_t lbeg = 0;
+  size_t lend = 0;
+  do {
+    lbeg = line.find_first_not_of(u8" \t\r", lend);
+    if (lbeg != std::u8string::npos) {
+      lend = line.find_first_of(u8" \t\r", lbeg);
+      if (lend != std::u8string::npos) {
+        aliases.emplace_back(line.substr(lbeg, lend - lbeg));
+      } else {
+        aliases.emplace_back(line.substr(lbeg));
+      }
+    }
+  } while (lbeg != std::u8string::npos && lend != std::u8string::npos);
+  return aliases;
+}
+
+static void parse_tba_trg(std::u8string_view mud, tba_parsed& out) {
+  while (mud.length() > 0 && mud.front() == '#') {
+    tba_trg_rec trg;
+    nextchar(mud);
+    trg.tnum = nextnum(mud);
+    skipspace(mud);
+    load_tba_field(mud); // Trigger Name - Discarded!
+    skipspace(mud);
+
+    trg.atype = nextnum(mud);
+    skipspace(mud);
+    trg.ttype = tba_bitvec(getuntil(mud, ' ')); // Trigger Types
+    skipspace(mud);
+    trg.narg = nextnum(mud);
+    skipspace(mud);
+
+    trg.arg = load_tba_field(mud); // Text argument!
+    getuntil(mud, '\n'); // Go to next Line, don't eat spaces.
+
+    trg.script = load_tba_field(mud); // Command List (Multi-Line)
+    skipspace(mud);
+    out.trgs.emplace_back(std::move(trg));
+  }
+}
+
+static void parse_tba_wld(std::u8string_view mud, tba_parsed& out) {
+  while (1) {
+    if (mud.length() == 0 || nextchar(mud) != '#') {
+      break;
+    }
+    tba_wld_rec room;
+    room.onum = nextnum(mud);
+    skipspace(mud);
+
+    room.name = load_tba_field(mud);
+    skipspace(mud);
+    room.desc = load_tba_field(mud);
+    skipspace(mud);
+
+    nextnum(mud);
+    skipspace(mud);
+    room.flags = tba_bitvec(getuntil(mud, ' '));
+    skipspace(mud);
+    nextnum(mud);
+    skipspace(mud);
+    nextnum(mud);
+    skipspace(mud);
+    nextnum(mud);
+    skipspace(mud);
+    room.sector = nextnum(mud);
+    skipspace(mud);
+    // FIXME: TBA's extra 3 flags variables (ignored now)?
+
+    while (1) {
+      if (mud.front() == 'D') {
+        tba_wld_exit exit;
+        nextchar(mud);
+        exit.dir = nextnum(mud);
+        skipspace(mud);
+
+        load_tba_field(mud);
+        skipspace(mud);
+        exit.name = load_tba_field(mud);
+        skipspace(mud);
+
+        exit.type = nextnum(mud);
+        skipspace(mud);
+        exit.key = nextnum(mud);
+        skipspace(mud);
+        exit.to = nextnum(mud);
+        skipspace(mud);
+        room.exits.emplace_back(std::move(exit));
+      } else if (mud.front() == 'E') {
+        // FIXME: Load These!
+        load_tba_field(mud);
+        skipspace(mud);
+        load_tba_field(mud);
+        skipspace(mud);
+      } else if (mud.front() != 'S') {
+        loge(u8"#{}: Warning, didn't see an ending S!", room.onum);
+        return;
+      } else {
+        break;
+      }
+    }
+    nextchar(mud); // Skip the 'S'
+    skipspace(mud);
+
+    while (mud.front() == 'T') {
+      nextchar(mud);
+      skipspace(mud);
+      room.trigs.push_back(nextnum(mud));
+      skipspace(mud);
+    }
+    out.wlds.emplace_back(std::move(room));
+  }
+}
+
+static void parse_tba_obj(std::u8string_view mud, tba_parsed& out) {
+  while (1) {
+    if (mud.length() == 0 || nextchar(mud) != '#') {
+      break;
+    }
+    tba_obj_rec obj;
+    obj.onum = nextnum(mud);
+    skipspace(mud);
+
+    obj.aliases = load_tba_aliases(mud);
+    skipspace(mud);
+    obj.name = load_tba_field(mud);
+    skipspace(mud);
+    obj.desc = load_tba_field(mud);
+    skipspace(mud);
+    obj.field = load_tba_field(mud);
+    skipspace(mud);
+
+    obj.tp = nextnum(mud);
+    skipspace(mud);
+    obj.flags = tba_bitvec(getgraph(mud));
+    skipspace(mud);
+
+    // Wear Bitvector
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    obj.wear = tba_bitvec(getgraph(mud));
+    getuntil(mud, '\n');
+
+    for (auto& val : obj.val) {
+      val = nextnum(mud);
+      skipspace(mud);
+    }
+
+    obj.wt = nextnum(mud);
+    skipspace(mud);
+    obj.vl = nextnum(mud);
+    skipspace(mud);
+    getuntil(mud, '\n');
+
+    while (mud.front() == 'A' || mud.front() == 'E' || mud.front() == 'T') {
+      tba_obj_extra extra;
+      extra.tag = nextchar(mud);
+      skipspace(mud);
+      if (extra.tag == 'A') { // Extra Affects
+        extra.num = nextnum(mud);
+        skipspace(mud);
+        extra.val = nextnum(mud);
+        skipspace(mud);
+      } else if (extra.tag == 'T') { // Triggers
+        extra.num = nextnum(mud);
+        skipspace(mud);
+      } else if (extra.tag == 'E') { // Extra Descriptions
+        std::u8string_view word = u8" ";
+        while (word.back() != '~') {
+          word = getgraph(mud);
+          skipspace(mud);
+          std::u8string buf(word);
+          if (buf.back() == '~') {
+            buf.pop_back();
+          }
+          for (auto& chr : buf) {
+            chr = ascii_tolower(chr);
+          }
+          extra.words.emplace_back(std::move(buf));
+        }
+        extra.desc = load_tba_field(mud);
+        skipspace(mud);
+      }
+      obj.extras.emplace_back(std::move(extra));
+    }
+    out.objs.emplace_back(std::move(obj));
+  }
+}
+
+static void parse_tba_mob(std::u8string_view mud, tba_parsed& out) {
+  while (1) {
+    if (mud.length() == 0 || nextchar(mud) != '#') {
+      break;
+    }
+    tba_mob_rec mob;
+    mob.onum = nextnum(mud);
+    skipspace(mud);
+
+    mob.aliases = load_tba_aliases(mud);
+    skipspace(mud);
+    mob.name = load_tba_field(mud);
+    skipspace(mud);
+    mob.desc = load_tba_field(mud);
+    skipspace(mud);
+    mob.field = load_tba_field(mud);
+    skipspace(mud);
+
+    mob.flags = tba_bitvec(getgraph(mud));
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    mob.aff = tba_bitvec(getgraph(mud));
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    getgraph(mud);
+    skipspace(mud);
+    mob.align = nextnum(mud);
+    skipspace(mud);
+    mob.tp = nextchar(mud);
+    skipspace(mud);
+
+    if (mob.tp == 'E' || mob.tp == 'S') {
+      mob.level = nextnum(mud);
+      skipspace(mud);
+      mob.thac0 = nextnum(mud);
+      skipspace(mud);
+      mob.ac = nextnum(mud);
+      skipspace(mud);
+
+      // Hit Points, then Barehand Damage, as in '4d6+2'
+      for (auto dice : {mob.hp, mob.dam}) {
+        dice[0] = nextnum(mud);
+        nextchar(mud); // 'd'
+        dice[1] = nextnum(mud);
+        nextchar(mud); // '+'
+        dice[2] = nextnum(mud);
+        skipspace(mud);
+      }
+
+      mob.gold = nextnum(mud);
+      getuntil(mud, '\n'); // XP //FIXME: Worth Karma?
+
+      mob.pos = nextnum(mud);
+      skipspace(mud);
+      nextnum(mud); // Default position is unused
+      skipspace(mud);
+      mob.gender = nextnum(mud);
+      skipspace(mud);
+    }
+
+    while (mob.tp == 'E') { // Basically an if with an infinite loop ;)
+      std::u8string field(getgraph(mud));
+      skipspace(mud);
+      if (field.back() == ':') {
+        mob.espec.emplace_back(std::move(field), nextnum(mud));
+        skipspace(mud);
+      } else {
+        break;
+      }
+    }
+
+    while (mud.front() == 'T') {
+      nextchar(mud); // The 'T'
+      skipspace(mud);
+      mob.trigs.push_back(nextnum(mud));
+      skipspace(mud);
+    }
+    out.mobs.emplace_back(std::move(mob));
+  }
+}
+
+static void parse_tba_zon(std::u8string_view mud, tba_parsed& out) {
+  for (int ctr = 0; ctr < 3; ++ctr) {
+    getuntil(mud, '\n');
+  }
+  skipspace(mud);
+  out.zon_hdr.bot = nextnum(mud);
+  skipspace(mud);
+  out.zon_hdr.top = nextnum(mud);
+  skipspace(mud);
+  out.zon_hdr.lifespan = nextnum(mud);
+  skipspace(mud);
+  out.zon_hdr.mode = nextnum(mud);
+  getuntil(mud, '\n'); // Zone flags and level range aren't used
+  skipspace(mud);
+
+  while (1) {
+    tba_zon_cmd cmd;
+    cmd.type = nextchar(mud);
+    skipspace(mud);
+    if (cmd.type == 'S') {
+      break;
+    } else if (cmd.type == 'D') { // Door state: room, direction, state
+      nextnum(mud);
+      skipspace(mud);
+      cmd.arg[0] = nextnum(mud);
+      skipspace(mud);
+      cmd.arg[1] = nextnum(mud);
+      skipspace(mud);
+      cmd.arg[2] = nextnum(mud);
+    } else if (cmd.type == 'M' || cmd.type == 'O' || cmd.type == 'P') { // vnum, where
+      nextnum(mud);
+      skipspace(mud);
+      cmd.arg[0] = nextnum(mud);
+      skipspace(mud);
+      nextnum(mud);
+      skipspace(mud);
+      cmd.arg[1] = nextnum(mud);
+    } else if (cmd.type == 'G' || cmd.type == 'E') { // vnum, wear position
+      nextnum(mud);
+      skipspace(mud);
+      cmd.arg[0] = nextnum(mud);
+      skipspace(mud);
+      nextnum(mud);
+      cmd.arg[1] = -1;
+      if (cmd.type == 'E') {
+        skipspace(mud);
+        cmd.arg[1] = nextnum(mud);
+      }
+    }
+    getuntil(mud, '\n');
+    if (cmd.type == 'D' || cmd.type == 'M' || cmd.type == 'O' || cmd.type == 'P' ||
+        cmd.type == 'G' || cmd.type == 'E') {
+      out.zons.emplace_back(cmd);
+    }
+  }
+}
+
+static void parse_tba_shp(std::u8string_view mud, tba_parsed& out) {
+  if (mud.substr(0, 25) == u8"CircleMUD v3.0 Shop File~") {
+    getuntil(mud, '\n');
+    while (1) {
+      if (mud.length() == 0 || nextchar(mud) != '#') {
+        break;
+      }
+      tba_shp_rec shop;
+      shop.num = nextnum(mud);
+      nextchar(mud); // Skip the extra '~' in these files.
+      skipspace(mud);
+
+      int val = nextnum(mud); // Item sold
+      skipspace(mud);
+      while (val >= 0) {
+        shop.items.push_back(val);
+        val = nextnum(mud); // Item sold
+        skipspace(mud);
+      }
+
+      shop.sell = nextdouble(mud); // Profit when Sell
+      skipspace(mud);
+      shop.buy = nextdouble(mud); // Profit when Buy
+      skipspace(mud);
+
+      auto buytype = getuntil(mud, '\n');
+      skipspace(mud);
+      while (getnum(buytype) >= 0) { // Terminated with a "-1"
+        shop.types.push_back(std::u8string(buytype));
+        buytype = getuntil(mud, '\n');
+        skipspace(mud);
+      }
+
+      // Skip the message lines, and Temper
+      for (int ctr = 0; ctr < 8; ++ctr) {
+        getuntil(mud, '\n');
+      }
+
+      getuntil(mud, '\n'); // Shop Bitvectors
+
+      shop.keeper = nextnum(mud);
+      skipspace(mud);
+
+      getuntil(mud, '\n'); // With Bitvectors
+
+      val = nextnum(mud); // Shop rooms
+      skipspace(mud);
+      while (val >= 0) {
+        val = nextnum(mud); // Shop rooms
+        skipspace(mud);
+      }
+
+      nextnum(mud); // Open time
+      skipspace(mud);
+      nextnum(mud); // Close time
+      skipspace(mud);
+      nextnum(mud); // Open time
+      skipspace(mud);
+      nextnum(mud); // Close time
+      skipspace(mud);
+      out.shps.emplace_back(std::move(shop));
+    }
+  } else if (mud.front() != '$') { // Not a Null Shop File!
+    loge(u8"Error: '{}' is not a CircleMUD v3.0 Shop File!", out.fn);
+  }
+}
+
 Object* dup_tba_obj(Object* obj) {
   Object* obj2 = nullptr;
   if (obj->Skill(prhash(u8"Wearable on Left Hand")) !=
@@ -330,121 +875,99 @@ void Object::TBAFinishMOB(Object* mob) {
   }
 }
 
-static Object *lastmob = nullptr, *lastbag = nullptr;
-static std::map<int, Object*> lastobj;
 void Object::TBALoadZON(const std::u8string& fn) {
-  infile mud(fn);
-  if (mud) {
+  TBALoadZON(parse_tba_file(fn, parse_tba_zon));
+}
+
+// Each zone's reset commands are compiled, once, into a zone resetter: an invisible object, in
+// the zone's first room, holding one step per M, O, or D command, and one per ROOM-ZONE trigger.
+// MOB and object steps are complete templates, with everything the G, E, and P commands put on
+// or in them, and with the room they go in as their SPECIAL_HOME, so a reset just clones them.
+// The templates' own triggers are left out of the trigger index of the room they sit in.
+void Object::TBALoadZON(const tba_parsed& file) {
+  const std::u8string& fn = file.fn;
+  if (file.found) {
     // loge(u8"Loading TBA Zone from \"{}\"\n", fn);
-    for (int ctr = 0; ctr < 3; ++ctr) {
-      getuntil(mud, '\n');
+    Object* first = nullptr;
+    for (int vnum = file.zon_hdr.bot; !first && vnum <= file.zon_hdr.top; ++vnum) {
+      first = bynumwld.get(vnum);
     }
-    skipspace(mud);
-
-    int done = 0;
-    while (!done) {
-      char8_t type = nextchar(mud);
-      skipspace(mud);
+    Object* resetter = nullptr;
+    auto add_step = [&](Object* step, Object* targ) {
+      if (!resetter) {
+        resetter = new Object(first ? first : targ->Room());
+        resetter->SetShortDesc(u8"a TBAMUD Zone Resetter");
+        resetter->SetDesc(u8"This thing puts its zone back the way it started.");
+        resetter->SetSkill(prhash(u8"Invisible"), 1000);
+        resetter->SetSkill(prhash(u8"TBAZoneBottom"), file.zon_hdr.bot);
+        resetter->SetSkill(prhash(u8"TBAZoneTop"), file.zon_hdr.top);
+        resetter->SetSkill(prhash(u8"TBAZoneLifespan"), file.zon_hdr.lifespan);
+        resetter->SetSkill(prhash(u8"TBAZoneResetMode"), file.zon_hdr.mode);
+        resetters.push_back(resetter);
+      }
+      step->SetParent(resetter);
+      step->AddAct(act_t::SPECIAL_HOME, targ);
+    };
+
+    for (const auto& cmd : file.zons) {
+      char8_t type = cmd.type;
       // loge(u8"Processing {} zone directive.", type);
       switch (type) {
-        case ('S'): {
-          done = 1;
-        } break;
         case ('D'): { // Door state
-          nextnum(mud);
-          skipspace(mud);
-          int room = nextnum(mud);
-          skipspace(mud);
-          int dnum = nextnum(mud);
-          skipspace(mud);
-          int state = nextnum(mud);
-          getuntil(mud, '\n');
+          int room = cmd.arg[0];
+          int dnum = cmd.arg[1];
+          int state = cmd.arg[2];
 
           Object* door = nullptr;
-          if (bynumwld.count(room) > 0)
-            door = bynumwld[room]->PickObject(dirname[dnum], LOC_INTERNAL);
-          if (door && state == 0) {
-            door->SetSkill(prhash(u8"Open"), 1000);
-            door->ClearSkill(prhash(u8"Locked"));
-          } else if (door && state == 1) {
-            door->ClearSkill(prhash(u8"Open"));
-            door->ClearSkill(prhash(u8"Locked"));
-          } else if (door && state == 2) {
-            door->ClearSkill(prhash(u8"Open"));
-            door->SetSkill(prhash(u8"Locked"), 1);
+          if (bynumwld.contains(room) && dnum >= 0 && dnum < 6)
+            door = bynumwld.get(room)->PickObject(dirname[dnum], LOC_INTERNAL);
+          if (door && state >= 0 && state <= 2) {
+            Object* step = new Object();
+            step->SetShortDesc(u8"a TBAMUD door reset");
+            step->SetSkill(prhash(u8"TBAZoneDoor"), state + 1);
+            add_step(step, door);
           }
         } break;
         case ('M'): {
-          nextnum(mud);
-          skipspace(mud);
-          int num = nextnum(mud);
-          skipspace(mud);
-          nextnum(mud);
-          skipspace(mud);
-          int room = nextnum(mud);
-          getuntil(mud, '\n');
-
-          if (bynumwld.count(room) && bynummob.count(num)) {
-            Object* obj = new Object(bynumwld[room]);
-            obj->SetShortDesc(u8"a TBAMUD MOB Popper");
-            obj->SetDesc(u8"This thing just pops out MOBs.");
+          int num = cmd.arg[0];
+          int room = cmd.arg[1];
 
+          if (bynumwld.contains(room) && bynummob.contains(num)) {
             // loge(u8"Put Mob \"{}\" in Room \"{}\"\n",
-            // obj->ShortDesc(), bynumwld[room]->ShortDesc());
+            // bynummob.get(num)->ShortDesc(), bynumwld.get(room)->ShortDesc());
 
             if (lastmob)
               TBAFinishMOB(lastmob);
-            lastmob = new Object(*(bynummob[num]));
-            bynummobinst[num] = lastmob;
-            lastmob->SetParent(obj);
-            obj->SetSkill(prhash(u8"TBAPopper"), 1);
-            obj->SetSkill(prhash(u8"Invisible"), 1000);
-            obj->Activate();
+            lastmob = new Object(*bynummob.get(num));
+            bynummobinst.set(num, lastmob);
+            add_step(lastmob, bynumwld.get(room));
             lastbag = nullptr;
           }
         } break;
         case ('O'): {
-          nextnum(mud);
-          skipspace(mud);
-          int num = nextnum(mud);
-          skipspace(mud);
-          nextnum(mud);
-          skipspace(mud);
-          int room = nextnum(mud);
-          getuntil(mud, '\n');
+          int num = cmd.arg[0];
+          int room = cmd.arg[1];
 
-          if (bynumwld.count(room) && bynumobj.count(num)) {
-            Object* obj = new Object(*(bynumobj[num]));
-            obj->SetParent(bynumwld[room]);
+          if (bynumwld.contains(room) && bynumobj.contains(num)) {
+            Object* obj = new Object(*bynumobj.get(num));
+            add_step(obj, bynumwld.get(room));
             // loge(u8"Put Obj \"{}\" in Room \"{}\"\n",
-            // obj->ShortDesc(), bynumwld[room]->ShortDesc());
-            if (obj->HasSkill(prhash(u8"Liquid Source"))) {
-              obj->Activate();
-            }
-            lastobj[num] = obj;
+            // obj->ShortDesc(), bynumwld.get(room)->ShortDesc());
+            lastobj.set(num, obj);
           }
         } break;
         case ('G'):
         case ('E'): {
-          nextnum(mud);
-          skipspace(mud);
-          int num = nextnum(mud);
-          skipspace(mud);
-          nextnum(mud);
-          int posit = -1;
-          if (type == 'E') {
-            skipspace(mud);
-            posit = nextnum(mud);
-          }
-          getuntil(mud, '\n');
+          int num = cmd.arg[0];
+          int posit = cmd.arg[1];
 
-          if (lastmob && bynumobj.count(num)) {
-            Object* obj = new Object(*(bynumobj[num]));
+          if (lastmob && bynumobj.contains(num)) {
+            Object* obj = new Object(*bynumobj.get(num));
             Object* obj2 = dup_tba_obj(obj);
             obj->SetParent(lastmob);
             if (obj2)
               obj2->SetParent(lastmob);
-            lastobj[num] = obj;
+            lastobj.set(num, obj);
 
             int bagit = 0;
             switch (posit) {
@@ -628,79 +1151,80 @@ void Object::TBALoadZON(const std::u8string& fn) {
           }
         } break;
         case ('P'): {
-          nextnum(mud);
-          skipspace(mud);
-          int num = nextnum(mud);
-          skipspace(mud);
-          nextnum(mud);
-          skipspace(mud);
-          int innum = nextnum(mud);
-          getuntil(mud, '\n');
+          int num = cmd.arg[0];
+          int innum = cmd.arg[1];
 
-          if (lastobj.count(innum) && bynumobj.count(num)) {
-            Object* obj = new Object(*(bynumobj[num]));
+          if (lastobj.contains(innum) && bynumobj.contains(num)) {
+            Object* obj = new Object(*bynumobj.get(num));
             Object* obj2 = dup_tba_obj(obj);
-            obj->SetParent(lastobj[innum]);
+            obj->SetParent(lastobj.get(innum));
             if (obj2)
-              obj2->SetParent(lastobj[innum]);
+              obj2->SetParent(lastobj.get(innum));
             // loge(u8"Put Obj \"{}\" in Obj \"{}\"\n", obj->ShortDesc(),
-            // lastobj[innum]->ShortDesc());
-            lastobj[num] = obj;
+            // lastobj.get(innum)->ShortDesc());
+            lastobj.set(num, obj);
           }
         } break;
-        default: {
-          getuntil(mud, '\n');
-        } break;
       }
     }
     if (lastmob)
       TBAFinishMOB(lastmob);
+
+    std::vector<Object*> zonetrgs; // Found first, since add_step() can add to a room
+    for (int vnum = file.zon_hdr.bot; vnum <= file.zon_hdr.top; ++vnum) {
+      Object* room = bynumwld.get(vnum);
+      if (room) {
+        for (auto trg : room->Contents()) {
+          if (trg->HasSkill(prhash(u8"TBAScript")) &&
+              (trg->Skill(prhash(u8"TBAScriptType")) & 0x4000010) == 0x4000010) { // ROOM-ZONE
+            zonetrgs.push_back(trg);
+          }
+        }
+      }
+    }
+    for (auto trg : zonetrgs) {
+      Object* step = new Object();
+      step->SetShortDesc(u8"a TBAMUD zone trigger");
+      add_step(step, trg);
+    }
+  }
+}
+
+// Do the first reset of every zone just imported, now that their shops are set up too, then
+// start the clocks of the ones which reset again.  They aren't active for this first one, so it
+// doesn't run their ROOM-ZONE triggers, as they don't run in a cached copy of the world either.
+void Object::TBAResetZones() {
+  for (auto resetter : resetters) {
+    resetter->ResetTBAZone(std::numeric_limits<int>::max());
+    if (resetter->Skill(prhash(u8"TBAZoneResetMode")) > 0) {
+      resetter->Activate();
+    }
   }
+  resetters.clear();
 }
 
 void Object::TBALoadMOB(const std::u8string& fn) {
+  TBALoadMOB(parse_tba_file(fn, parse_tba_mob));
+}
+
+void Object::TBALoadMOB(const tba_parsed& file) {
   if (mobroom == nullptr) {
     mobroom = new Object(this->World());
     mobroom->SetSkill(prhash(u8"Invisible"), 1000);
     mobroom->SetShortDesc(u8"The TBAMUD MOB Room");
   }
-  infile mud(fn);
-  if (mud) {
-    // loge(u8"Loading TBA Mobiles from \"{}\"\n", fn);
-    while (1) {
-      if (mud.length() == 0 || nextchar(mud) != '#') {
-        break;
-      }
-      int onum = nextnum(mud);
-      skipspace(mud);
+  if (file.found) {
+    // loge(u8"Loading TBA Mobiles from \"{}\"\n", file.fn);
+    for (const auto& rec : file.mobs) {
+      int onum = rec.onum;
       // loge(u8"Loaded MOB #{}", onum);
 
       Object* obj = new Object(mobroom);
       obj->SetSkill(prhash(u8"TBAMOB"), 1000000 + onum);
-      bynummob[onum] = obj;
-
-      std::vector<std::u8string_view> aliases;
-      std::u8string buffer(load_tba_field(mud));
-      std::transform(buffer.begin(), buffer.end(), buffer.begin(), ascii_tolower);
-      std::u8string_view line = buffer;
-      skipspace(mud);
-
-      size_t lbeg = 0;
-      size_t lend = 0;
-      do {
-        lbeg = line.find_first_not_of(u8" \t\r", lend);
-        if (lbeg != std::u8string::npos) {
-          lend = line.find_first_of(u8" \t\r", lbeg);
-          if (lend != std::u8string::npos) {
-            aliases.emplace_back(line.substr(lbeg, lend - lbeg));
-          } else {
-            aliases.emplace_back(line.substr(lbeg));
-          }
-        }
-      } while (lbeg != std::u8string::npos && lend != std::u8string::npos);
+      bynummob.set(onum, obj);
 
-      obj->SetShortDesc(load_tba_field(mud));
-      skipspace(mud);
+      const auto& aliases = rec.aliases;
+      obj->SetShortDesc(rec.name);
       // loge(u8"Loaded TBA Mobile with Name = {}", buf);
 
       std::u8string label = u8"";
@@ -748,12 +1272,10 @@ void Object::TBALoadMOB(const std::u8string& fn) {
         obj->SetShortDesc(fmt::format(u8"{} {}", obj->ShortDesc(), label));
       }
 
-      obj->SetDesc(load_tba_field(mud));
-      skipspace(mud);
+      obj->SetDesc(rec.desc);
       // loge(u8"Loaded TBA Mobile with Desc = {}", buf);
 
-      auto field = load_tba_field(mud);
-      skipspace(mud);
+      const auto& field = rec.field;
       if (field.length() > 0) {
         if (field[0] != '.') {
           obj->SetLongDesc(field);
@@ -773,10 +1295,9 @@ void Object::TBALoadMOB(const std::u8string& fn) {
       obj->SetAttribute(5, 3);
 
       int aware = 0, hidden = 0, sneak = 0;
-      int val, val2, val3;
-      char8_t tp;
-      uint32_t flags = tba_bitvec(getgraph(mud)); // Rest of line read below...
-      skipspace(mud);
+      int val;
+      char8_t tp = rec.tp;
+      uint32_t flags = rec.flags;
 
       obj->SetSkill(prhash(u8"TBAAction"), 8); // IS_NPC - I'll use it to see if(MOB)
       if (flags & 2) { // SENTINEL
@@ -805,14 +1326,7 @@ void Object::TBALoadMOB(const std::u8string& fn) {
       }
       // FIXME: Add others here.
 
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      flags = tba_bitvec(getgraph(mud)); // Rest of line read below...
-      skipspace(mud);
+      flags = rec.aff;
       if (flags & 64) { // WATERWALK
         obj->SetSkill(prhash(u8"TBAAffection"), obj->Skill(prhash(u8"TBAAffection")) | 64);
       }
@@ -824,16 +1338,7 @@ void Object::TBALoadMOB(const std::u8string& fn) {
       }
       // FIXME: Implement special powers of MOBs here.
 
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      val = nextnum(mud);
-      skipspace(mud);
-      tp = nextchar(mud);
-      skipspace(mud);
+      val = rec.align;
       if (val > 0)
         obj->SetSkill(prhash(u8"Honor"), val);
       else
@@ -842,48 +1347,22 @@ void Object::TBALoadMOB(const std::u8string& fn) {
       obj->SetSkill(prhash(u8"Accomplishment"), 1000000 + onum);
 
       if (tp == 'E' || tp == 'S') {
-        val = nextnum(mud);
-        skipspace(mud);
-        val2 = nextnum(mud);
-        skipspace(mud);
-        val3 = nextnum(mud);
-        skipspace(mud);
-        for (int ctr = 0; ctr < val; ++ctr)
-          obj->SetAttribute(ctr % 6, obj->NormAttribute(ctr % 6) + 1); // val1 = Level
-        obj->SetSkill(prhash(u8"TBAAttack"), ((20 - val2) / 3) + 3); // val2 = THAC0
-        obj->SetSkill(prhash(u8"TBADefense"), ((10 - val3) / 3) + 3); // val2 = AC
+        for (int ctr = 0; ctr < rec.level; ++ctr)
+          obj->SetAttribute(ctr % 6, obj->NormAttribute(ctr % 6) + 1); // Level
+        obj->SetSkill(prhash(u8"TBAAttack"), ((20 - rec.thac0) / 3) + 3); // THAC0
+        obj->SetSkill(prhash(u8"TBADefense"), ((10 - rec.ac) / 3) + 3); // AC
 
         // Hit Points
-        val = nextnum(mud);
-        nextchar(mud); // 'd' - as in '4d6'
-        val2 = nextnum(mud);
-        nextchar(mud); // '+' - as in '4d6+2'
-        val3 = nextnum(mud);
-        skipspace(mud);
-        val = (val * (val2 + 1) + 1) / 2 + val3;
+        val = (rec.hp[0] * (rec.hp[1] + 1) + 1) / 2 + rec.hp[2];
         obj->SetAttribute(0, (val + 49) / 50); // Becomes Body
 
         // Barehand Damage
-        val = nextnum(mud);
-        nextchar(mud); // 'd' - as in '4d6'
-        val2 = nextnum(mud);
-        nextchar(mud); // '+' - as in '4d6+2'
-        val3 = nextnum(mud);
-        skipspace(mud);
-        val = (val * (val2 + 1) + 1) / 2 + val3;
+        val = (rec.dam[0] * (rec.dam[1] + 1) + 1) / 2 + rec.dam[2];
         obj->SetAttribute(2, (val / 3) + 3); // Becomes Strength
 
-        val = nextnum(mud); // Gold
-        obj->SetSkill(prhash(u8"TBAGold"), val);
+        obj->SetSkill(prhash(u8"TBAGold"), rec.gold);
 
-        getuntil(mud, '\n'); // XP //FIXME: Worth Karma?
-
-        val = nextnum(mud);
-        skipspace(mud);
-        nextnum(mud); // val2 is unused
-        skipspace(mud);
-        val3 = nextnum(mud);
-        skipspace(mud);
+        val = rec.pos;
         if (val == 4) { // Mob Starts off Sleeping
           obj->SetPosition(pos_t::LIE);
           obj->AddAct(act_t::SLEEP);
@@ -895,38 +1374,31 @@ void Object::TBALoadMOB(const std::u8string& fn) {
         }
 
         static gender_t genderlist[] = {gender_t::NONE, gender_t::MALE, gender_t::FEMALE};
-        obj->gender = genderlist[val3];
+        obj->gender = genderlist[rec.gender];
       }
 
       obj->SetSkill(prhash(u8"NaturalWeapon"), 13); //"Hits" (is default in TBA)
-      while (tp == 'E') { // Basically an if with an infinite loop ;)
-        field = getgraph(mud);
-        skipspace(mud);
-        if (field.back() == ':') {
-          val = nextnum(mud);
-          skipspace(mud);
-          if (field == u8"Con:") {
-            obj->SetAttribute(0, std::max(obj->NormAttribute(0), (val / 3) + 3));
-          } else if (field == u8"Dex:") {
-            obj->SetAttribute(1, std::max(obj->NormAttribute(1), (val / 3) + 3));
-          } else if (field == u8"Str:") {
-            obj->SetAttribute(2, std::max(obj->NormAttribute(2), (val / 3) + 3));
-          } else if (field == u8"Cha:") {
-            obj->SetAttribute(3, std::max(obj->NormAttribute(3), (val / 3) + 3));
-          } else if (field == u8"Int:") {
-            obj->SetAttribute(4, std::max(obj->NormAttribute(4), (val / 3) + 3));
-          } else if (field == u8"Wis:") {
-            obj->SetAttribute(5, std::max(obj->NormAttribute(5), (val / 3) + 3));
-          } else if (field == u8"Add:") {
-            ; //'StrAdd' - Do Nothing
-          } else if (field == u8"BareHandAttack:") {
-            if (val == 13) {
-              val = 0; // Punches (is the Default in Acid)
-            }
-            obj->SetSkill(prhash(u8"NaturalWeapon"), val);
+      for (const auto& [spec, spec_val] : rec.espec) {
+        val = spec_val;
+        if (spec == u8"Con:") {
+          obj->SetAttribute(0, std::max(obj->NormAttribute(0), (val / 3) + 3));
+        } else if (spec == u8"Dex:") {
+          obj->SetAttribute(1, std::max(obj->NormAttribute(1), (val / 3) + 3));
+        } else if (spec == u8"Str:") {
+          obj->SetAttribute(2, std::max(obj->NormAttribute(2), (val / 3) + 3));
+        } else if (spec == u8"Cha:") {
+          obj->SetAttribute(3, std::max(obj->NormAttribute(3), (val / 3) + 3));
+        } else if (spec == u8"Int:") {
+          obj->SetAttribute(4, std::max(obj->NormAttribute(4), (val / 3) + 3));
+        } else if (spec == u8"Wis:") {
+          obj->SetAttribute(5, std::max(obj->NormAttribute(5), (val / 3) + 3));
+        } else if (spec == u8"Add:") {
+          ; //'StrAdd' - Do Nothing
+        } else if (spec == u8"BareHandAttack:") {
+          if (val == 13) {
+            val = 0; // Punches (is the Default in Acid)
           }
-        } else {
-          break;
+          obj->SetSkill(prhash(u8"NaturalWeapon"), val);
         }
       }
 
@@ -954,13 +1426,9 @@ void Object::TBALoadMOB(const std::u8string& fn) {
         obj->StartUsing(prhash(u8"Stealth"));
       }
 
-      while (mud.front() == 'T') {
-        nextchar(mud); // The 'T'
-        skipspace(mud);
-        int tnum = nextnum(mud);
-        skipspace(mud);
-        if (tnum > 0 && bynumtrg.count(tnum) > 0) {
-          Object* trg = new Object(*(bynumtrg[tnum]));
+      for (auto tnum : rec.trigs) {
+        if (tnum > 0 && bynumtrg.contains(tnum)) {
+          Object* trg = new Object(*bynumtrg.get(tnum));
           trg->SetParent(obj);
           todotrg.push_back(trg);
           //  loge(u8"Put Trg \"{}\" on MOB \"{}\"\n",
@@ -1147,49 +1615,28 @@ static void add_tba_spell(Object* obj, int spell, int power) {
 }
 
 void Object::TBALoadOBJ(const std::u8string& fn) {
+  TBALoadOBJ(parse_tba_file(fn, parse_tba_obj));
+}
+
+void Object::TBALoadOBJ(const tba_parsed& file) {
   if (objroom == nullptr) {
     objroom = new Object(this->World());
     objroom->SetSkill(prhash(u8"Invisible"), 1000);
     objroom->SetShortDesc(u8"The TBAMUD Object Room");
   }
-  infile mud(fn);
-  if (mud) {
-    // loge(u8"Loading TBA Objects from \"{}\"\n", fn);
-    while (1) {
-      if (mud.length() == 0 || nextchar(mud) != '#') {
-        break;
-      }
-      int onum = nextnum(mud);
-      skipspace(mud);
+  if (file.found) {
+    // loge(u8"Loading TBA Objects from \"{}\"\n", file.fn);
+    for (const auto& rec : file.objs) {
+      int onum = rec.onum;
       int valmod = 1000, powmod = 1;
       // loge(u8"Loaded object #{}", onum);
 
       Object* obj = new Object(objroom);
       obj->SetSkill(prhash(u8"TBAObject"), 1000000 + onum);
-      bynumobj[onum] = obj;
-
-      std::vector<std::u8string_view> aliases;
-      std::u8string buffer(load_tba_field(mud));
-      std::transform(buffer.begin(), buffer.end(), buffer.begin(), ascii_tolower);
-      std::u8string_view line = buffer;
-      skipspace(mud);
-
-      size_t lbeg = 0;
-      size_t lend = 0;
-      do {
-        lbeg = line.find_first_not_of(u8" \t\r", lend);
-        if (lbeg != std::u8string::npos) {
-          lend = line.find_first_of(u8" \t\r", lbeg);
-          if (lend != std::u8string::npos) {
-            aliases.emplace_back(line.substr(lbeg, lend - lbeg));
-          } else {
-            aliases.emplace_back(line.substr(lbeg));
-          }
-        }
-      } while (lbeg != std::u8string::npos && lend != std::u8string::npos);
+      bynumobj.set(onum, obj);
 
-      obj->SetShortDesc(load_tba_field(mud));
-      skipspace(mud);
+      const auto& aliases = rec.aliases;
+      obj->SetShortDesc(rec.name);
       // loge(u8"Loaded TBA Object with Name = {}", buf);
 
       std::u8string label = u8"";
@@ -1226,11 +1673,9 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
         obj->SetShortDesc(fmt::format(u8"{} {}", obj->ShortDesc(), label));
       }
 
-      obj->SetDesc(load_tba_field(mud));
-      skipspace(mud);
+      obj->SetDesc(rec.desc);
 
-      auto field = load_tba_field(mud);
-      skipspace(mud);
+      const auto& field = rec.field;
       if (field.length() > 0) {
         if (field[0] != '.') {
           obj->SetLongDesc(field);
@@ -1241,10 +1686,8 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
       }
       // loge(u8"Loaded TBA Object with Desc = {}", buf);
 
-      int tp = nextnum(mud);
-      skipspace(mud);
-      uint32_t flags = tba_bitvec(getgraph(mud));
-      skipspace(mud);
+      int tp = rec.tp;
+      uint32_t flags = rec.flags;
       if (flags & 1) { // GLOW
         obj->SetSkill(prhash(u8"Light Source"), 10);
       }
@@ -1288,15 +1731,7 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
         obj->SetSkill(prhash(u8"Priceless"), 1);
       }
 
-      // Wear Bitvector
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      getgraph(mud);
-      skipspace(mud);
-      flags = tba_bitvec(getgraph(mud));
-      getuntil(mud, '\n');
+      flags = rec.wear; // Wear Bitvector
       if (flags & 1) { // TAKE
         obj->SetPosition(pos_t::LIE);
       }
@@ -1432,15 +1867,7 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
       }
       obj->SetShortDesc(name);
 
-      int val[4];
-      val[0] = nextnum(mud);
-      skipspace(mud);
-      val[1] = nextnum(mud);
-      skipspace(mud);
-      val[2] = nextnum(mud);
-      skipspace(mud);
-      val[3] = nextnum(mud);
-      skipspace(mud);
+      int val[4] = {rec.val[0], rec.val[1], rec.val[2], rec.val[3]};
 
       if (tp == 1) { // LIGHTS
         if (val[2] > 1) {
@@ -2088,11 +2515,8 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
         obj->SetSkill(prhash(u8"WeaponReach"), wreach);
       }
 
-      int wt = nextnum(mud);
-      skipspace(mud);
-      int vl = nextnum(mud);
-      skipspace(mud);
-      getuntil(mud, '\n');
+      int wt = rec.wt;
+      int vl = rec.vl;
 
       if (tp != 20) { // MONEY DOESN'T WORK THIS WAY
         obj->SetWeight((wt >= 1000000) ? 1000000 : wt * 454);
@@ -2105,14 +2529,10 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
       }
 
       int magresist = 0;
-      while (mud.front() == 'A' || mud.front() == 'E' || mud.front() == 'T') {
-        char8_t tag = nextchar(mud);
-        skipspace(mud);
-        if (tag == 'A') { // Extra Affects
-          int anum = nextnum(mud);
-          skipspace(mud);
-          int aval = nextnum(mud);
-          skipspace(mud);
+      for (const auto& extra : rec.extras) {
+        if (extra.tag == 'A') { // Extra Affects
+          int anum = extra.num;
+          int aval = extra.val;
           switch (anum) {
             case (1): { // STR -> Strength
               obj->SetModifier(2, aval * 400 / powmod);
@@ -2202,29 +2622,18 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
               magresist += (aval * 400 / powmod);
             } break;
           }
-        } else if (tag == 'T') { // Triggers
-          int tnum = nextnum(mud);
-          skipspace(mud);
-          if (tnum > 0 && bynumtrg.count(tnum) > 0) {
-            Object* trg = new Object(*(bynumtrg[tnum]));
+        } else if (extra.tag == 'T') { // Triggers
+          int tnum = extra.num;
+          if (tnum > 0 && bynumtrg.contains(tnum)) {
+            Object* trg = new Object(*bynumtrg.get(tnum));
             trg->SetParent(obj);
             todotrg.push_back(trg);
             //    loge(u8"Put Trg \"{}\" on Obj \"{}\"\n",
             //	trg->Desc(), obj->ShortDesc()
             //	);
           }
-        } else if (tag == 'E') { // Extra Affects
-          std::u8string_view word = u8" ";
-          while (word.back() != '~') {
-            word = getgraph(mud);
-            skipspace(mud);
-            std::u8string buf(word);
-            if (buf.back() == '~') {
-              buf.pop_back();
-            }
-            for (auto& chr : buf) {
-              chr = ascii_tolower(chr);
-            }
+        } else if (extra.tag == 'E') { // Extra Descriptions
+          for (const auto& buf : extra.words) {
             if (buf.find_first_not_of(target_chars) != std::u8string::npos) {
               logey(u8"Warning: Ignoring non-alpha extra ({}) for '{}'!", buf, obj->ShortDesc());
             } else if (words_match(obj->ShortDesc(), buf)) {
@@ -2244,20 +2653,16 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
               // obj->ShortDesc());
             }
           }
-          auto buf = load_tba_field(mud);
-          skipspace(mud);
           if (!obj->HasLongDesc()) {
-            obj->SetLongDesc(buf);
+            obj->SetLongDesc(extra.desc);
           } else {
             std::u8string ld(obj->LongDesc());
             ld += u8"\n\n";
-            ld += buf;
+            ld += extra.desc;
             obj->SetLongDesc(ld);
             // logey(u8"Warning: Had to merge long descriptions of ({}) extra for
             // '{}'!\n", obj->LongDesc(), obj->ShortDesc());
           }
-        } else { // Extra Descriptions FIXME: Handle!
-          loge(u8"ERROR: Unknown tag!");
         }
       }
       if (magresist > 0) {
@@ -2270,12 +2675,16 @@ void Object::TBALoadOBJ(const std::u8string& fn) {
 }
 
 void Object::TBALoadWLD(const std::u8string& fn) {
-  infile mud(fn);
+  TBALoadWLD(parse_tba_file(fn, parse_tba_wld));
+}
+
+void Object::TBALoadWLD(const tba_parsed& file) {
+  const std::u8string& fn = file.fn;
   int znum = 0, offset = fn.length() - 5; // Chop off the .wld
   while (isdigit(fn[offset]))
     --offset;
   znum = getnum(fn.substr(offset + 1));
-  if (mud) {
+  if (file.found) {
     Object* zone = new Object(this);
     zone->SetShortDesc(
         std::u8string(u8"TBA Zone-") + fn.substr(0, fn.length() - 4).substr(offset + 1));
@@ -2284,24 +2693,15 @@ void Object::TBALoadWLD(const std::u8string& fn) {
     zone->SetSkill(prhash(u8"Day Time"), 120);
 
     // loge(u8"Loading TBA Realm from \"{}\"\n", fn);
-    while (1) {
-      if (mud.length() == 0 || nextchar(mud) != '#') {
-        break;
-      }
-      int onum = nextnum(mud);
-      skipspace(mud);
+    for (const auto& room : file.wlds) {
+      int onum = room.onum;
       // loge(u8"Loading room #{}", onum);
 
       Object* obj = new Object(zone);
-      olist.push_back(obj);
       obj->SetSkill(prhash(u8"TBARoom"), 1000000 + onum);
-      bynumwld[onum] = obj;
+      bynumwld.set(onum, obj);
       if (onum == 0) { // Player Start Room (Void) Hard-Coded Here
-        Object* world = obj->World();
-        world->AddAct(act_t::SPECIAL_HOME, obj);
-        if (!world->parent->IsAct(act_t::SPECIAL_HOME)) { // If is first world
-          world->parent->AddAct(act_t::SPECIAL_HOME, world);
-        }
+        tba_set_home(obj);
       }
 
       obj->SetWeight(0);
@@ -2309,27 +2709,14 @@ void Object::TBALoadWLD(const std::u8string& fn) {
       obj->SetSize(0);
       obj->SetValue(0);
 
-      obj->SetShortDesc(load_tba_field(mud));
-      skipspace(mud);
+      obj->SetShortDesc(room.name);
       // loge(u8"Loaded TBA Room with Name = {}", buf);
 
-      obj->SetDesc(load_tba_field(mud));
-      skipspace(mud);
+      obj->SetDesc(room.desc);
       // loge(u8"Loaded TBA Room with Desc = {}", buf);
 
-      nextnum(mud);
-      skipspace(mud);
-      uint32_t flags = tba_bitvec(getuntil(mud, ' '));
-      skipspace(mud);
-      nextnum(mud);
-      skipspace(mud);
-      nextnum(mud);
-      skipspace(mud);
-      nextnum(mud);
-      skipspace(mud);
-      int val = nextnum(mud);
-      skipspace(mud);
-      // FIXME: TBA's extra 3 flags variables (ignored now)?
+      uint32_t flags = room.flags;
+      int val = room.sector;
       if (val == 6)
         obj->SetSkill(prhash(u8"WaterDepth"), 1); // WATER_SWIM
       else if (val == 7)
@@ -2382,132 +2769,102 @@ void Object::TBALoadWLD(const std::u8string& fn) {
       //	//FIXME: Implement
       //	}
 
-      while (1) {
-        int dnum, tnum, tmp, tmp2;
-        if (mud.front() == 'D') {
-          nextchar(mud);
-          dnum = nextnum(mud);
-          skipspace(mud);
-
-          load_tba_field(mud);
-          skipspace(mud);
-          nmnum[dnum][obj] = load_tba_field(mud);
-          skipspace(mud);
-
-          tmp = nextnum(mud);
-          skipspace(mud);
-          tmp2 = nextnum(mud);
-          skipspace(mud);
-          tnum = nextnum(mud);
-          skipspace(mud);
-
-          tonum[dnum][obj] = tnum;
-          tynum[dnum][obj] = tmp;
-          knum[dnum][obj] = tmp2;
-        } else if (mud.front() == 'E') {
-          // FIXME: Load These!
-          load_tba_field(mud);
-          skipspace(mud);
-          load_tba_field(mud);
-          skipspace(mud);
-        } else if (mud.front() != 'S') {
-          loge(u8"#{}: Warning, didn't see an ending S!", onum);
-        } else {
-          break;
+      auto& pend = unlinked.emplace_back();
+      pend.room = obj;
+      for (auto& exit : pend.exits) {
+        exit.to = -1;
+      }
+      for (const auto& exit : room.exits) {
+        if (exit.dir >= 0 && exit.dir < 6) {
+          pend.exits[exit.dir] = exit;
         }
       }
-      nextchar(mud); // Skip the 'S'
-      skipspace(mud);
 
-      {
-        int tnum;
-        while (mud.front() == 'T') {
-          nextchar(mud);
-          skipspace(mud);
-          tnum = nextnum(mud);
-          skipspace(mud);
-          if (tnum > 0 && bynumtrg.count(tnum) > 0) {
-            Object* trg = new Object(*(bynumtrg[tnum]));
-            trg->SetParent(obj);
-            todotrg.push_back(trg);
-            //    loge(u8"Put Trg \"{}\" on Room \"{}\"\n",
-            //	trg->Desc(), obj->ShortDesc()
-            //	);
-          }
+      for (auto tnum : room.trigs) {
+        if (tnum > 0 && bynumtrg.contains(tnum)) {
+          Object* trg = new Object(*bynumtrg.get(tnum));
+          trg->SetParent(obj);
+          todotrg.push_back(trg);
+          //    loge(u8"Put Trg \"{}\" on Room \"{}\"\n",
+          //	trg->Desc(), obj->ShortDesc()
+          //	);
         }
       }
     }
 
-    for (auto ob : olist) {
+    for (auto& pend : unlinked) {
+      Object* ob = pend.room;
       for (int dir = 0; dir < 6; ++dir) {
-        if (tonum[dir].count(ob)) {
-          int tnum = tonum[dir][ob];
-          if (bynumwld.count(tnum)) {
-            Object* nobj = nullptr;
-            Object* nobj2 = nullptr;
-            std::u8string des, nm = dirname[dir];
-
-            auto cont = ob->Contents();
-            for (auto cind : cont) {
-              if (cind->ShortDesc() == u8"a passage exit") {
-                if (cind->ActTarg(act_t::SPECIAL_ACTEE)->Parent() == bynumwld[tnum]) {
-                  nobj = cind;
-                  nobj2 = cind->ActTarg(act_t::SPECIAL_ACTEE);
-                }
-              } else if (cind->ActTarg(act_t::SPECIAL_LINKED)) {
-                if (cind->ActTarg(act_t::SPECIAL_LINKED)->Parent() == bynumwld[tnum]) {
-                  nobj = cind;
-                  nobj2 = cind->ActTarg(act_t::SPECIAL_LINKED);
-                  nm = fmt::format(u8"{} and {}", nobj->ShortDesc(), dirname[dir]);
-                }
+        auto& exit = pend.exits[dir];
+        int tnum = exit.to;
+        Object* dest = bynumwld.get(tnum);
+        if (dest) {
+          Object* nobj = nullptr;
+          Object* nobj2 = nullptr;
+          std::u8string des, nm = dirname[dir];
+
+          auto cont = ob->Contents();
+          for (auto cind : cont) {
+            if (cind->ShortDesc() == u8"a passage exit") {
+              if (cind->ActTarg(act_t::SPECIAL_ACTEE)->Parent() == dest) {
+                nobj = cind;
+                nobj2 = cind->ActTarg(act_t::SPECIAL_ACTEE);
+              }
+            } else if (cind->ActTarg(act_t::SPECIAL_LINKED)) {
+              if (cind->ActTarg(act_t::SPECIAL_LINKED)->Parent() == dest) {
+                nobj = cind;
+                nobj2 = cind->ActTarg(act_t::SPECIAL_LINKED);
+                nm = fmt::format(u8"{} and {}", nobj->ShortDesc(), dirname[dir]);
               }
             }
-            if (!nobj) {
-              nobj = new Object;
-              nobj2 = new Object;
-              nobj->SetParent(ob);
-              nobj2->SetParent(bynumwld[tnum]);
-              nobj2->SetShortDesc(u8"a passage exit");
-              nobj2->SetDesc(u8"A passage exit.");
-              nobj2->SetSkill(prhash(u8"Invisible"), 1000);
-            } else {
-              nobj->ClearSkill(prhash(u8"Invisible"));
-            }
+          }
+          if (!nobj) {
+            nobj = new Object;
+            nobj2 = new Object;
+            nobj->SetParent(ob);
+            nobj2->SetParent(dest);
+            nobj2->SetShortDesc(u8"a passage exit");
+            nobj2->SetDesc(u8"A passage exit.");
+            nobj2->SetSkill(prhash(u8"Invisible"), 1000);
+          } else {
+            nobj->ClearSkill(prhash(u8"Invisible"));
+          }
 
-            if (nmnum[dir][ob] != u8"") {
-              nm += u8" (";
-              nm += nmnum[dir][ob];
-              nm += u8")";
-            }
-            if (tynum[dir][ob] != 0) { // FIXME: Respond to u8"door"?
-              des = std::u8string(u8"A door to the ") + dirname[dir] + u8" is here.";
-              nobj->SetSkill(prhash(u8"Closeable"), 1);
-              nobj->SetSkill(prhash(u8"Lockable"), 1);
-              if (tynum[dir][ob] == 1)
-                nobj->SetSkill(prhash(u8"Pickable"), 4);
-              if (tynum[dir][ob] == 2)
-                nobj->SetSkill(prhash(u8"Pickable"), 1000);
-              if (knum[dir][ob] > 0) {
-                nobj->SetSkill(prhash(u8"Lock"), 1000000 + knum[dir][ob]);
-                nobj->SetSkill(prhash(u8"Accomplishment"), 1300000 + tnum);
-              }
-            } else {
-              des = std::u8string(u8"A passage ") + dirname[dir] + u8" is here.";
+          if (exit.name != u8"") {
+            nm += u8" (";
+            nm += exit.name;
+            nm += u8")";
+          }
+          if (exit.type != 0) { // FIXME: Respond to u8"door"?
+            des = std::u8string(u8"A door to the ") + dirname[dir] + u8" is here.";
+            nobj->SetSkill(prhash(u8"Closeable"), 1);
+            nobj->SetSkill(prhash(u8"Lockable"), 1);
+            if (exit.type == 1)
+              nobj->SetSkill(prhash(u8"Pickable"), 4);
+            if (exit.type == 2)
+              nobj->SetSkill(prhash(u8"Pickable"), 1000);
+            if (exit.key > 0) {
+              nobj->SetSkill(prhash(u8"Lock"), 1000000 + exit.key);
+              nobj->SetSkill(prhash(u8"Accomplishment"), 1300000 + tnum);
             }
-            nobj->SetShortDesc(nm);
-            nobj->SetDesc(des);
-            nobj->SetSkill(prhash(u8"Open"), 1000);
-            nobj->SetSkill(prhash(u8"Enterable"), 1);
-            nobj->AddAct(act_t::SPECIAL_LINKED, nobj2);
-
-            nmnum[dir].erase(ob);
-            tonum[dir].erase(ob);
-            tynum[dir].erase(ob);
-            knum[dir].erase(ob);
+          } else {
+            des = std::u8string(u8"A passage ") + dirname[dir] + u8" is here.";
           }
+          nobj->SetShortDesc(nm);
+          nobj->SetDesc(des);
+          nobj->SetSkill(prhash(u8"Open"), 1000);
+          nobj->SetSkill(prhash(u8"Enterable"), 1);
+          nobj->AddAct(act_t::SPECIAL_LINKED, nobj2);
+
+          exit.to = -1;
         }
       }
     }
+    std::erase_if(unlinked, [](const tba_room_exits& pend) {
+      return std::all_of(std::begin(pend.exits), std::end(pend.exits), [](const auto& exit) {
+        return exit.to < 0;
+      });
+    });
   } else {
     loge(u8"Error: No TBA Realm \"{}\"\n", fn);
   }
@@ -2558,243 +2915,179 @@ static std::set<std::u8string> parse_tba_shop_rules(std::u8string rules) {
 }
 
 void Object::TBALoadSHP(const std::u8string& fn) {
-  infile mud(fn);
-  if (mud) {
-    Object* vortex = nullptr;
-    if (mud.substr(0, 25) == u8"CircleMUD v3.0 Shop File~") {
-      getuntil(mud, '\n');
-      while (1) {
-        if (mud.length() == 0 || nextchar(mud) != '#') {
-          break;
-        }
-        int val = nextnum(mud);
-        nextchar(mud); // Skip the extra '~' in these files.
-        skipspace(mud);
-
-        // loge(u8"Loading shop #{}", val);
-
-        vortex = new Object;
-        vortex->SetShortDesc(u8"a shopkeeper vortex");
-        vortex->SetDesc(u8"An advanced wormhole that shopkeeper's use.");
-        vortex->SetLongDesc(
-            fmt::format(u8"This inexplicable wormhole seems to implement shop #{}.", val));
-        vortex->SetSkill(prhash(u8"Vortex"), 1); // Mark it as a shopkeeper Vortex.
-        vortex->SetSkill(prhash(u8"Invisible"), 1000);
-        vortex->SetSkill(prhash(u8"Perishable"), 1);
-        vortex->SetSkill(prhash(u8"Wearable on Right Shoulder"), 1);
-        vortex->SetSkill(prhash(u8"Wearable on Left Shoulder"), 2);
+  TBALoadSHP(parse_tba_file(fn, parse_tba_shp));
+}
 
-        val = nextnum(mud); // Item sold
-        skipspace(mud);
-        while (val >= 0) {
-          if (val != 0 && bynumobj.count(val) == 0) {
-            loge(u8"Error: Shop's item #{} does not exist!", val);
-          } else if (val != 0) {
-            Object* item = new Object(*(bynumobj[val]));
-            Object* item2 = dup_tba_obj(item);
-            item->SetParent(vortex);
-            item->SetQuantity(1000);
-            if (item2) {
-              item2->SetParent(vortex);
-              item2->SetQuantity(1000);
-            }
+void Object::TBALoadSHP(const tba_parsed& file) {
+  if (file.found) {
+    for (const auto& shop : file.shps) {
+      // loge(u8"Loading shop #{}", shop.num);
+
+      Object* vortex = new Object;
+      vortex->SetShortDesc(u8"a shopkeeper vortex");
+      vortex->SetDesc(u8"An advanced wormhole that shopkeeper's use.");
+      vortex->SetLongDesc(
+          fmt::format(u8"This inexplicable wormhole seems to implement shop #{}.", shop.num));
+      vortex->SetSkill(prhash(u8"Vortex"), 1); // Mark it as a shopkeeper Vortex.
+      vortex->SetSkill(prhash(u8"Invisible"), 1000);
+      vortex->SetSkill(prhash(u8"Perishable"), 1);
+      vortex->SetSkill(prhash(u8"Wearable on Right Shoulder"), 1);
+      vortex->SetSkill(prhash(u8"Wearable on Left Shoulder"), 2);
+
+      for (auto val : shop.items) { // Items sold
+        if (val != 0 && !bynumobj.contains(val)) {
+          loge(u8"Error: Shop's item #{} does not exist!", val);
+        } else if (val != 0) {
+          Object* item = new Object(*bynumobj.get(val));
+          Object* item2 = dup_tba_obj(item);
+          item->SetParent(vortex);
+          item->SetQuantity(1000);
+          if (item2) {
+            item2->SetParent(vortex);
+            item2->SetQuantity(1000);
           }
-          val = nextnum(mud); // Item sold
-          skipspace(mud);
-        }
-
-        double num = nextdouble(mud); // Profit when Sell
-        skipspace(mud);
-        double num2 = nextdouble(mud); // Profit when Buy
-        skipspace(mud);
-
-        auto buytype = getuntil(mud, '\n');
-        skipspace(mud);
-        std::vector<std::u8string> types;
-        while (getnum(buytype) >= 0) { // Terminated with a "-1"
-          types.push_back(std::u8string(buytype));
-          buytype = getuntil(mud, '\n');
-          skipspace(mud);
-        }
-
-        // Skip the message lines, and Temper
-        for (int ctr = 0; ctr < 8; ++ctr) {
-          getuntil(mud, '\n');
-        }
-
-        getuntil(mud, '\n'); // Shop Bitvectors
-
-        int kpr = nextnum(mud);
-        skipspace(mud);
-        Object* keeper = nullptr;
-        if (bynummobinst.contains(kpr)) {
-          keeper = bynummobinst[kpr];
         }
+      }
 
-        getuntil(mud, '\n'); // With Bitvectors
-
-        val = nextnum(mud); // Shop rooms
-        skipspace(mud);
-        while (val >= 0) {
-          val = nextnum(mud); // Shop rooms
-          skipspace(mud);
-        }
+      double num = shop.sell; // Profit when Sell
+      double num2 = shop.buy; // Profit when Buy
+      const auto& types = shop.types;
 
-        nextnum(mud); // Open time
-        skipspace(mud);
-        nextnum(mud); // Close time
-        skipspace(mud);
-        nextnum(mud); // Open time
-        skipspace(mud);
-        nextnum(mud); // Close time
-        skipspace(mud);
+      int kpr = shop.keeper;
+      Object* keeper = nullptr;
+      if (bynummobinst.contains(kpr)) {
+        keeper = bynummobinst.get(kpr);
+      }
 
-        if (keeper) {
-          std::u8string picky = u8"";
-          keeper->SetSkill(prhash(u8"Sell Profit"), (int)(num * 1000.0 + 0.5));
+      if (keeper) {
+        std::u8string picky = u8"";
+        keeper->SetSkill(prhash(u8"Sell Profit"), (int)(num * 1000.0 + 0.5));
 
-          for (auto type : types) { // Buy Types
-            for (unsigned int ctr = 1; ascii_isalpha(type[ctr]); ++ctr) {
-              type[ctr] = ascii_tolower(type[ctr]);
-            }
+        for (auto type : types) { // Buy Types
+          for (unsigned int ctr = 1; ascii_isalpha(type[ctr]); ++ctr) {
+            type[ctr] = ascii_tolower(type[ctr]);
+          }
 
-            std::u8string extra = type;
-            int itnum = getnum(extra);
-            if (itnum > 0) {
-              while (isdigit(extra[0]))
-                extra = extra.substr(1);
-            } else {
-              while (isgraph(extra[0]))
-                extra = extra.substr(1);
-            }
-            while (extra.length() > 0 && isspace(extra[0]))
+          std::u8string extra = type;
+          int itnum = getnum(extra);
+          if (itnum > 0) {
+            while (isdigit(extra[0]))
               extra = extra.substr(1);
-
-            if (itnum == 1)
-              type = u8"Light";
-            else if (itnum == 2)
-              type = u8"Scroll";
-            else if (itnum == 3)
-              type = u8"Wand";
-            else if (itnum == 4)
-              type = u8"Staff";
-            else if (itnum == 5)
-              type = u8"Weapon";
-            else if (itnum == 6)
-              type = u8"Fire Weapon";
-            else if (itnum == 7)
-              type = u8"Missile";
-            else if (itnum == 8)
-              type = u8"Treasure";
-            else if (itnum == 9)
-              type = u8"Armor";
-            else if (itnum == 10)
-              type = u8"Potion";
-            else if (itnum == 11)
-              type = u8"Worn";
-            else if (itnum == 12)
-              type = u8"Other";
-            else if (itnum == 13)
-              type = u8"Trash";
-            else if (itnum == 14)
-              type = u8"Trap";
-            else if (itnum == 15)
-              type = u8"Container";
-            else if (itnum == 16)
-              type = u8"Note";
-            else if (itnum == 17)
-              type = u8"Liquid Container";
-            else if (itnum == 18)
-              type = u8"Key";
-            else if (itnum == 19)
-              type = u8"Food";
-            else if (itnum == 20)
-              type = u8"Money";
-            else if (itnum == 21)
-              type = u8"Pen";
-            else if (itnum == 22)
-              type = u8"Boat";
-            else if (itnum == 23)
-              type = u8"Fountain";
-            else if (itnum == 55)
-              type = u8"Cursed"; // According To: Rumble
-
-            if (extra[0]) {
-              // loge(u8"Rule: '{}'", extra);
-              std::set<std::u8string> extras = parse_tba_shop_rules(extra);
-              for (auto ex : extras) {
-                // loge(u8"Adding: 'Accept {}'", ex);
-                // keeper->SetSkill(prhash(u8"Accept ") + ex, 1);
-                picky += (type + u8": " + ex + u8"\n");
-              }
-            } else {
-              picky += type + u8": all\n";
+          } else {
+            while (isgraph(extra[0]))
+              extra = extra.substr(1);
+          }
+          while (extra.length() > 0 && isspace(extra[0]))
+            extra = extra.substr(1);
+
+          if (itnum == 1)
+            type = u8"Light";
+          else if (itnum == 2)
+            type = u8"Scroll";
+          else if (itnum == 3)
+            type = u8"Wand";
+          else if (itnum == 4)
+            type = u8"Staff";
+          else if (itnum == 5)
+            type = u8"Weapon";
+          else if (itnum == 6)
+            type = u8"Fire Weapon";
+          else if (itnum == 7)
+            type = u8"Missile";
+          else if (itnum == 8)
+            type = u8"Treasure";
+          else if (itnum == 9)
+            type = u8"Armor";
+          else if (itnum == 10)
+            type = u8"Potion";
+          else if (itnum == 11)
+            type = u8"Worn";
+          else if (itnum == 12)
+            type = u8"Other";
+          else if (itnum == 13)
+            type = u8"Trash";
+          else if (itnum == 14)
+            type = u8"Trap";
+          else if (itnum == 15)
+            type = u8"Container";
+          else if (itnum == 16)
+            type = u8"Note";
+          else if (itnum == 17)
+            type = u8"Liquid Container";
+          else if (itnum == 18)
+            type = u8"Key";
+          else if (itnum == 19)
+            type = u8"Food";
+          else if (itnum == 20)
+            type = u8"Money";
+          else if (itnum == 21)
+            type = u8"Pen";
+          else if (itnum == 22)
+            type = u8"Boat";
+          else if (itnum == 23)
+            type = u8"Fountain";
+          else if (itnum == 55)
+            type = u8"Cursed"; // According To: Rumble
+
+          if (extra[0]) {
+            // loge(u8"Rule: '{}'", extra);
+            std::set<std::u8string> extras = parse_tba_shop_rules(extra);
+            for (auto ex : extras) {
+              // loge(u8"Adding: 'Accept {}'", ex);
+              // keeper->SetSkill(prhash(u8"Accept ") + ex, 1);
+              picky += (type + u8": " + ex + u8"\n");
             }
+          } else {
+            picky += type + u8": all\n";
+          }
 
-            if (type != u8"0" && type != u8"Light" && type != u8"Scroll" && type != u8"Wand" &&
-                type != u8"Staff" && type != u8"Weapon" && type != u8"Fire Weapon" &&
-                type != u8"Missile" && type != u8"Treasure" && type != u8"Armor" &&
-                type != u8"Potion" && type != u8"Worn" && type != u8"Other" && type != u8"Trash" &&
-                type != u8"Trap" && type != u8"Container" && type != u8"Note" &&
-                type != u8"Liquid Container" && type != u8"Key" && type != u8"Food" &&
-                type != u8"Money" && type != u8"Pen" && type != u8"Boat" && type != u8"Fountain") {
-              logey(u8"Warning: Can't handle {}'s buy target: '{}'", keeper->Noun(), type);
-            } else if (type != u8"0") { // Apparently 0 used for u8"Ignore This"
-              keeper->SetSkill(std::u8string(u8"Buy ") + type, (int)(num2 * 1000.0 + 0.5));
-            }
+          if (type != u8"0" && type != u8"Light" && type != u8"Scroll" && type != u8"Wand" &&
+              type != u8"Staff" && type != u8"Weapon" && type != u8"Fire Weapon" &&
+              type != u8"Missile" && type != u8"Treasure" && type != u8"Armor" &&
+              type != u8"Potion" && type != u8"Worn" && type != u8"Other" && type != u8"Trash" &&
+              type != u8"Trap" && type != u8"Container" && type != u8"Note" &&
+              type != u8"Liquid Container" && type != u8"Key" && type != u8"Food" &&
+              type != u8"Money" && type != u8"Pen" && type != u8"Boat" && type != u8"Fountain") {
+            logey(u8"Warning: Can't handle {}'s buy target: '{}'", keeper->Noun(), type);
+          } else if (type != u8"0") { // Apparently 0 used for u8"Ignore This"
+            keeper->SetSkill(std::u8string(u8"Buy ") + type, (int)(num2 * 1000.0 + 0.5));
           }
-          vortex->SetLongDesc(picky);
-          vortex->SetParent(keeper);
-          keeper->AddAct(act_t::WEAR_RSHOULDER, vortex);
-        } else {
-          vortex->Recycle();
-          logey(u8"Warning: Can't find shopkeeper #{}!", kpr);
         }
+        vortex->SetLongDesc(picky);
+        vortex->SetParent(keeper);
+        keeper->AddAct(act_t::WEAR_RSHOULDER, vortex);
+      } else {
+        vortex->Recycle();
+        logey(u8"Warning: Can't find shopkeeper #{}!", kpr);
       }
-    } else if (mud.front() != '$') { // Not a Null Shop File!
-      loge(u8"Error: '{}' is not a CircleMUD v3.0 Shop File!", fn);
     }
   } else {
-    loge(u8"Error: '{}' does not exist!", fn);
+    loge(u8"Error: '{}' does not exist!", file.fn);
   }
 }
 
 void Object::TBALoadTRG(const std::u8string& fn) { // Triggers
-  infile mud(fn);
-  if (mud) {
-    int tnum = -1;
-    while (mud.front() == '#') {
-      nextchar(mud);
-      tnum = nextnum(mud);
-      skipspace(mud);
+  TBALoadTRG(parse_tba_file(fn, parse_tba_trg));
+}
+
+void Object::TBALoadTRG(const tba_parsed& file) {
+  if (file.found) {
+    for (const auto& trg : file.trgs) {
       Object* script = nullptr;
       script = new Object();
-      bynumtrg[tnum] = script;
+      bynumtrg.set(trg.tnum, script);
       script->SetSkill(prhash(u8"Invisible"), 1000);
-      script->SetSkill(prhash(u8"TBAScript"), 1000000 + tnum);
-      script->SetSkill(prhash(u8"Accomplishment"), 1200000 + tnum);
+      script->SetSkill(prhash(u8"TBAScript"), 1000000 + trg.tnum);
+      script->SetSkill(prhash(u8"Accomplishment"), 1200000 + trg.tnum);
       script->SetShortDesc(u8"A tbaMUD trigger script");
-      // loge(u8"Loading #{}", tnum);
-      load_tba_field(mud); // Trigger Name - Discarded!
-      // script->SetDesc(buf);
-      skipspace(mud);
-
-      int atype = nextnum(mud);
-      skipspace(mud);
-      int ttype = tba_bitvec(getuntil(mud, ' ')); // Trigger Types
-      skipspace(mud);
-      int narg = nextnum(mud);
-      skipspace(mud);
-      atype = 1 << (atype + 24); // Attach Type
-      script->SetSkill(prhash(u8"TBAScriptType"), atype | ttype); // Combined
-      script->SetSkill(prhash(u8"TBAScriptNArg"), narg); // Numeric Arg
+      // loge(u8"Loading #{}", trg.tnum);
 
-      script->SetDesc(load_tba_field(mud)); // Text argument!
-      getuntil(mud, '\n'); // Go to next Line, don't eat spaces.
+      int atype = 1 << (trg.atype + 24); // Attach Type
+      script->SetSkill(prhash(u8"TBAScriptType"), atype | trg.ttype); // Combined
+      script->SetSkill(prhash(u8"TBAScriptNArg"), trg.narg); // Numeric Arg
 
-      std::u8string long_desc(load_tba_field(mud)); // Command List (Multi-Line)
-      skipspace(mud);
-      script->SetLongDesc(long_desc);
+      script->SetDesc(trg.arg); // Text argument!
+      script->SetLongDesc(trg.script); // Command List (Multi-Line)
       if (script->LongDesc().contains(
               u8"* Check the direction the player must go to enter the guild.")) {
         // char8_t dir[16];
@@ -2825,6 +3118,217 @@ void Object::TBALoadTRG(const std::u8string& fn) { // Triggers
       }
     }
   } else {
-    loge(u8"Error: '{}' does not exist!", fn);
+    loge(u8"Error: '{}' does not exist!", file.fn);
+  }
+}
+
+static std::vector<tba_parsed> tba_index(const std::u8string& dir) {
+  std::vector<tba_parsed> files;
+  infile index(fmt::format(u8"tba/{}/index", dir));
+  if (index) {
+    while (index.length() > 3) {
+      files.emplace_back().fn = fmt::format(u8"tba/{}/{}", dir, getuntil(index, '\n'));
+    }
+  }
+  return files;
+}
+
+// The fully built world is cached (in acid/, by default), in the normal save format, named for a
+// hash of the sources it was built from, so an unchanged tba/ tree can just be loaded instead of
+// rebuilt.
+// Bump this whenever the importer changes what it builds from the same sources.
+static constexpr int tba_cache_version = 2;
+
+// 64-bit FNV-1a, but taken a word at a time, since this reads all of tba/ every time.  This can't
+// just use crc32c(), since that ignores case, and so would miss some edits.
+static uint64_t tba_hash(uint64_t hash, std::u8string_view data) {
+  size_t pos = 0;
+  for (; pos + sizeof(uint64_t) <= data.length(); pos += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data.data() + pos, sizeof(word));
+    hash = (hash ^ word) * 0x100000001B3ULL;
+    hash ^= hash >> 29;
+  }
+  for (; pos < data.length(); ++pos) {
+    hash = (hash ^ uint8_t(data[pos])) * 0x100000001B3ULL;
+  }
+  return hash;
+}
+
+static std::u8string tba_cache_name(
+    const std::u8string& dir,
+    std::initializer_list<const std::vector<tba_parsed>*> types) {
+  uint64_t hash = tba_hash(0xCBF29CE484222325ULL, fmt::format(u8"v{}\n", tba_cache_version));
+  for (auto files : types) {
+    for (const auto& file : *files) {
+      infile source(file.fn);
+      hash = tba_hash(hash, fmt::format(u8"{}:{}\n", file.fn, source.all().length()));
+      hash = tba_hash(hash, source.all());
+    }
+  }
+  return fmt::format(u8"{}/tba_{:016X}.wld", dir, hash);
+}
+
+// Redo what the import did outside of the saved objects: the world's home, and starting up the
+// room and object triggers which TBAFinalizeTriggers() activated.  Random ones were already
+// started by LoadFrom().
+static void tba_cache_fixup(Object* obj) {
+  if (obj->Skill(prhash(u8"TBARoom")) == 1000000) {
+    tba_set_home(obj);
+  }
+  const int type = obj->Skill(prhash(u8"TBAScriptType"));
+  if (obj->HasSkill(prhash(u8"TBAScript")) && obj->IsActive() && (type & 0x1000000) &&
+      !(type & 2)) {
+    new_trigger(Dice::Rand(13000, 25999), obj, nullptr, nullptr, u8"");
+  }
+  for (auto cind : obj->Contents()) {
+    tba_cache_fixup(cind);
+  }
+}
+
+static bool tba_cache_load(Object* world, const std::u8string& cache) {
+  if (!std::filesystem::exists(cache)) {
+    return false;
+  }
+  if (world->Load(cache)) {
+    return false;
+  }
+  for (auto cind : world->Contents()) {
+    tba_cache_fixup(cind);
+  }
+  return true;
+}
+
+static void tba_cache_save(Object* world, const std::u8string& dir, const std::u8string& cache) {
+  if (!std::filesystem::is_directory(dir)) {
+    return;
+  }
+  std::error_code err;
+  for (const auto& ent : std::filesystem::directory_iterator(dir, err)) {
+    auto name = ent.path().filename().u8string();
+    if (name.starts_with(u8"tba_") && name.ends_with(u8".wld")) { // Out of date
+      std::filesystem::remove(ent.path());
+    }
+  }
+  std::u8string tmp = cache + u8".tmp";
+  std::filesystem::remove(tmp);
+  if (!world->Save(tmp)) {
+    std::filesystem::rename(tmp, cache);
+  } else {
+    loge(u8"Unable to save TBA world cache!");
+  }
+}
+
+static int tba_msecs(std::chrono::steady_clock::time_point& since) {
+  auto now = std::chrono::steady_clock::now();
+  auto msecs = std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count();
+  since = now;
+  return msecs;
+}
+
+void Object::TBALoadAll(const std::u8string& cache_dir) {
+  auto mark = std::chrono::steady_clock::now();
+
+  std::vector<tba_parsed> trg = tba_index(u8"trg");
+  std::vector<tba_parsed> wld = tba_index(u8"wld");
+  std::vector<tba_parsed> obj = tba_index(u8"obj");
+  std::vector<tba_parsed> mob = tba_index(u8"mob");
+  std::vector<tba_parsed> zon = tba_index(u8"zon");
+  std::vector<tba_parsed> shp = tba_index(u8"shp");
+
+  // The cache holds this entire object, so it's only used when importing into an empty one.
+  bool cacheable = contents.empty() && !cache_dir.empty();
+  std::u8string cache;
+  if (cacheable) {
+    cache = tba_cache_name(cache_dir, {&trg, &wld, &obj, &mob, &zon, &shp});
+  }
+  if (cacheable && tba_cache_load(this, cache)) {
+    loge(u8"Loaded TBA world from {} in {}ms.", cache, tba_msecs(mark));
+    return;
+  }
+
+  // Parse every file at once, nothing here depends on any other file.
+  std::vector<std::pair<tba_parsed*, tba_parser>> jobs;
+  for (auto [files, parse] : {
+           std::make_pair(&trg, parse_tba_trg),
+           std::make_pair(&wld, parse_tba_wld),
+           std::make_pair(&obj, parse_tba_obj),
+           std::make_pair(&mob, parse_tba_mob),
+           std::make_pair(&zon, parse_tba_zon),
+           std::make_pair(&shp, parse_tba_shp)}) {
+    for (auto& file : *files) {
+      jobs.emplace_back(&file, parse);
+    }
+  }
+  std::atomic<size_t> next_job = 0;
+  auto worker = [&jobs, &next_job]() {
+    for (size_t job = next_job++; job < jobs.size(); job = next_job++) {
+      *jobs[job].first = parse_tba_file(jobs[job].first->fn, jobs[job].second);
+    }
+  };
+  size_t num_threads = std::min<size_t>(std::thread::hardware_concurrency(), jobs.size());
+  num_threads = std::max<size_t>(num_threads, 1);
+  std::vector<std::thread> pool;
+  for (size_t ctr = 1; ctr < num_threads; ++ctr) {
+    pool.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : pool) {
+    thread.join();
+  }
+  int parse_ms = tba_msecs(mark);
+
+  // Then build them, in order, since each type refers to the vnums of the ones before it.
+  for (const auto& file : trg) {
+    TBALoadTRG(file);
+  }
+  int trg_ms = tba_msecs(mark);
+  for (const auto& file : wld) {
+    TBALoadWLD(file);
+  }
+  int wld_ms = tba_msecs(mark);
+  for (const auto& file : obj) {
+    TBALoadOBJ(file);
+  }
+  int obj_ms = tba_msecs(mark);
+  for (const auto& file : mob) {
+    TBALoadMOB(file);
+  }
+  int mob_ms = tba_msecs(mark);
+  for (const auto& file : zon) {
+    TBALoadZON(file);
   }
+  TBAFinalizeTriggers();
+  int zon_ms = tba_msecs(mark);
+  for (const auto& file : shp) {
+    TBALoadSHP(file);
+  }
+  int shp_ms = tba_msecs(mark);
+  TBAResetZones();
+  int reset_ms = tba_msecs(mark);
+  TBACleanup();
+  int cleanup_ms = tba_msecs(mark);
+  if (cacheable) {
+    tba_cache_save(this, cache_dir, cache);
+  }
+  int cache_ms = tba_msecs(mark);
+
+  logeyy(u8"Warning: {} untranslated triggers!", untrans_trig);
+  logeyy(u8"Warning: {} tacked-on object aliases!", obj_aliases);
+  logeyy(u8"Warning: {} tacked-on mob aliases!", mob_aliases);
+  loge(
+      u8"Imported TBA world: parsed {} files on {} threads in {}ms, built trg {}ms, wld {}ms, "
+      u8"obj {}ms, mob {}ms, zon {}ms, shp {}ms, reset {}ms, cleanup {}ms, cached in {}ms.",
+      jobs.size(),
+      num_threads,
+      parse_ms,
+      trg_ms,
+      wld_ms,
+      obj_ms,
+      mob_ms,
+      zon_ms,
+      shp_ms,
+      reset_ms,
+      cleanup_ms,
+      cache_ms);
 }
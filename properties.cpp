@@ -58,6 +58,7 @@ void save_prop_names_to(outfile& fl) {
 
 void load_prop_names_from(std::u8string_view& fl) {
   int32_t size = nextnum(fl);
+  skipspace(fl);
 
   skill_defs.reserve(skill_defs.size() + size);
   for (int sk = 0; sk < size; ++sk) {
@@ -77,21 +78,25 @@ void purge_invalid_prop_names() {
   skill_defs.erase(std::unique(skill_defs.begin(), skill_defs.end()), skill_defs.end());
 }
 
+// The skill_defs list is always kept sorted by hash, so these can search it directly.
+static auto find_skill_def(uint32_t stok) {
+  return std::lower_bound(
+      skill_defs.begin(), skill_defs.end(), stok, [](const auto& def, uint32_t tok) {
+        return def.first < tok;
+      });
+}
+
 void confirm_skill_hash(uint32_t stok) {
-  auto itn = skill_defs.begin();
-  for (; itn != skill_defs.end() && itn->first != stok; ++itn) {
-  }
-  if (itn == skill_defs.end()) {
+  auto itn = find_skill_def(stok);
+  if (itn == skill_defs.end() || itn->first != stok) {
     loger(u8"Error: bogus skill hash (x{:08X})", stok);
-    skill_defs.emplace_back(std::make_pair(stok, u8"Unknown"));
+    skill_defs.emplace(itn, stok, u8"Unknown");
   }
 }
 void insert_skill_hash(uint32_t stok, const std::u8string_view& s) {
-  auto itn = skill_defs.begin();
-  for (; itn != skill_defs.end() && itn->first != stok; ++itn) {
-  }
-  if (itn == skill_defs.end()) {
-    skill_defs.emplace_back(std::make_pair(stok, s));
+  auto itn = find_skill_def(stok);
+  if (itn == skill_defs.end() || itn->first != stok) {
+    skill_defs.emplace(itn, stok, s);
   }
 }
 
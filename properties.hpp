@@ -524,6 +524,13 @@ constexpr auto prop_names = std::to_array({
     u8"TBAScriptNArg",
     u8"TBAScriptType",
     u8"TBAZone",
+    u8"TBAZoneAge",
+    u8"TBAZoneBottom",
+    u8"TBAZoneDoor",
+    u8"TBAZoneLifespan",
+    u8"TBAZoneResetMode",
+    u8"TBAZoneStep",
+    u8"TBAZoneTop",
     u8"Teamster",
     u8"Teleport",
     u8"Teleport Spell",
@@ -213,6 +213,7 @@ void Object::SetSkill(uint32_t stok, int v) {
   } else {
     itr->second = v;
   }
+  SkillChanged(stok);
 }
 
 void Object::SetSkill(const std::u8string_view& s, int v) {
@@ -230,6 +231,7 @@ void Object::ClearSkill(uint32_t stok) {
   }
   if (itr != skills.end()) {
     skills.erase(itr);
+    SkillChanged(stok);
   }
 }
 
@@ -0,0 +1,344 @@
+// *************************************************************************
+//  This file is part of AcidMUD by Steaphan Greene
+//
+//  Copyright 1999-2022 Steaphan Greene <steaphan@gmail.com>
+//
+//  AcidMUD is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  AcidMUD is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with AcidMUD (see the file named "COPYING");
+//  If not, see <http://www.gnu.org/licenses/>.
+//
+// *************************************************************************
+
+#include "test_main.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "../mind.hpp"
+#include "../object.hpp"
+#include "../properties.hpp"
+
+// These are hidden by default ("[.]"), run them with: tests/tests "[benchmark]"
+
+// A hub room linked to many others, with a mob in it being fought by many others.
+static Object* build_hub(Object* zone, int num) {
+  auto hub = new Object(zone);
+  hub->SetShortDesc(u8"a hub");
+  auto target = new Object(hub);
+  target->SetShortDesc(u8"a target");
+  for (int ctr = 0; ctr < num; ++ctr) {
+    auto spoke = new Object(zone);
+    spoke->SetShortDesc(u8"a spoke");
+    hub->Link(spoke, u8"out", u8"A way out.", u8"in", u8"A way in.");
+    auto fighter = new Object(spoke);
+    fighter->SetShortDesc(u8"a fighter");
+    fighter->AddAct(act_t::FIGHT, target);
+    fighter->AddAct(act_t::POINT, target);
+  }
+  return hub;
+}
+
+TEST_CASE("Recycle Throughput", "[.][benchmark]") {
+  init_universe();
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+
+  BENCHMARK_ADVANCED("Recycle Well-Connected Room")(Catch::Benchmark::Chronometer meter) {
+    std::vector<Object*> hubs;
+    for (int run = 0; run < meter.runs(); ++run) {
+      hubs.push_back(build_hub(zone, 64));
+    }
+    meter.measure([&hubs](int run) { hubs[run]->Recycle(); });
+    for (auto spoke : zone->Contents()) {
+      spoke->Recycle();
+    }
+  };
+
+  destroy_universe();
+}
+
+// Reads the short description and aliases of every object in the TBA corpus.
+static std::vector<std::pair<std::u8string, std::vector<std::u8string>>> load_tba_objs() {
+  std::vector<std::pair<std::u8string, std::vector<std::u8string>>> ret;
+  if (!std::filesystem::is_directory("tba/obj")) {
+    return ret;
+  }
+  for (const auto& ent : std::filesystem::directory_iterator("tba/obj")) {
+    if (ent.path().extension() != ".obj") {
+      continue;
+    }
+    std::ifstream file(ent.path());
+    std::string line;
+    while (std::getline(file, line)) {
+      if (line.length() < 2 || line[0] != '#') {
+        continue;
+      }
+      std::string aliases, sdesc;
+      if (!std::getline(file, aliases) || !std::getline(file, sdesc)) {
+        break;
+      }
+      if (aliases.ends_with('~') && sdesc.ends_with('~')) {
+        aliases.pop_back();
+        sdesc.pop_back();
+        std::vector<std::u8string> words;
+        std::istringstream alist(aliases);
+        std::string word;
+        while (alist >> word) {
+          words.emplace_back(word.begin(), word.end());
+        }
+        ret.emplace_back(std::u8string(sdesc.begin(), sdesc.end()), words);
+      }
+    }
+  }
+  return ret;
+}
+
+TEST_CASE("Matches Throughput", "[.][benchmark]") {
+  auto corpus = load_tba_objs();
+  if (corpus.empty()) {
+    WARN("No TBA object corpus found in tba/obj");
+    return;
+  }
+
+  init_universe();
+  std::vector<Object*> objs;
+  for (const auto& entry : corpus) {
+    auto obj = new Object(Object::Universe());
+    obj->SetShortDesc(entry.first);
+    objs.push_back(obj);
+  }
+
+  // Every alias against its own object, as the TBA loader does.
+  BENCHMARK("Matches TBA Object Aliases") {
+    int found = 0;
+    for (size_t idx = 0; idx < objs.size(); ++idx) {
+      for (const auto& alias : corpus[idx].second) {
+        found += objs[idx]->Matches(alias);
+      }
+    }
+    return found;
+  };
+
+  // Aliases and suffix-words, which fall through to the dictionary, against everything.
+  BENCHMARK("Matches Dictionary Words") {
+    int found = 0;
+    for (auto obj : objs) {
+      for (const auto& word : {u8"guard", u8"sword", u8"grey", u8"battle axe", u8"bread"}) {
+        found += obj->Matches(word);
+      }
+    }
+    return found;
+  };
+
+  destroy_universe();
+}
+
+int handle_command_wload(Object*, std::shared_ptr<Mind>&, const std::u8string_view&, int, int);
+
+TEST_CASE("DirectionsTo Throughput", "[.][benchmark]") {
+  if (!std::filesystem::is_directory("terrestria")) {
+    WARN("No terrestria maps found");
+    return;
+  }
+
+  init_universe();
+  auto builder = new Object(Object::Universe());
+  builder->SetShortDesc(u8"a builder");
+  auto mind = std::make_shared<Mind>(mind_t::TEST);
+  builder->Attach(mind);
+  handle_command_wload(builder, mind, u8"terrestria", 0, 0);
+
+  // Everyone who has both a home and a workplace, as they walk between them every day.
+  std::vector<std::pair<Object*, Object*>> commutes;
+  std::vector<Object*> todo = {Object::Universe()};
+  while (!todo.empty()) {
+    auto obj = todo.back();
+    todo.pop_back();
+    for (auto item : obj->Contents()) {
+      todo.push_back(item);
+    }
+    if (obj->ActTarg(act_t::SPECIAL_HOME) && obj->ActTarg(act_t::SPECIAL_WORK)) {
+      auto home = obj->ActTarg(act_t::SPECIAL_HOME)->Room();
+      auto work = obj->ActTarg(act_t::SPECIAL_WORK)->Room();
+      if (home->Zone() == work->Zone()) {
+        commutes.emplace_back(home, work);
+      }
+    }
+  }
+  REQUIRE(!commutes.empty());
+  BENCHMARK("DirectionsTo Work and Home") {
+    size_t steps = 0;
+    for (const auto& commute : commutes) {
+      steps += commute.first->DirectionsTo(commute.second, nullptr).length();
+      steps += commute.second->DirectionsTo(commute.first, nullptr).length();
+    }
+    return steps;
+  };
+
+  // Any change to who can get through a door forgets every route found so far.
+  Object* door = nullptr;
+  for (auto room : commutes.front().first->Zone()->Contents()) {
+    for (auto item : room->Contents()) {
+      if (item->IsAct(act_t::SPECIAL_LINKED) && !item->HasSkill(prhash(u8"Closeable"))) {
+        door = item;
+      }
+    }
+  }
+  REQUIRE(door != nullptr);
+  BENCHMARK("DirectionsTo Work and Home Uncached") {
+    door->SetSkill(prhash(u8"Open"), door->Skill(prhash(u8"Open")));
+    size_t steps = 0;
+    for (const auto& commute : commutes) {
+      steps += commute.first->DirectionsTo(commute.second, nullptr).length();
+      steps += commute.second->DirectionsTo(commute.first, nullptr).length();
+    }
+    return steps;
+  };
+
+  destroy_universe();
+}
+
+TEST_CASE("TBA Script Throughput", "[.][benchmark]") {
+  init_universe();
+  auto world = new Object(Object::Universe());
+  auto zone = new Object(world);
+  auto room = new Object(zone);
+  room->SetSkill(prhash(u8"TBARoom"), 1000001);
+  auto trig = new Object(room);
+  trig->SetShortDesc(u8"A tbaMUD trigger script");
+  trig->SetSkill(prhash(u8"TBAScript"), 1000001);
+  trig->SetSkill(prhash(u8"TBAScriptType"), 0x4000000); // ROOM-GLOBAL
+  trig->SetLongDesc(
+      u8"* Count through every kind of branch a few times\n"
+      u8"set n 0\n"
+      u8"while %n% < 20\n"
+      u8"  eval n %n% + 1\n"
+      u8"  if %n% == 1\n"
+      u8"    nop first\n"
+      u8"  elseif %n% == 2\n"
+      u8"    nop second\n"
+      u8"  else\n"
+      u8"    switch %n%\n"
+      u8"      case 3\n"
+      u8"        nop third\n"
+      u8"        break\n"
+      u8"      case 4\n"
+      u8"        nop fourth\n"
+      u8"        break\n"
+      u8"      default\n"
+      u8"        nop later\n"
+      u8"        break\n"
+      u8"    done\n"
+      u8"  end\n"
+      u8"done\n"
+      u8"global n\n");
+
+  BENCHMARK("Run Branchy Script") {
+    new_trigger(0, trig, nullptr);
+    return room->Skill(crc32c(u8"TBA:n"));
+  };
+
+  // Most firings are like this: a line or two, then done, so it's mostly per-firing setup.
+  auto quick = new Object(room);
+  quick->SetShortDesc(u8"A tbaMUD trigger script");
+  quick->SetSkill(prhash(u8"TBAScript"), 1000002);
+  quick->SetSkill(prhash(u8"TBAScriptType"), 0x4000000); // ROOM-GLOBAL
+  quick->SetLongDesc(u8"set greeted 1\nglobal greeted\n");
+
+  BENCHMARK("Fire Short Trigger") {
+    new_trigger(0, quick, nullptr);
+    return room->Skill(crc32c(u8"TBA:greeted"));
+  };
+
+  destroy_universe();
+}
+
+TEST_CASE("TBA Expression Throughput", "[.][benchmark]") {
+  // Typical conditions and evals, as they look with their variables already filled in.
+  static const std::vector<std::u8string> exprs = {
+      u8"12 < 20",
+      u8"3051 == 3051",
+      u8"south == south && 1",
+      u8"!0",
+      u8"57 - 1",
+      u8"obj:0x55d0c0ffee10",
+      u8"21 + 99",
+      u8"15 >= 10 && 15 < 20",
+  };
+
+  BENCHMARK("Original Evaluator") {
+    int total = 0;
+    for (const auto& expr : exprs) {
+      total += tba_eval_text(expr);
+    }
+    return total;
+  };
+
+  BENCHMARK("Compiled Evaluator") {
+    int total = 0;
+    for (const auto& expr : exprs) {
+      total += tba_eval(expr);
+    }
+    return total;
+  };
+}
+
+// A new, empty directory to cache TBA worlds in, so the live one in acid/ is never touched.
+static std::filesystem::path empty_tba_cache_dir() {
+  auto dir = std::filesystem::temp_directory_path() / "acidmud_tba_cache_bench";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+TEST_CASE("TBA World Import Throughput", "[.][benchmark]") {
+  if (!std::filesystem::exists("tba/wld/index")) {
+    WARN("No TBA world found in tba/");
+    return;
+  }
+  const auto dir = empty_tba_cache_dir().u8string();
+
+  init_universe();
+  std::vector<Object*> worlds;
+
+  // From the sources, including writing out the cache.
+  BENCHMARK_ADVANCED("Cold Import")(Catch::Benchmark::Chronometer meter) {
+    for (auto world : worlds) {
+      delete world;
+    }
+    worlds.clear();
+    meter.measure([&worlds, &dir]() {
+      empty_tba_cache_dir();
+      worlds.push_back(new Object(Object::Universe()));
+      worlds.back()->TBALoadAll(dir);
+    });
+  };
+
+  // From the cache the last cold import left.
+  BENCHMARK_ADVANCED("Warm Import")(Catch::Benchmark::Chronometer meter) {
+    for (auto world : worlds) {
+      delete world;
+    }
+    worlds.clear();
+    meter.measure([&worlds, &dir]() {
+      worlds.push_back(new Object(Object::Universe()));
+      worlds.back()->TBALoadAll(dir);
+    });
+  };
+
+  destroy_universe();
+  std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,111 @@
+// *************************************************************************
+//  This file is part of AcidMUD by Steaphan Greene
+//
+//  Copyright 1999-2022 Steaphan Greene <steaphan@gmail.com>
+//
+//  AcidMUD is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  AcidMUD is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with AcidMUD (see the file named "COPYING");
+//  If not, see <http://www.gnu.org/licenses/>.
+//
+// *************************************************************************
+
+
+#include "test_main.hpp"
+
+#include <string>
+#include <vector>
+
+#include "../commands.hpp"
+
+// The plain scan of the command list that command lookup used to do, in comlist order.
+static com_t scan_commands(const std::u8string_view str, com_mode_t mode) {
+  for (int ctr = 1; command_entry(ctr).id != COM_MAX; ++ctr) {
+    auto com = command_entry(ctr);
+    if (mode == COM_MODE_NINJA) {
+      if (com.ninja && str == com.command.substr(0, str.length())) {
+        return com_t(ctr);
+      }
+      if (com.id == COM_CHARACTERS && std::u8string_view(u8"chars").starts_with(str)) {
+        return com_t(ctr);
+      }
+      continue;
+    }
+
+    if (com.ninja) {
+      continue;
+    }
+    if (mode == COM_MODE_ETHEREAL && !com.ethereal) {
+      continue;
+    }
+    if (mode == COM_MODE_CORPOREAL && !com.corporeal) {
+      continue;
+    }
+
+    if (str == com.command.substr(0, str.length())) {
+      return com_t(ctr);
+    }
+    if (com.id == COM_SAY && (str.starts_with(u8"'") || str.starts_with(u8"\""))) {
+      return com.id;
+    }
+    if (com.id == COM_DUMP && std::u8string_view(u8"empty").starts_with(str)) {
+      return com.id;
+    }
+    if (com.id == COM_GET && std::u8string_view(u8"take").starts_with(str)) {
+      return com.id;
+    }
+    if (com.id == COM_PASSWORD && std::u8string_view(u8"passwd").starts_with(str)) {
+      return com.id;
+    }
+  }
+  return COM_NONE;
+}
+
+TEST_CASE("Command Lookup", "[commands]") {
+  std::vector<std::u8string> names = {
+      u8"empty", u8"take", u8"passwd", u8"chars", u8"'hello", u8"\"hello", u8"xyzzy"};
+  for (int ctr = 1; command_entry(ctr).id != COM_MAX; ++ctr) {
+    names.emplace_back(command_entry(ctr).command);
+  }
+
+  // Every prefix of every name, and each of those with something more after it.
+  std::vector<std::u8string> tries = {u8""};
+  for (const auto& name : names) {
+    for (size_t len = 1; len <= name.length(); ++len) {
+      tries.emplace_back(name.substr(0, len));
+      tries.emplace_back(name.substr(0, len) + u8"q");
+      tries.emplace_back(name.substr(0, len) + u8"'");
+    }
+  }
+  REQUIRE(tries.size() > 1000);
+
+  for (const auto& str : tries) {
+    for (auto mode : {COM_MODE_ETHEREAL, COM_MODE_CORPOREAL, COM_MODE_NINJA}) {
+      INFO(std::string(str.begin(), str.end()) << " in mode " << int(mode));
+      REQUIRE(identify_command(str, mode) == scan_commands(str, mode));
+    }
+  }
+
+  SECTION("Aliases") {
+    REQUIRE(identify_command(u8"emp", COM_MODE_CORPOREAL) == COM_DUMP);
+    REQUIRE(identify_command(u8"take", COM_MODE_CORPOREAL) == COM_GET);
+    REQUIRE(identify_command(u8"passwd", COM_MODE_ETHEREAL) == COM_PASSWORD);
+    REQUIRE(identify_command(u8"chars", COM_MODE_NINJA) == COM_CHARACTERS);
+    REQUIRE(identify_command(u8"chars", COM_MODE_CORPOREAL) == COM_NONE);
+  }
+
+  SECTION("Quotes") {
+    REQUIRE(identify_command(u8"'Hello", COM_MODE_CORPOREAL) == COM_SAY);
+    REQUIRE(identify_command(u8"\"Hello", COM_MODE_CORPOREAL) == COM_SAY);
+    REQUIRE(identify_command(u8"'Hello", COM_MODE_NINJA) == COM_NONE);
+  }
+}
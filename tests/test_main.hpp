@@ -19,6 +19,7 @@
 //
 // *************************************************************************
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
 namespace Catch {
@@ -21,6 +21,10 @@
 
 #include "test_main.hpp"
 
+#include <filesystem>
+#include <fstream>
+
+#include "../mind.hpp"
 #include "../object.hpp"
 #include "../properties.hpp"
 
@@ -169,6 +173,98 @@ TEST_CASE("Object Movement", "[object]") {
   destroy_universe();
 }
 
+TEST_CASE("Object Ancestry", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  // Note: Each must have a different ShortDesc to avoid being auto-combined.
+  auto world1 = new Object(Object::Universe());
+  world1->SetShortDesc(u8"world1");
+  auto world2 = new Object(Object::Universe());
+  world2->SetShortDesc(u8"world2");
+  auto zone1 = new Object(world1);
+  zone1->SetShortDesc(u8"zone1");
+  auto zone2 = new Object(world2);
+  zone2->SetShortDesc(u8"zone2");
+  auto room1 = new Object(zone1);
+  room1->SetShortDesc(u8"room1");
+  auto room2 = new Object(zone2);
+  room2->SetShortDesc(u8"room2");
+  auto bag = new Object(room1);
+  bag->SetShortDesc(u8"bag");
+  auto box = new Object(bag);
+  box->SetShortDesc(u8"box");
+  auto item = new Object(box);
+  item->SetShortDesc(u8"item");
+
+  REQUIRE(item->Room() == room1);
+  REQUIRE(item->Zone() == zone1);
+  REQUIRE(item->World() == world1);
+  REQUIRE(room1->Room() == room1);
+  REQUIRE(zone1->Room() == zone1);
+  REQUIRE(zone1->Zone() == zone1);
+  REQUIRE(world1->Zone() == world1);
+  REQUIRE(Object::Universe()->World() == Object::Universe());
+
+  SECTION("Move Container") {
+    bag->Travel(room2);
+    REQUIRE(bag->Room() == room2);
+    REQUIRE(box->Room() == room2);
+    REQUIRE(item->Room() == room2);
+    REQUIRE(item->Zone() == zone2);
+    REQUIRE(item->World() == world2);
+  }
+
+  SECTION("Move Leaf") {
+    REQUIRE(box->Room() == room1);
+    item->Travel(room2);
+    REQUIRE(item->Room() == room2);
+    REQUIRE(item->World() == world2);
+    REQUIRE(box->Room() == room1);
+    REQUIRE(box->World() == world1);
+  }
+
+  SECTION("Move Room") {
+    room1->Parent()->RemoveLink(room1);
+    room1->SetParent(zone2);
+    REQUIRE(room1->Room() == room1);
+    REQUIRE(room1->Zone() == zone2);
+    REQUIRE(item->Room() == room1);
+    REQUIRE(item->Zone() == zone2);
+    REQUIRE(item->World() == world2);
+  }
+
+  SECTION("Move Zone") {
+    auto chest = new Object(room2);
+    chest->SetShortDesc(u8"chest");
+    zone1->Parent()->RemoveLink(zone1);
+    zone1->SetParent(chest);
+    REQUIRE(room1->Room() == room2);
+    REQUIRE(box->Room() == room2);
+    REQUIRE(item->Room() == room2);
+  }
+
+  SECTION("Move Container Often") {
+    REQUIRE(item->Room() == room1);
+    for (int move = 0; move < 0xFFFF; ++move) { // Until its epoch wraps
+      box->Parent()->RemoveLink(box);
+      box->SetParent((move % 2) ? room1 : room2);
+    }
+    REQUIRE(item->Room() == room2);
+    REQUIRE(bag->Room() == room1);
+  }
+
+  SECTION("Recycle Container") {
+    REQUIRE(item->Room() == room1);
+    box->Recycle();
+    REQUIRE(item->Parent() == Object::TrashBin());
+    REQUIRE(item->Room() == item);
+    REQUIRE(item->World() == item);
+  }
+
+  destroy_universe();
+}
+
 TEST_CASE("Object Actions", "[object]") {
   init_universe();
   REQUIRE(Object::Universe() != nullptr);
@@ -434,6 +530,51 @@ TEST_CASE("Object Text Limits", "[object]") {
       u8"AAAAAAAAAAAAAAAAAAAA");
 }
 
+TEST_CASE("Object Copies", "[object]") {
+  init_universe();
+  auto orig = new Object();
+  orig->SetShortDesc(u8"a sword");
+  orig->SetDesc(u8"A sharp sword.");
+  orig->SetSkill(prhash(u8"Durability"), 10);
+
+  // Copies share their descriptions.
+  auto copy = new Object(*orig);
+  REQUIRE(copy->ShortDesc().data() == orig->ShortDesc().data());
+  REQUIRE(copy->Desc() == u8"A sharp sword.");
+  REQUIRE(copy->Skill(prhash(u8"Durability")) == 10);
+  REQUIRE(copy->IsSameAs(*orig));
+
+  // Until they change them.
+  copy->SetShortDesc(u8"a dull sword");
+  REQUIRE(orig->ShortDesc() == u8"a sword");
+  REQUIRE(copy->Desc() == u8"A sharp sword.");
+  REQUIRE(!copy->IsSameAs(*orig));
+
+  // They copy what they hold, as well as what they contain.
+  auto hilt = new Object(orig);
+  hilt->SetShortDesc(u8"a hilt");
+  orig->AddAct(act_t::HOLD, hilt);
+  auto copy2 = new Object(*orig);
+  REQUIRE(copy2->Contents().size() == 1);
+  REQUIRE(copy2->ActTarg(act_t::HOLD) == copy2->Contents().front());
+  REQUIRE(copy2->ActTarg(act_t::HOLD) != hilt);
+
+  // They outlive the original, and so do copies of them made by assignment.
+  auto assigned = new Object();
+  *assigned = *orig;
+  delete orig;
+  REQUIRE(copy2->ShortDesc() == u8"a sword");
+  REQUIRE(assigned->ShortDesc().data() == copy2->ShortDesc().data());
+  *assigned = *copy;
+  REQUIRE(assigned->ShortDesc() == u8"a dull sword");
+  REQUIRE(copy2->Desc() == u8"A sharp sword.");
+
+  delete assigned;
+  delete copy;
+  delete copy2;
+  destroy_universe();
+}
+
 TEST_CASE("Object Money", "[money]") {
   init_universe();
   REQUIRE(Object::Universe() != nullptr);
@@ -682,3 +823,1371 @@ TEST_CASE("Object Quantity", "[object]") {
 
   destroy_universe();
 }
+
+TEST_CASE("Object Contained Totals", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  // Note: Each must have a different ShortDesc to avoid being auto-combined.
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+  auto bag = new Object(room);
+  bag->SetShortDesc(u8"bag");
+  bag->SetSkill(prhash(u8"Capacity"), 100);
+  bag->SetSkill(prhash(u8"Container"), 1000);
+  auto item1 = new Object(room);
+  item1->SetShortDesc(u8"item1");
+  item1->SetWeight(300);
+  item1->SetVolume(30);
+  auto item2 = new Object(room);
+  item2->SetShortDesc(u8"item2");
+  item2->SetWeight(500);
+  item2->SetVolume(50);
+  auto item3 = new Object(room);
+  item3->SetShortDesc(u8"item3");
+  item3->SetWeight(400);
+  item3->SetVolume(10);
+
+  REQUIRE(room->ContainedWeight() == 1200);
+  REQUIRE(room->ContainedVolume() == 90);
+  REQUIRE(bag->ContainedWeight() == 0);
+  REQUIRE(bag->ContainedVolume() == 0);
+
+  REQUIRE(item1->Travel(bag) == 0);
+  REQUIRE(item2->Travel(bag) == 0);
+  REQUIRE(bag->ContainedWeight() == 800);
+  REQUIRE(bag->ContainedVolume() == 80);
+  REQUIRE(room->ContainedWeight() == 400);
+  REQUIRE(room->ContainedVolume() == 10);
+
+  REQUIRE(item3->Travel(bag) == -3); // Too heavy for what's left
+  item3->SetWeight(200);
+  REQUIRE(room->ContainedWeight() == 200);
+  REQUIRE(item3->Travel(bag) == 0);
+  REQUIRE(bag->ContainedWeight() == 1000);
+  REQUIRE(bag->ContainedVolume() == 90);
+
+  item2->SetVolume(40);
+  REQUIRE(bag->ContainedVolume() == 80);
+
+  auto item4 = item1->Split(1);
+  REQUIRE(item4->Parent() == bag);
+  REQUIRE(bag->ContainedWeight() == 1300);
+  REQUIRE(bag->ContainedVolume() == 110);
+
+  item4->Recycle();
+  REQUIRE(bag->ContainedWeight() == 1000);
+  REQUIRE(bag->ContainedVolume() == 80);
+
+  auto bag2 = new Object(*bag);
+  bag2->SetShortDesc(u8"bag2");
+  bag2->SetParent(room);
+  REQUIRE(bag2->ContainedWeight() == 1000);
+  REQUIRE(bag2->ContainedVolume() == 80);
+  REQUIRE(room->ContainedWeight() == bag->Weight() + bag2->Weight());
+
+  bag->Recycle();
+  REQUIRE(bag->ContainedWeight() == 0);
+  REQUIRE(bag->ContainedVolume() == 0);
+
+  REQUIRE(room->ContainedTotalsValid());
+  REQUIRE(bag2->ContainedTotalsValid());
+  REQUIRE(Object::TrashBin()->ContainedTotalsValid());
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Trash Reclamation", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+  REQUIRE(Object::TrashPending() == 0);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+  auto keeper = new Object(Object::TrashBin()); // Lives there, never recycled (like coins)
+  keeper->SetShortDesc(u8"keeper");
+  auto item1 = new Object(room);
+  item1->SetShortDesc(u8"item1");
+  item1->SetWeight(100);
+  auto item2 = new Object(room);
+  item2->SetShortDesc(u8"item2");
+  item2->SetWeight(200);
+  auto bag = new Object(room);
+  bag->SetShortDesc(u8"bag");
+  auto item3 = new Object(bag);
+  item3->SetShortDesc(u8"item3");
+
+  item1->Recycle();
+  bag->Recycle();
+  REQUIRE(item1->Parent() == Object::TrashBin());
+  REQUIRE(bag->Parent() == Object::TrashBin());
+  REQUIRE(item3->Parent() == Object::TrashBin());
+  REQUIRE(Object::TrashPending() == 3);
+
+  // Nothing is freed until it has spent a full tick in the trash.
+  REQUIRE(Object::ReclaimTrash() == 0);
+  tick_universe();
+  REQUIRE(Object::ReclaimTrash() == 0);
+  item2->Recycle();
+  REQUIRE(Object::TrashPending() == 4);
+  tick_universe();
+  REQUIRE(Object::ReclaimTrash(2) == 2);
+  REQUIRE(Object::TrashPending() == 2);
+  REQUIRE(Object::ReclaimTrash() == 1);
+  REQUIRE(Object::TrashPending() == 1);
+  tick_universe();
+  REQUIRE(Object::ReclaimTrash() == 1);
+  REQUIRE(Object::TrashPending() == 0);
+
+  REQUIRE(Object::TrashBin()->Contents(LOC_NINJA).size() == 1);
+  REQUIRE(Object::TrashBin()->Contents(LOC_NINJA).front() == keeper);
+  REQUIRE(Object::TrashBin()->ContainedTotalsValid());
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Minds", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto room = new Object(Object::Universe());
+  room->SetShortDesc(u8"room");
+  auto mob1 = new Object(room);
+  mob1->SetShortDesc(u8"mob1");
+  auto mob2 = new Object(room);
+  mob2->SetShortDesc(u8"mob2");
+  auto pc = new Object(room);
+  pc->SetShortDesc(u8"pc");
+
+  auto shared = get_mob_mind();
+  REQUIRE(shared->Shared());
+  mob1->Attach(shared);
+  mob2->Attach(shared);
+  REQUIRE(mob1->HasMind());
+  REQUIRE(mob2->HasMind());
+
+  // A shared mind is lent to each body as it asks, then handed back.
+  REQUIRE(mob1->Tactics() == u8"attack");
+  REQUIRE(mob2->Tactics() == u8"attack");
+  REQUIRE(shared->Body() == mob2);
+
+  auto mind = std::make_shared<Mind>(mind_t::TEST);
+  REQUIRE(!mind->Shared());
+  pc->Attach(mind);
+  pc->Attach(mind);
+  REQUIRE(mind->Body() == pc);
+  REQUIRE(!pc->HasMultipleMinds());
+  REQUIRE(mind.use_count() == 2);
+
+  pc->Send(ALL, -1, u8"Hello.");
+  REQUIRE(pc->LongDesc() == u8"[Hello.]");
+  REQUIRE(mind->Body() == pc);
+
+  pc->Detach(mind);
+  REQUIRE(!pc->HasMind());
+  REQUIRE(mind->Body() == nullptr);
+  REQUIRE(mind.use_count() == 1);
+
+  mob1->Detach(shared);
+  REQUIRE(!mob1->HasMind());
+  REQUIRE(mob2->HasMind());
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Keyword Index", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto room = new Object(Object::Universe());
+  room->SetShortDesc(u8"room");
+  auto room2 = new Object(Object::Universe());
+  room2->SetShortDesc(u8"room2");
+  auto actor = new Object(room);
+  actor->SetShortDesc(u8"an actor");
+
+  // Enough clutter that the room gets indexed.
+  for (int ctr = 0; ctr < 40; ++ctr) {
+    auto rock = new Object(room);
+    rock->SetShortDesc(u8"a small rock");
+  }
+  auto red = new Object(room);
+  red->SetShortDesc(u8"a red potion");
+  auto bag = new Object(room);
+  bag->SetShortDesc(u8"a leather bag");
+  bag->SetSkill(prhash(u8"Open"), 1000);
+  auto gem = new Object(bag);
+  gem->SetShortDesc(u8"a Red gem");
+  auto blue = new Object(room);
+  blue->SetShortDesc(u8"a blue potion");
+  auto sword = new Object(room);
+  sword->SetShortDesc(u8"a long sword");
+
+  REQUIRE(actor->PickObject(u8"potion", LOC_NEARBY) == red);
+  REQUIRE(actor->PickObject(u8"2.potion", LOC_NEARBY) == blue);
+  REQUIRE(actor->PickObject(u8"3.potion", LOC_NEARBY) == nullptr);
+  REQUIRE(actor->PickObject(u8"red", LOC_NEARBY) == red);
+  REQUIRE(actor->PickObject(u8"2.red", LOC_NEARBY) == gem);
+  REQUIRE(actor->PickObject(u8"red gem", LOC_NEARBY) == gem);
+  REQUIRE(actor->PickObject(u8"red potion", LOC_NEARBY) == red);
+  REQUIRE(actor->PickObject(u8"potion red", LOC_NEARBY) == nullptr);
+  REQUIRE(actor->PickObject(u8"pot", LOC_NEARBY) == nullptr);
+  REQUIRE(actor->PickObjects(u8"all.red", LOC_NEARBY).size() == 2);
+  REQUIRE(actor->PickObjects(u8"all.rock", LOC_NEARBY).size() == 40);
+  REQUIRE(actor->PickObject(u8"sword", LOC_NEARBY) == sword);
+  REQUIRE(actor->PickObject(u8"long sword", LOC_NEARBY) == sword);
+  REQUIRE(actor->PickObjects(u8"everything", LOC_NEARBY).size() == 45);
+
+  // Renamed, moved, and new things are all found (or not) as expected.
+  blue->SetShortDesc(u8"a green potion");
+  REQUIRE(actor->PickObject(u8"blue", LOC_NEARBY) == nullptr);
+  REQUIRE(actor->PickObject(u8"green", LOC_NEARBY) == blue);
+  red->Travel(room2);
+  REQUIRE(actor->PickObject(u8"potion", LOC_NEARBY) == blue);
+  REQUIRE(actor->PickObject(u8"red", LOC_NEARBY) == gem);
+  red->Travel(room);
+  REQUIRE(actor->PickObject(u8"2.potion", LOC_NEARBY) == red);
+  auto orange = new Object(room);
+  orange->SetShortDesc(u8"an orange potion");
+  REQUIRE(actor->PickObject(u8"3.potion", LOC_NEARBY) == orange);
+  blue->Recycle();
+  REQUIRE(actor->PickObject(u8"green", LOC_NEARBY) == nullptr);
+  REQUIRE(actor->PickObject(u8"2.potion", LOC_NEARBY) == orange);
+
+  // The room's own index serves searches from within, too.
+  REQUIRE(room->PickObject(u8"2.potion", LOC_INTERNAL) == orange);
+  REQUIRE(room->PickObject(u8"actor", LOC_INTERNAL) == actor);
+
+  // Things only linked in are found too, even after being renamed.
+  auto guest = new Object(room2);
+  guest->SetShortDesc(u8"a visiting guest");
+  room->AddLink(guest);
+  REQUIRE(room->PickObject(u8"guest", LOC_INTERNAL) == guest);
+  guest->SetShortDesc(u8"a visiting stranger");
+  REQUIRE(room->PickObject(u8"guest", LOC_INTERNAL) == nullptr);
+  REQUIRE(room->PickObject(u8"stranger", LOC_INTERNAL) == guest);
+  room->RemoveLink(guest);
+  REQUIRE(room->PickObject(u8"stranger", LOC_INTERNAL) == nullptr);
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Matches", "[object]") {
+  REQUIRE(matches(u8"a long sword", u8"long sword"));
+  REQUIRE(matches(u8"A Long Sword", u8"long sword"));
+  REQUIRE(!matches(u8"a long sword", u8"lon"));
+  REQUIRE(!matches(u8"a long sword", u8"sword long"));
+  REQUIRE(matches(u8"a long sword", u8"all"));
+  REQUIRE(!matches(u8"a long sword", u8""));
+
+  // Suffix-words
+  REQUIRE(matches(u8"a longsword", u8"sword"));
+  REQUIRE(matches(u8"a LongSword", u8"Sword"));
+  REQUIRE(matches(u8"the blacksmith is here", u8"smith"));
+  REQUIRE(!matches(u8"a longsword, sharp", u8"sword"));
+  REQUIRE(!matches(u8"a swordfish", u8"sword"));
+  REQUIRE(!matches(u8"a longbread", u8"bread"));
+
+  // Aliases
+  REQUIRE(matches(u8"the city guardsman", u8"guard"));
+  REQUIRE(matches(u8"a mercenary", u8"merc"));
+  REQUIRE(matches(u8"a battlehammer", u8"battle hammer"));
+  REQUIRE(matches(u8"a battle hammer", u8"battlehammer"));
+  REQUIRE(matches(u8"a gray cloak", u8"grey"));
+  REQUIRE(matches(u8"a bill-guisarme", u8"bill-bisarme"));
+  REQUIRE(matches(u8"a baked potato", u8"potatoe"));
+  REQUIRE(!matches(u8"a baked potatoe", u8"potato"));
+  REQUIRE(!matches(u8"a mercenary", u8"mercen"));
+
+  init_universe();
+  auto room = new Object(Object::Universe());
+  room->SetShortDesc(u8"room");
+  auto actor = new Object(room);
+  actor->SetShortDesc(u8"an actor");
+  for (int ctr = 0; ctr < 40; ++ctr) {
+    auto rock = new Object(room);
+    rock->SetShortDesc(u8"a small rock");
+  }
+  auto smith = new Object(room);
+  smith->SetShortDesc(u8"a blacksmith");
+  auto hammer = new Object(room);
+  hammer->SetShortDesc(u8"a battlehammer");
+  auto guard = new Object(room);
+  guard->SetShortDesc(u8"a guardsman");
+
+  // The same, through a keyword index
+  REQUIRE(actor->PickObject(u8"smith", LOC_NEARBY) == smith);
+  REQUIRE(actor->PickObject(u8"hammer", LOC_NEARBY) == hammer);
+  REQUIRE(actor->PickObject(u8"battle hammer", LOC_NEARBY) == hammer);
+  REQUIRE(actor->PickObject(u8"guard", LOC_NEARBY) == guard);
+  REQUIRE(actor->PickObject(u8"black", LOC_NEARBY) == nullptr);
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Trigger Index", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room1 = new Object(zone);
+  room1->SetShortDesc(u8"room1");
+  auto room2 = new Object(zone);
+  room2->SetShortDesc(u8"room2");
+  auto mob = new Object(room1);
+  mob->SetShortDesc(u8"a mob");
+  auto trig = new Object(mob);
+  trig->SetShortDesc(u8"A tbaMUD trigger script");
+  trig->SetSkill(prhash(u8"TBAScriptType"), 0x1000004); // MOB-COMMAND
+  auto bag = new Object(room2);
+  bag->SetShortDesc(u8"a bag");
+
+  REQUIRE(room1->TriggerTypesWithin() == 0x1000004);
+  REQUIRE(room2->TriggerTypesWithin() == 0);
+  REQUIRE(zone->TriggerTypesWithin() == ~0U);
+  REQUIRE(mob->TriggerTypesWithin() == ~0U);
+
+  SECTION("Move Carrier") {
+    mob->Travel(room2);
+    REQUIRE(room1->TriggerTypesWithin() == 0);
+    REQUIRE(room2->TriggerTypesWithin() == 0x1000004);
+    mob->Travel(bag);
+    REQUIRE(room2->TriggerTypesWithin() == 0x1000004);
+    mob->Recycle();
+    REQUIRE(room2->TriggerTypesWithin() == 0);
+  }
+
+  SECTION("Change Type") {
+    trig->SetSkill(prhash(u8"TBAScriptType"), 0x1000008); // MOB-SPEECH
+    REQUIRE(room1->TriggerTypesWithin() == 0x1000008);
+    trig->ClearSkill(prhash(u8"TBAScriptType"));
+    REQUIRE(room1->TriggerTypesWithin() == 0);
+  }
+
+  SECTION("New Trigger") {
+    auto trig2 = new Object(bag);
+    trig2->SetSkill(prhash(u8"TBAScriptType"), 0x2000004); // OBJ-COMMAND
+    REQUIRE(room2->TriggerTypesWithin() == 0x2000004);
+    auto copy = new Object(*mob);
+    REQUIRE(room2->TriggerTypesWithin() == 0x2000004);
+    copy->SetParent(room2);
+    REQUIRE(room2->TriggerTypesWithin() == 0x3000004);
+  }
+
+  SECTION("Open Room") {
+    room1->SetSkill(prhash(u8"Open"), 1000);
+    REQUIRE(room1->TriggerTypesWithin() == ~0U);
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Speech Triggers", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+  auto mob = new Object(room);
+  mob->SetShortDesc(u8"a mob");
+  mob->SetPosition(pos_t::STAND);
+  auto speaker = new Object(room);
+  speaker->SetShortDesc(u8"a speaker");
+  speaker->SetPosition(pos_t::STAND);
+
+  auto make_trigger = [](Object* owner, int type, int narg, std::u8string_view words) {
+    auto trig = new Object(owner);
+    trig->SetShortDesc(u8"A tbaMUD trigger script");
+    trig->SetDesc(words);
+    trig->SetSkill(prhash(u8"TBAScriptType"), type);
+    trig->SetSkill(prhash(u8"TBAScriptNArg"), narg);
+    return trig;
+  };
+  auto phrase = make_trigger(mob, 0x1000008, 0, u8"hello there"); // MOB-SPEECH
+  auto words = make_trigger(mob, 0x1000008, 1, u8"gold, silver"); // MOB-SPEECH
+  auto acts = make_trigger(mob, 0x1000010, 0, u8"*"); // MOB-ACT
+  auto room_words = make_trigger(room, 0x4000008, 1, u8"silver"); // ROOM-SPEECH
+
+  REQUIRE(room->TriggerTypesWithin() == 0x5000018);
+
+  auto say = [&](std::u8string_view speech) {
+    auto mes = fmt::format(u8";s says '{}'\n", speech);
+    room->SendOut(0, 0, mes, u8"", speaker, nullptr);
+    mob->SendOut(0, 0, mes, u8"", speaker, nullptr);
+  };
+
+  SECTION("Phrase") {
+    say(u8"Hello there, friend.");
+    REQUIRE(phrase->HasMind());
+    REQUIRE(!words->HasMind());
+    REQUIRE(!acts->HasMind());
+    REQUIRE(!room_words->HasMind());
+  }
+
+  SECTION("Words") {
+    say(u8"I'd take SILVER");
+    REQUIRE(!phrase->HasMind());
+    REQUIRE(words->HasMind());
+    REQUIRE(!acts->HasMind());
+    REQUIRE(room_words->HasMind());
+  }
+
+  SECTION("Within Words") {
+    say(u8"othello thereafter, silvery golden");
+    REQUIRE(!phrase->HasMind());
+    REQUIRE(!words->HasMind());
+    REQUIRE(!room_words->HasMind());
+  }
+
+  SECTION("Action") {
+    mob->SendOut(0, 0, u8";s smiles.\n", u8"", speaker, nullptr);
+    REQUIRE(!phrase->HasMind());
+    REQUIRE(acts->HasMind());
+  }
+
+  SECTION("Zone Resetter") {
+    auto resetter = new Object(room);
+    resetter->SetShortDesc(u8"a TBAMUD Zone Resetter");
+    resetter->SetSkill(prhash(u8"TBAZoneLifespan"), 15);
+    auto step = new Object(resetter);
+    step->SetShortDesc(u8"a mob template");
+    auto template_phrase = make_trigger(step, 0x1000008, 0, u8"hello there"); // MOB-SPEECH
+    make_trigger(step, 0x1000004, 0, u8"dance"); // MOB-COMMAND
+    REQUIRE(room->TriggerTypesWithin() == 0x5000018); // Neither is indexed
+    say(u8"Hello there, friend.");
+    REQUIRE(phrase->HasMind());
+    REQUIRE(!template_phrase->HasMind());
+  }
+
+  SECTION("Changed Words") {
+    phrase->SetDesc(u8"goodbye");
+    say(u8"hello there");
+    REQUIRE(!phrase->HasMind());
+    say(u8"Goodbye!");
+    REQUIRE(phrase->HasMind());
+  }
+
+  SECTION("Same As Unindexed") {
+    const std::u8string_view tests[] = {
+        u8"hello there",
+        u8"hello  there",
+        u8"hello therein",
+        u8"oh, hello there",
+        u8"gold",
+        u8"golden silver",
+        u8"",
+        u8"silver's",
+        u8"x-silver",
+        u8"4silver"};
+    for (auto speech : tests) {
+      auto listener = new Object(room);
+      listener->SetShortDesc(u8"a listener");
+      listener->SetPosition(pos_t::STAND);
+      auto lphrase = make_trigger(listener, 0x1000008, 0, phrase->Desc());
+      auto lwords = make_trigger(listener, 0x1000008, 1, words->Desc());
+      listener->SendOut(0, 0, fmt::format(u8";s says '{}'\n", speech), u8"", speaker, nullptr);
+      REQUIRE(lphrase->HasMind() == phrase_match(speech, lphrase->Desc()));
+      REQUIRE(lwords->HasMind() == words_match(speech, lwords->Desc()));
+    }
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object SendOut", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+
+  // Note: Each must have a different ShortDesc to avoid being auto-combined.
+  auto person = [room](std::u8string_view desc) {
+    auto ret = new Object(room);
+    ret->SetShortDesc(desc);
+    for (int attr = 0; attr < 6; ++attr) {
+      ret->SetAttribute(attr, 3);
+    }
+    ret->SetPosition(pos_t::STAND);
+    ret->Attach(std::make_shared<Mind>(mind_t::TEST));
+    return ret;
+  };
+  auto jane = person(u8"a woman");
+  jane->SetName(u8"Jane Doe");
+  jane->SetSkill(prhash(u8"Object ID"), 7);
+  auto bob = person(u8"a man");
+  auto carol = person(u8"a stranger");
+  carol->Learn(7, u8"Jane Doe");
+  auto dan = person(u8"a passerby");
+  auto sword = new Object(bob);
+  sword->SetShortDesc(u8"a sword");
+  auto statue = new Object(room);
+  statue->SetShortDesc(u8"a statue");
+  statue->SetPosition(pos_t::STAND);
+
+  SECTION("Nouns") {
+    room->SendOut(ALL, -1, u8";s points at ;s.\n", u8"You point at ;s.\n", jane, sword);
+    REQUIRE(witness(jane) == u8"You point at a man's sword.\n");
+    REQUIRE(witness(bob) == u8"A woman points at your sword.\n");
+    REQUIRE(witness(carol) == u8"Jane Doe, a woman, points at a man's sword.\n");
+    REQUIRE(witness(dan) == u8"A woman points at a man's sword.\n");
+  }
+
+  SECTION("Braces") {
+    room->SendOut(ALL, -1, u8"{;s} waves.\n", u8"", jane, nullptr);
+    REQUIRE(witness(jane) == u8"");
+    REQUIRE(witness(carol) == u8";Jane Doe, a woman,; waves.\n");
+    REQUIRE(witness(dan) == u8";a woman; waves.\n");
+    room->SendOut(ALL, -1, u8";s waves ;", u8"", jane, nullptr); // Mismatched, never sent
+    REQUIRE(witness(dan) == u8";a woman; waves.\n");
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Noun Cache", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto room = new Object(Object::Universe());
+  room->SetShortDesc(u8"room");
+  auto person = [room](std::u8string_view desc) {
+    auto ret = new Object(room);
+    ret->SetShortDesc(desc);
+    for (int attr = 0; attr < 6; ++attr) {
+      ret->SetAttribute(attr, 3);
+    }
+    return ret;
+  };
+  auto jane = person(u8"a woman");
+  jane->SetName(u8"Jane Doe");
+  jane->SetSkill(prhash(u8"Object ID"), 7);
+  auto bob = person(u8"a man");
+  auto carol = person(u8"an elf");
+  auto ring = new Object(jane);
+  ring->SetShortDesc(u8"an iron ring");
+
+  REQUIRE(ring->Noun(0, 0, bob) == u8"a woman's iron ring");
+  REQUIRE(ring->Noun(0, 0, bob) == u8"a woman's iron ring");
+  REQUIRE(ring->Noun(1, 0, bob) == u8"the woman's iron ring");
+  REQUIRE(ring->Noun(0, 0, jane) == u8"your iron ring");
+  REQUIRE(ring->Noun(0, 0, nullptr) == u8"Jane Doe's iron ring");
+  REQUIRE(jane->Noun(0, 1, bob) == u8"a woman");
+  REQUIRE(carol->Noun(1, 0, bob) == u8"the elf");
+
+  SECTION("Learn") {
+    bob->Learn(7, u8"Jane Doe");
+    REQUIRE(ring->Noun(0, 0, bob) == u8"Jane Doe's iron ring");
+    REQUIRE(ring->Noun(0, 0, carol) == u8"a woman's iron ring");
+    REQUIRE(jane->Noun(0, 1, bob) == u8"Jane Doe, a woman,");
+  }
+
+  SECTION("Rename") {
+    ring->SetShortDesc(u8"a gold ring");
+    REQUIRE(ring->Noun(0, 0, bob) == u8"a woman's gold ring");
+    jane->SetShortDesc(u8"a tall woman");
+    REQUIRE(ring->Noun(0, 0, bob) == u8"a tall woman's gold ring");
+  }
+
+  SECTION("New Owner") {
+    ring->Travel(bob);
+    REQUIRE(ring->Noun(0, 0, carol) == u8"a man's iron ring");
+    REQUIRE(ring->Noun(0, 0, bob) == u8"your iron ring");
+    ring->Travel(room);
+    REQUIRE(ring->Noun(0, 0, carol) == u8"an iron ring");
+    REQUIRE(ring->Noun(1, 0, carol) == u8"the iron ring");
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Loud", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+
+  // A row of rooms, west to east, each with someone listening in it.
+  std::vector<Object*> rooms;
+  std::vector<Object*> listeners;
+  for (int rnum = 0; rnum < 5; ++rnum) {
+    rooms.push_back(new Object(zone));
+    rooms.back()->SetShortDesc(fmt::format(u8"room{}", rnum));
+    listeners.push_back(new Object(rooms.back()));
+    listeners.back()->SetShortDesc(fmt::format(u8"listener{}", rnum));
+    listeners.back()->SetPosition(pos_t::STAND);
+    listeners.back()->Attach(std::make_shared<Mind>(mind_t::TEST));
+    if (rnum > 0) {
+      rooms[rnum - 1]->Link(rooms[rnum], u8"east", u8"", u8"west", u8"");
+    }
+  }
+
+  SECTION("Open Doors") {
+    rooms[0]->Loud(3, u8"a bang.");
+    REQUIRE(witness(listeners[0]) == u8"");
+    REQUIRE(witness(listeners[1]) == u8"From west you hear a bang.\n");
+    REQUIRE(witness(listeners[2]) == u8"From west you hear a bang.\n");
+    REQUIRE(witness(listeners[3]) == u8"");
+  }
+
+  SECTION("Closed Door") {
+    rooms[1]->PickObject(u8"west", LOC_INTERNAL)->ClearSkill(prhash(u8"Open"));
+    rooms[0]->Loud(3, u8"a bang.");
+    REQUIRE(witness(listeners[1]) == u8"From west you hear a bang.\n");
+    REQUIRE(witness(listeners[2]) == u8"");
+  }
+
+  SECTION("New Link") {
+    rooms[0]->Loud(2, u8"a bang.");
+    REQUIRE(witness(listeners[4]) == u8"");
+    rooms[4]->Link(rooms[0], u8"north", u8"", u8"south", u8"");
+    rooms[0]->Loud(2, u8"a crash.");
+    REQUIRE(witness(listeners[4]) == u8"From north you hear a crash.\n");
+    REQUIRE(witness(listeners[1]) == u8"From west you hear a bang.\nFrom west you hear a crash.\n");
+  }
+
+  SECTION("Loudest Way") {
+    // Closed doors the first way, but an open shortcut from room0 straight to room2.
+    rooms[1]->PickObject(u8"west", LOC_INTERNAL)->ClearSkill(prhash(u8"Open"));
+    rooms[2]->PickObject(u8"west", LOC_INTERNAL)->ClearSkill(prhash(u8"Open"));
+    rooms[0]->Link(rooms[2], u8"up", u8"", u8"down", u8"");
+    rooms[0]->Loud(5, u8"a bang.");
+    REQUIRE(witness(listeners[1]) == u8"From west you hear a bang.\n");
+    REQUIRE(witness(listeners[2]) == u8"From down you hear a bang.\n");
+    REQUIRE(witness(listeners[3]) == u8"From west you hear a bang.\n");
+    REQUIRE(witness(listeners[4]) == u8"From west you hear a bang.\n");
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Directions", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+
+  // A row of rooms, west to east.
+  std::vector<Object*> rooms;
+  for (int rnum = 0; rnum < 5; ++rnum) {
+    rooms.push_back(new Object(zone));
+    rooms.back()->SetShortDesc(fmt::format(u8"room{}", rnum));
+    if (rnum > 0) {
+      rooms[rnum - 1]->Link(rooms[rnum], u8"east", u8"", u8"west", u8"");
+    }
+  }
+
+  SECTION("Cached") {
+    REQUIRE(rooms[0]->DirectionsTo(rooms[4], nullptr) == u8"eeee");
+    REQUIRE(rooms[0]->DirectionsTo(rooms[4], nullptr) == u8"eeee");
+    REQUIRE(rooms[4]->DirectionsTo(rooms[1], nullptr) == u8"www");
+    REQUIRE(rooms[2]->DirectionsTo(rooms[2], nullptr) == u8"");
+  }
+
+  SECTION("New Link") {
+    REQUIRE(rooms[0]->DirectionsTo(rooms[4], nullptr) == u8"eeee");
+    rooms[0]->Link(rooms[4], u8"up", u8"", u8"down", u8"");
+    REQUIRE(rooms[0]->DirectionsTo(rooms[4], nullptr) == u8"u");
+    REQUIRE(rooms[4]->DirectionsTo(rooms[1], nullptr) == u8"de");
+  }
+
+  SECTION("Locked Door") {
+    auto door = rooms[1]->PickObject(u8"east", LOC_INTERNAL);
+    REQUIRE(door != nullptr);
+    door->ClearSkill(prhash(u8"Open"));
+    door->SetSkill(prhash(u8"Closeable"), 1);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], nullptr) == u8"eee");
+
+    door->SetSkill(prhash(u8"Lock"), 7);
+    door->SetSkill(prhash(u8"Locked"), 1);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], nullptr) == u8"");
+    REQUIRE(rooms[3]->DirectionsTo(rooms[0], nullptr) == u8"www");
+
+    auto keyholder = new Object(rooms[0]);
+    keyholder->SetShortDesc(u8"a keyholder");
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"");
+    auto key = new Object(keyholder);
+    key->SetShortDesc(u8"a key");
+    key->SetSkill(prhash(u8"Key"), 7);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"eee");
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], nullptr) == u8"");
+
+    // The keyholder's keys are remembered only until they change.
+    key->SetSkill(prhash(u8"Key"), 8);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"");
+    auto pouch = new Object(keyholder);
+    pouch->SetShortDesc(u8"a pouch");
+    pouch->SetSkill(prhash(u8"Container"), 1000);
+    key->SetSkill(prhash(u8"Key"), 7);
+    key->Travel(pouch);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"eee");
+    key->Travel(rooms[0]);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"");
+    key->Travel(pouch);
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], keyholder) == u8"eee");
+
+    door->ClearSkill(prhash(u8"Locked"));
+    REQUIRE(rooms[0]->DirectionsTo(rooms[3], nullptr) == u8"eee");
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object Light Level", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+  auto lamp = new Object(room);
+  lamp->SetShortDesc(u8"a lamp");
+  lamp->SetSkill(prhash(u8"Light Source"), 100);
+  REQUIRE(room->LightLevel() == 100);
+  REQUIRE(room->LightLevel() == 100);
+
+  SECTION("Dimmed") {
+    lamp->SetSkill(prhash(u8"Light Source"), 40);
+    REQUIRE(room->LightLevel() == 40);
+    lamp->ClearSkill(prhash(u8"Light Source"));
+    REQUIRE(room->LightLevel() == 0);
+  }
+
+  SECTION("Boxed") {
+    auto box = new Object(room);
+    box->SetShortDesc(u8"a box");
+    lamp->Travel(box);
+    REQUIRE(room->LightLevel() == 0);
+    box->SetSkill(prhash(u8"Open"), 1000);
+    REQUIRE(room->LightLevel() == 100);
+    lamp->SetSkill(prhash(u8"Light Source"), 60);
+    REQUIRE(room->LightLevel() == 60);
+    box->ClearSkill(prhash(u8"Open"));
+    REQUIRE(room->LightLevel() == 0);
+    REQUIRE(box->LightLevel() == 60);
+  }
+
+  SECTION("Carried") {
+    auto person = new Object(room);
+    person->SetShortDesc(u8"a person");
+    lamp->Travel(person);
+    REQUIRE(room->LightLevel() == 0);
+    person->AddAct(act_t::HOLD, lamp);
+    REQUIRE(room->LightLevel() == 100);
+    person->StopAct(act_t::HOLD);
+    REQUIRE(room->LightLevel() == 0);
+  }
+
+  SECTION("Daylight") {
+    zone->SetSkill(prhash(u8"Light Source"), 1000);
+    room->SetSkill(prhash(u8"Translucent"), 500);
+    REQUIRE(room->LightLevel() == 600);
+    REQUIRE(lamp->LightLevel() == 100);
+  }
+
+  SECTION("Invisible") {
+    auto ghost = new Object(room);
+    ghost->SetShortDesc(u8"a ghost");
+    REQUIRE(room->Contents(0).size() == 2);
+    ghost->SetSkill(prhash(u8"Invisible"), 10);
+    REQUIRE(room->Contents(0).size() == 1);
+    REQUIRE(room->Contents(LOC_HEAT).size() == 2);
+    ghost->ClearSkill(prhash(u8"Invisible"));
+    REQUIRE(room->Contents(0).size() == 2);
+    ghost->Recycle();
+    REQUIRE(room->Contents(0).size() == 1);
+  }
+
+  destroy_universe();
+}
+
+TEST_CASE("Object TBA Scripts", "[object]") {
+  init_universe();
+  REQUIRE(Object::Universe() != nullptr);
+
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"world");
+  auto zone = new Object(world);
+  zone->SetShortDesc(u8"zone");
+  auto room = new Object(zone);
+  room->SetShortDesc(u8"room");
+  room->SetSkill(prhash(u8"TBARoom"), 1000001);
+
+  // Each script notes where it went as digits in %out%, which it leaves on the room at the end.
+  auto run = [room](std::u8string_view script) {
+    auto trig = new Object(room);
+    trig->SetShortDesc(u8"A tbaMUD trigger script");
+    trig->SetSkill(prhash(u8"TBAScript"), 1000001);
+    trig->SetSkill(prhash(u8"TBAScriptType"), 0x4000000); // ROOM-GLOBAL
+    trig->SetLongDesc(script);
+    new_trigger(0, trig, nullptr);
+    return room->Skill(crc32c(u8"TBA:out"));
+  };
+
+  SECTION("If Chains") {
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"set n 0\n"
+            u8"while %n% < 4\n"
+            u8"  eval n %n% + 1\n"
+            u8"  if %n% == 1\n"
+            u8"    set out %out%1\n"
+            u8"  elseif %n% == 2\n"
+            u8"    set out %out%2\n"
+            u8"  else\n"
+            u8"    if %n% == 3\n"
+            u8"      set out %out%3\n"
+            u8"    end\n"
+            u8"    set out %out%9\n"
+            u8"  end\n"
+            u8"done\n"
+            u8"* set out %out%6\n"
+            u8"set out %out%%n%\n"
+            u8"global out\n") == 7123994);
+  }
+
+  SECTION("Switches") {
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"set n 0\n"
+            u8"while %n% < 4\n"
+            u8"  eval n %n% + 1\n"
+            u8"  switch %n%\n"
+            u8"    case 2\n"
+            u8"      set out %out%2\n"
+            u8"      break\n"
+            u8"    case 3\n"
+            u8"      switch 1\n"
+            u8"        case 1\n"
+            u8"          set out %out%5\n"
+            u8"          break\n"
+            u8"      done\n"
+            u8"      set out %out%3\n"
+            u8"      break\n"
+            u8"    default\n"
+            u8"      set out %out%0\n"
+            u8"      break\n"
+            u8"  done\n"
+            u8"done\n"
+            u8"global out\n") == 702530);
+  }
+
+  SECTION("Quota") {
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"global out\n"
+            u8"while 1\n"
+            u8"  set out %out%1\n"
+            u8"done\n"
+            u8"set out 8\n"
+            u8"global out\n") == 7);
+  }
+
+  SECTION("Variables") {
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"if %asound% == asound\n"
+            u8"  set out %out%1\n"
+            u8"end\n"
+            u8"set asound 2\n"
+            u8"set out %out%%asound%\n"
+            u8"unset asound\n"
+            u8"if %asound% == asound\n"
+            u8"  set out %out%9\n"
+            u8"end\n"
+            u8"set here %self%\n"
+            u8"if %here% == %self%\n"
+            u8"  set out %out%3\n"
+            u8"end\n"
+            u8"set here 4\n"
+            u8"set out %out%%here%\n"
+            u8"global out\n") == 71234);
+  }
+
+  SECTION("Compiled Expressions") {
+    // Each variable is one operand, whatever its value looks like.
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"set w two words\n"
+            u8"if %w% == two words\n"
+            u8"  set out %out%1\n"
+            u8"end\n"
+            u8"if %self% && %self.vnum% == 1\n"
+            u8"  set out %out%2\n"
+            u8"end\n"
+            u8"set m -3\n"
+            u8"eval p 5 * %m%\n"
+            u8"if %p% == -15\n"
+            u8"  set out %out%3\n"
+            u8"end\n"
+            u8"set s a+b\n"
+            u8"if %s% == a+b\n"
+            u8"  set out %out%4\n"
+            u8"end\n"
+            u8"switch %w%\n"
+            u8"  case two\n"
+            u8"    set out %out%9\n"
+            u8"    break\n"
+            u8"  case two words\n"
+            u8"    set out %out%5\n"
+            u8"    break\n"
+            u8"done\n"
+            u8"global out\n") == 712345);
+  }
+
+  SECTION("Percent Values") {
+    // Once a value brings in a '%' of its own, the rest of the line is read as if it was typed.
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"set pct 5%%1\n"
+            u8"set out %out%%pct%%out%\n"
+            u8"global out\n") == 75);
+    REQUIRE(
+        run(u8"set v 4%%zz\n"
+            u8"set out %v%%z%\n"
+            u8"global out\n") == 4);
+  }
+
+  SECTION("Built Names") {
+    REQUIRE(
+        run(u8"set out 7\n"
+            u8"set n 1\n"
+            u8"set v%n% 2\n"
+            u8"set out %out%%v1%\n"
+            u8"eval w%n% %v1% + 1\n"
+            u8"set out %out%%w1%\n"
+            u8"extract x%n% 2 9 4 9\n"
+            u8"set out %out%%x1%\n"
+            u8"unset v%n%\n"
+            u8"set out %out%%v1%5\n"
+            u8"global out\n") == 72345);
+  }
+
+  SECTION("Recycled Minds") {
+    auto trig = new Object(room);
+    trig->SetSkill(prhash(u8"TBAScriptType"), 0x4000000); // ROOM-GLOBAL
+    auto mind = new_mind(mind_t::TBATRIG, trig);
+    Mind* first = mind.get();
+    trig->Detach(mind);
+    recycle_mind(std::move(mind));
+    mind = new_mind(mind_t::TBATRIG, trig);
+    REQUIRE(mind.get() == first);
+    REQUIRE(mind->Body() == trig);
+    trig->Detach(mind);
+
+    // Nothing from one firing may leak into the next one run by the same mind.
+    REQUIRE(run(u8"set out 7\nset leftover 5\nglobal out\n") == 7);
+    REQUIRE(run(u8"set out 7%leftover%1\nglobal out\n") == 71);
+  }
+
+  SECTION("Edited Scripts") {
+    // Triggers running the same script share it, until one of them is given a new one.
+    std::vector<Object*> trigs;
+    for (int copy = 0; copy < 2; ++copy) {
+      trigs.push_back(new Object(room));
+      trigs.back()->SetSkill(prhash(u8"TBAScript"), 1000002);
+      trigs.back()->SetSkill(prhash(u8"TBAScriptType"), 0x4000000); // ROOM-GLOBAL
+      trigs.back()->SetLongDesc(u8"set out 1\nglobal out\n");
+    }
+    auto fire = [room](Object* trig) {
+      new_trigger(0, trig, nullptr);
+      return room->Skill(crc32c(u8"TBA:out"));
+    };
+    REQUIRE(fire(trigs[0]) == 1);
+    REQUIRE(fire(trigs[1]) == 1);
+    trigs[1]->SetLongDesc(u8"set out 2\nglobal out\n");
+    REQUIRE(fire(trigs[1]) == 2);
+    REQUIRE(fire(trigs[0]) == 1);
+    trigs[0]->Recycle();
+    REQUIRE(fire(trigs[1]) == 2);
+  }
+
+  SECTION("Profiling") {
+    Mind::ClearTBAProfile();
+    Mind::SetTBAProfiling(true);
+    run(u8"set out 7\nglobal out\n");
+    run(u8"set out 7\nwhile 1\n  set out %out%1\ndone\n");
+    Mind::SetTBAProfiling(false);
+    run(u8"set out 7\nglobal out\n");
+
+    // Script #1000001: fired twice, ran 2 lines, then 1024 before being cut off by the quota.
+    auto report = Mind::TBAProfileReport(u8"lines");
+    REQUIRE(report.contains(u8"by lines:"));
+    auto row = fmt::format(u8"{:8} {:9} {:9} {:11} {:6} {:9}", 1000001, 2, 2, 1026, 1, 0);
+    REQUIRE(report.contains(row));
+    Mind::ClearTBAProfile();
+  }
+
+  destroy_universe();
+}
+
+// Every if/elseif/while condition and eval value in the TBA trigger corpus, with its variables
+// still in it, as %name%.
+static std::vector<std::u8string> load_tba_exprs() {
+  std::vector<std::u8string> ret;
+  if (!std::filesystem::is_directory("tba/trg")) {
+    return ret;
+  }
+  for (const auto& ent : std::filesystem::directory_iterator("tba/trg")) {
+    std::ifstream file(ent.path());
+    std::string line;
+    while (std::getline(file, line)) {
+      std::u8string_view expr(reinterpret_cast<const char8_t*>(line.data()), line.length());
+      skipspace(expr);
+      if (process(expr, u8"eval ")) {
+        getgraph(expr);
+      } else if (!process(expr, u8"if ") && !process(expr, u8"elseif ") &&
+                 !process(expr, u8"while ")) {
+        continue;
+      }
+      ret.emplace_back(expr);
+    }
+  }
+  return ret;
+}
+
+TEST_CASE("TBA Expressions", "[tba]") {
+  // Each is checked with its %vars% replaced by every one of these, in turn.
+  static const std::vector<std::u8string_view> values = {
+      u8"0",
+      u8"1",
+      u8"-3",
+      u8"42",
+      u8"007",
+      u8"hello",
+      u8"two words",
+      u8"a-b",
+      u8"9x",
+      u8"4294967297",
+      u8"123456789012345678901234567890",
+      u8"",
+      u8"obj:0x55d0c0ffee10",
+      u8"obj:0x0",
+      u8"obj:0x5a",
+  };
+  auto check = [](const std::u8string_view& expr) {
+    INFO(std::string(expr.begin(), expr.end()));
+    REQUIRE(tba_comp(expr) == tba_comp_text(expr));
+    REQUIRE(tba_eval(expr) == tba_eval_text(expr));
+  };
+
+  SECTION("Odd Cases") {
+    check(u8"(1 + 2) * 3");
+    check(u8"2 * (3 + 4) - 1");
+    check(u8"5 * -3");
+    check(u8"-5 - 3 < 0");
+    check(u8"-5 -3");
+    check(u8"x == a-b");
+    check(u8"a-b == a-b");
+    check(u8"!5");
+    check(u8"!(5 > 3)");
+    check(u8"((4");
+    check(u8"7 / 0");
+    check(u8"5 & 3");
+    check(u8"1 || 0 && 0");
+    check(u8"obj:0x5a-b == 1");
+    check(u8"world /= hello world");
+    check(u8"  12  ==  12  \nignored");
+    check(u8"4294967297 + 1");
+    check(u8"-4294967297 < 0");
+    check(u8"123456789012345678901234567890 - 1");
+  }
+
+  SECTION("Trigger Corpus") {
+    auto exprs = load_tba_exprs();
+    if (exprs.empty()) {
+      WARN("No TBA trigger corpus found in tba/trg");
+      return;
+    }
+    for (const auto& expr : exprs) {
+      for (size_t first = 0; first < values.size(); ++first) {
+        std::u8string text;
+        size_t var = first;
+        for (size_t pos = 0; pos < expr.length(); ++pos) {
+          size_t end = expr.find('%', pos + 1);
+          if (expr[pos] == '%' && end != std::u8string::npos) {
+            text += values[var++ % values.size()];
+            pos = end;
+          } else {
+            text += expr[pos];
+          }
+        }
+        check(text);
+      }
+    }
+  }
+
+  SECTION("Compiled Variables") {
+    // Compiled with its %vars% as operands, each is the same as with their values put into the
+    // text, where that doesn't parse them as more than one: with no operators in the values, and
+    // (since hyphens between letters aren't minuses) none next to the variables.  Those with
+    // arguments (which can have variables in them) are left out, with those having spaces, and
+    // those with parentheses after an operator (whose results may be negative).
+    static const std::vector<std::u8string> plain = {
+        u8"0",
+        u8"1",
+        u8"42",
+        u8"007",
+        u8"hello",
+        u8"two words",
+        u8"9x",
+        u8"4294967297",
+        u8"123456789012345678901234567890",
+        u8"obj:0x55d0c0ffee10",
+        u8"obj:0x0",
+        u8"obj:0x5a",
+    };
+    auto exprs = load_tba_exprs();
+    exprs.emplace_back(u8"%a% + %b% * %c%");
+    exprs.emplace_back(u8"(%a% + 1) * %b%");
+    exprs.emplace_back(u8"%a% %b% == %c%");
+    exprs.emplace_back(u8"%a% /= x%b%y || !%c%");
+    for (const auto& expr : exprs) {
+      if (expr.contains(u8"%-") || expr.contains(u8"-%") ||
+          expr.find('(', 1) != std::u8string::npos ||
+          std::count(expr.begin(), expr.end(), '%') % 2 != 0) {
+        continue;
+      }
+      bool spaced = false;
+      for (size_t pos = expr.find('%'); pos != std::u8string::npos;
+           pos = expr.find('%', expr.find('%', pos + 1) + 1)) {
+        auto name = std::u8string_view(expr).substr(pos, expr.find('%', pos + 1) - pos);
+        spaced = spaced || name.find_first_of(u8" \t()") != std::u8string::npos;
+      }
+      if (spaced) {
+        continue;
+      }
+      for (size_t first = 0; first < plain.size(); ++first) {
+        std::u8string text;
+        std::vector<std::u8string> vals;
+        for (size_t pos = 0; pos < expr.length(); ++pos) {
+          if (expr[pos] == '%') {
+            vals.push_back(plain[(first + vals.size()) % plain.size()]);
+            text += vals.back();
+            pos = expr.find('%', pos + 1);
+          } else {
+            text += expr[pos];
+          }
+        }
+        INFO(std::string(expr.begin(), expr.end()));
+        INFO(std::string(text.begin(), text.end()));
+        REQUIRE(tba_comp(expr, vals) == tba_comp_text(text));
+        REQUIRE(tba_eval(expr, vals) == tba_eval_text(text));
+      }
+    }
+  }
+}
+
+static Object* find_tba_room(Object* where, int vnum) {
+  for (auto obj : where->Contents()) {
+    if (obj->Skill(prhash(u8"TBARoom")) == 1000000 + vnum) {
+      return obj;
+    } else if (obj->Skill(prhash(u8"TBARoom")) == 0) {
+      auto room = find_tba_room(obj, vnum);
+      if (room) {
+        return room;
+      }
+    }
+  }
+  return nullptr;
+}
+
+TEST_CASE("TBA World Import", "[tba]") {
+  if (!std::filesystem::exists("tba/wld/index")) {
+    return;
+  }
+  init_universe();
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"The tbaMUD World");
+  world->TBALoadAll(u8""); // Always import, never from (or to) a cache
+
+  auto temple = find_tba_room(world, 3001);
+  REQUIRE(temple != nullptr);
+  REQUIRE(temple->ShortDesc() == u8"The Temple Of Midgaard");
+  REQUIRE(temple->Skill(prhash(u8"Peaceful")) == 1000);
+  REQUIRE(temple->Skill(prhash(u8"TBAZone")) == 999999); // NOMOB
+
+  // Exits are linked to the rooms they lead to.
+  auto north = temple->PickObject(u8"north", LOC_INTERNAL);
+  REQUIRE(north != nullptr);
+  REQUIRE(north->ActTarg(act_t::SPECIAL_LINKED) != nullptr);
+  REQUIRE(north->ActTarg(act_t::SPECIAL_LINKED)->Parent() == find_tba_room(world, 3054));
+
+  // The first zone reset puts mobs, made from their prototypes, into their rooms.
+  Object* baker = nullptr;
+  for (auto mob : find_tba_room(world, 3009)->Contents()) {
+    if (mob->Skill(prhash(u8"TBAMOB")) == 1003001) {
+      baker = mob;
+    }
+  }
+  REQUIRE(baker != nullptr);
+  REQUIRE(baker->ShortDesc().starts_with(u8"the baker"));
+  REQUIRE(baker->IsActive());
+
+  destroy_universe();
+}
+
+static Object* find_tba_resetter(Object* where, int bot) {
+  for (auto obj : where->Contents()) {
+    if (obj->HasSkill(prhash(u8"TBAZoneLifespan"))) {
+      if (obj->Skill(prhash(u8"TBAZoneBottom")) == bot) {
+        return obj;
+      }
+    } else if (obj->Skill(prhash(u8"TBAMOB")) == 0 && obj->Skill(prhash(u8"TBAObject")) == 0) {
+      auto resetter = find_tba_resetter(obj, bot);
+      if (resetter) {
+        return resetter;
+      }
+    }
+  }
+  return nullptr;
+}
+
+TEST_CASE("TBA Zone Reset", "[tba]") {
+  if (!std::filesystem::exists("tba/wld/index")) {
+    return;
+  }
+  init_universe();
+  auto world = new Object(Object::Universe());
+  world->SetShortDesc(u8"The tbaMUD World");
+  world->TBALoadAll(u8""); // Always import, never from (or to) a cache
+
+  auto resetter = find_tba_resetter(world, 3000);
+  REQUIRE(resetter != nullptr);
+  REQUIRE(resetter->IsActive());
+  REQUIRE(resetter->Skill(prhash(u8"TBAZoneLifespan")) == 15);
+  REQUIRE(resetter->Skill(prhash(u8"TBAZoneResetMode")) == 2);
+
+  // Each MOB step is a template, and watches the last MOB it put in its room.
+  auto bakery = find_tba_room(world, 3009);
+  Object* step = nullptr;
+  for (auto obj : resetter->Contents()) {
+    if (obj->Skill(prhash(u8"TBAMOB")) == 1003001) {
+      step = obj;
+    }
+  }
+  REQUIRE(step != nullptr);
+  REQUIRE(!step->IsActive());
+  REQUIRE(step->ActTarg(act_t::SPECIAL_HOME) == bakery);
+  REQUIRE(step->ActTarg(act_t::SPECIAL_MONITOR) != nullptr);
+  REQUIRE(step->ActTarg(act_t::SPECIAL_MONITOR)->Parent() == bakery);
+
+  // Nothing comes back until the zone's lifespan is up.
+  int missing = 0;
+  for (auto obj : resetter->Contents()) {
+    if (obj->HasSkill(prhash(u8"TBAMOB")) && obj->ActTarg(act_t::SPECIAL_MONITOR)) {
+      obj->ActTarg(act_t::SPECIAL_MONITOR)->Recycle();
+      ++missing;
+    }
+  }
+  REQUIRE(missing > 16);
+  REQUIRE(step->ActTarg(act_t::SPECIAL_MONITOR) == nullptr);
+  resetter->UpdateTBAZone();
+  REQUIRE(step->ActTarg(act_t::SPECIAL_MONITOR) == nullptr);
+  REQUIRE(resetter->Skill(prhash(u8"TBAZoneAge")) == 1);
+
+  // Then the reset puts back what is missing, but only a little of it per tick.
+  resetter->SetSkill(prhash(u8"TBAZoneAge"), 15 * 20);
+  resetter->UpdateTBAZone();
+  REQUIRE(resetter->HasSkill(prhash(u8"TBAZoneStep")));
+  REQUIRE(!resetter->HasSkill(prhash(u8"TBAZoneAge")));
+  int back = 0;
+  for (auto obj : resetter->Contents()) {
+    if (obj->HasSkill(prhash(u8"TBAMOB")) && obj->ActTarg(act_t::SPECIAL_MONITOR)) {
+      ++back;
+    }
+  }
+  REQUIRE(back == 16);
+  while (resetter->HasSkill(prhash(u8"TBAZoneStep"))) {
+    resetter->UpdateTBAZone();
+  }
+  for (auto obj : resetter->Contents()) {
+    if (obj->HasSkill(prhash(u8"TBAMOB"))) {
+      REQUIRE(obj->ActTarg(act_t::SPECIAL_MONITOR) != nullptr);
+      REQUIRE(obj->ActTarg(act_t::SPECIAL_MONITOR)->Parent() == obj->ActTarg(act_t::SPECIAL_HOME));
+    }
+  }
+  REQUIRE(step->ActTarg(act_t::SPECIAL_MONITOR)->ShortDesc().starts_with(u8"the baker"));
+
+  destroy_universe();
+}
+
+// A new, empty directory to cache TBA worlds in, so the live one in acid/ is never touched.
+static std::filesystem::path empty_tba_cache_dir() {
+  auto dir = std::filesystem::temp_directory_path() / "acidmud_tba_cache_test";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+static std::string saved_world(Object* world, const std::filesystem::path& fn) {
+  std::filesystem::remove(fn);
+  REQUIRE(world->Save(fn.u8string()) == 0);
+  std::ifstream file(fn);
+  std::string ret((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::filesystem::remove(fn);
+  return ret;
+}
+
+TEST_CASE("TBA World Cache", "[tba]") {
+  if (!std::filesystem::exists("tba/wld/index")) {
+    return;
+  }
+  auto fn = std::filesystem::temp_directory_path() / "acidmud_tba_cache_test.wld";
+  auto dir = empty_tba_cache_dir();
+
+  // The first import builds the world from the sources, and caches it.
+  init_universe();
+  auto cold = new Object(Object::Universe());
+  cold->SetShortDesc(u8"The tbaMUD World");
+  cold->TBALoadAll(dir.u8string());
+  int caches = 0;
+  for (const auto& ent : std::filesystem::directory_iterator(dir)) {
+    if (ent.path().filename().string().starts_with("tba_")) {
+      ++caches;
+    }
+  }
+  REQUIRE(caches == 1);
+  auto cold_world = saved_world(cold, fn);
+  destroy_universe();
+
+  // The next one loads that instead, and ends up with exactly the same world.
+  init_universe();
+  auto warm = new Object(Object::Universe());
+  warm->SetShortDesc(u8"The tbaMUD World");
+  warm->TBALoadAll(dir.u8string());
+  REQUIRE(warm->ActTarg(act_t::SPECIAL_HOME) == find_tba_room(warm, 0));
+  REQUIRE(Object::Universe()->ActTarg(act_t::SPECIAL_HOME) == warm);
+  bool same_world = (saved_world(warm, fn) == cold_world); // Too big to print if not
+  REQUIRE(same_world);
+  destroy_universe();
+  std::filesystem::remove_all(dir);
+}
@@ -87,12 +87,18 @@ size_t prev_line(const std::u8string_view& str, size_t pos) {
   return pos;
 }
 
-static bool phrase_match_sensitive(
-    const std::u8string_view& str,
-    const std::u8string_view& phrase) {
+// The phrase must already be lowercase, str is lowercased as it is compared, so nothing is copied.
+bool phrase_match(const std::u8string_view& str, const std::u8string_view& phrase) {
+  if (phrase.length() == 0)
+    return false;
+
   auto desc = str;
   while (desc.length() >= phrase.length()) {
-    if (desc.starts_with(phrase) &&
+    if (std::equal(
+            phrase.begin(),
+            phrase.end(),
+            desc.begin(),
+            [](char8_t p, char8_t d) { return p == ascii_tolower(d); }) &&
         (desc.length() == phrase.length() || !ascii_isalnum(desc.at(phrase.length())))) {
       return true;
     }
@@ -109,19 +115,6 @@ static bool phrase_match_sensitive(
   return false;
 }
 
-bool phrase_match(const std::u8string_view& str, const std::u8string_view& phrase) {
-  if (phrase.length() == 0)
-    return false;
-
-  if (std::ranges::any_of(str, ascii_isupper)) {
-    std::u8string str2(str);
-    std::ranges::transform(str2, str2.begin(), ascii_tolower);
-    return phrase_match_sensitive(str2, phrase);
-  } else {
-    return phrase_match_sensitive(str, phrase);
-  }
-}
-
 bool words_match(const std::u8string_view& str, const std::u8string_view& words) {
   auto start = std::ranges::find_if(words, ascii_isalpha);
   while (start != words.end()) {
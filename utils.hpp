@@ -122,14 +122,15 @@ inline double getdouble(const std::u8string_view& in_line) {
   return nextdouble(line);
 }
 
+// Numbers too long to fit just wrap around, rather than overflow.
 inline int64_t nextnum(std::u8string_view& line) {
-  int64_t ret = 0;
+  uint64_t ret = 0;
   bool negative = false;
-  if (line.front() == '-') {
+  if (!line.empty() && line.front() == '-') {
     line = line.substr(1);
     negative = true;
   }
-  while (ascii_isdigit(line.front())) {
+  while (!line.empty() && ascii_isdigit(line.front())) {
     ret *= 10;
     ret += (line.front() - '0');
     line = line.substr(1);